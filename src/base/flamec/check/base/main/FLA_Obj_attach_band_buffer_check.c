@@ -0,0 +1,25 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Obj_attach_band_buffer_check( void *buffer, dim_t k, dim_t ldim, FLA_Obj *obj )
+{
+  FLA_Error e_val;
+
+  e_val = FLA_Check_null_pointer( obj );
+  FLA_Check_error_code( e_val );
+
+  if ( ldim < k + 1 )
+    FLA_Check_error_code( FLA_INVALID_BAND_STORAGE );
+
+  return FLA_SUCCESS;
+}
+
@@ -14,7 +14,7 @@ FLA_Error FLA_Axpyrt_check( FLA_Uplo uplo, FLA_Trans trans, FLA_Obj alpha, FLA_O
 {
   FLA_Error e_val;
 
-  e_val = FLA_Check_valid_trans( uplo );
+  e_val = FLA_Check_valid_uplo( uplo );
   FLA_Check_error_code( e_val );
 
   e_val = FLA_Check_valid_trans( trans );
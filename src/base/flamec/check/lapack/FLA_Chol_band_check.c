@@ -0,0 +1,34 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Chol_band_check( FLA_Uplo uplo, dim_t kd, FLA_Obj A )
+{
+  FLA_Error e_val;
+
+  e_val = FLA_Check_valid_uplo( uplo );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_floating_object( A );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_nonconstant_object( A );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_square( A );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_band_storage( A, kd );
+  FLA_Check_error_code( e_val );
+  
+  return FLA_SUCCESS;
+}
+
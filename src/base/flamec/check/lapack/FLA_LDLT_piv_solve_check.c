@@ -0,0 +1,49 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_LDLT_piv_solve_check( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p, FLA_Obj B, FLA_Obj X )
+{
+  FLA_Error e_val;
+
+  e_val = FLA_Check_valid_uplo( uplo );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_real_object( A );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_nonconstant_object( A );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_identical_object_datatype( A, B );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_identical_object_datatype( A, X );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_int_object( p );
+  FLA_Check_error_code( e_val );
+  
+  e_val = FLA_Check_square( A );
+  FLA_Check_error_code( e_val );
+  
+  e_val = FLA_Check_col_vector( p );
+  FLA_Check_error_code( e_val );
+  
+  e_val = FLA_Check_vector_dim( p, FLA_Obj_length( A ) );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_matrix_matrix_dims( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE, A, X, B );
+  FLA_Check_error_code( e_val );
+
+  return FLA_SUCCESS;
+}
+
@@ -0,0 +1,38 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_LU_piv_band_check( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p )
+{
+  FLA_Error e_val;
+
+  e_val = FLA_Check_floating_object( A );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_nonconstant_object( A );
+  FLA_Check_error_code( e_val );
+
+  e_val = FLA_Check_int_object( p );
+  FLA_Check_error_code( e_val );
+  
+  e_val = FLA_Check_col_vector( p );
+  FLA_Check_error_code( e_val );
+  
+  e_val = FLA_Check_vector_dim_min( p, FLA_Obj_min_dim( A ) );
+  FLA_Check_error_code( e_val );
+
+  // The factors fill in kl superdiagonals above the ku-th.
+  e_val = FLA_Check_band_storage( A, kl + ku );
+  FLA_Check_error_code( e_val );
+
+  return FLA_SUCCESS;
+}
+
@@ -26,6 +26,7 @@ typedef struct FLA_Blocksize_s
 #define FLA_OPT_VAR_OFFSET             80
 #define FLA_BLK_VAR_OFFSET            120
 #define FLA_BLF_VAR_OFFSET            160
+#define FLA_REC_VAR_OFFSET            200
 
 #define FLA_UNBLOCKED_VARIANT1        (FLA_UNB_VAR_OFFSET+1)
 #define FLA_UNBLOCKED_VARIANT2        (FLA_UNB_VAR_OFFSET+2)
@@ -81,6 +82,8 @@ typedef struct FLA_Blocksize_s
 #define FLA_BLK_FUS_VARIANT9          (FLA_BLF_VAR_OFFSET+9)
 #define FLA_BLK_FUS_VARIANT10         (FLA_BLF_VAR_OFFSET+10)
 
+#define FLA_RECURSIVE_VARIANT1        (FLA_REC_VAR_OFFSET+1)
+
 #define FLA_Cntl_matrix_type( cntl )  cntl->matrix_type
 #define FLA_Cntl_blocksize( cntl )    cntl->blocksize
 #define FLA_Cntl_variant( cntl )      cntl->variant
@@ -69,6 +69,26 @@ fla_lu_t* FLA_Cntl_lu_obj_create( FLA_Matrix_type  matrix_type,
 }
 
 
+fla_ldlt_t* FLA_Cntl_ldlt_obj_create( FLA_Matrix_type  matrix_type,
+                                      int              variant,
+                                      fla_blocksize_t* blocksize,
+                                      fla_ldlt_t*      sub_ldlt,
+                                      fla_gemm_t*      sub_gemm )
+{
+	fla_ldlt_t* cntl;
+	
+	cntl = ( fla_ldlt_t* ) FLA_malloc( sizeof(fla_ldlt_t) );
+
+	cntl->matrix_type = matrix_type;
+	cntl->variant     = variant;
+	cntl->blocksize   = blocksize;
+	cntl->sub_ldlt    = sub_ldlt;
+	cntl->sub_gemm    = sub_gemm;
+
+	return cntl;
+}
+
+
 fla_appiv_t* FLA_Cntl_appiv_obj_create( FLA_Matrix_type  matrix_type,
                                         int              variant,
                                         fla_blocksize_t* blocksize,
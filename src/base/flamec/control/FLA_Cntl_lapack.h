@@ -66,6 +66,17 @@ struct fla_lu_s
 typedef struct fla_lu_s fla_lu_t;
 
 
+struct fla_ldlt_s
+{
+	FLA_Matrix_type    matrix_type;
+	int                variant;
+	fla_blocksize_t*   blocksize;
+	struct fla_ldlt_s* sub_ldlt;
+	struct fla_gemm_s* sub_gemm;
+};
+typedef struct fla_ldlt_s fla_ldlt_t;
+
+
 struct fla_qr_ut_s
 {
 	FLA_Matrix_type     matrix_type;
@@ -375,6 +386,7 @@ typedef struct fla_eig_gest_s fla_eig_gest_t;
 
 #define FLA_Cntl_sub_chol( cntl )      cntl->sub_chol
 #define FLA_Cntl_sub_lu( cntl )        cntl->sub_lu
+#define FLA_Cntl_sub_ldlt( cntl )      cntl->sub_ldlt
 #define FLA_Cntl_sub_qr( cntl )        cntl->sub_qr
 #define FLA_Cntl_sub_qrut( cntl )      cntl->sub_qrut
 #define FLA_Cntl_sub_qr2ut( cntl )     cntl->sub_qr2ut
@@ -420,6 +432,11 @@ fla_lu_t* FLA_Cntl_lu_obj_create( FLA_Matrix_type  matrix_type,
                                   fla_trsm_t*      sub_trsm2,
                                   fla_appiv_t*     sub_appiv1,
                                   fla_appiv_t*     sub_appiv2 );
+fla_ldlt_t* FLA_Cntl_ldlt_obj_create( FLA_Matrix_type  matrix_type,
+                                      int              variant,
+                                      fla_blocksize_t* blocksize,
+                                      fla_ldlt_t*      sub_ldlt,
+                                      fla_gemm_t*      sub_gemm );
 fla_appiv_t* FLA_Cntl_appiv_obj_create( FLA_Matrix_type  matrix_type,
                                         int              variant,
                                         fla_blocksize_t* blocksize,
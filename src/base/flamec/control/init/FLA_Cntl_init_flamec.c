@@ -45,6 +45,7 @@ void FLA_Cntl_init_flamec()
   FLA_Chol_cntl_init();
   FLA_LU_nopiv_cntl_init();
   FLA_LU_piv_cntl_init();
+  FLA_LDLT_piv_cntl_init();
   FLA_Trinv_cntl_init();
   FLA_Ttmm_cntl_init();
   FLA_Sylv_cntl_init();
@@ -101,6 +102,7 @@ void FLA_Cntl_finalize_flamec()
   FLA_Chol_cntl_finalize();
   FLA_LU_nopiv_cntl_finalize();
   FLA_LU_piv_cntl_finalize();
+  FLA_LDLT_piv_cntl_finalize();
   FLA_Trinv_cntl_finalize();
   FLA_Ttmm_cntl_finalize();
   FLA_Sylv_cntl_finalize();
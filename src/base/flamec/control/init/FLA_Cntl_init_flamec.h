@@ -71,6 +71,7 @@ void FLA_Apply_pivots_cntl_init( void );
 void FLA_Chol_cntl_init( void );
 void FLA_LU_piv_cntl_init( void );
 void FLA_LU_nopiv_cntl_init( void );
+void FLA_LDLT_piv_cntl_init( void );
 void FLA_QR_UT_cntl_init( void );
 void FLA_QR2_UT_cntl_init( void );
 void FLA_LQ_UT_cntl_init( void );
@@ -94,6 +95,7 @@ void FLA_Apply_pivots_cntl_finalize( void );
 void FLA_Chol_cntl_finalize( void );
 void FLA_LU_piv_cntl_finalize( void );
 void FLA_LU_nopiv_cntl_finalize( void );
+void FLA_LDLT_piv_cntl_finalize( void );
 void FLA_QR_UT_cntl_finalize( void );
 void FLA_QR2_UT_cntl_finalize( void );
 void FLA_LQ_UT_cntl_finalize( void );
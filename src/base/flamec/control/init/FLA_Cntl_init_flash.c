@@ -43,6 +43,7 @@ void FLA_Cntl_init_flash()
   FLASH_Chol_cntl_init();
   FLASH_LU_nopiv_cntl_init();
   FLASH_LU_piv_cntl_init();
+  FLASH_LDLT_piv_cntl_init();
   FLASH_LU_incpiv_cntl_init();
   FLASH_Trinv_cntl_init();
   FLASH_Ttmm_cntl_init();
@@ -101,6 +102,7 @@ void FLA_Cntl_finalize_flash()
   FLASH_Chol_cntl_finalize();
   FLASH_LU_nopiv_cntl_finalize();
   FLASH_LU_piv_cntl_finalize();
+  FLASH_LDLT_piv_cntl_finalize();
   FLASH_LU_incpiv_cntl_finalize();
   FLASH_Trinv_cntl_finalize();
   FLASH_Ttmm_cntl_finalize();
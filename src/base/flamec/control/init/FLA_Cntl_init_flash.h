@@ -71,6 +71,7 @@ void FLASH_Apply_pivots_cntl_init( void );
 void FLASH_Chol_cntl_init( void );
 void FLASH_LU_nopiv_cntl_init( void );
 void FLASH_LU_piv_cntl_init( void );
+void FLASH_LDLT_piv_cntl_init( void );
 void FLASH_LU_incpiv_cntl_init( void );
 void FLASH_Trinv_cntl_init( void );
 void FLASH_Ttmm_cntl_init( void );
@@ -98,6 +99,7 @@ void FLASH_Apply_pivots_cntl_finalize( void );
 void FLASH_Chol_cntl_finalize( void );
 void FLASH_LU_nopiv_cntl_finalize( void );
 void FLASH_LU_piv_cntl_finalize( void );
+void FLASH_LDLT_piv_cntl_finalize( void );
 void FLASH_LU_incpiv_cntl_finalize( void );
 void FLASH_Trinv_cntl_finalize( void );
 void FLASH_Ttmm_cntl_finalize( void );
@@ -12,6 +12,7 @@
 
 extern fla_herk_t* fla_herk_cntl_blas;
 extern fla_trsm_t* fla_trsm_cntl_blas;
+extern fla_gemm_t* fla_gemm_cntl_blas;
 
 fla_chol_t*        fla_chol_cntl = NULL;
 fla_chol_t*        fla_chol_cntl2 = NULL;
@@ -22,10 +23,14 @@ fla_blocksize_t*   fla_chol_var3_bsize = NULL;
 fla_blocksize_t*   fla_chol_var3_bsize_in = NULL;
 double             fla_chol_var3_in_to_ou_bsize_ratio = 0.25;
 
+fla_chol_t*        fla_chol_band_cntl = NULL;
+fla_chol_t*        fla_chol_band_cntl_leaf = NULL;
+fla_blocksize_t*   fla_chol_band_var3_bsize = NULL;
+
 void FLA_Chol_cntl_init()
 {
-	// Set blocksize with default values for conventional storage.
-	fla_chol_var3_bsize  = FLA_Query_blocksizes( FLA_DIMENSION_MIN );
+	// Set blocksize with the (possibly tuned) values for conventional storage.
+	fla_chol_var3_bsize  = FLA_Tune_query_blocksizes( FLA_TUNE_CHOL );
 	fla_chol_var3_bsize_in = FLA_Blocksize_create_copy( fla_chol_var3_bsize );
 	FLA_Blocksize_scale( fla_chol_var3_bsize_in, fla_chol_var3_in_to_ou_bsize_ratio );
 
@@ -68,6 +73,28 @@ void FLA_Chol_cntl_init()
 	                                                 fla_herk_cntl_blas,
 	                                                 fla_trsm_cntl_blas,
 	                                                 NULL );
+
+	// Set the blocksize for band matrices. The blocks are confined to the
+	// band, so they are smaller than those for dense matrices.
+	fla_chol_band_var3_bsize = FLA_Blocksize_create( 32, 32, 32, 32 );
+
+	// Create a control tree to factor band matrices one column at a time.
+	fla_chol_band_cntl_leaf  = FLA_Cntl_chol_obj_create( FLA_FLAT,
+	                                                     FLA_UNB_OPT_VARIANT3,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL );
+
+	// Create a control tree for band matrices with wide bands.
+	fla_chol_band_cntl       = FLA_Cntl_chol_obj_create( FLA_FLAT,
+	                                                     FLA_BLOCKED_VARIANT3,
+	                                                     fla_chol_band_var3_bsize,
+	                                                     fla_chol_cntl_leaf,
+	                                                     fla_herk_cntl_blas,
+	                                                     fla_trsm_cntl_blas,
+	                                                     fla_gemm_cntl_blas );
 }
 
 void FLA_Chol_cntl_finalize()
@@ -79,5 +106,10 @@ void FLA_Chol_cntl_finalize()
 
 	FLA_Blocksize_free( fla_chol_var3_bsize );
 	FLA_Blocksize_free( fla_chol_var3_bsize_in );
+
+	FLA_Cntl_obj_free( fla_chol_band_cntl );
+	FLA_Cntl_obj_free( fla_chol_band_cntl_leaf );
+
+	FLA_Blocksize_free( fla_chol_band_var3_bsize );
 }
 
@@ -0,0 +1,46 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_gemm_t* fla_gemm_cntl_blas;
+
+fla_ldlt_t*        fla_ldlt_piv_cntl = NULL;
+fla_ldlt_t*        fla_ldlt_piv_cntl_leaf = NULL;
+fla_blocksize_t*   fla_ldlt_piv_var1_bsize = NULL;
+
+void FLA_LDLT_piv_cntl_init()
+{
+	// Set blocksizes with default values for conventional storage.
+	fla_ldlt_piv_var1_bsize  = FLA_Query_blocksizes( FLA_DIMENSION_MIN );
+
+	// Create a control tree to invoke unblocked variant 1.
+	fla_ldlt_piv_cntl_leaf   = FLA_Cntl_ldlt_obj_create( FLA_FLAT,
+	                                                     FLA_UNB_OPT_VARIANT1,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL );
+
+	// Create a control tree for large problems.
+	fla_ldlt_piv_cntl        = FLA_Cntl_ldlt_obj_create( FLA_FLAT,
+	                                                     FLA_BLOCKED_VARIANT1,
+	                                                     fla_ldlt_piv_var1_bsize,
+	                                                     fla_ldlt_piv_cntl_leaf,
+	                                                     fla_gemm_cntl_blas );
+}
+
+void FLA_LDLT_piv_cntl_finalize()
+{
+	FLA_Cntl_obj_free( fla_ldlt_piv_cntl );
+	FLA_Cntl_obj_free( fla_ldlt_piv_cntl_leaf );
+
+	FLA_Blocksize_free( fla_ldlt_piv_var1_bsize );
+}
+
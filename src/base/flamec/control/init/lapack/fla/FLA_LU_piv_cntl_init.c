@@ -16,6 +16,7 @@ extern fla_appiv_t* fla_appiv_cntl_leaf;
 
 fla_lu_t*           fla_lu_piv_cntl = NULL;
 fla_lu_t*           fla_lu_piv_cntl2 = NULL;
+fla_lu_t*           fla_lu_piv_cntl_rec = NULL;
 
 fla_lu_t*           fla_lu_piv_cntl_in = NULL;
 fla_lu_t*           fla_lu_piv_cntl_leaf = NULL;
@@ -23,10 +24,14 @@ fla_blocksize_t*    fla_lu_piv_var5_bsize = NULL;
 fla_blocksize_t*    fla_lu_piv_var5_bsize_in = NULL;
 double              fla_lu_piv_var5_in_to_ou_bsize_ratio = 0.125;
 
+fla_lu_t*           fla_lu_piv_band_cntl = NULL;
+fla_lu_t*           fla_lu_piv_band_cntl_leaf = NULL;
+fla_blocksize_t*    fla_lu_piv_band_var5_bsize = NULL;
+
 void FLA_LU_piv_cntl_init()
 {
-	// Set blocksizes with default values for conventional storage.
-	fla_lu_piv_var5_bsize    = FLA_Query_blocksizes( FLA_DIMENSION_MIN );
+	// Set blocksizes with the (possibly tuned) values for conventional storage.
+	fla_lu_piv_var5_bsize    = FLA_Tune_query_blocksizes( FLA_TUNE_LU_PIV );
 	fla_lu_piv_var5_bsize_in = FLA_Blocksize_create_copy( fla_lu_piv_var5_bsize );
 	FLA_Blocksize_scale( fla_lu_piv_var5_bsize_in, fla_lu_piv_var5_in_to_ou_bsize_ratio );
 
@@ -73,6 +78,20 @@ void FLA_LU_piv_cntl_init()
 	                                                 fla_appiv_cntl_leaf,
 	                                                 fla_appiv_cntl_leaf );
 
+	// Create a control tree that splits the columns in half recursively down
+	// to panels as wide as the inner blocksize.
+	fla_lu_piv_cntl_rec    = FLA_Cntl_lu_obj_create( FLA_FLAT, 
+	                                                 FLA_RECURSIVE_VARIANT1,
+	                                                 fla_lu_piv_var5_bsize_in,
+	                                                 fla_lu_piv_cntl_leaf,
+	                                                 fla_gemm_cntl_blas,
+	                                                 fla_gemm_cntl_blas,
+	                                                 fla_gemm_cntl_blas,
+	                                                 fla_trsm_cntl_blas,
+	                                                 fla_trsm_cntl_blas,
+	                                                 fla_appiv_cntl_leaf,
+	                                                 fla_appiv_cntl_leaf );
+
 	// Create a control tree for large problems with no extra recursion.
 	fla_lu_piv_cntl        = FLA_Cntl_lu_obj_create( FLA_FLAT, 
 	                                                 FLA_BLOCKED_VARIANT5,
@@ -85,16 +104,52 @@ void FLA_LU_piv_cntl_init()
 	                                                 fla_trsm_cntl_blas,
 	                                                 fla_appiv_cntl_leaf,
 	                                                 fla_appiv_cntl_leaf );
+
+	// Set the blocksize for band matrices. The blocks are confined to the
+	// band, so they are smaller than those for dense matrices.
+	fla_lu_piv_band_var5_bsize = FLA_Blocksize_create( 32, 32, 32, 32 );
+
+	// Create a control tree to factor band matrices one column at a time.
+	fla_lu_piv_band_cntl_leaf  = FLA_Cntl_lu_obj_create( FLA_FLAT,
+	                                                     FLA_UNB_OPT_VARIANT5,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL,
+	                                                     NULL );
+
+	// Create a control tree for band matrices with wide bands.
+	fla_lu_piv_band_cntl       = FLA_Cntl_lu_obj_create( FLA_FLAT,
+	                                                     FLA_BLOCKED_VARIANT5,
+	                                                     fla_lu_piv_band_var5_bsize,
+	                                                     fla_lu_piv_cntl_leaf,
+	                                                     fla_gemm_cntl_blas,
+	                                                     fla_gemm_cntl_blas,
+	                                                     fla_gemm_cntl_blas,
+	                                                     fla_trsm_cntl_blas,
+	                                                     fla_trsm_cntl_blas,
+	                                                     fla_appiv_cntl_leaf,
+	                                                     fla_appiv_cntl_leaf );
 }
 
 void FLA_LU_piv_cntl_finalize()
 {
 	FLA_Cntl_obj_free( fla_lu_piv_cntl );
 	FLA_Cntl_obj_free( fla_lu_piv_cntl2 );
+	FLA_Cntl_obj_free( fla_lu_piv_cntl_rec );
 	FLA_Cntl_obj_free( fla_lu_piv_cntl_in );
 	FLA_Cntl_obj_free( fla_lu_piv_cntl_leaf );
 
 	FLA_Blocksize_free( fla_lu_piv_var5_bsize );
 	FLA_Blocksize_free( fla_lu_piv_var5_bsize_in );
+
+	FLA_Cntl_obj_free( fla_lu_piv_band_cntl );
+	FLA_Cntl_obj_free( fla_lu_piv_band_cntl_leaf );
+
+	FLA_Blocksize_free( fla_lu_piv_band_var5_bsize );
 }
 
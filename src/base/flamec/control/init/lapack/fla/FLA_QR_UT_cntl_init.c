@@ -22,9 +22,9 @@ fla_blocksize_t*    fla_qrut_var1_bsize_leaf = NULL;
 
 void FLA_QR_UT_cntl_init()
 {
-	// Set blocksizes with default values for conventional storage.
-	fla_qrut_var1_bsize_leaf = FLA_Query_blocksizes( FLA_DIMENSION_MIN );
-	FLA_Blocksize_scale( fla_qrut_var1_bsize_leaf, FLA_QR_INNER_TO_OUTER_B_RATIO );
+	// Set blocksizes with the (possibly tuned) values for conventional
+	// storage, which are already scaled for the width of T.
+	fla_qrut_var1_bsize_leaf = FLA_Tune_query_blocksizes( FLA_TUNE_QR_UT );
 
 	// Create a control tree to invoke unblocked variant 2.
 	fla_qrut_cntl_unb  = FLA_Cntl_qrut_obj_create( FLA_FLAT,
@@ -18,9 +18,9 @@ fla_blocksize_t*    fla_tridiagut_bsize_leaf = NULL;
 
 void FLA_Tridiag_UT_cntl_init()
 {
-	// Set blocksizes with default values for conventional storage.
-	fla_tridiagut_bsize_leaf = FLA_Query_blocksizes( FLA_DIMENSION_MIN );
-	FLA_Blocksize_scale( fla_tridiagut_bsize_leaf, FLA_TRIDIAG_INNER_TO_OUTER_B_RATIO );
+	// Set blocksizes with the (possibly tuned) values for conventional
+	// storage, which are already scaled for the width of T.
+	fla_tridiagut_bsize_leaf = FLA_Tune_query_blocksizes( FLA_TUNE_TRIDIAG_UT );
 
 	// Create a control tree that uses fused subproblems.
 	fla_tridiagut_cntl_fused = FLA_Cntl_tridiagut_obj_create( FLA_FLAT, 
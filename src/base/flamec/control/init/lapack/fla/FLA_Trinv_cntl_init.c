@@ -20,8 +20,8 @@ fla_blocksize_t*   fla_trinv_var3_bsize = NULL;
 
 void FLA_Trinv_cntl_init()
 {
-	// Set blocksize with default value for conventional storage.
-	fla_trinv_var3_bsize  = FLA_Query_blocksizes( FLA_DIMENSION_MIN );
+	// Set blocksize with the (possibly tuned) value for conventional storage.
+	fla_trinv_var3_bsize  = FLA_Tune_query_blocksizes( FLA_TUNE_TRINV );
 	//fla_trinv_var3_bsize  = FLA_Blocksize_create( 192, 192, 192, 192 );
 
 	// Create a control tree to invoke LAPACK.
@@ -0,0 +1,46 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_gemm_t*  flash_gemm_cntl_blas;
+
+fla_ldlt_t*         flash_ldlt_piv_cntl_leaf = NULL;
+fla_ldlt_t*         flash_ldlt_piv_cntl = NULL;
+fla_blocksize_t*    flash_ldlt_piv_bsize = NULL;
+
+void FLASH_LDLT_piv_cntl_init()
+{
+	// Set blocksize for hierarchical storage.
+	flash_ldlt_piv_bsize       = FLA_Blocksize_create( 1, 1, 1, 1 );
+
+	// Create a control tree that assumes A is a b x b block.
+	flash_ldlt_piv_cntl_leaf   = FLA_Cntl_ldlt_obj_create( FLA_HIER,
+	                                                       FLA_SUBPROBLEM,
+	                                                       NULL,
+	                                                       NULL,
+	                                                       NULL );
+
+	// Create a control tree that assumes A is large.
+	flash_ldlt_piv_cntl        = FLA_Cntl_ldlt_obj_create( FLA_HIER,
+	                                                       FLA_BLOCKED_VARIANT1,
+	                                                       flash_ldlt_piv_bsize,
+	                                                       flash_ldlt_piv_cntl_leaf,
+	                                                       flash_gemm_cntl_blas );
+}
+
+void FLASH_LDLT_piv_cntl_finalize()
+{
+	FLA_Cntl_obj_free( flash_ldlt_piv_cntl_leaf );
+	FLA_Cntl_obj_free( flash_ldlt_piv_cntl );
+
+	FLA_Blocksize_free( flash_ldlt_piv_bsize );
+}
+
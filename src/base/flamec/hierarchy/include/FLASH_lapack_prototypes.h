@@ -13,10 +13,13 @@
 // Implemented:
 FLA_Error FLASH_Chol( FLA_Uplo uplo, FLA_Obj A );
 FLA_Error FLASH_Chol_solve( FLA_Uplo uplo, FLA_Obj A, FLA_Obj B, FLA_Obj X );
+FLA_Error FLASH_Chol_band( FLA_Uplo uplo, dim_t kd, FLA_Obj A );
 FLA_Error FLASH_LU_nopiv( FLA_Obj A );
 FLA_Error FLASH_LU_nopiv_solve( FLA_Obj A, FLA_Obj B, FLA_Obj X );
 FLA_Error FLASH_LU_piv( FLA_Obj A, FLA_Obj p );
 FLA_Error FLASH_LU_piv_solve( FLA_Obj A, FLA_Obj p, FLA_Obj B, FLA_Obj X );
+FLA_Error FLASH_LDLT_piv( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p );
+FLA_Error FLASH_LDLT_piv_solve( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p, FLA_Obj B, FLA_Obj X );
 FLA_Error FLASH_LU_incpiv( FLA_Obj A, FLA_Obj p, FLA_Obj L );
 FLA_Error FLASH_FS_incpiv( FLA_Obj A, FLA_Obj p, FLA_Obj L, FLA_Obj b );
 FLA_Error FLASH_Trinv( FLA_Uplo uplo, FLA_Diag diag, FLA_Obj A );
@@ -33,6 +33,19 @@
 #define F77_cgetf2 F77_FUNC( cgetf2 , CGETF2 )
 #define F77_zgetf2 F77_FUNC( zgetf2 , ZGETF2 )
       
+#define F77_spbtrf F77_FUNC( spbtrf , SPBTRF )
+#define F77_dpbtrf F77_FUNC( dpbtrf , DPBTRF )
+#define F77_cpbtrf F77_FUNC( cpbtrf , CPBTRF )
+#define F77_zpbtrf F77_FUNC( zpbtrf , ZPBTRF )
+      
+#define F77_sgbtrf F77_FUNC( sgbtrf , SGBTRF )
+#define F77_dgbtrf F77_FUNC( dgbtrf , DGBTRF )
+#define F77_cgbtrf F77_FUNC( cgbtrf , CGBTRF )
+#define F77_zgbtrf F77_FUNC( zgbtrf , ZGBTRF )
+      
+#define F77_ssytrf F77_FUNC( ssytrf , SSYTRF )
+#define F77_dsytrf F77_FUNC( dsytrf , DSYTRF )
+      
 #define F77_sgeqrf F77_FUNC( sgeqrf , SGEQRF )
 #define F77_dgeqrf F77_FUNC( dgeqrf , DGEQRF )
 #define F77_cgeqrf F77_FUNC( cgeqrf , CGEQRF )
@@ -340,6 +353,25 @@ int F77_dgetf2( int* m, int* n, double*   a, int* lda, int* ipiv, int* info );
 int F77_cgetf2( int* m, int* n, scomplex* a, int* lda, int* ipiv, int* info );
 int F77_zgetf2( int* m, int* n, dcomplex* a, int* lda, int* ipiv, int* info );
 
+// --- Band Cholesky factorization ---
+
+int F77_spbtrf( char* uplo, int* n, int* kd, float*    ab, int* ldab, int* info );
+int F77_dpbtrf( char* uplo, int* n, int* kd, double*   ab, int* ldab, int* info );
+int F77_cpbtrf( char* uplo, int* n, int* kd, scomplex* ab, int* ldab, int* info );
+int F77_zpbtrf( char* uplo, int* n, int* kd, dcomplex* ab, int* ldab, int* info );
+
+// --- Band LU factorization with partial pivoting ---
+
+int F77_sgbtrf( int* m, int* n, int* kl, int* ku, float*    ab, int* ldab, int* ipiv, int* info );
+int F77_dgbtrf( int* m, int* n, int* kl, int* ku, double*   ab, int* ldab, int* ipiv, int* info );
+int F77_cgbtrf( int* m, int* n, int* kl, int* ku, scomplex* ab, int* ldab, int* ipiv, int* info );
+int F77_zgbtrf( int* m, int* n, int* kl, int* ku, dcomplex* ab, int* ldab, int* ipiv, int* info );
+
+// --- LDL^T factorization with Bunch-Kaufman pivoting ---
+
+int F77_ssytrf( char* uplo, int* n, float*    a, int* lda, int* ipiv, float*    work, int* lwork, int* info );
+int F77_dsytrf( char* uplo, int* n, double*   a, int* lda, int* ipiv, double*   work, int* lwork, int* info );
+
 // --- QR factorization (classic) ---
 
 int F77_sgeqrf( int* m, int* n, float*    a, int* lda, float*    tau, float*    work, int* lwork, int* info );
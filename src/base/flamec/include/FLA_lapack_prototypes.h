@@ -11,8 +11,11 @@
 // --- top-level wrapper prototypes --------------------------------------------
 
 FLA_Error FLA_Chol( FLA_Uplo uplo, FLA_Obj A );
+FLA_Error FLA_Chol_band( FLA_Uplo uplo, dim_t kd, FLA_Obj A );
 FLA_Error FLA_LU_nopiv( FLA_Obj A );
 FLA_Error FLA_LU_piv( FLA_Obj A, FLA_Obj p );
+FLA_Error FLA_LU_piv_band( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p );
+FLA_Error FLA_LDLT_piv( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p );
 FLA_Error FLA_QR_UT( FLA_Obj A, FLA_Obj T );
 FLA_Error FLA_QR_UT_piv( FLA_Obj A, FLA_Obj T, FLA_Obj w, FLA_Obj p );
 FLA_Error FLA_LQ_UT( FLA_Obj A, FLA_Obj S );
@@ -29,6 +32,13 @@ FLA_Error FLA_Apply_HUD_UT( FLA_Side side, FLA_Obj tau, FLA_Obj w12t, FLA_Obj u2
 FLA_Error FLA_Apply_Q_UT( FLA_Side side, FLA_Trans trans, FLA_Direct direct, FLA_Store storev, FLA_Obj A, FLA_Obj T, FLA_Obj W, FLA_Obj B );
 FLA_Error FLA_Apply_pivots( FLA_Side side, FLA_Trans trans, FLA_Obj p, FLA_Obj A );
 
+FLA_Error FLA_Chol_batched( FLA_Uplo uplo, FLA_Datatype datatype, int n_batch, int* mn_A, void** buff_A, int* ldim_A, FLA_Error* r_val );
+FLA_Error FLA_Chol_batched_strided( FLA_Uplo uplo, FLA_Datatype datatype, int n_batch, int mn_A, void* buff_A, int ldim_A, int stride_A, FLA_Error* r_val );
+FLA_Error FLA_LU_piv_batched( FLA_Datatype datatype, int n_batch, int* m_A, int* n_A, void** buff_A, int* ldim_A, int** buff_p, FLA_Error* r_val );
+FLA_Error FLA_LU_piv_batched_strided( FLA_Datatype datatype, int n_batch, int m_A, int n_A, void* buff_A, int ldim_A, int stride_A, int* buff_p, int stride_p, FLA_Error* r_val );
+FLA_Error FLA_QR_UT_batched( FLA_Datatype datatype, int n_batch, int* m_A, int* n_A, void** buff_A, int* ldim_A, void** buff_T, int* ldim_T );
+FLA_Error FLA_QR_UT_batched_strided( FLA_Datatype datatype, int n_batch, int m_A, int n_A, void* buff_A, int ldim_A, int stride_A, void* buff_T, int ldim_T, int stride_T );
+
 // --- task wrapper prototypes -------------------------------------------------
 
 FLA_Error FLA_Chol_task( FLA_Uplo uplo, FLA_Obj A, fla_chol_t* cntl );
@@ -41,6 +51,8 @@ FLA_Error FLA_Apply_pivots_macro_task( FLA_Side side, FLA_Trans trans, FLA_Obj p
 FLA_Error FLA_LU_nopiv_task( FLA_Obj A, fla_lu_t* cntl );
 FLA_Error FLA_LU_piv_task( FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
 FLA_Error FLA_LU_piv_copy_task( FLA_Obj A, FLA_Obj p, FLA_Obj U, fla_lu_t* cntl );
+FLA_Error FLA_LDLT_piv_panel_task( FLA_Obj A, FLA_Obj p, FLA_Obj L, FLA_Obj W, FLA_Obj s, int offset, fla_ldlt_t* cntl );
+FLA_Error FLA_LDLT_piv_update_task( FLA_Obj L, FLA_Obj W, FLA_Obj A, fla_gemm_t* cntl );
 FLA_Error FLA_Trsm_piv_task( FLA_Obj A, FLA_Obj B, FLA_Obj p, fla_trsm_t* cntl );
 FLA_Error FLA_SA_LU_task( FLA_Obj U, FLA_Obj D, FLA_Obj p, FLA_Obj L, dim_t nb_alg, fla_lu_t* cntl );
 FLA_Error FLA_SA_FS_task( FLA_Obj L, FLA_Obj D, FLA_Obj p, FLA_Obj C, FLA_Obj E, dim_t nb_alg, fla_gemm_t* cntl );
@@ -260,10 +272,14 @@ FLA_Error FLA_Trsm_piv_external_hip( rocblas_handle handle, FLA_Obj A, void* A_h
 
 FLA_Error FLA_Chol_check( FLA_Uplo uplo, FLA_Obj A );
 FLA_Error FLA_Chol_solve_check( FLA_Uplo uplo, FLA_Obj A, FLA_Obj B, FLA_Obj X );
+FLA_Error FLA_Chol_band_check( FLA_Uplo uplo, dim_t kd, FLA_Obj A );
 FLA_Error FLA_LU_nopiv_check( FLA_Obj A );
 FLA_Error FLA_LU_nopiv_solve_check( FLA_Obj A, FLA_Obj B, FLA_Obj X );
 FLA_Error FLA_LU_piv_check( FLA_Obj A, FLA_Obj p );
 FLA_Error FLA_LU_piv_solve_check( FLA_Obj A, FLA_Obj p, FLA_Obj B, FLA_Obj X );
+FLA_Error FLA_LU_piv_band_check( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p );
+FLA_Error FLA_LDLT_piv_check( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p );
+FLA_Error FLA_LDLT_piv_solve_check( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p, FLA_Obj B, FLA_Obj X );
 FLA_Error FLA_LU_incpiv_check( FLA_Obj A, FLA_Obj p, FLA_Obj L );
 FLA_Error FLA_LU_incpiv_solve_check( FLA_Obj A, FLA_Obj p, FLA_Obj L, FLA_Obj B, FLA_Obj X );
 FLA_Error FLA_FS_incpiv_check( FLA_Obj A, FLA_Obj p, FLA_Obj L, FLA_Obj b );
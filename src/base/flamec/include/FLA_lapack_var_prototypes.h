@@ -10,8 +10,11 @@
 
 // Factorizations
 #include "FLA_Chol.h"
+#include "FLA_Chol_band.h"
 #include "FLA_LU_nopiv.h"
 #include "FLA_LU_piv.h"
+#include "FLA_LU_piv_band.h"
+#include "FLA_LDLT_piv.h"
 #include "FLA_LU_incpiv.h"
 #include "FLA_QR_UT.h"
 #include "FLA_QR_UT_piv.h"
@@ -148,6 +148,32 @@
 #define FLA_MACH_EPS2                 1610
 #define FLA_MACH_N_VALS                 11
 
+// FLA_Tune_op
+#define FLA_TUNE_HEVD                 1700
+#define FLA_TUNE_SVD                  1701
+#define FLA_TUNE_BSVD                 1702
+#define FLA_TUNE_CHOL                 1703
+#define FLA_TUNE_LU_PIV               1704
+#define FLA_TUNE_QR_UT                1705
+#define FLA_TUNE_TRIDIAG_UT           1706
+#define FLA_TUNE_TRINV                1707
+#define FLA_TUNE_N_OPS                   8
+
+// FLA_Tune_param
+#define FLA_TUNE_N_ITER_MAX           1800
+#define FLA_TUNE_K_ACCUM              1801
+#define FLA_TUNE_B_ALG                1802
+#define FLA_TUNE_N_LEVELS             1803
+#define FLA_TUNE_M_2S                 1804
+#define FLA_TUNE_M_DC                 1805
+#define FLA_TUNE_TSQR_RATIO           1806
+#define FLA_TUNE_TSQR_N_THREADS       1807
+#define FLA_TUNE_M_2S_VEC             1808
+#define FLA_TUNE_N_PARAMS                9
+
+// The number of problem size ranges over which a tuning parameter may vary.
+#define FLA_TUNE_MAX_BANDS               8
+
 // FLA_Diag_off
 #define FLA_SUPER_DIAGONAL     ( 1)
 #define FLA_MAIN_DIAGONAL        0
@@ -304,9 +330,13 @@
 #define FLA_INVALID_SVD_TYPE_COMBINATION      (-109)
 #define FLA_INVALID_SVD_TYPE_AND_TRANS_COMBINATION (-110)
 #define FLA_OBJECT_NOT_COMPARABLE             (-111)
+#define FLA_INVALID_TUNE_OP                   (-112)
+#define FLA_INVALID_TUNE_PARAM                (-113)
+#define FLA_INVALID_BAND_STORAGE              (-114)
+#define FLA_TUNE_TOO_MANY_SWITCH_POINTS       (-115)
 
 // Necessary when computing whether an error code is defined.
-#define FLA_ERROR_CODE_MAX                    (-111)
+#define FLA_ERROR_CODE_MAX                    (-115)
 
 // Internal string matrix limits.
 #define FLA_MAX_NUM_ERROR_MSGS                 150
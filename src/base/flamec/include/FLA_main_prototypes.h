@@ -128,10 +128,13 @@ FLA_Error     FLA_Check_vector_dim( FLA_Obj x, dim_t expected_length );
 FLA_Error     FLA_Check_row_vector( FLA_Obj x );
 FLA_Error     FLA_Check_col_vector( FLA_Obj x );
 FLA_Error     FLA_Check_valid_machval( FLA_Machval val );
+FLA_Error     FLA_Check_valid_tune_op( FLA_Tune_op op );
+FLA_Error     FLA_Check_valid_tune_param( FLA_Tune_param param );
 FLA_Error     FLA_Check_valid_evd_type( FLA_Evd_type evd_type );
 FLA_Error     FLA_Check_valid_svd_type( FLA_Svd_type svd_type );
 FLA_Error     FLA_Check_valid_diag_offset( FLA_Obj A, FLA_Diag_off offset );
 FLA_Error     FLA_Check_col_storage( FLA_Obj A );
+FLA_Error     FLA_Check_band_storage( FLA_Obj A, dim_t k );
 FLA_Error     FLA_Check_row_storage( FLA_Obj A );
 
 
@@ -163,6 +166,30 @@ void          FLA_Finalize_numerical_constants( void );
 
 
 
+// -----------------------------------------------------------------------------
+
+void          FLA_Tune_init( void );
+void          FLA_Tune_finalize( void );
+void          FLA_Tune_reset( void );
+dim_t         FLA_Tune_get( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param );
+void          FLA_Tune_set( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param, dim_t value );
+dim_t         FLA_Tune_get_for_size( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param, dim_t m );
+FLA_Error     FLA_Tune_set_for_size( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param, dim_t m_min, dim_t value );
+fla_blocksize_t* FLA_Tune_query_blocksizes( FLA_Tune_op op );
+dim_t         FLA_Tune_search( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param, dim_t m, int n_repeats );
+FLA_Error     FLA_Tune_load( char* file_name );
+FLA_Error     FLA_Tune_save( char* file_name );
+char*         FLA_Tune_default_file( void );
+
+
+
+// -----------------------------------------------------------------------------
+
+void          FLA_Batch_run( int n_batch, int n_group, void (*func)( int i_first, int n_batch, void* args ), void* args );
+void          FLA_Thread_run( int n_threads, void* (*func)( void* ), void* args );
+
+
+
 //------------------------------------------------------------------------------
 
 void          FLA_Lock_init( FLA_Lock* fla_lock_ptr );
@@ -250,6 +277,7 @@ FLA_Error     FLA_Obj_create_constant( double const_real, FLA_Obj *obj );
 FLA_Error     FLA_Obj_create_constant_ext( float const_s, double const_d, FLA_Obj *obj );
 FLA_Error     FLA_Obj_create_complex_constant( double const_real, double const_imag, FLA_Obj *obj );
 FLA_Error     FLA_Obj_attach_buffer( void *buffer, dim_t rs, dim_t cs, FLA_Obj *obj );
+FLA_Error     FLA_Obj_attach_band_buffer( void *buffer, dim_t k, dim_t ldim, FLA_Obj *obj );
 FLA_Error     FLA_Obj_create_buffer( dim_t rs, dim_t cs, FLA_Obj *obj );
 FLA_Error     FLA_Obj_free( FLA_Obj *obj );
 FLA_Error     FLA_Obj_free_without_buffer( FLA_Obj *obj );
@@ -268,6 +296,7 @@ FLA_Error     FLA_Obj_create_constant_check( double const_real, FLA_Obj *obj );
 FLA_Error     FLA_Obj_create_constant_ext_check( float const_s, double const_d, FLA_Obj *obj );
 FLA_Error     FLA_Obj_create_complex_constant_check( double const_real, double const_imag, FLA_Obj *obj );
 FLA_Error     FLA_Obj_attach_buffer_check( void *buffer, dim_t rs, dim_t cs, FLA_Obj *obj );
+FLA_Error     FLA_Obj_attach_band_buffer_check( void *buffer, dim_t k, dim_t ldim, FLA_Obj *obj );
 FLA_Error     FLA_Obj_create_buffer_check( dim_t rs, dim_t cs, FLA_Obj *obj );
 FLA_Error     FLA_Obj_free_check( FLA_Obj *obj );
 FLA_Error     FLA_Obj_free_without_buffer_check( FLA_Obj *obj );
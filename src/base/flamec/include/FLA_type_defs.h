@@ -64,6 +64,8 @@ typedef int FLA_Inv;
 typedef int FLA_Evd_type;
 typedef int FLA_Svd_type;
 typedef int FLA_Machval;
+typedef int FLA_Tune_op;
+typedef int FLA_Tune_param;
 typedef int FLA_Diag_off;
 
 #ifndef _DEFINED_DIM_T
@@ -126,8 +128,14 @@ typedef int                   FLASH_Data_aff;
 typedef struct FLASH_Queue_s  FLASH_Queue;
 typedef struct FLASH_Task_s   FLASH_Task;
 typedef struct FLASH_Dep_s    FLASH_Dep;
+typedef struct FLASH_Deque_s  FLASH_Deque;
+typedef struct FLASH_Deque_buffer_s FLASH_Deque_buffer;
+typedef struct FLASH_Graph_s  FLASH_Graph;
+typedef void (*FLASH_Task_invoker)( FLASH_Task* t );
+typedef double (*FLASH_Task_cost)( FLASH_Task* t );
 #endif
 typedef struct FLASH_Thread_s FLASH_Thread;
+typedef unsigned long         FLASH_Queue_handle;
 
 typedef struct FLA_Obj_struct
 {
@@ -162,6 +170,13 @@ typedef struct FLA_Obj_struct
 
   // Task that last overwrote this block, flow dependency
   FLASH_Task*   write_task;
+
+  // NUMA node on which the block was placed, or -1 if never placed
+  int           numa_node;
+
+  // Shared L2 and L3 caches that last touched this block, each tag packing
+  // the cache group with the bytes that group had touched at the time
+  unsigned long cache_tag[2];
 #endif
 } FLA_Base_obj;
 
@@ -199,6 +214,7 @@ struct FLASH_Task_s
   int           order;
   int           queue;
   int           height;
+  double        priority;
   int           thread;
   int           cache;
   FLA_Bool      hit;
@@ -206,6 +222,9 @@ struct FLASH_Task_s
   // Function pointer
   void*         func;
 
+  // Unpacks the arguments and calls func
+  FLASH_Task_invoker invoker;
+
   // Control tree pointer
   void*         cntl;
 
@@ -262,6 +281,60 @@ struct FLASH_Dep_s
   // Support for linked list of FLASH_Deps
   FLASH_Dep*    next_dep;
 };
+
+struct FLASH_Deque_buffer_s
+{
+  // Capacity of the circular buffer, always a power of two
+  long                size;
+
+  // Buffer this one replaced, kept alive until the deque is finalized
+  FLASH_Deque_buffer* prev;
+
+  // Circular array of ready tasks
+  FLASH_Task*         task[1];
+};
+
+struct FLASH_Deque_s
+{
+  // Index of the oldest task, advanced by stealing threads
+  long                top;
+  char                pad_top[64 - sizeof(long)];
+
+  // Index one past the newest task, only written by the owning thread
+  long                bottom;
+  char                pad_bottom[64 - sizeof(long)];
+
+  // Current circular buffer of ready tasks
+  FLASH_Deque_buffer* buffer;
+};
+
+struct FLASH_Graph_s
+{
+  // Recorded tasks in queue order, without their arguments or links
+  int           n_tasks;
+  FLASH_Task*   task;
+
+  // Arguments of all tasks, concatenated in queue order
+  int*          int_arg;
+  FLA_Obj*      obj_arg;
+
+  // Operand node referenced by each FLA_Obj argument, or -1 if none
+  int*          obj_node;
+
+  // Queue indices of the dependent tasks of all tasks
+  int*          dep;
+
+  // Number of nodes in the hierarchy of each operand
+  int           n_objs;
+  int*          n_obj_nodes;
+
+  // Dimensions and block identifiers of all operand nodes
+  int           n_nodes;
+  dim_t*        node_m;
+  dim_t*        node_n;
+  int*          node_read_blocks;
+  int*          node_write_blocks;
+};
 #endif // FLA_ENABLE_SUPERMATRIX
 
 struct FLASH_Thread_s
@@ -269,6 +342,10 @@ struct FLASH_Thread_s
   // The thread's unique identifier
   int       id;
 
+  // The number of threads that execute the same function, among which the
+  // work is to be divided
+  int       n_threads;
+
   // Pointer to variables needed to execute SuperMatrix mechanism
   void*     args;
 
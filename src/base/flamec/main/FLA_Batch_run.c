@@ -0,0 +1,77 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// The batched factorizations hand their problems out to the threads in
+// contiguous ranges of whole groups, where a group is the number of
+// problems that one call to an interleaved kernel factors together.
+
+// The fewest groups given to each thread by FLA_Batch_run().
+#define FLA_BATCH_RUN_MIN_GROUPS 4
+
+typedef struct FLA_Batch_run_vars_s
+{
+  void       (*func)( int i_first, int n_batch, void* args );
+  int        n_batch;
+  int        n_group;
+  void*      args;
+} FLA_Batch_run_vars;
+
+static void* FLA_Batch_run_thread( void* arg );
+
+void FLA_Batch_run( int n_batch, int n_group, void (*func)( int i_first, int n_batch, void* args ), void* args )
+{
+  FLA_Batch_run_vars run;
+  int                n_threads = 1;
+
+  if ( n_batch <= 0 ) return;
+
+  n_group = max( 1, n_group );
+
+#ifdef FLA_ENABLE_MULTITHREADING
+  // Use the threads that SuperMatrix is set to use, but give each of them
+  // enough problems to amortize the cost of waking it.
+  n_threads = FLASH_Queue_get_num_threads();
+  n_threads = max( 1, min( n_threads, n_batch / ( FLA_BATCH_RUN_MIN_GROUPS * n_group ) ) );
+#endif
+
+  if ( n_threads == 1 )
+  {
+    func( 0, n_batch, args );
+
+    return;
+  }
+
+  run.func    = func;
+  run.n_batch = n_batch;
+  run.n_group = n_group;
+  run.args    = args;
+
+  FLA_Thread_run( n_threads, FLA_Batch_run_thread, ( void* ) &run );
+}
+
+
+static void* FLA_Batch_run_thread( void* arg )
+{
+  FLASH_Thread*       me       = ( FLASH_Thread* ) arg;
+  FLA_Batch_run_vars* run      = ( FLA_Batch_run_vars* ) me->args;
+  int                 n_groups = ( run->n_batch + run->n_group - 1 ) / run->n_group;
+  int                 g_first  = ( me->id     ) * n_groups / me->n_threads;
+  int                 g_last   = ( me->id + 1 ) * n_groups / me->n_threads;
+  int                 i_first  = g_first * run->n_group;
+  int                 i_last   = min( run->n_batch, g_last * run->n_group );
+
+  if ( i_first < i_last )
+    run->func( i_first, i_last - i_first, run->args );
+
+  return NULL;
+}
+
@@ -1312,6 +1312,41 @@ FLA_Error FLA_Check_valid_machval( FLA_Machval val )
   return e_val;
 }
 
+FLA_Error FLA_Check_valid_tune_op( FLA_Tune_op op )
+{
+  FLA_Error e_val = FLA_SUCCESS;
+
+  if ( op != FLA_TUNE_HEVD   &&
+       op != FLA_TUNE_SVD    &&
+       op != FLA_TUNE_BSVD   &&
+       op != FLA_TUNE_CHOL   &&
+       op != FLA_TUNE_LU_PIV &&
+       op != FLA_TUNE_QR_UT  &&
+       op != FLA_TUNE_TRIDIAG_UT &&
+       op != FLA_TUNE_TRINV )
+    e_val = FLA_INVALID_TUNE_OP;
+
+  return e_val;
+}
+
+FLA_Error FLA_Check_valid_tune_param( FLA_Tune_param param )
+{
+  FLA_Error e_val = FLA_SUCCESS;
+
+  if ( param != FLA_TUNE_N_ITER_MAX &&
+       param != FLA_TUNE_K_ACCUM    &&
+       param != FLA_TUNE_B_ALG      &&
+       param != FLA_TUNE_N_LEVELS   &&
+       param != FLA_TUNE_M_2S       &&
+       param != FLA_TUNE_M_DC       &&
+       param != FLA_TUNE_TSQR_RATIO &&
+       param != FLA_TUNE_TSQR_N_THREADS &&
+       param != FLA_TUNE_M_2S_VEC )
+    e_val = FLA_INVALID_TUNE_PARAM;
+
+  return e_val;
+}
+
 FLA_Error FLA_Check_valid_diag_offset( FLA_Obj A, FLA_Diag_off offset )
 {
   FLA_Error e_val = FLA_SUCCESS;
@@ -1332,6 +1367,20 @@ FLA_Error FLA_Check_col_storage( FLA_Obj A )
   return e_val;
 }
 
+FLA_Error FLA_Check_band_storage( FLA_Obj A, dim_t k )
+{
+  FLA_Error e_val = FLA_SUCCESS;
+
+  // The diagonals within k of the main diagonal are passed to the BLAS as
+  // column-major blocks of at most min( k, m ) rows, whose leading dimension
+  // is the column stride of A.
+  if ( FLA_Obj_row_stride( A ) != 1 ||
+       FLA_Obj_col_stride( A ) < min( k, FLA_Obj_length( A ) ) )
+    e_val = FLA_INVALID_BAND_STORAGE;
+
+  return e_val;
+}
+
 FLA_Error FLA_Check_row_storage( FLA_Obj A )
 {
   FLA_Error e_val = FLA_SUCCESS;
@@ -223,6 +223,14 @@ void FLA_Error_messages_init( void )
              "Invalid svd type parameters (FLA_SVD_VECTORS_OVERWRITE) and trans parameters combination." );
 	sprintf( FLA_Error_string_for_code(FLA_OBJECT_NOT_COMPARABLE),
              "Expected real or int object." );
+	sprintf( FLA_Error_string_for_code(FLA_INVALID_TUNE_OP),
+             "Invalid tunable operation value." );
+	sprintf( FLA_Error_string_for_code(FLA_INVALID_TUNE_PARAM),
+             "Invalid tunable parameter value." );
+	sprintf( FLA_Error_string_for_code(FLA_INVALID_BAND_STORAGE),
+             "Band storage does not hold the requested diagonals." );
+	sprintf( FLA_Error_string_for_code(FLA_TUNE_TOO_MANY_SWITCH_POINTS),
+             "More switch points than a tunable parameter can hold." );
 }
 
 /* ***************************************************************************
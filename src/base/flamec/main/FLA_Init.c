@@ -10,9 +10,36 @@
 
 #include "FLAME.h"
 
+// FLA_Init_safe() may be called from several application threads however
+// the library was configured, so it serializes on a mutex of its own. The
+// OpenMP build uses a critical section instead. The Windows build, which
+// lacks POSIX threads and may lack OpenMP, spins on an interlocked flag.
+#if defined(FLA_ENABLE_MULTITHREADING) && FLA_MULTITHREADING_MODEL == FLA_OPENMP
+#define FLA_INIT_SAFE_USE_OPENMP
+#elif defined(FLA_ENABLE_WINDOWS_BUILD)
+#define FLA_INIT_SAFE_USE_WIN32
+#else
+#define FLA_INIT_SAFE_USE_PTHREADS
+#include <pthread.h>
+#endif
+
 
 static FLA_Bool FLA_initialized = FALSE;
 
+// FLA_Init_safe() reads this flag without a lock, so it is set only once
+// FLA_Init() has finished, unlike FLA_initialized, with release semantics
+// that pair with the acquiring load in FLA_Init_safe().
+static volatile FLA_Bool FLA_init_complete = FALSE;
+static FLA_Bool          FLA_finalize_at_exit_registered = FALSE;
+
+#if defined(FLA_INIT_SAFE_USE_PTHREADS)
+static pthread_mutex_t   FLA_init_safe_lock = PTHREAD_MUTEX_INITIALIZER;
+#elif defined(FLA_INIT_SAFE_USE_WIN32)
+static volatile LONG     FLA_init_safe_lock = 0;
+#endif
+
+static void FLA_Finalize_at_exit( void );
+
 FLA_Obj FLA_THREE = {};
 FLA_Obj FLA_TWO = {};
 FLA_Obj FLA_ONE = {};
@@ -56,6 +83,8 @@ void FLA_Init()
 
   FLA_Init_constants();
 
+  FLA_Tune_init();
+
   FLA_Cntl_init();
 
 #if FLA_VECTOR_INTRINSIC_TYPE == FLA_SSE_INTRINSICS
@@ -65,6 +94,12 @@ void FLA_Init()
 #ifdef FLA_ENABLE_SUPERMATRIX
   FLASH_Queue_init();
 #endif
+
+#ifdef __GNUC__
+  __atomic_store_n( &FLA_init_complete, TRUE, __ATOMIC_RELEASE );
+#else
+  FLA_init_complete = TRUE;
+#endif
 }
 
 /* *************************************************************************
@@ -77,10 +112,13 @@ void FLA_Finalize()
 {
   if ( FLA_initialized == FALSE ) return;
 
-  FLA_initialized = FALSE;
+  FLA_initialized   = FALSE;
+  FLA_init_complete = FALSE;
 
   FLA_Finalize_constants();
 
+  FLA_Tune_finalize();
+
   FLA_Cntl_finalize();
 
 #ifdef FLA_ENABLE_SUPERMATRIX
@@ -98,15 +136,48 @@ void FLA_Finalize()
 
 void FLA_Init_safe( FLA_Error* init_result )
 {
-  if ( FLA_Initialized() )
-  {
-    *init_result = FLA_FAILURE;
-  }
-  else
+  // The lapack2flame and lapack2flash wrappers call this pair on every
+  // call. Rather than build and tear down the control trees, constants and
+  // SuperMatrix queue each time, initialize the library the first time it
+  // is needed and leave it initialized until the application calls
+  // FLA_Finalize() or exits. Since FLA_Finalize_safe() undoes only what
+  // it is told this call did, *init_result is always FLA_FAILURE.
+  *init_result = FLA_FAILURE;
+
+  // Once the flag is seen set, so are the constants and control trees.
+#ifdef __GNUC__
+  if ( __atomic_load_n( &FLA_init_complete, __ATOMIC_ACQUIRE ) == TRUE ) return;
+#else
+  if ( FLA_init_complete == TRUE ) return;
+#endif
+
+#if defined(FLA_INIT_SAFE_USE_PTHREADS)
+  pthread_mutex_lock( &FLA_init_safe_lock );
+#elif defined(FLA_INIT_SAFE_USE_WIN32)
+  // Initialization happens once, so the other threads yield rather than
+  // block while they wait for it.
+  while ( InterlockedCompareExchange( &FLA_init_safe_lock, 1, 0 ) != 0 )
+    SwitchToThread();
+#elif defined(FLA_INIT_SAFE_USE_OPENMP)
+  #pragma omp critical ( FLA_Init_safe )
+#endif
   {
-    FLA_Init();
-    *init_result = FLA_SUCCESS;
+    if ( FLA_Initialized() == FALSE )
+    {
+      FLA_Init();
+
+      if ( FLA_finalize_at_exit_registered == FALSE )
+      {
+        atexit( FLA_Finalize_at_exit );
+        FLA_finalize_at_exit_registered = TRUE;
+      }
+    }
   }
+#if defined(FLA_INIT_SAFE_USE_PTHREADS)
+  pthread_mutex_unlock( &FLA_init_safe_lock );
+#elif defined(FLA_INIT_SAFE_USE_WIN32)
+  InterlockedExchange( &FLA_init_safe_lock, 0 );
+#endif
 }
 
 /* *************************************************************************
@@ -121,6 +192,18 @@ void FLA_Finalize_safe( FLA_Error init_result )
     FLA_Finalize();
 }
 
+/* *************************************************************************
+
+  FLA_Finalize_at_exit()
+
+ *************************************************************************** */
+
+static void FLA_Finalize_at_exit( void )
+{
+  // Do nothing if the application has already called FLA_Finalize().
+  FLA_Finalize();
+}
+
 /* *************************************************************************
 
    FLA_Initialized()
@@ -125,6 +125,9 @@ FLA_Error FLA_Obj_create_ext( FLA_Datatype datatype, FLA_Elemtype elemtype, dim_
   obj->base->read_task_head = NULL;
   obj->base->read_task_tail = NULL;
   obj->base->write_task     = NULL;
+  obj->base->numa_node      = -1;
+  obj->base->cache_tag[0]   = 0;
+  obj->base->cache_tag[1]   = 0;
 #endif
 
   return FLA_SUCCESS;
@@ -401,6 +404,9 @@ FLA_Error FLA_Obj_create_without_buffer( FLA_Datatype datatype, dim_t m, dim_t n
   obj->base->read_task_head = NULL;
   obj->base->read_task_tail = NULL;
   obj->base->write_task     = NULL;
+  obj->base->numa_node      = -1;
+  obj->base->cache_tag[0]   = 0;
+  obj->base->cache_tag[1]   = 0;
 #endif
 
   return FLA_SUCCESS;
@@ -541,6 +547,27 @@ FLA_Error FLA_Obj_attach_buffer( void *buffer, dim_t rs, dim_t cs, FLA_Obj *obj
 
 
 
+FLA_Error FLA_Obj_attach_band_buffer( void *buffer, dim_t k, dim_t ldim, FLA_Obj *obj )
+{
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_Obj_attach_band_buffer_check( buffer, k, ldim, obj );
+
+  // In LAPACK band storage, element ( i, j ) is kept in row k + i - j of
+  // column j of an ldim x n array, so that moving down a column advances
+  // by one element and moving across a row by ldim - 1. With these strides,
+  // the elements on the diagonals that the array holds, from the k-th
+  // superdiagonal to the ( ldim - 1 - k )-th subdiagonal, may be referenced
+  // as usual. The elements outside of the band share storage with those
+  // inside of it and must not be referenced.
+  obj->base->buffer      = ( char* ) buffer + k * FLA_Obj_elem_size( *obj );
+  obj->base->rs          = 1;
+  obj->base->cs          = ldim - 1;
+
+  return FLA_SUCCESS;
+}
+
+
+
 FLA_Error FLA_Obj_create_buffer( dim_t rs, dim_t cs, FLA_Obj *obj )
 {
   size_t buffer_size;
@@ -0,0 +1,118 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#if defined(FLA_ENABLE_MULTITHREADING) && FLA_MULTITHREADING_MODEL == FLA_OPENMP
+#ifdef FLA_ENABLE_TIDSP
+#include <ti/omp/omp.h>
+#else
+#include <omp.h>
+#endif
+#endif
+
+void FLA_Thread_run( int n_threads, void* (*func)( void* ), void* args )
+{
+  FLASH_Thread self;
+
+  // Run func on a team of up to n_threads threads, with the calling thread
+  // as thread 0. Each thread is passed a FLASH_Thread with its id, the size
+  // of the team and args. The team may be smaller than requested: when the
+  // threads are already busy with another job (such as in a call made from
+  // within func, or from another application thread while the SuperMatrix
+  // pool is in use), func runs on the calling thread alone, as thread 0 of
+  // a team of one. func must therefore divide its work by the n_threads
+  // field of its argument, and not assume that any other thread runs.
+#ifdef FLA_ENABLE_MULTITHREADING
+  if ( n_threads > 1 )
+  {
+#if FLA_MULTITHREADING_MODEL == FLA_OPENMP
+
+    // A nested parallel region may run all of its iterations on one thread,
+    // so run alone within an enclosing one.
+    if ( !omp_in_parallel() )
+    {
+      #pragma omp parallel num_threads( n_threads )
+      {
+        FLASH_Thread me;
+
+        me.id        = omp_get_thread_num();
+        me.n_threads = omp_get_num_threads();
+        me.args      = args;
+
+        func( ( void* ) &me );
+      }
+
+      return;
+    }
+
+#elif FLA_MULTITHREADING_MODEL == FLA_PTHREADS
+#ifdef FLA_ENABLE_SUPERMATRIX
+
+    // Borrow the persistent pool of SuperMatrix workers.
+    FLASH_Queue_pool_run( n_threads, func, args );
+
+    return;
+
+#else
+
+    FLASH_Thread* thread;
+    int           i;
+
+    thread = ( FLASH_Thread* ) FLA_malloc( n_threads * sizeof( FLASH_Thread ) );
+
+    for ( i = 0; i < n_threads; ++i )
+    {
+      thread[i].id        = i;
+      thread[i].n_threads = n_threads;
+      thread[i].args      = args;
+    }
+
+    // The calling thread acts as thread 0.
+    for ( i = 1; i < n_threads; ++i )
+    {
+      int pthread_e_val = pthread_create( &(thread[i].pthread_obj),
+                                          NULL,
+                                          func,
+                                          ( void* ) &thread[i] );
+#ifdef FLA_ENABLE_INTERNAL_ERROR_CHECKING
+      FLA_Error e_val = FLA_Check_pthread_create_result( pthread_e_val );
+      FLA_Check_error_code( e_val );
+#endif
+    }
+
+    func( ( void* ) &thread[0] );
+
+    for ( i = 1; i < n_threads; ++i )
+    {
+      void* thread_status;
+      int   pthread_e_val = pthread_join( thread[i].pthread_obj, &thread_status );
+#ifdef FLA_ENABLE_INTERNAL_ERROR_CHECKING
+      FLA_Error e_val = FLA_Check_pthread_join_result( pthread_e_val );
+      FLA_Check_error_code( e_val );
+#endif
+    }
+
+    FLA_free( thread );
+
+    return;
+
+#endif
+#endif
+  }
+#endif
+
+  self.id        = 0;
+  self.n_threads = 1;
+  self.args      = args;
+
+  func( ( void* ) &self );
+}
+
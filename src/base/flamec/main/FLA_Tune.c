@@ -0,0 +1,377 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// The algorithmic parameters of the eigenvalue and singular value solvers
+// and the blocksizes of the factorizations, per operation and datatype.
+// They start out at the values the front ends and control trees have always
+// used and may be changed with FLA_Tune_set(), or read from a file by
+// FLA_Tune_load(). FLA_Init() loads the file named by the FLA_TUNE_FILE
+// environment variable, or else $HOME/.libflame_tune, if it exists. Each
+// line of the file reads
+//
+//   <op> <dt> <param> <value> [<m_min>]
+//
+// where <op> is one of hevd, svd, bsvd, chol, lu_piv, qr_ut, tridiag_ut or
+// trinv, <dt> is one of s, d, c or z, and <param> is one of n_iter_max,
+// k_accum, b_alg, n_levels, m_2s, m_dc, tsqr_ratio, tsqr_n_threads or
+// m_2s_vec. Only b_alg applies to the factorizations, and n_levels to Chol,
+// LU_piv and Trinv, whose front ends pick a control tree with that many
+// levels of algorithms: 1 for the unblocked variant, 2 for a blocked variant
+// over it and 3 for two levels of blocking. m_2s is the smallest order at
+// which Hevd and Svd reduce A in two stages when no vectors are wanted, and
+// m_2s_vec the smallest at which Svd does so when they are; an m_2s_vec of
+// 0, the default, keeps Svd in one stage whenever it forms vectors. m_dc is
+// the smallest order at which Hevd computes eigenvectors by divide and
+// conquer. QR_UT factors A by TSQR when it has at least tsqr_ratio times as
+// many rows as columns, 16 by default, and at least tsqr_n_threads threads
+// can work on it; a tsqr_ratio of 0 leaves TSQR off. A line with m_min gives
+// the value used for problems of size m_min and larger, up to the next
+// switch point, so that the lines of one parameter form a decision table
+// over problem sizes.
+// Blank lines, lines starting with '#' and lines that do not parse are
+// ignored. A parameter holds at most FLA_TUNE_MAX_BANDS values; a switch
+// point beyond those is refused by FLA_Tune_set_for_size(), which returns
+// FLA_TUNE_TOO_MANY_SWITCH_POINTS, as does FLA_Tune_load() once it has read
+// the rest of the file.
+
+static dim_t fla_tune_n_bands[FLA_TUNE_N_OPS][FLA_TUNE_N_PARAMS][4];
+static dim_t fla_tune_m_min[FLA_TUNE_N_OPS][FLA_TUNE_N_PARAMS][4][FLA_TUNE_MAX_BANDS];
+static dim_t fla_tune_value[FLA_TUNE_N_OPS][FLA_TUNE_N_PARAMS][4][FLA_TUNE_MAX_BANDS];
+
+static char* fla_tune_op_name[FLA_TUNE_N_OPS]       = { "hevd", "svd", "bsvd",
+                                                        "chol", "lu_piv", "qr_ut", "tridiag_ut",
+                                                        "trinv" };
+static char* fla_tune_param_name[FLA_TUNE_N_PARAMS] = { "n_iter_max", "k_accum", "b_alg", "n_levels",
+                                                        "m_2s", "m_dc", "tsqr_ratio", "tsqr_n_threads",
+                                                        "m_2s_vec" };
+static char  fla_tune_dt_name[4]                    = { 's', 'd', 'c', 'z' };
+static FLA_Datatype fla_tune_dt[4]                  = { FLA_FLOAT, FLA_DOUBLE,
+                                                        FLA_COMPLEX, FLA_DOUBLE_COMPLEX };
+
+static char  fla_tune_file_name[1024];
+
+static FLA_Error FLA_Tune_set_index( int op, int param, int dt, dim_t m_min, dim_t value );
+static FLA_Bool  FLA_Tune_may_be_zero( int param );
+
+
+void FLA_Tune_init( void )
+{
+  char* file_name;
+
+  FLA_Tune_reset();
+
+  // A missing file leaves the defaults in place.
+  file_name = FLA_Tune_default_file();
+
+  if ( file_name != NULL )
+    FLA_Tune_load( file_name );
+}
+
+
+void FLA_Tune_finalize( void )
+{
+  FLA_Tune_reset();
+}
+
+
+void FLA_Tune_reset( void )
+{
+  int   op, param, dt;
+  dim_t b_min;
+
+  for ( op = 0; op < FLA_TUNE_N_OPS; ++op )
+  {
+    for ( dt = 0; dt < 4; ++dt )
+    {
+      for ( param = 0; param < FLA_TUNE_N_PARAMS; ++param )
+      {
+        fla_tune_n_bands[op][param][dt]  = 1;
+        fla_tune_m_min[op][param][dt][0] = 0;
+      }
+
+      fla_tune_value[op][0][dt][0] = 30;  // n_iter_max
+      fla_tune_value[op][1][dt][0] = 32;  // k_accum
+      fla_tune_value[op][2][dt][0] = 512; // b_alg
+      fla_tune_value[op][3][dt][0] = 1;   // n_levels
+      fla_tune_value[op][4][dt][0] = 1;   // m_2s
+      fla_tune_value[op][5][dt][0] = 1;   // m_dc
+      fla_tune_value[op][6][dt][0] = 16;  // tsqr_ratio
+      fla_tune_value[op][7][dt][0] = 2;   // tsqr_n_threads
+      fla_tune_value[op][8][dt][0] = 0;   // m_2s_vec
+    }
+  }
+
+  // Hevd and Svd reduce matrices to condensed form in two stages from the
+  // order at which the savings in the first stage outweigh the cost of the
+  // second, and Hevd switches to divide and conquer once its Gemm updates
+  // outrun the QR algorithm.
+  for ( dt = 0; dt < 4; ++dt )
+  {
+    fla_tune_value[FLA_TUNE_HEVD - FLA_TUNE_HEVD][4][dt][0] = 1000;
+    fla_tune_value[FLA_TUNE_HEVD - FLA_TUNE_HEVD][5][dt][0] = 128;
+    fla_tune_value[FLA_TUNE_SVD  - FLA_TUNE_HEVD][4][dt][0] = 500;
+  }
+
+  // The factorizations block by the blocksize queried from the library,
+  // which QR_UT and Tridiag_UT scale down for the width of T.
+  for ( dt = 0; dt < 4; ++dt )
+  {
+    b_min = FLA_Query_blocksize( fla_tune_dt[dt], FLA_DIMENSION_MIN );
+
+    fla_tune_value[FLA_TUNE_CHOL       - FLA_TUNE_HEVD][2][dt][0] = b_min;
+    fla_tune_value[FLA_TUNE_LU_PIV     - FLA_TUNE_HEVD][2][dt][0] = b_min;
+    fla_tune_value[FLA_TUNE_QR_UT      - FLA_TUNE_HEVD][2][dt][0] =
+      ( dim_t )( ( double ) b_min * FLA_QR_INNER_TO_OUTER_B_RATIO );
+    fla_tune_value[FLA_TUNE_TRIDIAG_UT - FLA_TUNE_HEVD][2][dt][0] =
+      ( dim_t )( ( double ) b_min * FLA_TRIDIAG_INNER_TO_OUTER_B_RATIO );
+    fla_tune_value[FLA_TUNE_TRINV      - FLA_TUNE_HEVD][2][dt][0] = b_min;
+
+    // Problems that fit in a single block are factored by the unblocked
+    // variant, and larger ones with two levels of blocking. Trinv keeps a
+    // single level of blocking.
+    FLA_Tune_set_index( FLA_TUNE_CHOL   - FLA_TUNE_HEVD, 3, dt, b_min,     3 );
+    FLA_Tune_set_index( FLA_TUNE_LU_PIV - FLA_TUNE_HEVD, 3, dt, b_min,     3 );
+    FLA_Tune_set_index( FLA_TUNE_TRINV  - FLA_TUNE_HEVD, 3, dt, b_min + 1, 2 );
+  }
+}
+
+
+dim_t FLA_Tune_get( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param )
+{
+  return FLA_Tune_get_for_size( dt, op, param, 0 );
+}
+
+
+void FLA_Tune_set( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param, dim_t value )
+{
+  if ( dt == FLA_CONSTANT ) dt = FLA_DOUBLE;
+
+  FLA_Tune_set_for_size( dt, op, param, 0, value );
+
+  // A value set for every problem size drops any switch points.
+  fla_tune_n_bands[op    - FLA_TUNE_HEVD]
+                  [param - FLA_TUNE_N_ITER_MAX]
+                  [dt & FLA_DTYPE_INDEX_MASK] = 1;
+}
+
+
+dim_t FLA_Tune_get_for_size( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param, dim_t m )
+{
+  int   i_op, i_param, i_dt;
+  dim_t i;
+
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+  {
+    FLA_Check_error_code( FLA_Check_floating_datatype( dt ) );
+    FLA_Check_error_code( FLA_Check_valid_tune_op( op ) );
+    FLA_Check_error_code( FLA_Check_valid_tune_param( param ) );
+  }
+
+  // Constants are treated as double precision.
+  if ( dt == FLA_CONSTANT ) dt = FLA_DOUBLE;
+
+  i_op    = op    - FLA_TUNE_HEVD;
+  i_param = param - FLA_TUNE_N_ITER_MAX;
+  i_dt    = dt & FLA_DTYPE_INDEX_MASK;
+
+  // The bands are kept sorted by their switch points, the first of which
+  // is always zero.
+  for ( i = fla_tune_n_bands[i_op][i_param][i_dt] - 1; i > 0; --i )
+    if ( m >= fla_tune_m_min[i_op][i_param][i_dt][i] ) break;
+
+  return fla_tune_value[i_op][i_param][i_dt][i];
+}
+
+
+FLA_Error FLA_Tune_set_for_size( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param, dim_t m_min, dim_t value )
+{
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+  {
+    FLA_Check_error_code( FLA_Check_floating_datatype( dt ) );
+    FLA_Check_error_code( FLA_Check_valid_tune_op( op ) );
+    FLA_Check_error_code( FLA_Check_valid_tune_param( param ) );
+  }
+
+  if ( dt == FLA_CONSTANT ) dt = FLA_DOUBLE;
+
+  return FLA_Tune_set_index( op - FLA_TUNE_HEVD,
+                             param - FLA_TUNE_N_ITER_MAX,
+                             dt & FLA_DTYPE_INDEX_MASK,
+                             m_min, value );
+}
+
+
+static FLA_Error FLA_Tune_set_index( int op, int param, int dt, dim_t m_min, dim_t value )
+{
+  dim_t* n_bands = &fla_tune_n_bands[op][param][dt];
+  dim_t* m_band  = fla_tune_m_min[op][param][dt];
+  dim_t* v_band  = fla_tune_value[op][param][dt];
+  dim_t  i, j;
+
+  // Every parameter must be positive for the algorithms to make progress,
+  // except those that are zero when what they select is off.
+  if ( value < 1 && !FLA_Tune_may_be_zero( param ) ) value = 1;
+
+  for ( i = 0; i < *n_bands; ++i )
+    if ( m_band[i] >= m_min ) break;
+
+  if ( i < *n_bands && m_band[i] == m_min )
+  {
+    v_band[i] = value;
+  }
+  else if ( *n_bands < FLA_TUNE_MAX_BANDS )
+  {
+    // Insert a new switch point, keeping the bands sorted.
+    for ( j = *n_bands; j > i; --j )
+    {
+      m_band[j] = m_band[j-1];
+      v_band[j] = v_band[j-1];
+    }
+
+    m_band[i] = m_min;
+    v_band[i] = value;
+    *n_bands += 1;
+  }
+  else
+  {
+    // There is no room for another switch point.
+    return FLA_TUNE_TOO_MANY_SWITCH_POINTS;
+  }
+
+  return FLA_SUCCESS;
+}
+
+
+static FLA_Bool FLA_Tune_may_be_zero( int param )
+{
+  return ( param == FLA_TUNE_TSQR_RATIO - FLA_TUNE_N_ITER_MAX ||
+           param == FLA_TUNE_M_2S_VEC   - FLA_TUNE_N_ITER_MAX );
+}
+
+
+fla_blocksize_t* FLA_Tune_query_blocksizes( FLA_Tune_op op )
+{
+  // Package the blocksizes of op for all of the datatypes, as
+  // FLA_Query_blocksizes() does for the library defaults.
+  return FLA_Blocksize_create( FLA_Tune_get( FLA_FLOAT,          op, FLA_TUNE_B_ALG ),
+                               FLA_Tune_get( FLA_DOUBLE,         op, FLA_TUNE_B_ALG ),
+                               FLA_Tune_get( FLA_COMPLEX,        op, FLA_TUNE_B_ALG ),
+                               FLA_Tune_get( FLA_DOUBLE_COMPLEX, op, FLA_TUNE_B_ALG ) );
+}
+
+
+FLA_Error FLA_Tune_load( char* file_name )
+{
+  FILE*     fp;
+  char      line[256];
+  char      op_str[32];
+  char      param_str[32];
+  char      dt_char;
+  long      value;
+  long      m_min;
+  int       n_read;
+  int       op, param, dt;
+  FLA_Error r_val = FLA_SUCCESS;
+
+  fp = fopen( file_name, "r" );
+
+  if ( fp == NULL )
+    return FLA_FAILURE;
+
+  while ( fgets( line, sizeof( line ), fp ) != NULL )
+  {
+    if ( line[0] == '#' ) continue;
+
+    n_read = sscanf( line, "%31s %c %31s %ld %ld", op_str, &dt_char, param_str, &value, &m_min );
+
+    if ( n_read == 4 ) m_min = 0;
+    else if ( n_read != 5 ) continue;
+
+    for ( op = 0; op < FLA_TUNE_N_OPS; ++op )
+      if ( strcmp( op_str, fla_tune_op_name[op] ) == 0 ) break;
+
+    for ( param = 0; param < FLA_TUNE_N_PARAMS; ++param )
+      if ( strcmp( param_str, fla_tune_param_name[param] ) == 0 ) break;
+
+    for ( dt = 0; dt < 4; ++dt )
+      if ( dt_char == fla_tune_dt_name[dt] ) break;
+
+    if ( op == FLA_TUNE_N_OPS || param == FLA_TUNE_N_PARAMS || dt == 4 ||
+         value < ( FLA_Tune_may_be_zero( param ) ? 0 : 1 ) || m_min < 0 )
+      continue;
+
+    if ( FLA_Tune_set_index( op, param, dt, ( dim_t ) m_min, ( dim_t ) value ) != FLA_SUCCESS )
+      r_val = FLA_TUNE_TOO_MANY_SWITCH_POINTS;
+  }
+
+  fclose( fp );
+
+  return r_val;
+}
+
+
+FLA_Error FLA_Tune_save( char* file_name )
+{
+  FILE* fp;
+  int   op, param, dt;
+  dim_t i;
+
+  fp = fopen( file_name, "w" );
+
+  if ( fp == NULL )
+    return FLA_FAILURE;
+
+  fprintf( fp, "# libflame tuning parameters\n" );
+  fprintf( fp, "# <op> <dt> <param> <value> [<m_min>]\n" );
+
+  for ( op = 0; op < FLA_TUNE_N_OPS; ++op )
+    for ( dt = 0; dt < 4; ++dt )
+      for ( param = 0; param < FLA_TUNE_N_PARAMS; ++param )
+      {
+        fprintf( fp, "%-10s %c %-10s %ld\n",
+                 fla_tune_op_name[op], fla_tune_dt_name[dt],
+                 fla_tune_param_name[param],
+                 ( long ) fla_tune_value[op][param][dt][0] );
+
+        for ( i = 1; i < fla_tune_n_bands[op][param][dt]; ++i )
+          fprintf( fp, "%-10s %c %-10s %ld %ld\n",
+                   fla_tune_op_name[op], fla_tune_dt_name[dt],
+                   fla_tune_param_name[param],
+                   ( long ) fla_tune_value[op][param][dt][i],
+                   ( long ) fla_tune_m_min[op][param][dt][i] );
+      }
+
+  fclose( fp );
+
+  return FLA_SUCCESS;
+}
+
+
+char* FLA_Tune_default_file( void )
+{
+  char* env;
+
+  env = getenv( "FLA_TUNE_FILE" );
+
+  if ( env != NULL && env[0] != '\0' )
+    return env;
+
+  env = getenv( "HOME" );
+
+  if ( env == NULL || strlen( env ) + 16 > sizeof( fla_tune_file_name ) )
+    return NULL;
+
+  sprintf( fla_tune_file_name, "%s/.libflame_tune", env );
+
+  return fla_tune_file_name;
+}
+
@@ -0,0 +1,175 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// Candidate values tried by FLA_Tune_search(). QR_UT and Tridiag_UT block
+// by the width of T, which is a fraction of the blocksize of the other
+// factorizations, so they are searched over smaller blocksizes.
+#define FLA_TUNE_SEARCH_N_CAND 7
+
+static dim_t fla_tune_search_b[FLA_TUNE_SEARCH_N_CAND]        = { 32, 48, 64, 96, 128, 192, 256 };
+static dim_t fla_tune_search_b_t[FLA_TUNE_SEARCH_N_CAND]      = { 8, 16, 24, 32, 48, 64, 96 };
+static dim_t fla_tune_search_n_levels[FLA_TUNE_SEARCH_N_CAND] = { 1, 2, 3 };
+
+#define FLA_TUNE_SEARCH_TOL 0.03
+
+static double FLA_Tune_search_time( FLA_Tune_op op, int n_repeats, FLA_Obj A_save, FLA_Obj A, FLA_Obj p );
+
+// Time op on an m x m problem of datatype dt for each candidate value of
+// param, which is either FLA_TUNE_B_ALG or FLA_TUNE_N_LEVELS, and return
+// the chosen one. Blocksizes are timed with every level of blocking in use,
+// and numbers of levels with the current blocksize. The search leaves both
+// parameters of op for dt set for all problem sizes, so that a sweep over
+// sizes should record its switch points with FLA_Tune_set_for_size() only
+// once it is done.
+dim_t FLA_Tune_search( FLA_Datatype dt, FLA_Tune_op op, FLA_Tune_param param, dim_t m, int n_repeats )
+{
+  FLA_Obj A, A_save, p;
+  dim_t*  cand;
+  dim_t   n_cand_max, n_levels_max;
+  dim_t   v_best = 0;
+  double  dtime[FLA_TUNE_SEARCH_N_CAND];
+  double  dtime_best = 1.0e9;
+  int     i, n_cand;
+
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+  {
+    FLA_Check_error_code( FLA_Check_floating_datatype( dt ) );
+    FLA_Check_error_code( FLA_Check_valid_tune_op( op ) );
+    FLA_Check_error_code( FLA_Check_valid_tune_param( param ) );
+  }
+
+  if ( ( op != FLA_TUNE_CHOL  && op != FLA_TUNE_LU_PIV &&
+         op != FLA_TUNE_QR_UT && op != FLA_TUNE_TRIDIAG_UT &&
+         op != FLA_TUNE_TRINV ) ||
+       ( param != FLA_TUNE_B_ALG && param != FLA_TUNE_N_LEVELS ) ||
+       ( param == FLA_TUNE_N_LEVELS &&
+         op != FLA_TUNE_CHOL && op != FLA_TUNE_LU_PIV && op != FLA_TUNE_TRINV ) )
+    FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+
+  // Trinv has a single level of blocking.
+  n_levels_max = ( op == FLA_TUNE_TRINV ? 2 : 3 );
+
+  if ( param == FLA_TUNE_N_LEVELS )
+  {
+    cand       = fla_tune_search_n_levels;
+    n_cand_max = n_levels_max;
+  }
+  else
+  {
+    cand       = ( op == FLA_TUNE_QR_UT || op == FLA_TUNE_TRIDIAG_UT ? fla_tune_search_b_t
+                                                                     : fla_tune_search_b );
+    n_cand_max = FLA_TUNE_SEARCH_N_CAND;
+
+    if ( op == FLA_TUNE_CHOL || op == FLA_TUNE_LU_PIV || op == FLA_TUNE_TRINV )
+      FLA_Tune_set( dt, op, FLA_TUNE_N_LEVELS, n_levels_max );
+  }
+
+  FLA_Obj_create( dt,      m, m, 0, 0, &A );
+  FLA_Obj_create( dt,      m, m, 0, 0, &A_save );
+  FLA_Obj_create( FLA_INT, m, 1, 0, 0, &p );
+
+  if ( op == FLA_TUNE_CHOL )
+    FLA_Random_spd_matrix( FLA_LOWER_TRIANGULAR, A_save );
+  else if ( op == FLA_TUNE_TRIDIAG_UT )
+    FLA_Random_herm_matrix( FLA_LOWER_TRIANGULAR, A_save );
+  else if ( op == FLA_TUNE_TRINV )
+    FLA_Random_tri_matrix( FLA_LOWER_TRIANGULAR, FLA_NONUNIT_DIAG, A_save );
+  else
+    FLA_Random_matrix( A_save );
+
+  for ( i = 0; i < n_cand_max; ++i )
+  {
+    if ( param == FLA_TUNE_B_ALG && cand[i] > m ) break;
+
+    FLA_Tune_set( dt, op, param, cand[i] );
+
+    dtime[i]   = FLA_Tune_search_time( op, n_repeats, A_save, A, p );
+    dtime_best = min( dtime_best, dtime[i] );
+  }
+
+  n_cand = i;
+
+  // Choose the smallest value that comes within the tolerance of the
+  // fastest, which keeps timing noise from scattering switch points.
+  for ( i = 0; i < n_cand; ++i )
+  {
+    if ( dtime[i] <= ( 1.0 + FLA_TUNE_SEARCH_TOL ) * dtime_best )
+    {
+      v_best = cand[i];
+      break;
+    }
+  }
+
+  // Problems smaller than every candidate blocksize are blocked by the
+  // smallest.
+  if ( v_best == 0 ) v_best = cand[0];
+
+  FLA_Tune_set( dt, op, param, v_best );
+
+  FLA_Obj_free( &A );
+  FLA_Obj_free( &A_save );
+  FLA_Obj_free( &p );
+
+  return v_best;
+}
+
+
+static double FLA_Tune_search_time( FLA_Tune_op op, int n_repeats, FLA_Obj A_save, FLA_Obj A, FLA_Obj p )
+{
+  FLA_Obj T;
+  double  dtime = 1.0e9;
+  double  dtime_rep;
+  int     irep;
+
+  for ( irep = 0; irep < n_repeats; ++irep )
+  {
+    FLA_Copy( A_save, A );
+
+    // T depends on the blocksize being tried, so it is created anew before
+    // every timing.
+    if      ( op == FLA_TUNE_QR_UT )      FLA_QR_UT_create_T( A, &T );
+    else if ( op == FLA_TUNE_TRIDIAG_UT ) FLA_Tridiag_UT_create_T( A, &T );
+
+    dtime_rep = FLA_Clock();
+
+    switch ( op )
+    {
+      case FLA_TUNE_CHOL:
+        FLA_Chol( FLA_LOWER_TRIANGULAR, A );
+        break;
+
+      case FLA_TUNE_LU_PIV:
+        FLA_LU_piv( A, p );
+        break;
+
+      case FLA_TUNE_QR_UT:
+        FLA_QR_UT( A, T );
+        break;
+
+      case FLA_TUNE_TRIDIAG_UT:
+        FLA_Tridiag_UT( FLA_LOWER_TRIANGULAR, A, T );
+        break;
+
+      case FLA_TUNE_TRINV:
+        FLA_Trinv( FLA_LOWER_TRIANGULAR, FLA_NONUNIT_DIAG, A );
+        break;
+    }
+
+    dtime_rep = FLA_Clock() - dtime_rep;
+    dtime     = min( dtime, dtime_rep );
+
+    if ( op == FLA_TUNE_QR_UT || op == FLA_TUNE_TRIDIAG_UT )
+      FLA_Obj_free( &T );
+  }
+
+  return dtime;
+}
@@ -0,0 +1,255 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// Time the factorization of a batch of small matrices stored one after
+// another in one buffer, first by calling FLA_Chol(), FLA_LU_piv() and
+// FLA_QR_UT() on each of them and then with the strided batched routines,
+// and report both rates in matrices per second, the speedup and the
+// largest difference between the two sets of factors.
+
+#define N_OPS 3
+
+enum { OP_CHOL, OP_LU_PIV, OP_QR_UT };
+
+void time_batched( int op, int batched, int n_repeats, int n_batch, int n,
+                   FLA_Obj A_save, FLA_Obj A, FLA_Obj* A_i,
+                   FLA_Obj p, FLA_Obj* p_i, FLA_Obj T, FLA_Obj* T_i,
+                   double* dtime );
+
+
+int main(int argc, char *argv[])
+{
+  int
+    n_first, n_last, n_inc, n,
+    n_repeats, n_batch,
+    op, i, k, dt;
+
+  double
+    dtime_loop,
+    dtime_batched,
+    diff;
+
+  char
+    dt_str[8];
+
+  char*
+    op_names[N_OPS] = { "chol", "lu_piv", "qr_ut" };
+
+  FLA_Datatype
+    datatype;
+
+  FLA_Obj
+    A_save, A, A_loop, p, p_loop, T, T_loop, alpha, max_abs;
+
+  FLA_Obj*
+    A_i;
+  FLA_Obj*
+    p_i;
+  FLA_Obj*
+    T_i;
+
+
+  FLA_Init();
+
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c number of matrices in the batch:", '%' );
+  scanf( "%d", &n_batch );
+  fprintf( stdout, "%c %d\n", '%', n_batch );
+
+  fprintf( stdout, "%c enter matrix size first, last, inc:", '%' );
+  scanf( "%d%d%d", &n_first, &n_last, &n_inc );
+  fprintf( stdout, "%c %d %d %d\n", '%', n_first, n_last, n_inc );
+
+  fprintf( stdout, "%c enter datatypes (some of sdcz):", '%' );
+  scanf( "%7s", dt_str );
+  fprintf( stdout, "%c %s\n", '%', dt_str );
+
+
+  fprintf( stdout, "\nclear all;\n\n" );
+
+
+  A_i = ( FLA_Obj* ) FLA_malloc( n_batch * sizeof( FLA_Obj ) );
+  p_i = ( FLA_Obj* ) FLA_malloc( n_batch * sizeof( FLA_Obj ) );
+  T_i = ( FLA_Obj* ) FLA_malloc( n_batch * sizeof( FLA_Obj ) );
+
+  for ( dt = 0; dt_str[dt] != '\0'; ++dt )
+  {
+    if      ( dt_str[dt] == 's' ) datatype = FLA_FLOAT;
+    else if ( dt_str[dt] == 'd' ) datatype = FLA_DOUBLE;
+    else if ( dt_str[dt] == 'c' ) datatype = FLA_COMPLEX;
+    else if ( dt_str[dt] == 'z' ) datatype = FLA_DOUBLE_COMPLEX;
+    else continue;
+
+    for ( n = n_first, i = 1; n <= n_last; n += n_inc, i += 1 )
+    {
+      // The batch is stored as one n x ( n_batch n ) matrix, so matrix k
+      // begins k n^2 elements into the buffer.
+      FLA_Obj_create( datatype, n, n_batch * n, 1, n, &A_save );
+      FLA_Obj_create( datatype, n, n_batch * n, 1, n, &A );
+      FLA_Obj_create( datatype, n, n_batch * n, 1, n, &A_loop );
+      FLA_Obj_create( datatype, n, n_batch * n, 1, n, &T );
+      FLA_Obj_create( datatype, n, n_batch * n, 1, n, &T_loop );
+      FLA_Obj_create( FLA_INT, n, n_batch, 1, n, &p );
+      FLA_Obj_create( FLA_INT, n, n_batch, 1, n, &p_loop );
+      FLA_Obj_create( FLA_Obj_datatype_proj_to_real( A ), 1, 1, 0, 0, &max_abs );
+      FLA_Obj_create( datatype, 1, 1, 0, 0, &alpha );
+
+      FLA_Random_matrix( A_save );
+      FLA_Set( FLA_ZERO, T );
+      FLA_Set( FLA_ZERO, T_loop );
+
+      // Shift the diagonals by n so that every matrix is positive definite.
+      FLA_Set( FLA_ZERO, alpha );
+      if      ( datatype == FLA_FLOAT          ) *FLA_FLOAT_PTR( alpha )                = ( float  ) n;
+      else if ( datatype == FLA_DOUBLE         ) *FLA_DOUBLE_PTR( alpha )               = ( double ) n;
+      else if ( datatype == FLA_COMPLEX        ) FLA_COMPLEX_PTR( alpha )->real         = ( float  ) n;
+      else if ( datatype == FLA_DOUBLE_COMPLEX ) FLA_DOUBLE_COMPLEX_PTR( alpha )->real  = ( double ) n;
+
+      for ( k = 0; k < n_batch; ++k )
+      {
+        FLA_Obj A_k;
+
+        FLA_Obj_create_without_buffer( datatype, n, n, &A_k );
+        FLA_Obj_attach_buffer( ( char* ) FLA_Obj_buffer_at_view( A_save ) +
+                               ( size_t ) k * n * n * FLA_Obj_datatype_size( datatype ),
+                               1, n, &A_k );
+        FLA_Shift_diag( FLA_NO_CONJUGATE, alpha, A_k );
+        FLA_Obj_free_without_buffer( &A_k );
+      }
+
+      for ( op = 0; op < N_OPS; ++op )
+      {
+        time_batched( op, FALSE, n_repeats, n_batch, n,
+                      A_save, A_loop, A_i, p_loop, p_i, T_loop, T_i, &dtime_loop );
+
+        time_batched( op, TRUE, n_repeats, n_batch, n,
+                      A_save, A, A_i, p, p_i, T, T_i, &dtime_batched );
+
+        FLA_Axpy( FLA_MINUS_ONE, A_loop, A );
+        FLA_Max_abs_value( A, max_abs );
+        FLA_Obj_extract_real_scalar( max_abs, &diff );
+
+        fprintf( stdout, "data_%s_%c( %d, 1:5 ) = [ %d %10.3le %10.3le %6.2lf %6.2le ];\n",
+                 op_names[op], dt_str[dt], i, n,
+                 n_batch / dtime_loop, n_batch / dtime_batched,
+                 dtime_loop / dtime_batched, diff );
+        fflush( stdout );
+      }
+
+      fprintf( stdout, "\n" );
+
+      FLA_Obj_free( &A_save );
+      FLA_Obj_free( &A );
+      FLA_Obj_free( &A_loop );
+      FLA_Obj_free( &T );
+      FLA_Obj_free( &T_loop );
+      FLA_Obj_free( &p );
+      FLA_Obj_free( &p_loop );
+      FLA_Obj_free( &max_abs );
+      FLA_Obj_free( &alpha );
+    }
+  }
+
+  FLA_free( A_i );
+  FLA_free( p_i );
+  FLA_free( T_i );
+
+  FLA_Finalize();
+
+  return 0;
+}
+
+
+void time_batched( int op, int batched, int n_repeats, int n_batch, int n,
+                   FLA_Obj A_save, FLA_Obj A, FLA_Obj* A_i,
+                   FLA_Obj p, FLA_Obj* p_i, FLA_Obj T, FLA_Obj* T_i,
+                   double* dtime )
+{
+  FLA_Datatype datatype   = FLA_Obj_datatype( A );
+  size_t       elem_size  = FLA_Obj_datatype_size( datatype );
+  char*        buff_A     = ( char* ) FLA_Obj_buffer_at_view( A );
+  char*        buff_T     = ( char* ) FLA_Obj_buffer_at_view( T );
+  int*         buff_p     = ( int*  ) FLA_Obj_buffer_at_view( p );
+  double       dtime_save = 1.0e9;
+  int          irep, k;
+
+  for ( k = 0; k < n_batch; ++k )
+  {
+    FLA_Obj_create_without_buffer( datatype, n, n, &A_i[k] );
+    FLA_Obj_create_without_buffer( datatype, n, n, &T_i[k] );
+    FLA_Obj_create_without_buffer( FLA_INT,  n, 1, &p_i[k] );
+    FLA_Obj_attach_buffer( buff_A + ( size_t ) k * n * n * elem_size, 1, n, &A_i[k] );
+    FLA_Obj_attach_buffer( buff_T + ( size_t ) k * n * n * elem_size, 1, n, &T_i[k] );
+    FLA_Obj_attach_buffer( buff_p + ( size_t ) k * n, 1, n, &p_i[k] );
+  }
+
+  for ( irep = 0; irep < n_repeats; irep++ )
+  {
+    FLA_Copy_external( A_save, A );
+
+    *dtime = FLA_Clock();
+
+    if ( batched )
+    {
+      switch ( op )
+      {
+        case OP_CHOL:
+          FLA_Chol_batched_strided( FLA_LOWER_TRIANGULAR, datatype, n_batch,
+                                    n, buff_A, n, n * n, NULL );
+          break;
+        case OP_LU_PIV:
+          FLA_LU_piv_batched_strided( datatype, n_batch, n, n, buff_A, n, n * n,
+                                      buff_p, n, NULL );
+          break;
+        case OP_QR_UT:
+          FLA_QR_UT_batched_strided( datatype, n_batch, n, n, buff_A, n, n * n,
+                                     buff_T, n, n * n );
+          break;
+      }
+    }
+    else
+    {
+      for ( k = 0; k < n_batch; ++k )
+      {
+        switch ( op )
+        {
+          case OP_CHOL:
+            FLA_Chol( FLA_LOWER_TRIANGULAR, A_i[k] );
+            break;
+          case OP_LU_PIV:
+            FLA_LU_piv( A_i[k], p_i[k] );
+            break;
+          case OP_QR_UT:
+            FLA_QR_UT( A_i[k], T_i[k] );
+            break;
+        }
+      }
+    }
+
+    *dtime = FLA_Clock() - *dtime;
+    dtime_save = min( *dtime, dtime_save );
+  }
+
+  for ( k = 0; k < n_batch; ++k )
+  {
+    FLA_Obj_free_without_buffer( &A_i[k] );
+    FLA_Obj_free_without_buffer( &T_i[k] );
+    FLA_Obj_free_without_buffer( &p_i[k] );
+  }
+
+  *dtime = dtime_save;
+}
+
@@ -0,0 +1,131 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// Time the blocked factorizations across blocksizes, numbers of levels of
+// blocking and problem sizes on this machine, and save the fastest choices,
+// along with the problem sizes at which they change, to the tuning file
+// that FLA_Init() loads.
+
+#define N_OPS 5
+#define N_P_MAX 64
+
+int main(int argc, char *argv[])
+{
+  int 
+    p_first, p_last, p_inc, p,
+    n_repeats, n_p,
+    op, i, dt;
+
+  dim_t
+    b_best[N_P_MAX],
+    n_levels_best[N_P_MAX];
+
+  char
+    dt_str[8],
+    file_name[1024];
+
+  FLA_Tune_op  ops[N_OPS]      = { FLA_TUNE_CHOL, FLA_TUNE_LU_PIV, FLA_TUNE_TRINV,
+                                   FLA_TUNE_QR_UT, FLA_TUNE_TRIDIAG_UT };
+  char*        op_names[N_OPS] = { "chol", "lu_piv", "trinv", "qr_ut", "tridiag_ut" };
+  FLA_Bool     has_levels;
+  FLA_Datatype datatype;
+  
+
+  FLA_Init();
+
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c enter problem size first, last, inc:", '%' );
+  scanf( "%d%d%d", &p_first, &p_last, &p_inc );
+  fprintf( stdout, "%c %d %d %d\n", '%', p_first, p_last, p_inc );
+
+  fprintf( stdout, "%c enter datatypes (some of sdcz):", '%' );
+  scanf( "%7s", dt_str );
+  fprintf( stdout, "%c %s\n", '%', dt_str );
+
+  fprintf( stdout, "%c enter tuning file (- for the default):", '%' );
+  scanf( "%1023s", file_name );
+  if ( strcmp( file_name, "-" ) == 0 && FLA_Tune_default_file() != NULL )
+    strcpy( file_name, FLA_Tune_default_file() );
+  fprintf( stdout, "%c %s\n", '%', file_name );
+
+
+  fprintf( stdout, "\n" );
+
+
+  for ( dt = 0; dt_str[dt] != '\0'; ++dt )
+  {
+    if      ( dt_str[dt] == 's' ) datatype = FLA_FLOAT;
+    else if ( dt_str[dt] == 'd' ) datatype = FLA_DOUBLE;
+    else if ( dt_str[dt] == 'c' ) datatype = FLA_COMPLEX;
+    else if ( dt_str[dt] == 'z' ) datatype = FLA_DOUBLE_COMPLEX;
+    else continue;
+
+    for ( op = 0; op < N_OPS; ++op )
+    {
+      has_levels = ( ops[op] == FLA_TUNE_CHOL || ops[op] == FLA_TUNE_LU_PIV ||
+                     ops[op] == FLA_TUNE_TRINV );
+      n_p = 0;
+
+      for ( p = p_first, i = 1; p <= p_last && n_p < N_P_MAX; p += p_inc, i += 1 )
+      {
+        b_best[n_p]        = FLA_Tune_search( datatype, ops[op], FLA_TUNE_B_ALG, p, n_repeats );
+        n_levels_best[n_p] = ( has_levels ? FLA_Tune_search( datatype, ops[op], FLA_TUNE_N_LEVELS, p, n_repeats )
+                                          : 1 );
+
+        fprintf( stdout, "data_%s_%c( %d, 1:3 ) = [ %d %4d %d ];\n",
+                 op_names[op], dt_str[dt], i, p,
+                 ( int ) b_best[n_p], ( int ) n_levels_best[n_p] );
+        fflush( stdout );
+
+        n_p += 1;
+      }
+
+      if ( n_p == 0 ) continue;
+
+      // Record the choices found for the smallest problem for all sizes,
+      // then a switch point wherever the fastest choice changes.
+      FLA_Tune_set( datatype, ops[op], FLA_TUNE_B_ALG, b_best[0] );
+
+      for ( i = 1; i < n_p; ++i )
+        if ( b_best[i] != b_best[i-1] )
+          if ( FLA_Tune_set_for_size( datatype, ops[op], FLA_TUNE_B_ALG,
+                                      p_first + i * p_inc, b_best[i] ) != FLA_SUCCESS )
+            fprintf( stdout, "%c too many switch points; b_alg for %d not kept\n",
+                     '%', p_first + i * p_inc );
+
+      if ( has_levels )
+      {
+        FLA_Tune_set( datatype, ops[op], FLA_TUNE_N_LEVELS, n_levels_best[0] );
+
+        for ( i = 1; i < n_p; ++i )
+          if ( n_levels_best[i] != n_levels_best[i-1] )
+            if ( FLA_Tune_set_for_size( datatype, ops[op], FLA_TUNE_N_LEVELS,
+                                        p_first + i * p_inc, n_levels_best[i] ) != FLA_SUCCESS )
+              fprintf( stdout, "%c too many switch points; n_levels for %d not kept\n",
+                       '%', p_first + i * p_inc );
+      }
+
+      fprintf( stdout, "\n" );
+    }
+  }
+
+  if ( FLA_Tune_save( file_name ) != FLA_SUCCESS )
+    fprintf( stdout, "%c could not write %s\n", '%', file_name );
+
+  FLA_Finalize();
+
+  return 0;
+}
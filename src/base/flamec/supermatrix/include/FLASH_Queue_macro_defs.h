@@ -29,6 +29,58 @@
 #define FLASH_QUEUE_AFFINITY_1D_COLUMN_BLOCK_CYCLIC  3
 #define FLASH_QUEUE_AFFINITY_ROUND_ROBIN             4
 
+// FLASH_Deque
+#define FLASH_DEQUE_MIN_SIZE                         64
+
+// Task kinds
+#define FLASH_QUEUE_MAX_TASK_KINDS                   256
+#define FLASH_QUEUE_TASK_KIND_HASH( func ) \
+        ( ( int ) ( ( ( ( size_t ) ( func ) >> 4 ) * 2654435761UL ) & \
+                    ( FLASH_QUEUE_MAX_TASK_KINDS - 1 ) ) )
+
+// Task arena
+#define FLASH_QUEUE_ARENA_SLAB_SIZE                  ( 1024 * 1024 )
+#define FLASH_QUEUE_ARENA_ALIGN                      16
+#define FLASH_QUEUE_ARENA_ROUND( size ) \
+        ( ( ( size ) + FLASH_QUEUE_ARENA_ALIGN - 1 ) & \
+          ~( ( size_t ) FLASH_QUEUE_ARENA_ALIGN - 1 ) )
+
+// Locality
+#define FLASH_QUEUE_LOCALITY_LEVELS                  2
+#define FLASH_QUEUE_LOCALITY_WINDOW                  8
+#define FLASH_QUEUE_MAX_DISTANCE                     3
+#define FLASH_QUEUE_LOCALITY_STAMP_BITS              40
+#define FLASH_QUEUE_LOCALITY_STAMP_MASK \
+        ( ( 1UL << FLASH_QUEUE_LOCALITY_STAMP_BITS ) - 1 )
+
+// Tracing
+#define FLASH_QUEUE_TRACE_SIZE                       65536
+
+// Atomic operations needed by the lock-free scheduling structures. These
+// are only available with compilers that provide the __atomic builtins;
+// otherwise the lock-based waiting queues are always used.
+#if defined(__GNUC__) || defined(__clang__)
+#define FLASH_QUEUE_ENABLE_ATOMICS
+
+#define FLASH_ATOMIC_LOAD( ptr ) \
+        __atomic_load_n( ptr, __ATOMIC_ACQUIRE )
+#define FLASH_ATOMIC_LOAD_RELAXED( ptr ) \
+        __atomic_load_n( ptr, __ATOMIC_RELAXED )
+#define FLASH_ATOMIC_STORE( ptr, val ) \
+        __atomic_store_n( ptr, val, __ATOMIC_RELEASE )
+#define FLASH_ATOMIC_STORE_RELAXED( ptr, val ) \
+        __atomic_store_n( ptr, val, __ATOMIC_RELAXED )
+#define FLASH_ATOMIC_CAS( ptr, expected, desired ) \
+        __atomic_compare_exchange_n( ptr, expected, desired, FALSE, \
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED )
+#define FLASH_ATOMIC_FETCH_ADD( ptr, val ) \
+        __atomic_fetch_add( ptr, val, __ATOMIC_ACQ_REL )
+#define FLASH_ATOMIC_FENCE() \
+        __atomic_thread_fence( __ATOMIC_SEQ_CST )
+#define FLASH_ATOMIC_FENCE_RELEASE() \
+        __atomic_thread_fence( __ATOMIC_RELEASE )
+#endif
+
 /*
 Reminder to create a macro to enqueue when SuperMatrix is configured, and
 also to create a macro for when it is not below to return an error code.
@@ -111,6 +163,25 @@ also to create a macro for when it is not below to return an error code.
                           0, 0, 0, 1, \
                           A )
 
+#define ENQUEUE_FLASH_LDLT_piv_panel( A, p, L, W, s, offset, cntl ) \
+        FLASH_Queue_push( (void *) FLA_LDLT_piv_panel_task, \
+                          (void *) cntl, \
+                          "LDLT ", \
+                          FALSE, \
+                          FALSE, \
+                          1, 0, 0, 5, \
+                          offset, \
+                          A, p, L, W, s )
+
+#define ENQUEUE_FLASH_LDLT_piv_update( L, W, A, cntl ) \
+        FLASH_Queue_push( (void *) FLA_LDLT_piv_update_task, \
+                          (void *) cntl, \
+                          "LDLTu", \
+                          FALSE, \
+                          FALSE, \
+                          0, 0, 2, 1, \
+                          L, W, A )
+
 #define ENQUEUE_FLASH_Trinv( uplo, diag, A, cntl ) \
         FLASH_Queue_push( (void *) FLA_Trinv_task, \
                           (void *) cntl, \
@@ -522,6 +593,12 @@ also to create a macro for when it is not below to return an error code.
 #define ENQUEUE_FLASH_LU_nopiv( A, cntl ) \
         FLA_Check_error_code( FLA_SUPERMATRIX_NOT_ENABLED )
 
+#define ENQUEUE_FLASH_LDLT_piv_panel( A, p, L, W, s, offset, cntl ) \
+        FLA_Check_error_code( FLA_SUPERMATRIX_NOT_ENABLED )
+
+#define ENQUEUE_FLASH_LDLT_piv_update( L, W, A, cntl ) \
+        FLA_Check_error_code( FLA_SUPERMATRIX_NOT_ENABLED )
+
 #define ENQUEUE_FLASH_Trinv( uplo, diag, A, cntl ) \
         FLA_Check_error_code( FLA_SUPERMATRIX_NOT_ENABLED )
 
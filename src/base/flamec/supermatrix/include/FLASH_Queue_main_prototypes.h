@@ -14,6 +14,9 @@
 
 void           FLASH_Queue_begin( void );
 void           FLASH_Queue_end( void );
+FLASH_Queue_handle FLASH_Queue_end_async( void );
+FLA_Error      FLASH_Queue_wait( FLASH_Queue_handle handle );
+void           FLASH_Queue_flush( void );
 unsigned int   FLASH_Queue_stack_depth( void );
 
 FLA_Error      FLASH_Queue_enable( void );
@@ -40,17 +43,42 @@ void           FLASH_Queue_set_caching( FLA_Bool caching );
 FLA_Bool       FLASH_Queue_get_caching( void );
 void           FLASH_Queue_set_work_stealing( FLA_Bool work_stealing );
 FLA_Bool       FLASH_Queue_get_work_stealing( void );
+void           FLASH_Queue_set_deques( FLA_Bool deques );
+FLA_Bool       FLASH_Queue_get_deques( void );
+void           FLASH_Queue_set_numa( FLA_Bool numa );
+FLA_Bool       FLASH_Queue_get_numa( void );
+void           FLASH_Queue_set_locality( FLA_Bool locality );
+FLA_Bool       FLASH_Queue_get_locality( void );
+void           FLASH_Queue_set_tracing( FLA_Bool tracing );
+FLA_Bool       FLASH_Queue_get_tracing( void );
+FLA_Error      FLASH_Queue_write_trace( char* file_name );
 void           FLASH_Queue_set_data_affinity( FLASH_Data_aff data_affinity );
 FLASH_Data_aff FLASH_Queue_get_data_affinity( void );
 double         FLASH_Queue_get_total_time( void );
 double         FLASH_Queue_get_parallel_time( void );
+double         FLASH_Queue_get_idle_time( int thread );
+void           FLASH_Queue_get_numa_accesses( dim_t* local, dim_t* remote );
+void           FLASH_Queue_set_spin_budget( int spin_budget );
+int            FLASH_Queue_get_spin_budget( void );
+void           FLASH_Queue_set_task_arena( FLA_Bool task_arena );
+FLA_Bool       FLASH_Queue_get_task_arena( void );
+FLA_Error      FLASH_Queue_register_task( void* func, FLASH_Task_invoker invoker );
+FLASH_Task_invoker FLASH_Queue_get_task_invoker( void* func );
+FLA_Error      FLASH_Queue_set_task_cost( void* func, FLASH_Task_cost cost );
 
 void           FLASH_Queue_exec( void );
 
+FLA_Error      FLASH_Queue_capture_begin( int n_objs, FLA_Obj* objs );
+FLA_Error      FLASH_Queue_capture_end( FLASH_Graph* graph );
+FLA_Error      FLASH_Graph_replay( FLASH_Graph graph, FLA_Obj* objs );
+void           FLASH_Graph_free( FLASH_Graph* graph );
+
 
 // --- helper functions -------------------------------------------------------
 
 void           FLASH_Queue_set_parallel_time( double dtime );
+void           FLASH_Queue_set_idle_time( int n_threads, double* idle_time );
+void           FLASH_Queue_set_numa_accesses( dim_t local, dim_t remote );
 void           FLASH_Queue_set_block_size( dim_t size );
 dim_t          FLASH_Queue_get_block_size( void );
 void           FLASH_Queue_set_cache_size( dim_t size );
@@ -62,6 +90,10 @@ int            FLASH_Queue_get_cores_per_cache( void );
 void           FLASH_Queue_set_cores_per_queue( int cores );
 int            FLASH_Queue_get_cores_per_queue( void );
 void           FLASH_Queue_reset( void );
+void           FLASH_Queue_set_capture( FLA_Bool capture );
+FLA_Bool       FLASH_Queue_get_capture( void );
+void*          FLASH_Queue_arena_alloc( size_t size );
+void           FLASH_Queue_arena_release( FLA_Bool all );
 FLASH_Task*    FLASH_Queue_get_head_task( void );
 FLASH_Task*    FLASH_Queue_get_tail_task( void );
 void           FLASH_Queue_push( void *func, void *cntl, char *name,
@@ -70,23 +102,64 @@ void           FLASH_Queue_push( void *func, void *cntl, char *name,
                                  int n_input_args, int n_output_args, ... );
 void           FLASH_Queue_push_input( FLA_Obj obj, FLASH_Task* t );
 void           FLASH_Queue_push_output( FLA_Obj obj, FLASH_Task* t );
+void           FLASH_Queue_push_task( FLASH_Task* t );
 FLASH_Task*    FLASH_Task_alloc( void *func, void *cntl, char *name,
                                  FLA_Bool enabled_gpu, FLA_Bool enabled_hip,
                                  int n_int_args, int n_fla_args,
                                  int n_input_args, int n_output_args );
 void           FLASH_Task_free( FLASH_Task *t );
+void           FLASH_Task_free_memory( FLASH_Task *t );
+FLASH_Dep*     FLASH_Dep_alloc( void );
+void           FLASH_Dep_free( FLASH_Dep *d );
 void           FLASH_Queue_exec_task( FLASH_Task *t );
+void           FLASH_Queue_init_task_kinds( void );
+void*          FLASH_Queue_find_task_kind( void* func );
+double         FLASH_Task_cost_estimate( FLASH_Task *t );
+int            FLASH_Graph_count_nodes( FLA_Obj H );
+void           FLASH_Graph_collect_nodes( FLA_Obj H, void* node, int* k );
+int            FLASH_Graph_compare_nodes( const void* a, const void* b );
 void           FLASH_Queue_verbose_output( void );
 
 void           FLASH_Queue_init_tasks( void *arg );
 void           FLASH_Queue_wait_enqueue( FLASH_Task *t, void *arg );
 FLASH_Task*    FLASH_Queue_wait_dequeue( int queue, int cache, void *arg );
 FLASH_Task*    FLASH_Queue_wait_dequeue_block( int queue, int cache, void *arg );
+void           FLASH_Queue_heap_insert( FLASH_Task *t, void *arg );
+FLASH_Task*    FLASH_Queue_heap_remove( int queue, int i, void *arg );
+int            FLASH_Queue_heap_warmest( int queue, FLA_Bool top, void *arg );
+FLASH_Task*    FLASH_Queue_wait_warmest( int queue, FLA_Bool head, void *arg );
 void           FLASH_Queue_update_cache( FLASH_Task *t, void *arg );
 void           FLASH_Queue_update_cache_block( FLA_Obj obj, int cache, FLA_Bool output, void *arg );
 void           FLASH_Queue_prefetch( int cache, void *arg );
 void           FLASH_Queue_prefetch_block( FLA_Obj obj );
 FLASH_Task*    FLASH_Queue_work_stealing( int queue, void *arg );
+FLASH_Task*    FLASH_Queue_work_stealing_deque( int thread, void *arg );
+int            FLASH_Queue_thread_distance( int a, int b, void *arg );
+FLASH_Deque_buffer* FLASH_Deque_buffer_alloc( long size );
+void           FLASH_Deque_init( FLASH_Deque* dq, long size );
+void           FLASH_Deque_finalize( FLASH_Deque* dq );
+void           FLASH_Deque_push( FLASH_Deque* dq, FLASH_Task* t );
+FLASH_Task*    FLASH_Deque_pop( FLASH_Deque* dq );
+FLASH_Task*    FLASH_Deque_steal( FLASH_Deque* dq );
+long           FLASH_Deque_size( FLASH_Deque* dq );
+void           FLASH_Queue_numa_init( void );
+void           FLASH_Queue_numa_finalize( void );
+int            FLASH_Queue_numa_thread_node( int thread );
+void           FLASH_Queue_numa_pin_thread( int thread );
+void           FLASH_Queue_numa_unpin_thread( int thread );
+void           FLASH_Queue_numa_place_block( FLA_Obj obj, int node );
+void           FLASH_Queue_numa_place_task( FLASH_Task *t, void *arg );
+void           FLASH_Queue_numa_count_task( FLASH_Task *t, int thread, void *arg );
+void           FLASH_Queue_locality_init( void );
+void           FLASH_Queue_locality_finalize( void );
+int            FLASH_Queue_locality_cpu( void );
+FLA_Bool       FLASH_Queue_locality_shared( int cpu_a, int cpu_b, int level );
+int            FLASH_Queue_locality_visit( FLASH_Task *t, int cpu, FLA_Bool touch );
+void           FLASH_Queue_trace_init( int n_threads );
+void           FLASH_Queue_trace_finalize( void );
+void           FLASH_Queue_trace_reset( void );
+void           FLASH_Queue_trace_task( int thread, FLASH_Task *t, FLA_Bool stolen, double start, double end );
+void           FLASH_Queue_trace_idle( int thread, double start, double end );
 #ifdef FLA_ENABLE_GPU
 void           FLASH_Queue_create_gpu( int thread, void *arg );
 void           FLASH_Queue_destroy_gpu( int thread, void *arg );
@@ -114,7 +187,14 @@ void           FLASH_Queue_flush_block_hip( FLA_Obj obj, int thread, void *arg )
 void           FLASH_Queue_flush_hip( int thread, void *arg );
 #endif
 void           FLASH_Queue_exec_parallel( void *arg );
+void           FLASH_Queue_pool_init( int n_threads );
+void           FLASH_Queue_pool_finalize( void );
+void           FLASH_Queue_pool_run( int n_threads, void* (*func)( void* ), void *arg );
+void           FLASH_Queue_pool_run_all( int n_threads, void* (*func)( void* ), void *arg );
+FLA_Bool       FLASH_Queue_pool_in_job( void );
 void*          FLASH_Queue_exec_parallel_function( void *arg );
+void           FLASH_Queue_wait_idle( int n_idle, int epoch, void *arg );
+void           FLASH_Queue_wake_idle( FLA_Bool all, void *arg );
 FLASH_Task*    FLASH_Task_update_dependencies( FLASH_Task *t, void *arg );
 FLASH_Task*    FLASH_Task_update_binding( FLASH_Task *t, FLASH_Task *r, void *arg );
 void           FLASH_Task_free_parallel( FLASH_Task *t, void *arg );
@@ -24,6 +24,17 @@
 
 #ifdef FLA_ENABLE_SUPERMATRIX
 
+// A slab of the task arena. The memory handed out by the arena follows the
+// header of the slab.
+typedef struct FLASH_Slab_s FLASH_Slab;
+
+struct FLASH_Slab_s
+{
+   FLASH_Slab* next;
+   size_t      size;
+   size_t      used;
+};
+
 FLASH_Queue           _tq;
 
 static FLA_Bool       flash_queue_initialized     = FALSE;
@@ -35,6 +46,10 @@ static FLASH_Verbose  flash_queue_verbose         = FLASH_QUEUE_VERBOSE_NONE;
 static FLA_Bool       flash_queue_sorting         = FALSE;
 static FLA_Bool       flash_queue_caching         = FALSE;
 static FLA_Bool       flash_queue_work_stealing   = FALSE;
+static FLA_Bool       flash_queue_deques          = FALSE;
+static FLA_Bool       flash_queue_numa            = FALSE;
+static FLA_Bool       flash_queue_locality        = FALSE;
+static FLA_Bool       flash_queue_tracing         = FALSE;
 static FLASH_Data_aff flash_queue_data_affinity   = FLASH_QUEUE_AFFINITY_NONE;
 
 static double         flash_queue_total_time      = 0.0;
@@ -47,10 +62,25 @@ static dim_t          flash_queue_cache_line_size = 64;
 static int            flash_queue_cores_per_cache = 1;
 static int            flash_queue_cores_per_queue = 0;
 
+static int            flash_queue_spin_budget     = 1000;
+static int            flash_queue_n_idle_times    = 0;
+static double*        flash_queue_idle_time       = NULL;
+
+static dim_t          flash_queue_numa_local      = 0;
+static dim_t          flash_queue_numa_remote     = 0;
+
+static FLA_Bool       flash_queue_capture         = FALSE;
+
+static FLA_Bool       flash_queue_task_arena      = TRUE;
+static FLA_Bool       flash_queue_arena_active    = FALSE;
+static FLASH_Slab*    flash_queue_slab_head       = NULL;
+static FLASH_Slab*    flash_queue_slab_tail       = NULL;
+
 #endif
 
 
 static unsigned int   flash_queue_stack           = 0;
+static FLASH_Queue_handle flash_queue_n_execs     = 0;
 static FLA_Bool       flash_queue_enabled         = TRUE;
 
 static unsigned int   flash_queue_n_threads       = 1;
@@ -64,9 +94,15 @@ void FLASH_Queue_begin( void )
 ----------------------------------------------------------------------------*/
 {
 #ifdef FLA_ENABLE_SUPERMATRIX
-   if ( flash_queue_stack == 0 )
+   // The operations of a thread running a job of the worker pool execute at
+   // once, outside of any parallel region.
+   if ( FLASH_Queue_pool_in_job() )
+      return;
+
+   if ( flash_queue_stack == 0 && _tq.n_tasks == 0 )
    {
-      // Save the starting time for the total execution time.
+      // Save the starting time for the total execution time, unless tasks
+      // of a deferred region are still pending.
       flash_queue_total_time = FLA_Clock();
    }
 #endif
@@ -85,20 +121,98 @@ void FLASH_Queue_end( void )
 
 ----------------------------------------------------------------------------*/
 {
+#ifdef FLA_ENABLE_SUPERMATRIX
+   if ( FLASH_Queue_pool_in_job() )
+      return;
+#endif
+
    // Pop off the stack.
    flash_queue_stack--;
 
-#ifdef FLA_ENABLE_SUPERMATRIX
+   // Execute tasks if encounter the outermost parallel region.
    if ( flash_queue_stack == 0 )
-   {
-      // Execute tasks if encounter the outermost parallel region.
-      FLASH_Queue_exec();
+      FLASH_Queue_flush();
 
-      // Find the total execution time.
-      flash_queue_total_time = FLA_Clock() - flash_queue_total_time;
-   }
+   return;
+}
+
+
+FLASH_Queue_handle FLASH_Queue_end_async( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_end_async
+
+----------------------------------------------------------------------------*/
+{
+#ifdef FLA_ENABLE_SUPERMATRIX
+   // The operations of a thread running a job have already executed.
+   if ( FLASH_Queue_pool_in_job() )
+      return flash_queue_n_execs;
+#endif
+
+   // Pop off the stack.
+   flash_queue_stack--;
+
+   // End the region with its submission deferred: nothing executes yet, and
+   // the calling thread returns at once. The tasks stay enqueued so that the
+   // tasks of several deferred regions execute together as one graph, on
+   // the calling thread and the workers, once a handle is waited on or a
+   // synchronous outermost region ends, which is the next execution of the
+   // queue. Until then the operands of the region must not be touched.
+   return flash_queue_n_execs + 1;
+}
+
+
+FLA_Error FLASH_Queue_wait( FLASH_Queue_handle handle )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_wait
+
+----------------------------------------------------------------------------*/
+{
+   // Return if the tasks of the handle have already executed.
+   if ( handle <= flash_queue_n_execs )
+      return FLA_SUCCESS;
+
+   // The tasks cannot execute within a parallel region, nor from within a
+   // job of the worker pool.
+   if ( flash_queue_stack > 0 )
+      return FLA_FAILURE;
+
+#ifdef FLA_ENABLE_SUPERMATRIX
+   if ( FLASH_Queue_pool_in_job() )
+      return FLA_FAILURE;
+#endif
+
+   // Execute the tasks of every pending deferred region.
+   FLASH_Queue_flush();
+
+   return ( handle <= flash_queue_n_execs ? FLA_SUCCESS : FLA_FAILURE );
+}
+
+
+void FLASH_Queue_flush( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_flush
+
+----------------------------------------------------------------------------*/
+{
+#ifdef FLA_ENABLE_SUPERMATRIX
+   // Tasks captured into a graph are not executed.
+   if ( flash_queue_capture == TRUE )
+      return;
+
+   // Execute all enqueued tasks.
+   FLASH_Queue_exec();
+
+   // Find the total execution time.
+   flash_queue_total_time = FLA_Clock() - flash_queue_total_time;
 #endif
 
+   // Complete every handle returned since the last execution.
+   flash_queue_n_execs++;
+
    return;
 }
 
@@ -175,9 +289,10 @@ FLA_Bool FLASH_Queue_get_enabled( void )
 
 ----------------------------------------------------------------------------*/
 {
-   // Return if enabled, but always false if SuperMatrix is not configured.
+   // Return if enabled, but always false if SuperMatrix is not configured
+   // or the calling thread is running a job of the worker pool.
 #ifdef FLA_ENABLE_SUPERMATRIX
-   return flash_queue_enabled;
+   return flash_queue_enabled && !FLASH_Queue_pool_in_job();
 #else
    return FALSE;
 #endif
@@ -265,6 +380,9 @@ void FLASH_Queue_init( void )
    // Reset all the initial values.
    FLASH_Queue_reset();
 
+   // Register the task kinds built into libflame.
+   FLASH_Queue_init_task_kinds();
+
    // Set the initialized flag.
    flash_queue_initialized = TRUE;
 
@@ -291,9 +409,33 @@ void FLASH_Queue_finalize( void )
    if ( flash_queue_initialized == FALSE )
       return;
 
+   // Execute the tasks of any deferred region that was never waited on.
+   if ( flash_queue_stack == 0 && _tq.n_tasks > 0 )
+      FLASH_Queue_flush();
+
    // Clear the initialized flag.
    flash_queue_initialized = FALSE;
 
+   // Terminate the persistent worker threads.
+   FLASH_Queue_pool_finalize();
+
+   // Free the idle times recorded by the last execution.
+   if ( flash_queue_idle_time != NULL )
+      FLA_free( flash_queue_idle_time );
+
+   flash_queue_idle_time    = NULL;
+   flash_queue_n_idle_times = 0;
+
+   // Return every slab of the task arena to the system.
+   FLASH_Queue_arena_release( TRUE );
+
+   // Forget the NUMA and cache topologies.
+   FLASH_Queue_numa_finalize();
+   FLASH_Queue_locality_finalize();
+
+   // Free the ring buffers of the trace.
+   FLASH_Queue_trace_finalize();
+
 #ifdef FLA_ENABLE_GPU
    FLASH_Queue_finalize_gpu();
 #endif
@@ -413,6 +555,106 @@ FLA_Bool FLASH_Queue_get_work_stealing( void )
 }
 
 
+void FLASH_Queue_set_deques( FLA_Bool deques )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_deques
+
+----------------------------------------------------------------------------*/
+{
+   flash_queue_deques = deques;
+
+   return;
+}
+
+
+FLA_Bool FLASH_Queue_get_deques( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_deques
+
+----------------------------------------------------------------------------*/
+{
+   return flash_queue_deques;
+}
+
+
+void FLASH_Queue_set_numa( FLA_Bool numa )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_numa
+
+----------------------------------------------------------------------------*/
+{
+   flash_queue_numa = numa;
+
+   return;
+}
+
+
+FLA_Bool FLASH_Queue_get_numa( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_numa
+
+----------------------------------------------------------------------------*/
+{
+   return flash_queue_numa;
+}
+
+
+void FLASH_Queue_set_locality( FLA_Bool locality )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_locality
+
+----------------------------------------------------------------------------*/
+{
+   flash_queue_locality = locality;
+
+   return;
+}
+
+
+FLA_Bool FLASH_Queue_get_locality( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_locality
+
+----------------------------------------------------------------------------*/
+{
+   return flash_queue_locality;
+}
+
+
+void FLASH_Queue_set_tracing( FLA_Bool tracing )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_tracing
+
+----------------------------------------------------------------------------*/
+{
+   // Start a new trace when tracing is turned on.
+   if ( tracing && !flash_queue_tracing )
+      FLASH_Queue_trace_reset();
+
+   flash_queue_tracing = tracing;
+
+   return;
+}
+
+
+FLA_Bool FLASH_Queue_get_tracing( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_tracing
+
+----------------------------------------------------------------------------*/
+{
+   return flash_queue_tracing;
+}
+
+
 void FLASH_Queue_set_data_affinity( FLASH_Data_aff data_affinity )
 /*----------------------------------------------------------------------------
 
@@ -467,6 +709,89 @@ double FLASH_Queue_get_parallel_time( void )
 }
 
 
+double FLASH_Queue_get_idle_time( int thread )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_idle_time
+
+----------------------------------------------------------------------------*/
+{
+   // Only return time if out of parallel region and the thread took part in
+   // the last execution.
+   if ( flash_queue_stack == 0 && 
+        thread >= 0 && thread < flash_queue_n_idle_times )
+      return flash_queue_idle_time[thread];
+
+   return 0.0;
+}
+
+
+void FLASH_Queue_get_numa_accesses( dim_t* local, dim_t* remote )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_numa_accesses
+
+----------------------------------------------------------------------------*/
+{
+   // Only return counts if out of parallel region.
+   *local  = ( flash_queue_stack == 0 ? flash_queue_numa_local  : 0 );
+   *remote = ( flash_queue_stack == 0 ? flash_queue_numa_remote : 0 );
+
+   return;
+}
+
+
+void FLASH_Queue_set_spin_budget( int spin_budget )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_spin_budget
+
+----------------------------------------------------------------------------*/
+{
+   // A negative budget means an idle thread sleeps right away.
+   flash_queue_spin_budget = max( spin_budget, 0 );
+
+   return;
+}
+
+
+int FLASH_Queue_get_spin_budget( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_spin_budget
+
+----------------------------------------------------------------------------*/
+{
+   return flash_queue_spin_budget;
+}
+
+
+void FLASH_Queue_set_task_arena( FLA_Bool task_arena )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_task_arena
+
+----------------------------------------------------------------------------*/
+{
+   // The setting takes effect when the first task of the next queue is
+   // enqueued, so toggling it while tasks are pending is harmless.
+   flash_queue_task_arena = task_arena;
+
+   return;
+}
+
+
+FLA_Bool FLASH_Queue_get_task_arena( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_task_arena
+
+----------------------------------------------------------------------------*/
+{
+   return flash_queue_task_arena;
+}
+
+
 // --- helper functions --- ===================================================
 
 
@@ -483,6 +808,46 @@ void FLASH_Queue_set_parallel_time( double dtime )
 }
 
 
+void FLASH_Queue_set_idle_time( int n_threads, double* idle_time )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_idle_time
+
+----------------------------------------------------------------------------*/
+{
+   int i;
+
+   // Resize the array of idle times if the number of threads has changed.
+   if ( n_threads != flash_queue_n_idle_times )
+   {
+      if ( flash_queue_idle_time != NULL )
+         FLA_free( flash_queue_idle_time );
+
+      flash_queue_idle_time    = ( double* ) FLA_malloc( n_threads * sizeof( double ) );
+      flash_queue_n_idle_times = n_threads;
+   }
+
+   for ( i = 0; i < n_threads; i++ )
+      flash_queue_idle_time[i] = idle_time[i];
+
+   return;
+}
+
+
+void FLASH_Queue_set_numa_accesses( dim_t local, dim_t remote )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_numa_accesses
+
+----------------------------------------------------------------------------*/
+{
+   flash_queue_numa_local  = local;
+   flash_queue_numa_remote = remote;
+
+   return;
+}
+
+
 void FLASH_Queue_set_block_size( dim_t size )
 /*----------------------------------------------------------------------------
 
@@ -621,6 +986,114 @@ void FLASH_Queue_reset( void )
    flash_queue_n_read_blocks  = 0;
    flash_queue_n_write_blocks = 0;
 
+   // Recycle the task arena but keep its first slab for the next queue.
+   FLASH_Queue_arena_release( FALSE );
+
+   return;
+}
+
+
+void FLASH_Queue_set_capture( FLA_Bool capture )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_capture
+
+----------------------------------------------------------------------------*/
+{
+   flash_queue_capture = capture;
+
+   return;
+}
+
+
+FLA_Bool FLASH_Queue_get_capture( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_capture
+
+----------------------------------------------------------------------------*/
+{
+   return flash_queue_capture;
+}
+
+
+void* FLASH_Queue_arena_alloc( size_t size )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_arena_alloc
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Slab* s      = flash_queue_slab_tail;
+   size_t      header = FLASH_QUEUE_ARENA_ROUND( sizeof( FLASH_Slab ) );
+   size_t      n_bytes;
+   void*       p;
+
+   size = FLASH_QUEUE_ARENA_ROUND( size );
+
+   // Open a new slab if the current one cannot hold the request. Requests
+   // larger than a slab receive a slab of their own.
+   if ( s == NULL || s->used + size > s->size )
+   {
+      n_bytes = max( size, FLASH_QUEUE_ARENA_SLAB_SIZE );
+
+      s       = ( FLASH_Slab* ) FLA_malloc( header + n_bytes );
+      s->next = NULL;
+      s->size = n_bytes;
+      s->used = 0;
+
+      if ( flash_queue_slab_tail == NULL )
+         flash_queue_slab_head       = s;
+      else
+         flash_queue_slab_tail->next = s;
+
+      flash_queue_slab_tail = s;
+   }
+
+   p = ( void* ) ( ( char* ) s + header + s->used );
+
+   s->used += size;
+
+   return p;
+}
+
+
+void FLASH_Queue_arena_release( FLA_Bool all )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_arena_release
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Slab* s;
+   FLASH_Slab* next;
+
+   if ( flash_queue_slab_head == NULL )
+      return;
+
+   // Free every slab except the first, which is rewound unless all of the
+   // memory was requested back.
+   s = ( all ? flash_queue_slab_head : flash_queue_slab_head->next );
+
+   while ( s != NULL )
+   {
+      next = s->next;
+      FLA_free( s );
+      s = next;
+   }
+
+   if ( all )
+   {
+      flash_queue_slab_head = NULL;
+   }
+   else
+   {
+      flash_queue_slab_head->next = NULL;
+      flash_queue_slab_head->used = 0;
+   }
+
+   flash_queue_slab_tail = flash_queue_slab_head;
+
    return;
 }
 
@@ -767,24 +1240,8 @@ void FLASH_Queue_push( void* func,
    // Finalize the variable argument environment.
    va_end( var_arg_list );
   
-   // Add the task to the tail of the queue (and the head if queue is empty).
-   if ( _tq.n_tasks == 0 )
-   {
-      _tq.head = t;
-      _tq.tail = t;
-   }
-   else
-   {
-      t->prev_task = _tq.tail;
-      _tq.tail->next_task = t;
-      _tq.tail            = t;
-
-      // Determine the index of the task in the task queue.
-      t->order = t->prev_task->order + 1;
-   }
-   
-   // Increment the number of tasks.
-   _tq.n_tasks++;
+   // Add the task to the tail of the queue.
+   FLASH_Queue_push_task( t );
 
    return;
 }
@@ -819,7 +1276,7 @@ void FLASH_Queue_push_input( FLA_Obj obj,
    { // Flow dependence.
       task = obj.base->write_task;
       
-      d = (FLASH_Dep *) FLA_malloc( sizeof(FLASH_Dep) );
+      d = FLASH_Dep_alloc();
       
       d->task     = t;
       d->next_dep = NULL;
@@ -842,7 +1299,7 @@ void FLASH_Queue_push_input( FLA_Obj obj,
    if ( obj.base->n_read_tasks == 0 ||
         obj.base->read_task_tail->task != t )
    { // Anti-dependence potentially.
-      d = (FLASH_Dep *) FLA_malloc( sizeof(FLASH_Dep) );
+      d = FLASH_Dep_alloc();
       
       d->task     = t;
       d->next_dep = NULL;
@@ -906,7 +1363,7 @@ void FLASH_Queue_push_output( FLA_Obj obj,
          // Create dependency from task that last wrote the block.
          task = obj.base->write_task;
          
-         d = (FLASH_Dep *) FLA_malloc( sizeof(FLASH_Dep) );
+         d = FLASH_Dep_alloc();
          
          d->task     = t;
          d->next_dep = NULL;
@@ -962,7 +1419,7 @@ void FLASH_Queue_push_output( FLA_Obj obj,
       }  
       else
       {
-         FLA_free( d );
+         FLASH_Dep_free( d );
       }
       
       d = next_dep;
@@ -979,6 +1436,36 @@ void FLASH_Queue_push_output( FLA_Obj obj,
 }
 
 
+void FLASH_Queue_push_task( FLASH_Task* t )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_push_task
+
+----------------------------------------------------------------------------*/
+{
+   // Add the task to the tail of the queue (and the head if queue is empty).
+   if ( _tq.n_tasks == 0 )
+   {
+      _tq.head = t;
+      _tq.tail = t;
+   }
+   else
+   {
+      t->prev_task = _tq.tail;
+      _tq.tail->next_task = t;
+      _tq.tail            = t;
+
+      // Determine the index of the task in the task queue.
+      t->order = t->prev_task->order + 1;
+   }
+   
+   // Increment the number of tasks.
+   _tq.n_tasks++;
+
+   return;
+}
+
+
 FLASH_Task* FLASH_Task_alloc( void *func,
                               void *cntl,
                               char *name,
@@ -995,32 +1482,60 @@ FLASH_Task* FLASH_Task_alloc( void *func,
 ----------------------------------------------------------------------------*/
 {
    FLASH_Task* t;
+   size_t      n_bytes;
 
-   // Allocate space for the task structure t.
-   t             = (FLASH_Task *) FLA_malloc( sizeof(FLASH_Task) );
+   // Latch the allocation policy when the first task of a queue is created
+   // so that every task and dependence in the queue is freed consistently.
+   if ( _tq.n_tasks == 0 )
+      flash_queue_arena_active = flash_queue_task_arena;
 
-   // Allocate space for the task's integer arguments.
-   t->int_arg    = (int *) FLA_malloc( n_int_args * sizeof(int) );
+   if ( flash_queue_arena_active )
+   {
+      // Carve the task structure and all of its argument arrays out of a
+      // single arena allocation. The FLA_Obj arrays are placed first so
+      // that they remain aligned.
+      n_bytes = FLASH_QUEUE_ARENA_ROUND( sizeof(FLASH_Task) ) +
+                ( n_fla_args + n_input_args + n_output_args ) * sizeof(FLA_Obj) +
+                n_int_args * sizeof(int);
 
-   // Allocate space for the task's FLA_Obj arguments.
-   t->fla_arg    = (FLA_Obj *) FLA_malloc( n_fla_args * sizeof(FLA_Obj) );
+      t             = (FLASH_Task *) FLASH_Queue_arena_alloc( n_bytes );
 
-   // Allocate space for the task's input FLA_Obj arguments.
-   t->input_arg  = (FLA_Obj *) FLA_malloc( n_input_args * sizeof(FLA_Obj) );
+      t->fla_arg    = (FLA_Obj *) ( ( char* ) t +
+                                    FLASH_QUEUE_ARENA_ROUND( sizeof(FLASH_Task) ) );
+      t->input_arg  = t->fla_arg + n_fla_args;
+      t->output_arg = t->input_arg + n_input_args;
+      t->int_arg    = (int *) ( t->output_arg + n_output_args );
+   }
+   else
+   {
+      // Allocate space for the task structure t.
+      t             = (FLASH_Task *) FLA_malloc( sizeof(FLASH_Task) );
 
-   // Allocate space for the task's output FLA_Obj arguments.
-   t->output_arg = (FLA_Obj *) FLA_malloc( n_output_args * sizeof(FLA_Obj) );
+      // Allocate space for the task's integer arguments.
+      t->int_arg    = (int *) FLA_malloc( n_int_args * sizeof(int) );
+
+      // Allocate space for the task's FLA_Obj arguments.
+      t->fla_arg    = (FLA_Obj *) FLA_malloc( n_fla_args * sizeof(FLA_Obj) );
+
+      // Allocate space for the task's input FLA_Obj arguments.
+      t->input_arg  = (FLA_Obj *) FLA_malloc( n_input_args * sizeof(FLA_Obj) );
+
+      // Allocate space for the task's output FLA_Obj arguments.
+      t->output_arg = (FLA_Obj *) FLA_malloc( n_output_args * sizeof(FLA_Obj) );
+   }
    
    // Initialize other fields of the structure.
    t->n_ready       = 0;
    t->order         = 0;
    t->queue         = 0;
    t->height        = 0;
+   t->priority      = 0.0;
    t->thread        = 0;
    t->cache         = 0;
    t->hit           = FALSE;
 
    t->func          = func;
+   t->invoker       = FLASH_Queue_get_task_invoker( func );
    t->cntl          = cntl;
    t->name          = name;
    t->enabled_gpu   = enabled_gpu;
@@ -1113,7 +1628,7 @@ void FLASH_Task_free( FLASH_Task *t )
                for ( j = 0; j < k; j++ )
                {
                   next_dep = d->next_dep;
-                  FLA_free( d );
+                  FLASH_Dep_free( d );
                   d = next_dep;
                }
             }
@@ -1131,7 +1646,7 @@ void FLASH_Task_free( FLASH_Task *t )
          for ( j = 0; j < k; j++ )
          {
             next_dep = d->next_dep;
-            FLA_free( d );
+            FLASH_Dep_free( d );
             d = next_dep;
          }
       }
@@ -1143,10 +1658,29 @@ void FLASH_Task_free( FLASH_Task *t )
    for ( i = 0; i < t->n_dep_args; i++ )
    {
       next_dep = d->next_dep;
-      FLA_free( d );
+      FLASH_Dep_free( d );
       d = next_dep;
    }   
 
+   // Free the argument arrays and the struct itself.
+   FLASH_Task_free_memory( t );
+
+   return;
+}
+
+
+void FLASH_Task_free_memory( FLASH_Task *t )
+/*----------------------------------------------------------------------------
+
+   FLASH_Task_free_memory
+
+----------------------------------------------------------------------------*/
+{
+   // Tasks carved out of the arena are reclaimed all at once by
+   // FLASH_Queue_reset().
+   if ( flash_queue_arena_active )
+      return;
+
    // Free the int_arg field of t.
    FLA_free( t->int_arg );
    
@@ -1166,642 +1700,52 @@ void FLASH_Task_free( FLASH_Task *t )
 }
 
 
-void FLASH_Queue_exec_task( FLASH_Task* t )
+FLASH_Dep* FLASH_Dep_alloc( void )
 /*----------------------------------------------------------------------------
 
-   FLASH_Queue_exec_task
+   FLASH_Dep_alloc
 
 ----------------------------------------------------------------------------*/
 {
-   // Define local function pointer types.
-
-   // LAPACK-level
-   typedef FLA_Error(*flash_lu_piv_macro_p)(FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
-   typedef FLA_Error(*flash_apply_pivots_macro_p)(FLA_Side side, FLA_Trans trans, FLA_Obj p, FLA_Obj A, fla_appiv_t* cntl);
-   typedef FLA_Error(*flash_lu_piv_p)(FLA_Obj A, FLA_Obj p, fla_lu_t* cntl);
-   typedef FLA_Error(*flash_lu_piv_copy_p)(FLA_Obj A, FLA_Obj p, FLA_Obj U, fla_lu_t* cntl);
-   typedef FLA_Error(*flash_trsm_piv_p)(FLA_Obj A, FLA_Obj C, FLA_Obj p, fla_trsm_t* cntl);
-   typedef FLA_Error(*flash_sa_lu_p)(FLA_Obj U, FLA_Obj D, FLA_Obj p, FLA_Obj L, int nb_alg, fla_lu_t* cntl);
-   typedef FLA_Error(*flash_sa_fs_p)(FLA_Obj L, FLA_Obj D, FLA_Obj p, FLA_Obj C, FLA_Obj E, int nb_alg, fla_gemm_t* cntl);
-   typedef FLA_Error(*flash_lu_nopiv_p)(FLA_Obj A, fla_lu_t* cntl);
-   typedef FLA_Error(*flash_trinv_p)(FLA_Uplo uplo, FLA_Diag diag, FLA_Obj A, fla_trinv_t* cntl);
-   typedef FLA_Error(*flash_ttmm_p)(FLA_Uplo uplo, FLA_Obj A, fla_ttmm_t* cntl);
-   typedef FLA_Error(*flash_chol_p)(FLA_Uplo uplo, FLA_Obj A, fla_chol_t* cntl);
-   typedef FLA_Error(*flash_sylv_p)(FLA_Trans transa, FLA_Trans transb, FLA_Obj isgn, FLA_Obj A, FLA_Obj B, FLA_Obj C, FLA_Obj scale, fla_sylv_t* cntl);
-   typedef FLA_Error(*flash_lyap_p)(FLA_Trans trans, FLA_Obj isgn, FLA_Obj A, FLA_Obj C, FLA_Obj scale, fla_lyap_t* cntl);
-   typedef FLA_Error(*flash_qrut_macro_p)(FLA_Obj A, FLA_Obj T, fla_qrut_t* cntl);
-   typedef FLA_Error(*flash_qrut_p)(FLA_Obj A, FLA_Obj T, fla_qrut_t* cntl);
-   typedef FLA_Error(*flash_qrutc_p)(FLA_Obj A, FLA_Obj T, FLA_Obj U, fla_qrut_t* cntl);
-   typedef FLA_Error(*flash_qr2ut_p)(FLA_Obj B, FLA_Obj D, FLA_Obj T, fla_qr2ut_t* cntl);
-   typedef FLA_Error(*flash_lqut_macro_p)(FLA_Obj A, FLA_Obj T, fla_lqut_t* cntl);
-   typedef FLA_Error(*flash_caqr2ut_p)(FLA_Obj B, FLA_Obj D, FLA_Obj T, fla_caqr2ut_t* cntl);
-   typedef FLA_Error(*flash_uddateut_p)(FLA_Obj R, FLA_Obj C, FLA_Obj D, FLA_Obj T, fla_uddateut_t* cntl);
-   typedef FLA_Error(*flash_apqut_p)(FLA_Side side, FLA_Trans trans, FLA_Direct direct, FLA_Store storev, FLA_Obj A, FLA_Obj T, FLA_Obj W, FLA_Obj B, fla_apqut_t* cntl);
-   typedef FLA_Error(*flash_apq2ut_p)(FLA_Side side, FLA_Trans trans, FLA_Direct direct, FLA_Store storev, FLA_Obj D, FLA_Obj T, FLA_Obj W, FLA_Obj C, FLA_Obj E, fla_apq2ut_t* cntl);
-   typedef FLA_Error(*flash_apcaq2ut_p)(FLA_Side side, FLA_Trans trans, FLA_Direct direct, FLA_Store storev, FLA_Obj D, FLA_Obj T, FLA_Obj W, FLA_Obj C, FLA_Obj E, fla_apcaq2ut_t* cntl);
-   typedef FLA_Error(*flash_apqudut_p)(FLA_Side side, FLA_Trans trans, FLA_Direct direct, FLA_Store storev, FLA_Obj T, FLA_Obj W, FLA_Obj R, FLA_Obj U, FLA_Obj C, FLA_Obj V, FLA_Obj D, fla_apqudut_t* cntl);
-   typedef FLA_Error(*flash_eig_gest_p)(FLA_Inv inv, FLA_Uplo uplo, FLA_Obj A, FLA_Obj Y, FLA_Obj B, fla_eig_gest_t* cntl);
-
-   // Level-3 BLAS
-   typedef FLA_Error(*flash_gemm_p)(FLA_Trans transa, FLA_Trans transb, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_gemm_t* cntl);
-   typedef FLA_Error(*flash_hemm_p)(FLA_Side side, FLA_Uplo uplo, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_hemm_t* cntl);
-   typedef FLA_Error(*flash_herk_p)(FLA_Uplo uplo, FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj beta, FLA_Obj C, fla_herk_t* cntl);
-   typedef FLA_Error(*flash_her2k_p)(FLA_Uplo uplo, FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_her2k_t* cntl);
-   typedef FLA_Error(*flash_symm_p)(FLA_Side side, FLA_Uplo uplo, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_symm_t* cntl);
-   typedef FLA_Error(*flash_syrk_p)(FLA_Uplo uplo, FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj beta, FLA_Obj C, fla_syrk_t* cntl);
-   typedef FLA_Error(*flash_syr2k_p)(FLA_Uplo uplo, FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_syr2k_t* cntl);
-   typedef FLA_Error(*flash_trmm_p)(FLA_Side side, FLA_Uplo uplo, FLA_Trans trans, FLA_Diag diag, FLA_Obj alpha, FLA_Obj A, FLA_Obj C, fla_trmm_t* cntl);
-   typedef FLA_Error(*flash_trsm_p)(FLA_Side side, FLA_Uplo uplo, FLA_Trans trans, FLA_Diag diag, FLA_Obj alpha, FLA_Obj A, FLA_Obj C, fla_trsm_t* cntl);
-
-   // Level-2 BLAS
-   typedef FLA_Error(*flash_gemv_p)(FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj x, FLA_Obj beta, FLA_Obj y, fla_gemv_t* cntl);
-   typedef FLA_Error(*flash_trsv_p)(FLA_Uplo uplo, FLA_Trans trans, FLA_Diag diag, FLA_Obj A, FLA_Obj x, fla_trsv_t* cntl);
-
-   // Level-1 BLAS
-   typedef FLA_Error(*flash_axpy_p)(FLA_Obj alpha, FLA_Obj A, FLA_Obj B, fla_axpy_t* cntl);
-   typedef FLA_Error(*flash_axpyt_p)(FLA_Trans trans, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, fla_axpyt_t* cntl);
-   typedef FLA_Error(*flash_copy_p)(FLA_Obj A, FLA_Obj B, fla_copy_t* cntl);
-   typedef FLA_Error(*flash_copyt_p)(FLA_Trans trans, FLA_Obj A, FLA_Obj B, fla_copyt_t* cntl);
-   typedef FLA_Error(*flash_copyr_p)(FLA_Uplo uplo, FLA_Obj A, FLA_Obj B, fla_copyr_t* cntl);
-   typedef FLA_Error(*flash_scal_p)(FLA_Obj alpha, FLA_Obj A, fla_scal_t* cntl);
-   typedef FLA_Error(*flash_scalr_p)(FLA_Uplo uplo, FLA_Obj alpha, FLA_Obj A, fla_scalr_t* cntl);
-
-   // Base
-   typedef FLA_Error(*flash_obj_create_buffer_p)(dim_t rs, dim_t cs, FLA_Obj A, void* cntl);
-   typedef FLA_Error(*flash_obj_free_buffer_p)(FLA_Obj A, void* cntl);
+   if ( flash_queue_arena_active )
+      return (FLASH_Dep *) FLASH_Queue_arena_alloc( sizeof(FLASH_Dep) );
 
-   // Only execute task if it is not NULL.
-   if ( t == NULL )
-      return;
+   return (FLASH_Dep *) FLA_malloc( sizeof(FLASH_Dep) );
+}
 
-   // Now "switch" between the various possible task functions.
 
-   // FLA_LU_piv_macro
-   if ( t->func == (void *) FLA_LU_piv_macro_task )
-   {
-      flash_lu_piv_macro_p func;
-      func = (flash_lu_piv_macro_p) t->func;
-      
-      func(               t->output_arg[0],
-                          t->output_arg[1],
-            ( fla_lu_t* ) t->cntl );
-   }
-   // FLA_Apply_pivots_macro
-   else if ( t->func == (void *) FLA_Apply_pivots_macro_task )
-   {
-      flash_apply_pivots_macro_p func;
-      func = (flash_apply_pivots_macro_p) t->func;
-      
-      func( ( FLA_Side  )    t->int_arg[0],
-            ( FLA_Trans )    t->int_arg[1],
-                             t->input_arg[0],
-                             t->output_arg[0],
-            ( fla_appiv_t* ) t->cntl );
-   }
-   // FLA_LU_piv
-   else if ( t->func == (void *) FLA_LU_piv_task )
-   {
-      flash_lu_piv_p func;
-      func = (flash_lu_piv_p) t->func;
-      
-      func(               t->output_arg[0],
-                          t->fla_arg[0],
-            ( fla_lu_t* ) t->cntl );
-   }
-   // FLA_LU_piv_copy
-   else if ( t->func == (void *) FLA_LU_piv_copy_task )
-   {
-      flash_lu_piv_copy_p func;
-      func = (flash_lu_piv_copy_p) t->func;
+void FLASH_Dep_free( FLASH_Dep *d )
+/*----------------------------------------------------------------------------
 
-      func(               t->output_arg[0],
-                          t->fla_arg[0],
-                          t->output_arg[1],
-            ( fla_lu_t* ) t->cntl );
-   }
-   // FLA_Trsm_piv
-   else if ( t->func == (void *) FLA_Trsm_piv_task )
-   {
-      flash_trsm_piv_p func;
-      func = (flash_trsm_piv_p) t->func;
+   FLASH_Dep_free
 
-      func(                 t->input_arg[0],
-                            t->output_arg[0],
-                            t->fla_arg[0],
-            ( fla_trsm_t* ) t->cntl );
-   }
-   // FLA_SA_LU
-   else if ( t->func == (void *) FLA_SA_LU_task )
-   {
-      flash_sa_lu_p func;
-      func = (flash_sa_lu_p) t->func;
-      
-      func(               t->output_arg[1],
-                          t->output_arg[0],
-                          t->fla_arg[0],
-                          t->fla_arg[1],
-                          t->int_arg[0],
-            ( fla_lu_t* ) t->cntl );
-   }
-   // FLA_SA_FS
-   else if ( t->func == (void *) FLA_SA_FS_task )
-   {
-      flash_sa_fs_p func;
-      func = (flash_sa_fs_p) t->func;
-         
-      func(                 t->fla_arg[0],
-                            t->input_arg[0],
-                            t->fla_arg[1],                          
-                            t->output_arg[1],
-                            t->output_arg[0],
-                            t->int_arg[0],
-            ( fla_gemm_t* ) t->cntl );
-   }
-   // FLA_LU_nopiv
-   else if ( t->func == (void *) FLA_LU_nopiv_task )
-   {
-      flash_lu_nopiv_p func;
-      func = (flash_lu_nopiv_p) t->func;
+----------------------------------------------------------------------------*/
+{
+   if ( flash_queue_arena_active )
+      return;
 
-      func(               t->output_arg[0],
-            ( fla_lu_t* ) t->cntl );
-   }
-   // FLA_Trinv
-   else if ( t->func == (void *) FLA_Trinv_task )
-   {
-      flash_trinv_p func;
-      func = (flash_trinv_p) t->func;
-      
-      func( ( FLA_Uplo     ) t->int_arg[0],
-            ( FLA_Diag     ) t->int_arg[1],
-                             t->output_arg[0],
-            ( fla_trinv_t* ) t->cntl );
-   }
-   // FLA_Ttmm
-   else if ( t->func == (void *) FLA_Ttmm_task )
-   {   
-      flash_ttmm_p func;
-      func = (flash_ttmm_p) t->func;
-      
-      func( ( FLA_Uplo    ) t->int_arg[0],
-                            t->output_arg[0],
-            ( fla_ttmm_t* ) t->cntl );
-   }
-   // FLA_Chol
-   else if ( t->func == (void *) FLA_Chol_task )
-   {   
-      flash_chol_p func;
-      func = (flash_chol_p) t->func;
-      
-      func( ( FLA_Uplo    ) t->int_arg[0],
-                            t->output_arg[0],
-            ( fla_chol_t* ) t->cntl );
-   }
-   // FLA_Sylv
-   else if ( t->func == (void *) FLA_Sylv_task )
-   {   
-      flash_sylv_p func;
-      func = (flash_sylv_p) t->func;
-      
-      func( ( FLA_Trans   ) t->int_arg[0],
-            ( FLA_Trans   ) t->int_arg[1],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->input_arg[1],
-                            t->output_arg[0],
-                            t->fla_arg[1],
-            ( fla_sylv_t* ) t->cntl );
-   }
-   // FLA_Lyap
-   else if ( t->func == (void *) FLA_Lyap_task )
-   {   
-      flash_lyap_p func;
-      func = (flash_lyap_p) t->func;
-      
-      func( ( FLA_Trans   ) t->int_arg[0],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->output_arg[0],
-                            t->fla_arg[1],
-            ( fla_lyap_t* ) t->cntl );
-   }
-   // FLA_QR_UT_macro
-   else if ( t->func == (void *) FLA_QR_UT_macro_task )
-   {   
-      flash_qrut_macro_p func;
-      func = (flash_qrut_macro_p) t->func;
-      
-      func(                 t->output_arg[0],
-                            t->output_arg[1],
-            ( fla_qrut_t* ) t->cntl );
-   }
-   // FLA_QR_UT
-   else if ( t->func == (void *) FLA_QR_UT_task )
-   {   
-      flash_qrut_p func;
-      func = (flash_qrut_p) t->func;
-      
-      func(                 t->output_arg[0],
-                            t->fla_arg[0],
-            ( fla_qrut_t* ) t->cntl );
-   }
-   // FLA_QR_UT_copy
-   else if ( t->func == (void *) FLA_QR_UT_copy_task )
-   {   
-      flash_qrutc_p func;
-      func = (flash_qrutc_p) t->func;
-
-      func(                 t->output_arg[0],
-                            t->fla_arg[0],
-                            t->output_arg[1],
-            ( fla_qrut_t* ) t->cntl );
-   }
-   // FLA_QR2_UT
-   else if ( t->func == (void *) FLA_QR2_UT_task )
-   {   
-      flash_qr2ut_p func;
-      func = (flash_qr2ut_p) t->func;
-         
-      func(                 t->output_arg[1],
-                            t->output_arg[0],
-                            t->fla_arg[0],
-           ( fla_qr2ut_t* ) t->cntl );
-   }
-   // FLA_LQ_UT_macro
-   else if ( t->func == (void *) FLA_LQ_UT_macro_task )
-   {   
-      flash_lqut_macro_p func;
-      func = (flash_lqut_macro_p) t->func;
-      
-      func(                 t->output_arg[0],
-                            t->output_arg[1],
-            ( fla_lqut_t* ) t->cntl );
-   }
-   // FLA_CAQR2_UT
-   else if ( t->func == (void *) FLA_CAQR2_UT_task )
-   {   
-      flash_caqr2ut_p func;
-      func = (flash_caqr2ut_p) t->func;
-         
-      func(                 t->output_arg[1],
-                            t->output_arg[0],
-                            t->fla_arg[0],
-         ( fla_caqr2ut_t* ) t->cntl );
-   }
-   // FLA_UDdate_UT
-   else if ( t->func == (void *) FLA_UDdate_UT_task )
-   {   
-      flash_uddateut_p func;
-      func = (flash_uddateut_p) t->func;
-      
-      func(                 t->output_arg[0],
-                            t->output_arg[1],
-                            t->output_arg[2],
-                            t->output_arg[3],
-        ( fla_uddateut_t* ) t->cntl );
-   }
-   // FLA_Apply_Q_UT
-   else if ( t->func == (void *) FLA_Apply_Q_UT_task )
-   {   
-      flash_apqut_p func;
-      func = (flash_apqut_p) t->func;
-      
-      func( ( FLA_Side     ) t->int_arg[0],
-            ( FLA_Trans    ) t->int_arg[1],
-            ( FLA_Direct   ) t->int_arg[2],
-            ( FLA_Store    ) t->int_arg[3],
-                             t->input_arg[0],
-                             t->fla_arg[0],
-                             t->output_arg[1],
-                             t->output_arg[0],
-            ( fla_apqut_t* ) t->cntl );
-   }
-   // FLA_Apply_Q2_UT
-   else if ( t->func == (void *) FLA_Apply_Q2_UT_task )
-   {   
-      flash_apq2ut_p func;
-      func = (flash_apq2ut_p) t->func;
-      
-      func( ( FLA_Side      ) t->int_arg[0],
-            ( FLA_Trans     ) t->int_arg[1],
-            ( FLA_Direct    ) t->int_arg[2],
-            ( FLA_Store     ) t->int_arg[3],
-                              t->input_arg[0],
-                              t->fla_arg[0],
-                              t->output_arg[2],
-                              t->output_arg[1],
-                              t->output_arg[0],
-            ( fla_apq2ut_t* ) t->cntl );
-   }
-   // FLA_Apply_CAQ2_UT
-   else if ( t->func == (void *) FLA_Apply_CAQ2_UT_task )
-   {   
-      flash_apcaq2ut_p func;
-      func = (flash_apcaq2ut_p) t->func;
-      
-      func( ( FLA_Side      ) t->int_arg[0],
-            ( FLA_Trans     ) t->int_arg[1],
-            ( FLA_Direct    ) t->int_arg[2],
-            ( FLA_Store     ) t->int_arg[3],
-                              t->input_arg[0],
-                              t->fla_arg[0],
-                              t->output_arg[2],
-                              t->output_arg[1],
-                              t->output_arg[0],
-          ( fla_apcaq2ut_t* ) t->cntl );
-   }
-   // FLA_Apply_QUD_UT
-   else if ( t->func == (void *) FLA_Apply_QUD_UT_task )
-   {   
-      flash_apqudut_p func;
-      func = (flash_apqudut_p) t->func;
-      
-      func( ( FLA_Side       ) t->int_arg[0],
-            ( FLA_Trans      ) t->int_arg[1],
-            ( FLA_Direct     ) t->int_arg[2],
-            ( FLA_Store      ) t->int_arg[3],
-                               t->input_arg[0],
-                               t->output_arg[0],
-                               t->output_arg[1],
-                               t->input_arg[1],
-                               t->output_arg[2],
-                               t->input_arg[2],
-                               t->output_arg[3],
-            ( fla_apqudut_t* ) t->cntl );
-   }
-   // FLA_Eig_gest
-   else if ( t->func == (void *) FLA_Eig_gest_task )
-   {   
-      flash_eig_gest_p func;
-      func = (flash_eig_gest_p) t->func;
-      
-      func( ( FLA_Inv         ) t->int_arg[0],
-            ( FLA_Uplo        ) t->int_arg[1],
-                                t->output_arg[1],
-                                t->output_arg[0],
-                                t->input_arg[0],
-            ( fla_eig_gest_t* ) t->cntl );
-   }
-   // FLA_Gemm
-   else if ( t->func == (void *) FLA_Gemm_task )
-   {
-      flash_gemm_p func;
-      func = (flash_gemm_p) t->func;
-      
-      func( ( FLA_Trans   ) t->int_arg[0],
-            ( FLA_Trans   ) t->int_arg[1],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->input_arg[1],
-                            t->fla_arg[1],
-                            t->output_arg[0],
-            ( fla_gemm_t* ) t->cntl );
-   }
-   // FLA_Hemm
-   else if ( t->func == (void *) FLA_Hemm_task )
-   {
-      flash_hemm_p func;
-      func = (flash_hemm_p) t->func;
-      
-      func( ( FLA_Side    ) t->int_arg[0],
-            ( FLA_Uplo    ) t->int_arg[1],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->input_arg[1],
-                            t->fla_arg[1],
-                            t->output_arg[0],
-            ( fla_hemm_t* ) t->cntl );
-   }
-   // FLA_Herk
-   else if ( t->func == (void *) FLA_Herk_task )
-   {
-      flash_herk_p func;
-      func = (flash_herk_p) t->func;
-      
-      func( ( FLA_Uplo    ) t->int_arg[0],
-            ( FLA_Trans   ) t->int_arg[1],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->fla_arg[1],
-                            t->output_arg[0],
-            ( fla_herk_t* ) t->cntl );
-   }
-   // FLA_Her2k
-   else if ( t->func == (void *) FLA_Her2k_task )
-   {
-      flash_her2k_p func;
-      func = (flash_her2k_p) t->func;
-      
-      func( ( FLA_Uplo     ) t->int_arg[0],
-            ( FLA_Trans    ) t->int_arg[1],
-                             t->fla_arg[0],
-                             t->input_arg[0],
-                             t->input_arg[1],
-                             t->fla_arg[1],
-                             t->output_arg[0],
-            ( fla_her2k_t* ) t->cntl );
-   }
-   // FLA_Symm
-   else if ( t->func == (void *) FLA_Symm_task )
-   {
-      flash_symm_p func;
-      func = (flash_symm_p) t->func;
-      
-      func( ( FLA_Side    ) t->int_arg[0],
-            ( FLA_Uplo    ) t->int_arg[1],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->input_arg[1],
-                            t->fla_arg[1],
-                            t->output_arg[0],
-            ( fla_symm_t* ) t->cntl );
-   }
-   // FLA_Syrk
-   else if ( t->func == (void *) FLA_Syrk_task )
-   {
-      flash_syrk_p func;
-      func = (flash_syrk_p) t->func;
-      
-      func( ( FLA_Uplo    ) t->int_arg[0],
-            ( FLA_Trans   ) t->int_arg[1],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->fla_arg[1],
-                            t->output_arg[0],
-            ( fla_syrk_t* ) t->cntl );
-   }
-   // FLA_Syr2k
-   else if ( t->func == (void *) FLA_Syr2k_task )
-   {
-      flash_syr2k_p func;
-      func = (flash_syr2k_p) t->func;
-      
-      func( ( FLA_Uplo     ) t->int_arg[0],
-            ( FLA_Trans    ) t->int_arg[1],
-                             t->fla_arg[0],
-                             t->input_arg[0],
-                             t->input_arg[1],
-                             t->fla_arg[1],
-                             t->output_arg[0],
-            ( fla_syr2k_t* ) t->cntl );
-   }
-   // FLA_Trmm
-   else if ( t->func == (void *) FLA_Trmm_task )
-   {
-      flash_trmm_p func;
-      func = (flash_trmm_p) t->func;
-      
-      func( ( FLA_Side    ) t->int_arg[0],
-            ( FLA_Uplo    ) t->int_arg[1],
-            ( FLA_Trans   ) t->int_arg[2],
-            ( FLA_Diag    ) t->int_arg[3],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->output_arg[0],
-            ( fla_trmm_t* ) t->cntl );
-   }
-   // FLA_Trsm
-   else if ( t->func == (void *) FLA_Trsm_task )
-   {
-      flash_trsm_p func;
-      func = (flash_trsm_p) t->func;
-      
-      func( ( FLA_Side    ) t->int_arg[0],
-            ( FLA_Uplo    ) t->int_arg[1],
-            ( FLA_Trans   ) t->int_arg[2],
-            ( FLA_Diag    ) t->int_arg[3],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->output_arg[0],
-            ( fla_trsm_t* ) t->cntl );
-   }
-   // FLA_Gemv
-   else if ( t->func == (void *) FLA_Gemv_task )
-   {
-      flash_gemv_p func;
-      func = (flash_gemv_p) t->func;
-      
-      func( ( FLA_Trans   ) t->int_arg[0],
-                            t->fla_arg[0],
-                            t->input_arg[0],
-                            t->input_arg[1],
-                            t->fla_arg[1],
-                            t->output_arg[0],
-            ( fla_gemv_t* ) t->cntl );
-   }
-   // FLA_Trsv
-   else if ( t->func == (void *) FLA_Trsv_task )
-   {
-      flash_trsv_p func;
-      func = (flash_trsv_p) t->func;
-      
-      func( ( FLA_Uplo    ) t->int_arg[0],
-            ( FLA_Trans   ) t->int_arg[1],
-            ( FLA_Diag    ) t->int_arg[2],
-                            t->input_arg[0],
-                            t->output_arg[0],
-            ( fla_trsv_t* ) t->cntl );
-   }
-   // FLA_Axpy
-   else if ( t->func == (void *) FLA_Axpy_task )
-   {
-      flash_axpy_p func;
-      func = (flash_axpy_p) t->func;
-         
-      func(                 t->fla_arg[0],
-                            t->input_arg[0],
-                            t->output_arg[0],
-            ( fla_axpy_t* ) t->cntl );
-   }
-   // FLA_Axpyt
-   else if ( t->func == (void *) FLA_Axpyt_task )
-   {
-      flash_axpyt_p func;
-      func = (flash_axpyt_p) t->func;
-      
-      func( ( FLA_Trans    ) t->int_arg[0],
-                             t->fla_arg[0],
-                             t->input_arg[0],
-                             t->output_arg[0],
-            ( fla_axpyt_t* ) t->cntl );
-   }
-   // FLA_Copy
-   else if ( t->func == (void *) FLA_Copy_task )
-   {
-      flash_copy_p func;
-      func = (flash_copy_p) t->func;
-         
-      func(                 t->input_arg[0],
-                            t->output_arg[0],
-            ( fla_copy_t* ) t->cntl );
-   }
-   // FLA_Copyt
-   else if ( t->func == (void *) FLA_Copyt_task )
-   {
-      flash_copyt_p func;
-      func = (flash_copyt_p) t->func;
-      
-      func( ( FLA_Trans    ) t->int_arg[0],
-                             t->input_arg[0],
-                             t->output_arg[0],
-            ( fla_copyt_t* ) t->cntl );
-   }
-   // FLA_Copyr
-   else if ( t->func == (void *) FLA_Copyr_task )
-   {
-      flash_copyr_p func;
-      func = (flash_copyr_p) t->func;
-      
-      func( ( FLA_Uplo     ) t->int_arg[0],
-                             t->input_arg[0],
-                             t->output_arg[0],
-            ( fla_copyr_t* ) t->cntl );
-   }
-   // FLA_Scal
-   else if ( t->func == (void *) FLA_Scal_task )
-   {
-      flash_scal_p func;
-      func = (flash_scal_p) t->func;
+   FLA_free( d );
 
-      func(                 t->fla_arg[0],
-                            t->output_arg[0],
-            ( fla_scal_t* ) t->cntl );
-   }
-   // FLA_Scalr
-   else if ( t->func == (void *) FLA_Scalr_task )
-   {
-      flash_scalr_p func;
-      func = (flash_scalr_p) t->func;
+   return;
+}
 
-      func( ( FLA_Uplo     ) t->int_arg[0],
-                             t->fla_arg[0],
-                             t->output_arg[0],
-            ( fla_scalr_t* ) t->cntl );
-   }
-   // FLA_Obj_create_buffer
-   else if ( t->func == (void *) FLA_Obj_create_buffer_task )
-   {
-      flash_obj_create_buffer_p func;
-      func = (flash_obj_create_buffer_p) t->func;
 
-      func( ( dim_t       ) t->int_arg[0],
-            ( dim_t       ) t->int_arg[1],
-                            t->output_arg[0],
-                            t->cntl );
-   }
-   // FLA_Obj_free_buffer
-   else if ( t->func == (void *) FLA_Obj_free_buffer_task )
-   {
-      flash_obj_free_buffer_p func;
-      func = (flash_obj_free_buffer_p) t->func;
+void FLASH_Queue_exec_task( FLASH_Task* t )
+/*----------------------------------------------------------------------------
 
-      func(                 t->output_arg[0],
-                            t->cntl );
-   }
+   FLASH_Queue_exec_task
+
+----------------------------------------------------------------------------*/
+{
+   // Only execute task if it is not NULL.
+   if ( t == NULL )
+      return;
+
+   // Call the invoker that was chosen for the task when it was created.
+   if ( t->invoker != NULL )
+      t->invoker( t );
    else
-   {
       FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
-   }
    
    return;
 }
@@ -0,0 +1,209 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+
+#ifdef FLA_ENABLE_SUPERMATRIX
+
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+
+// The routines below implement the Chase-Lev work-stealing deque with the
+// memory orderings given by Le, Pop, Cohen, and Zappa Nardelli for weak
+// memory models. Only the owning thread may call push and pop on a deque,
+// while any thread may call steal.
+
+
+FLASH_Deque_buffer* FLASH_Deque_buffer_alloc( long size )
+/*----------------------------------------------------------------------------
+
+   FLASH_Deque_buffer_alloc
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Deque_buffer* b;
+
+   b = ( FLASH_Deque_buffer* ) FLA_malloc( sizeof( FLASH_Deque_buffer ) +
+                                           ( size - 1 ) * sizeof( FLASH_Task* ) );
+
+   b->size = size;
+   b->prev = NULL;
+
+   return b;
+}
+
+
+void FLASH_Deque_init( FLASH_Deque* dq, long size )
+/*----------------------------------------------------------------------------
+
+   FLASH_Deque_init
+
+----------------------------------------------------------------------------*/
+{
+   long n = FLASH_DEQUE_MIN_SIZE;
+
+   // Round the initial capacity up to a power of two.
+   while ( n < size )
+      n *= 2;
+
+   dq->top    = 0;
+   dq->bottom = 0;
+   dq->buffer = FLASH_Deque_buffer_alloc( n );
+
+   return;
+}
+
+
+void FLASH_Deque_finalize( FLASH_Deque* dq )
+/*----------------------------------------------------------------------------
+
+   FLASH_Deque_finalize
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Deque_buffer* b = dq->buffer;
+   FLASH_Deque_buffer* prev;
+
+   // Free the current buffer along with every buffer it replaced, since
+   // a stealing thread may have still been reading from an old buffer.
+   while ( b != NULL )
+   {
+      prev = b->prev;
+      FLA_free( b );
+      b = prev;
+   }
+
+   dq->buffer = NULL;
+
+   return;
+}
+
+
+void FLASH_Deque_push( FLASH_Deque* dq, FLASH_Task* t )
+/*----------------------------------------------------------------------------
+
+   FLASH_Deque_push
+
+----------------------------------------------------------------------------*/
+{
+   long                i;
+   long                b   = FLASH_ATOMIC_LOAD_RELAXED( &(dq->bottom) );
+   long                top = FLASH_ATOMIC_LOAD( &(dq->top) );
+   FLASH_Deque_buffer* a   = FLASH_ATOMIC_LOAD_RELAXED( &(dq->buffer) );
+   FLASH_Deque_buffer* g;
+
+   // Double the size of the buffer if it is full.
+   if ( b - top > a->size - 1 )
+   {
+      g = FLASH_Deque_buffer_alloc( 2 * a->size );
+
+      for ( i = top; i < b; i++ )
+         g->task[i & ( g->size - 1 )] = a->task[i & ( a->size - 1 )];
+
+      g->prev = a;
+
+      FLASH_ATOMIC_STORE( &(dq->buffer), g );
+      a = g;
+   }
+
+   FLASH_ATOMIC_STORE_RELAXED( &(a->task[b & ( a->size - 1 )]), t );
+   FLASH_ATOMIC_FENCE_RELEASE();
+   FLASH_ATOMIC_STORE_RELAXED( &(dq->bottom), b + 1 );
+
+   return;
+}
+
+
+FLASH_Task* FLASH_Deque_pop( FLASH_Deque* dq )
+/*----------------------------------------------------------------------------
+
+   FLASH_Deque_pop
+
+----------------------------------------------------------------------------*/
+{
+   long                b = FLASH_ATOMIC_LOAD_RELAXED( &(dq->bottom) ) - 1;
+   FLASH_Deque_buffer* a = FLASH_ATOMIC_LOAD_RELAXED( &(dq->buffer) );
+   long                top;
+   FLASH_Task*         t = NULL;
+
+   FLASH_ATOMIC_STORE_RELAXED( &(dq->bottom), b );
+   FLASH_ATOMIC_FENCE();
+   top = FLASH_ATOMIC_LOAD_RELAXED( &(dq->top) );
+
+   if ( top <= b )
+   {
+      // The deque is not empty, so take the newest task.
+      t = FLASH_ATOMIC_LOAD_RELAXED( &(a->task[b & ( a->size - 1 )]) );
+
+      if ( top == b )
+      {
+         // This is the last task, so race against stealing threads for it.
+         if ( !FLASH_ATOMIC_CAS( &(dq->top), &top, top + 1 ) )
+            t = NULL;
+
+         FLASH_ATOMIC_STORE_RELAXED( &(dq->bottom), b + 1 );
+      }
+   }
+   else
+   {
+      // The deque is empty, so restore the bottom.
+      FLASH_ATOMIC_STORE_RELAXED( &(dq->bottom), b + 1 );
+   }
+
+   return t;
+}
+
+
+FLASH_Task* FLASH_Deque_steal( FLASH_Deque* dq )
+/*----------------------------------------------------------------------------
+
+   FLASH_Deque_steal
+
+----------------------------------------------------------------------------*/
+{
+   long                top = FLASH_ATOMIC_LOAD( &(dq->top) );
+   long                b;
+   FLASH_Deque_buffer* a;
+   FLASH_Task*         t = NULL;
+
+   FLASH_ATOMIC_FENCE();
+   b = FLASH_ATOMIC_LOAD( &(dq->bottom) );
+
+   if ( top < b )
+   {
+      // Take the oldest task unless another thread claimed it first.
+      a = FLASH_ATOMIC_LOAD( &(dq->buffer) );
+      t = FLASH_ATOMIC_LOAD_RELAXED( &(a->task[top & ( a->size - 1 )]) );
+
+      if ( !FLASH_ATOMIC_CAS( &(dq->top), &top, top + 1 ) )
+         t = NULL;
+   }
+
+   return t;
+}
+
+
+long FLASH_Deque_size( FLASH_Deque* dq )
+/*----------------------------------------------------------------------------
+
+   FLASH_Deque_size
+
+----------------------------------------------------------------------------*/
+{
+   long b   = FLASH_ATOMIC_LOAD( &(dq->bottom) );
+   long top = FLASH_ATOMIC_LOAD( &(dq->top) );
+
+   // The result is only a snapshot when other threads are active.
+   return ( b > top ? b - top : 0 );
+}
+
+#endif // FLASH_QUEUE_ENABLE_ATOMICS
+
+#endif // FLA_ENABLE_SUPERMATRIX
@@ -27,6 +27,10 @@
 #include <stdlib.h>
 #endif
 
+#if !defined(FLA_ENABLE_WINDOWS_BUILD) && !defined(FLA_ENABLE_TIDSP)
+#include <sched.h>
+#endif
+
 
 #ifdef FLA_ENABLE_SUPERMATRIX
 
@@ -34,6 +38,13 @@
 
 #define MIN_CACHE_BLOCKS  3
 
+// Idle threads can only sleep on a condition variable with POSIX threads.
+#if defined(FLA_ENABLE_MULTITHREADING) && \
+    FLA_MULTITHREADING_MODEL == FLA_PTHREADS && \
+    defined(FLASH_QUEUE_ENABLE_ATOMICS)
+#define FLASH_QUEUE_ENABLE_PARKING
+#endif
+
 #ifdef FLA_ENABLE_GPU
 typedef struct FLA_Obj_gpu_struct
 {
@@ -70,6 +81,19 @@ typedef struct FLA_Obj_hip_struct
 } FLA_Obj_hip;
 #endif
 
+// A binary max-heap of ready tasks ordered by priority, which replaces the
+// insertion sort of a waiting queue when sorting is enabled. The number of
+// tasks in the heap is kept in the n_tasks field of the waiting queue.
+typedef struct FLASH_Heap_s
+{
+   // Number of task pointers that fit in the array.
+   int          n_alloc;
+
+   // Array of tasks in heap order.
+   FLASH_Task** task;
+
+} FLASH_Heap;
+
 typedef struct FLASH_Queue_variables
 {
    // A lock on the global task counter.  
@@ -110,10 +134,53 @@ typedef struct FLASH_Queue_variables
    // The waiting queue of tasks for each thread.
    FLASH_Queue* wait_queue;
 
+   // The lock-free work-stealing deque of ready tasks for each thread.
+   FLASH_Deque* deque;
+
+   // The priority heap of ready tasks for each waiting queue.
+   FLASH_Heap*  heap;
+
+   // The NUMA node of each thread when blocks are placed on NUMA nodes.
+   int*         numa_node;
+
+   // Whether tasks are scheduled by the blocks warm in the shared caches.
+   FLA_Bool     locality;
+
+   // The CPU on which each thread last executed a task, or -1 if unknown.
+   int*         cpu;
+
+   // Whether each task and idle period is recorded into the trace.
+   FLA_Bool     tracing;
+
+   // The 2D factorization of the threads or queues that own the blocks.
+   int          numa_length;
+   int          numa_width;
+
+   // The number of accesses each thread made to blocks on its own node and
+   // on other nodes.
+   dim_t*       numa_local;
+   dim_t*       numa_remote;
+
    // A global task counter that keeps track of how many tasks on the waiting
    // queue have been processed.
    int          pc;
 
+   // A counter incremented whenever a task is enqueued, which lets an idle
+   // thread detect that work arrived after it last looked for a task.
+   int          epoch;
+
+   // The number of idle threads sleeping until a task is enqueued.
+   int          n_parked;
+
+   // The time each thread spent without a task to execute.
+   double*      idle_time;
+
+#ifdef FLASH_QUEUE_ENABLE_PARKING
+   // A mutex and condition variable on which idle threads sleep.
+   pthread_mutex_t park_lock;
+   pthread_cond_t  park_cond;
+#endif
+
 #ifdef FLA_ENABLE_GPU
    // A lock that allows threads to safely access the cache structures.
    // Needed only when multithreading is enabled.
@@ -166,7 +233,10 @@ void FLASH_Queue_exec( void )
    int          n_caches;
    int          size;
    int          i;
+   int          n_owners;
    dim_t        block_size = FLASH_Queue_get_block_size();
+   dim_t        numa_local  = 0;
+   dim_t        numa_remote = 0;
    double       dtime;
 
    FLA_Lock*    run_lock = NULL;
@@ -177,6 +247,8 @@ void FLASH_Queue_exec( void )
    FLA_Obj*     cache;
    FLA_Obj*     prefetch;
    FLASH_Queue* wait_queue;
+   FLASH_Deque* deque = NULL;
+   FLASH_Heap*  heap  = NULL;
 
 #ifdef FLA_ENABLE_GPU
 #ifdef FLA_ENABLE_MULTITHREADING
@@ -208,6 +280,44 @@ void FLASH_Queue_exec( void )
    FLASH_Queue_set_work_stealing( FALSE );
 #endif
 
+#if !defined(FLA_ENABLE_MULTITHREADING) || !defined(FLASH_QUEUE_ENABLE_ATOMICS)
+   // Lock-free deques require both threads and atomic operations.
+   FLASH_Queue_set_deques( FALSE );
+#endif
+
+#ifndef FLASH_QUEUE_ENABLE_ATOMICS
+   // The cache tags of the blocks are updated with atomic operations.
+   FLASH_Queue_set_locality( FALSE );
+#endif
+
+   // Tracking the blocks warm in the shared caches supersedes the simulated
+   // cache affinity.
+   if ( FLASH_Queue_get_locality() )
+      FLASH_Queue_set_caching( FALSE );
+
+#ifdef FLA_ENABLE_GPU
+   // Tasks may be reenqueued by GPUs, which only the waiting queues support.
+   if ( FLASH_Queue_get_enabled_gpu() )
+      FLASH_Queue_set_deques( FALSE );
+#endif
+
+#ifdef FLA_ENABLE_HIP
+   // Tasks may be reenqueued by accelerators, which only the waiting queues
+   // support.
+   if ( FLASH_Queue_get_enabled_hip() )
+      FLASH_Queue_set_deques( FALSE );
+#endif
+
+   // Keep tasks on the threads that own their blocks when the blocks are
+   // placed on NUMA nodes and no other queue policy was chosen.
+   if ( FLASH_Queue_get_numa() && 
+        FLASH_Queue_get_data_affinity() == FLASH_QUEUE_AFFINITY_NONE &&
+        !FLASH_Queue_get_work_stealing() && !FLASH_Queue_get_deques() &&
+        !FLASH_Queue_get_caching() )
+   {
+      FLASH_Queue_set_data_affinity( FLASH_QUEUE_AFFINITY_2D_BLOCK_CYCLIC );
+   }
+
    // Query the number of user set threads per queue.
    n_queues = FLASH_Queue_get_cores_per_queue();
 
@@ -258,6 +368,16 @@ void FLASH_Queue_exec( void )
       }
    }
 
+   // Use one deque per thread, which supersedes all other queue policies.
+   if ( FLASH_Queue_get_deques() )
+   {
+      FLASH_Queue_set_caching( FALSE );
+      FLASH_Queue_set_data_affinity( FLASH_QUEUE_AFFINITY_NONE );
+      FLASH_Queue_set_work_stealing( FALSE );
+
+      n_queues = n_threads;
+   }
+
    // Determine the number of caches.
    n_caches = n_threads / FLASH_Queue_get_cores_per_cache();
 
@@ -332,9 +452,92 @@ void FLASH_Queue_exec( void )
       args.wait_queue[i].tail = NULL;
    }
 
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+   // Allocate and initialize a deque for each thread.
+   if ( FLASH_Queue_get_deques() )
+   {
+      deque = ( FLASH_Deque* ) FLA_malloc( n_threads * sizeof( FLASH_Deque ) );
+
+      for ( i = 0; i < n_threads; i++ )
+         FLASH_Deque_init( &(deque[i]), n_tasks / n_threads );
+   }
+#endif
+   args.deque = deque;
+
+   // Keep the ready tasks of each waiting queue in a priority heap when
+   // sorting. Cache affinity must instead search the whole waiting queue.
+   if ( FLASH_Queue_get_sorting() && !FLASH_Queue_get_caching() &&
+        !FLASH_Queue_get_deques() )
+   {
+      heap = ( FLASH_Heap* ) FLA_malloc( n_queues * sizeof( FLASH_Heap ) );
+
+      for ( i = 0; i < n_queues; i++ )
+      {
+         heap[i].n_alloc = FLASH_DEQUE_MIN_SIZE;
+         heap[i].task    = ( FLASH_Task** ) FLA_malloc( heap[i].n_alloc *
+                                                        sizeof( FLASH_Task* ) );
+      }
+   }
+   args.heap = heap;
+
+   // Prepare a ring buffer of trace events for each thread.
+   args.tracing = FLASH_Queue_get_tracing();
+
+   if ( args.tracing )
+      FLASH_Queue_trace_init( n_threads );
+
+   // Track the CPU on which each thread last executed a task.
+   args.locality = FLASH_Queue_get_locality();
+   args.cpu      = ( int* ) FLA_malloc( n_threads * sizeof( int ) );
+
+   for ( i = 0; i < n_threads; i++ )
+      args.cpu[i] = -1;
+
+   args.numa_node   = NULL;
+   args.numa_local  = NULL;
+   args.numa_remote = NULL;
+
+   // Find the NUMA node of each thread and the threads or queues that own
+   // the blocks, which follow the data affinity if there is one.
+   if ( FLASH_Queue_get_numa() )
+   {
+      args.numa_node   = ( int* ) FLA_malloc( n_threads * sizeof( int ) );
+      args.numa_local  = ( dim_t* ) FLA_malloc( n_threads * sizeof( dim_t ) );
+      args.numa_remote = ( dim_t* ) FLA_malloc( n_threads * sizeof( dim_t ) );
+
+      for ( i = 0; i < n_threads; i++ )
+      {
+         args.numa_node[i]   = FLASH_Queue_numa_thread_node( i );
+         args.numa_local[i]  = 0;
+         args.numa_remote[i] = 0;
+      }
+
+      n_owners = ( FLASH_Queue_get_data_affinity() == 
+                   FLASH_QUEUE_AFFINITY_NONE ? n_threads : n_queues );
+
+      args.numa_width = 0;
+      while ( args.numa_width * args.numa_width <= n_owners ) args.numa_width++;
+      args.numa_width--;
+      while ( n_owners % args.numa_width != 0 ) args.numa_width--;
+      args.numa_length = n_owners / args.numa_width;
+   }
+
    // Initialize the aggregate task counter.
    args.pc = 0;
 
+   // Initialize the state of idle threads.
+   args.epoch     = 0;
+   args.n_parked  = 0;
+   args.idle_time = ( double* ) FLA_malloc( n_threads * sizeof( double ) );
+
+   for ( i = 0; i < n_threads; i++ )
+      args.idle_time[i] = 0.0;
+
+#ifdef FLASH_QUEUE_ENABLE_PARKING
+   pthread_mutex_init( &(args.park_lock), NULL );
+   pthread_cond_init( &(args.park_cond), NULL );
+#endif
+
 #ifdef FLA_ENABLE_GPU
 #ifdef FLA_ENABLE_MULTITHREADING
    // Allocate and initialize the gpu locks.
@@ -414,6 +617,32 @@ void FLASH_Queue_exec( void )
    dtime = FLA_Clock() - dtime;
    FLASH_Queue_set_parallel_time( dtime );
 
+   // Save the time each thread spent idle.
+   FLASH_Queue_set_idle_time( n_threads, args.idle_time );
+   FLA_free( args.idle_time );
+
+   // Save the number of accesses to local and remote blocks.
+   if ( args.numa_node != NULL )
+   {
+      for ( i = 0; i < n_threads; i++ )
+      {
+         numa_local  += args.numa_local[i];
+         numa_remote += args.numa_remote[i];
+      }
+
+      FLA_free( args.numa_node );
+      FLA_free( args.numa_local );
+      FLA_free( args.numa_remote );
+   }
+   FLASH_Queue_set_numa_accesses( numa_local, numa_remote );
+
+   FLA_free( args.cpu );
+
+#ifdef FLASH_QUEUE_ENABLE_PARKING
+   pthread_mutex_destroy( &(args.park_lock) );
+   pthread_cond_destroy( &(args.park_cond) );
+#endif
+
 #ifdef FLA_ENABLE_MULTITHREADING   
    // Destroy the locks.
    FLA_Lock_destroy( args.all_lock );
@@ -446,6 +675,24 @@ void FLASH_Queue_exec( void )
    FLA_free( prefetch );
    FLA_free( wait_queue );
 
+   if ( heap != NULL )
+   {
+      for ( i = 0; i < n_queues; i++ )
+         FLA_free( heap[i].task );
+
+      FLA_free( heap );
+   }
+
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+   if ( deque != NULL )
+   {
+      for ( i = 0; i < n_threads; i++ )
+         FLASH_Deque_finalize( &(deque[i]) );
+
+      FLA_free( deque );
+   }
+#endif
+
 #ifdef FLA_ENABLE_GPU
 #ifdef FLA_ENABLE_MULTITHREADING
    for ( i = 0; i < n_threads; i++ )
@@ -489,6 +736,9 @@ void FLASH_Queue_init_tasks( void* arg )
    int            length     = 0;
    int            width      = 0;
    int            height     = 0;
+   double         priority   = 0.0;
+   double         total      = 0.0;
+   FLA_Bool       sorting    = FLASH_Queue_get_sorting();
    int            size       = args->size;
    FLASH_Data_aff data_aff   = FLASH_Queue_get_data_affinity();
    FLASH_Task*    t;
@@ -518,6 +768,20 @@ void FLASH_Queue_init_tasks( void* arg )
       width  = sq_rt;     
    }
 
+   // Estimate the cost of each task and the total cost of all tasks, which
+   // weight the priority of each task when sorting.
+   if ( sorting )
+   {
+      t = FLASH_Queue_get_head_task();
+
+      for ( i = 0; i < n_tasks; i++ )
+      {
+         t->priority = FLASH_Task_cost_estimate( t );
+         total      += t->priority;
+         t = t->next_task;
+      }
+   }
+
    // Grab the tail of the task queue.
    t = FLASH_Queue_get_tail_task();
 
@@ -556,23 +820,38 @@ void FLASH_Queue_init_tasks( void* arg )
          }
       }
 
+      // Place the blocks of the task on the NUMA nodes of their owners.
+      if ( args->numa_node != NULL )
+         FLASH_Queue_numa_place_task( t, arg );
+
       // Determine the height of each task in the DAG.
-      height = 0;
+      height   = 0;
+      priority = 0.0;
       d = t->dep_arg_head;
 
-      // Take the maximum height of dependent tasks.
+      // Take the maximum height and priority of dependent tasks.
       for ( j = 0; j < t->n_dep_args; j++ )
       {
-         height = max( height, d->task->height );
+         height   = max( height, d->task->height );
+         priority = max( priority, d->task->priority );
          d = d->next_dep;
       }
 
       t->height = height + 1;
 
+      // The priority of a task is its cost plus the costliest path of
+      // dependent tasks to the end of the DAG, i.e., its weighted bottom
+      // level, so tasks on the critical path are executed first.
+      if ( sorting )
+         t->priority += priority;
+
       // Since freeing a task is always a leaf, we want to force it to execute 
       // earlier by giving it a greater height in order to reclaim memory.
       if ( t->func == (void *) FLA_Obj_free_buffer_task )
-         t->height += n_tasks;
+      {
+         t->height   += n_tasks;
+         t->priority += total;
+      }
 
 #ifdef FLA_ENABLE_GPU
       for ( j = 0; j < t->n_output_args + t->n_input_args; j++ )
@@ -735,10 +1014,14 @@ void FLASH_Queue_init_tasks( void* arg )
    // Grab the head of the task queue.
    t = FLASH_Queue_get_head_task();
    
-   for ( i = 0; i < n_tasks && n_ready > 0; i++ )
+   for ( i = 0, k = 0; i < n_tasks && n_ready > 0; i++ )
    {
       if ( t->n_ready == 0 )
       {
+         // Deal the initial ready tasks round-robin across the deques.
+         if ( args->deque != NULL )
+            t->queue = k++ % n_queues;
+
          // Enqueue all the ready and available tasks.
          FLASH_Queue_wait_enqueue( t, arg );
 
@@ -774,6 +1057,31 @@ void FLASH_Queue_wait_enqueue( FLASH_Task* t, void* arg )
    FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
    int queue = t->queue;
 
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+   // Push onto the deque, which must be owned by the calling thread unless
+   // the threads have not started yet.
+   if ( args->deque != NULL )
+   {
+      FLASH_Deque_push( &(args->deque[queue]), t );
+
+      // Wake an idle thread to steal the task.
+      FLASH_Queue_wake_idle( FALSE, arg );
+
+      return;
+   }
+#endif
+
+   if ( args->heap != NULL )
+   {
+      // Place the task in the priority heap.
+      FLASH_Queue_heap_insert( t, arg );
+
+      // Wake an idle thread to dequeue the task.
+      FLASH_Queue_wake_idle( FALSE, arg );
+
+      return;
+   }
+
    if ( args->wait_queue[queue].n_tasks == 0 )
    {
       args->wait_queue[queue].head = t;
@@ -788,7 +1096,7 @@ void FLASH_Queue_wait_enqueue( FLASH_Task* t, void* arg )
       {
          while ( t->prev_wait != NULL )
          {
-            if ( t->prev_wait->height >= t->height )
+            if ( t->prev_wait->priority >= t->priority )
                break;
             
             t->next_wait = t->prev_wait;
@@ -812,6 +1120,9 @@ void FLASH_Queue_wait_enqueue( FLASH_Task* t, void* arg )
    // Increment number of tasks on waiting queue.
    args->wait_queue[queue].n_tasks++;
 
+   // Wake an idle thread to dequeue the task.
+   FLASH_Queue_wake_idle( FALSE, arg );
+
    return;
 }
 
@@ -835,7 +1146,15 @@ FLASH_Task* FLASH_Queue_wait_dequeue( int queue, int cache, void* arg )
    enabled = FLASH_Queue_get_enabled_hip();
 #endif
 
-   if ( args->wait_queue[queue].n_tasks > 0 )
+   if ( args->heap != NULL )
+   {
+      // Dequeue the task with the highest priority, or the warmest of the
+      // tasks with the highest priorities.
+      if ( args->wait_queue[queue].n_tasks > 0 )
+         t = FLASH_Queue_heap_remove( queue, ( args->locality ?
+                  FLASH_Queue_heap_warmest( queue, TRUE, arg ) : 0 ), arg );
+   }
+   else if ( args->wait_queue[queue].n_tasks > 0 )
    {
       // Dequeue the first task.
       t = args->wait_queue[queue].head;
@@ -848,11 +1167,16 @@ FLASH_Task* FLASH_Queue_wait_dequeue( int queue, int cache, void* arg )
       }
       else
       {
-         // Grab a new task if using cache affinity.
-	 if ( FLASH_Queue_get_caching() )
+         // Grab a new task if using cache affinity or locality.
+	 if ( FLASH_Queue_get_caching() || args->locality )
 	 {
+            // Find the warmest of the first few tasks.
+            if ( args->locality )
+            {
+               t = FLASH_Queue_wait_warmest( queue, TRUE, arg );
+            }
             // Determine if using GPU or not.
-            if ( enabled )
+            else if ( enabled )
             {
 #ifdef FLA_ENABLE_GPU
 #ifdef FLA_ENABLE_MULTITHREADING
@@ -931,6 +1255,163 @@ FLASH_Task* FLASH_Queue_wait_dequeue( int queue, int cache, void* arg )
    return t;
 }
 
+void FLASH_Queue_heap_insert( FLASH_Task* t, void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_heap_insert
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+   FLASH_Heap*  h = &(args->heap[t->queue]);
+   FLASH_Task** task;
+   int          i = args->wait_queue[t->queue].n_tasks;
+   int          p;
+
+   // Double the size of the array if it is full.
+   if ( i == h->n_alloc )
+   {
+      h->n_alloc *= 2;
+      h->task     = ( FLASH_Task** ) FLA_realloc( h->task, h->n_alloc *
+                                                  sizeof( FLASH_Task* ) );
+   }
+
+   task = h->task;
+
+   // Sift the task up from the bottom of the heap.
+   while ( i > 0 )
+   {
+      p = ( i - 1 ) / 2;
+
+      if ( task[p]->priority >= t->priority )
+         break;
+
+      task[i] = task[p];
+      i = p;
+   }
+
+   task[i] = t;
+
+   args->wait_queue[t->queue].n_tasks++;
+
+   return;
+}
+
+
+FLASH_Task* FLASH_Queue_heap_remove( int queue, int i, void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_heap_remove
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+   FLASH_Task** task = args->heap[queue].task;
+   FLASH_Task*  t    = task[i];
+   FLASH_Task*  last;
+   int          n;
+   int          c;
+
+   n    = --args->wait_queue[queue].n_tasks;
+   last = task[n];
+
+   // Move the last task into the vacated position, sifting it up if it has a
+   // higher priority than the parent and down otherwise.
+   if ( i < n )
+   {
+      while ( i > 0 && task[( i - 1 ) / 2]->priority < last->priority )
+      {
+         task[i] = task[( i - 1 ) / 2];
+         i = ( i - 1 ) / 2;
+      }
+
+      while ( ( c = 2 * i + 1 ) < n )
+      {
+         if ( c + 1 < n && task[c + 1]->priority > task[c]->priority )
+            c++;
+
+         if ( last->priority >= task[c]->priority )
+            break;
+
+         task[i] = task[c];
+         i = c;
+      }
+
+      task[i] = last;
+   }
+
+   return t;
+}
+
+
+int FLASH_Queue_heap_warmest( int queue, FLA_Bool top, void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_heap_warmest
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+   FLASH_Task** task = args->heap[queue].task;
+   int          n    = args->wait_queue[queue].n_tasks;
+   int          w    = min( n, FLASH_QUEUE_LOCALITY_WINDOW );
+   int          cpu  = FLASH_Queue_locality_cpu();
+   int          i, k, score;
+   int          best = ( top ? 0 : n - 1 );
+   int          best_score = 0;
+
+   // Search the first or last few positions of the heap, which hold tasks
+   // with a high or low priority, for the task with the most warm blocks.
+   for ( i = 0; i < w; i++ )
+   {
+      k     = ( top ? i : n - 1 - i );
+      score = FLASH_Queue_locality_visit( task[k], cpu, FALSE );
+
+      if ( score > best_score )
+      {
+         best       = k;
+         best_score = score;
+      }
+   }
+
+   return best;
+}
+
+
+FLASH_Task* FLASH_Queue_wait_warmest( int queue, FLA_Bool head, void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_wait_warmest
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+   FLASH_Task* t    = ( head ? args->wait_queue[queue].head :
+                               args->wait_queue[queue].tail );
+   FLASH_Task* best = t;
+   int         cpu  = FLASH_Queue_locality_cpu();
+   int         i, score;
+   int         best_score = 0;
+
+   // Search the first or last few tasks of the waiting queue for the task
+   // with the most warm blocks.
+   for ( i = 0; i < FLASH_QUEUE_LOCALITY_WINDOW && t != NULL; i++ )
+   {
+      score = FLASH_Queue_locality_visit( t, cpu, FALSE );
+
+      if ( score > best_score )
+      {
+         best       = t;
+         best_score = score;
+      }
+
+      t = ( head ? t->next_wait : t->prev_wait );
+   }
+
+   return best;
+}
+
+
 
 FLASH_Task* FLASH_Queue_wait_dequeue_block( int queue, int cache, void* arg )
 /*----------------------------------------------------------------------------
@@ -1327,8 +1808,10 @@ FLASH_Task* FLASH_Queue_work_stealing( int queue, void *arg )
 ----------------------------------------------------------------------------*/
 {
    FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
-   int         q;
-   int         n_queues = args->n_queues;
+   int         i, k, q, v, d, best;
+   int         n_queues  = args->n_queues;
+   int         n_threads = FLASH_Queue_get_num_threads();
+   int         n_per     = n_threads / n_queues;
    FLASH_Task* t = NULL;
 
    // Do not perform work stealing if there is only one queue.
@@ -1351,28 +1834,75 @@ FLASH_Task* FLASH_Queue_work_stealing( int queue, void *arg )
    }
    while ( q == queue );
 
+   // Prefer the nearest queue with tasks when the caches or NUMA nodes of
+   // the threads are known. Scanning from the random queue breaks ties
+   // randomly. The number of tasks is read without locking since it only
+   // guides the choice.
+   if ( args->locality || args->numa_node != NULL )
+   {
+      best = FLASH_QUEUE_MAX_DISTANCE + 1;
+      v    = -1;
+
+      for ( i = 0; i < n_queues; i++ )
+      {
+         k = ( q + i ) % n_queues;
+
+         if ( k == queue || args->wait_queue[k].n_tasks == 0 )
+            continue;
+
+         d = FLASH_Queue_thread_distance( queue * n_per, k * n_per, arg );
+
+         if ( d < best )
+         {
+            best = d;
+            v    = k;
+         }
+      }
+
+      if ( v < 0 )
+         return t;
+
+      q = v;
+   }
+
 #ifdef FLA_ENABLE_MULTITHREADING
    FLA_Lock_acquire( &(args->run_lock[q]) ); // R ***
 #endif
 
-   // If there are tasks that this thread can steal.
-   if ( args->wait_queue[q].n_tasks > 0 )
+   if ( args->heap != NULL )
    {
-      // Dequeue the last task.
-      t = args->wait_queue[q].tail;
-
-      if ( args->wait_queue[q].n_tasks == 1 )
+      // Steal a leaf of the heap, which has a low priority, and leave the
+      // tasks on the critical path to the owning thread.
+      if ( args->wait_queue[q].n_tasks > 0 )
       {
-         // Clear the queue of its only task.
-         args->wait_queue[q].head = NULL;
-         args->wait_queue[q].tail = NULL;
+         k = args->wait_queue[q].n_tasks - 1;
+
+         // Steal the warmest of the last few leaves.
+         if ( args->locality )
+            k = FLASH_Queue_heap_warmest( q, FALSE, arg );
+
+         t = FLASH_Queue_heap_remove( q, k, arg );
+         t->queue = queue;
       }
+   }
+   else if ( args->wait_queue[q].n_tasks > 0 )
+   {
+      // Dequeue the last task, or the warmest of the last few tasks.
+      t = args->wait_queue[q].tail;
+
+      if ( args->locality )
+         t = FLASH_Queue_wait_warmest( q, FALSE, arg );
+
+      // Adjust pointers in waiting queue.
+      if ( t->prev_wait == NULL )
+         args->wait_queue[q].head = t->next_wait;
       else
-      {
-         // Adjust pointers in waiting queue.
+         t->prev_wait->next_wait = t->next_wait;
+
+      if ( t->next_wait == NULL )
          args->wait_queue[q].tail = t->prev_wait;
-         args->wait_queue[q].tail->next_wait = NULL;
-      }
+      else
+         t->next_wait->prev_wait = t->prev_wait;
 
       // Reset waiting queue data about the stolen task.
       t->queue = queue;
@@ -1389,6 +1919,306 @@ FLASH_Task* FLASH_Queue_work_stealing( int queue, void *arg )
    return t;
 }
 
+
+FLASH_Task* FLASH_Queue_work_stealing_deque( int thread, void *arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_work_stealing_deque
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Task* t = NULL;
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+   FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+   int         i, q, start, d;
+   int         n_threads = FLASH_Queue_get_num_threads();
+   int         max_d     = ( args->locality || args->numa_node != NULL ?
+                             FLASH_QUEUE_MAX_DISTANCE : 0 );
+
+   // Do not perform work stealing if there is only one deque.
+   if ( n_threads == 1 )
+      return t;
+
+   // Start from a random deque not equal to the current deque.
+#ifdef FLA_ENABLE_TIDSP
+   start = rand() % ( n_threads - 1 );
+#else
+   start = lrand48() % ( n_threads - 1 );
+#endif
+
+   // Visit every other deque once, taking the oldest task from the first
+   // deque that is not empty. When the caches or NUMA nodes of the threads
+   // are known, the deques of the nearest threads are visited first.
+   for ( d = 0; d <= max_d && t == NULL; d++ )
+   {
+      for ( i = 0; i < n_threads - 1 && t == NULL; i++ )
+      {
+         q = ( thread + 1 + ( start + i ) % ( n_threads - 1 ) ) % n_threads;
+
+         if ( max_d > 0 && FLASH_Queue_thread_distance( thread, q, arg ) != d )
+            continue;
+
+         t = FLASH_Deque_steal( &(args->deque[q]) );
+      }
+   }
+
+   // The stolen task now belongs to the current thread.
+   if ( t != NULL )
+      t->queue = thread;
+#endif
+
+   return t;
+}
+
+
+int FLASH_Queue_thread_distance( int a, int b, void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_thread_distance
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+   int cpu_a, cpu_b;
+
+   // Threads sharing an L2 cache are the nearest, followed by threads
+   // sharing an L3 cache.
+   if ( args->locality )
+   {
+      cpu_a = FLASH_ATOMIC_LOAD_RELAXED( &(args->cpu[a]) );
+      cpu_b = FLASH_ATOMIC_LOAD_RELAXED( &(args->cpu[b]) );
+
+      if ( FLASH_Queue_locality_shared( cpu_a, cpu_b, 0 ) )
+         return 0;
+
+      if ( FLASH_Queue_locality_shared( cpu_a, cpu_b, 1 ) )
+         return 1;
+   }
+#endif
+
+   // Then come threads on the same NUMA node.
+   if ( args->numa_node != NULL && args->numa_node[a] == args->numa_node[b] )
+      return 2;
+
+   return FLASH_QUEUE_MAX_DISTANCE;
+}
+
+
+void FLASH_Queue_numa_place_task( FLASH_Task* t, void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_numa_place_task
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+   int            i, owner;
+   int            n_threads = FLASH_Queue_get_num_threads();
+   int            n_owners  = args->numa_length * args->numa_width;
+   FLASH_Data_aff data_aff  = FLASH_Queue_get_data_affinity();
+   dim_t          jj, kk, m, n, cs;
+   FLA_Obj        obj, blk;
+   FLA_Obj*       buf;
+
+   for ( i = 0; i < t->n_output_args + t->n_input_args; i++ )
+   {
+      // Find the correct input or output argument.
+      if ( i < t->n_output_args )
+         obj = t->output_arg[i];
+      else
+         obj = t->input_arg[i - t->n_output_args];
+
+      // Place each block of a macroblock separately.
+      if ( FLA_Obj_elemtype( obj ) == FLA_MATRIX )
+      {
+         m   = FLA_Obj_length( obj );
+         n   = FLA_Obj_width( obj );
+         cs  = FLA_Obj_col_stride( obj );
+         buf = FLASH_OBJ_PTR_AT( obj );
+      }
+      else
+      {
+         m   = 1;
+         n   = 1;
+         cs  = 1;
+         buf = &obj;
+      }
+
+      for ( jj = 0; jj < n; jj++ )
+      {
+         for ( kk = 0; kk < m; kk++ )
+         {
+            blk = *( buf + jj * cs + kk );
+
+            // Find the owner of the block as data affinity would.
+            if ( data_aff == FLASH_QUEUE_AFFINITY_1D_ROW_BLOCK_CYCLIC )
+               owner = blk.base->m_index % n_owners;
+            else if ( data_aff == FLASH_QUEUE_AFFINITY_1D_COLUMN_BLOCK_CYCLIC )
+               owner = blk.base->n_index % n_owners;
+            else
+               owner = ( blk.base->m_index % args->numa_length ) +
+                       ( blk.base->n_index % args->numa_width  ) * 
+                       args->numa_length;
+
+            FLASH_Queue_numa_place_block( blk, 
+               args->numa_node[owner * ( n_threads / n_owners )] );
+         }
+      }
+   }
+
+   return;
+}
+
+
+void FLASH_Queue_numa_count_task( FLASH_Task* t, int thread, void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_numa_count_task
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+   int            i;
+   int            node = args->numa_node[thread];
+   dim_t          jj, kk, m, n, cs;
+   FLA_Obj        obj, blk;
+   FLA_Obj*       buf;
+
+   for ( i = 0; i < t->n_output_args + t->n_input_args; i++ )
+   {
+      // Find the correct input or output argument.
+      if ( i < t->n_output_args )
+         obj = t->output_arg[i];
+      else
+         obj = t->input_arg[i - t->n_output_args];
+
+      // Count each block of a macroblock separately.
+      if ( FLA_Obj_elemtype( obj ) == FLA_MATRIX )
+      {
+         m   = FLA_Obj_length( obj );
+         n   = FLA_Obj_width( obj );
+         cs  = FLA_Obj_col_stride( obj );
+         buf = FLASH_OBJ_PTR_AT( obj );
+      }
+      else
+      {
+         m   = 1;
+         n   = 1;
+         cs  = 1;
+         buf = &obj;
+      }
+
+      for ( jj = 0; jj < n; jj++ )
+      {
+         for ( kk = 0; kk < m; kk++ )
+         {
+            blk = *( buf + jj * cs + kk );
+
+            // Blocks that were never placed are not counted.
+            if ( blk.base->numa_node == node )
+               args->numa_local[thread]++;
+            else if ( blk.base->numa_node >= 0 )
+               args->numa_remote[thread]++;
+         }
+      }
+   }
+
+   return;
+}
+
+
+
+
+void FLASH_Queue_wait_idle( int n_idle, int epoch, void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_wait_idle
+
+----------------------------------------------------------------------------*/
+{
+   int spin_budget = FLASH_Queue_get_spin_budget();
+
+   // Keep polling for tasks while within the spin budget.
+   if ( n_idle < spin_budget )
+      return;
+
+   // Then give up the core to other threads for a while.
+   if ( n_idle < 2 * spin_budget )
+   {
+#if !defined(FLA_ENABLE_WINDOWS_BUILD) && !defined(FLA_ENABLE_TIDSP)
+      sched_yield();
+#endif
+      return;
+   }
+
+#ifdef FLASH_QUEUE_ENABLE_PARKING
+   {
+      FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+      int n_tasks = FLASH_Queue_get_num_tasks();
+
+      // Finally, sleep until a task is enqueued or all tasks have committed.
+      // The epoch was read before this thread last looked for a task, so any
+      // task enqueued since then prevents it from sleeping.
+      pthread_mutex_lock( &(args->park_lock) );
+
+      // The full fence pairs with the one in FLASH_Queue_wake_idle(): each
+      // side stores to one variable and then loads the other, which only
+      // sequentially consistent ordering keeps from passing each other.
+      FLASH_ATOMIC_FETCH_ADD( &(args->n_parked), 1 );
+      FLASH_ATOMIC_FENCE();
+
+      while ( FLASH_ATOMIC_LOAD( &(args->epoch) ) == epoch &&
+              FLASH_ATOMIC_LOAD( &(args->pc) ) < n_tasks )
+         pthread_cond_wait( &(args->park_cond), &(args->park_lock) );
+
+      FLASH_ATOMIC_FETCH_ADD( &(args->n_parked), -1 );
+
+      pthread_mutex_unlock( &(args->park_lock) );
+   }
+#elif !defined(FLA_ENABLE_WINDOWS_BUILD) && !defined(FLA_ENABLE_TIDSP)
+   sched_yield();
+#endif
+
+   return;
+}
+
+
+void FLASH_Queue_wake_idle( FLA_Bool all, void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_wake_idle
+
+----------------------------------------------------------------------------*/
+{
+#ifdef FLASH_QUEUE_ENABLE_PARKING
+   FLASH_Queue_vars* args = ( FLASH_Queue_vars* ) arg;
+
+   // Announce the new work before checking for sleeping threads. Together
+   // with the order of operations in FLASH_Queue_wait_idle(), this ensures
+   // that either the sleeping thread sees the new epoch or we see it asleep.
+   FLASH_ATOMIC_FETCH_ADD( &(args->epoch), 1 );
+   FLASH_ATOMIC_FENCE();
+
+   if ( FLASH_ATOMIC_LOAD( &(args->n_parked) ) > 0 )
+   {
+      pthread_mutex_lock( &(args->park_lock) );
+
+      // Any thread can take the task from a shared queue or by stealing it
+      // from a deque, but otherwise only the threads of its queue can.
+      if ( all || ( args->deque == NULL && args->n_queues > 1 ) )
+         pthread_cond_broadcast( &(args->park_cond) );
+      else
+         pthread_cond_signal( &(args->park_cond) );
+
+      pthread_mutex_unlock( &(args->park_lock) );
+   }
+#endif
+
+   return;
+}
+
 #ifdef FLA_ENABLE_GPU
 
 void FLASH_Queue_create_gpu( int thread, void *arg )
@@ -3026,14 +3856,22 @@ void FLASH_Queue_exec_parallel( void* arg )
 
 ----------------------------------------------------------------------------*/
 {
-   int   i;
    int   n_threads = FLASH_Queue_get_num_threads();
    void* (*thread_entry_point)( void* );
+#if FLA_MULTITHREADING_MODEL == FLA_OPENMP
+   int           i;
+   FLASH_Thread* thread;
+#endif
+
+   // Determine which function to send threads to.
+   thread_entry_point = FLASH_Queue_exec_parallel_function;
+
+#if FLA_MULTITHREADING_MODEL == FLA_OPENMP
 
    // Allocate the thread structures array. Here, an array of FLASH_Thread
    // structures of length n_threads is allocated and the fields of each
    // structure set to appropriate values.
-   FLASH_Thread* thread = ( FLASH_Thread* ) FLA_malloc( n_threads * sizeof( FLASH_Thread ) );
+   thread = ( FLASH_Thread* ) FLA_malloc( n_threads * sizeof( FLASH_Thread ) );
 
    // Initialize the thread structures array.
    for ( i = 0; i < n_threads; i++ )
@@ -3043,17 +3881,8 @@ void FLASH_Queue_exec_parallel( void* arg )
 
       // Save the pointer to the necessary variables with the thread.
       thread[i].args = arg;
-
-      // The pthread object, if it was even compiled into the FLASH_Thread
-      // structure, will be initialized by the pthread implementation when we
-      // call pthread_create() and does not need to be touched at this time.
    }
 
-   // Determine which function to send threads to.
-   thread_entry_point = FLASH_Queue_exec_parallel_function;
-
-#if FLA_MULTITHREADING_MODEL == FLA_OPENMP
-
    // An OpenMP parallel for region spawns n_threads threads. Each thread
    // executes the work function with a different FLASH_Thread argument.
    // An implicit synchronization point exists at the end of the curly
@@ -3068,58 +3897,18 @@ void FLASH_Queue_exec_parallel( void* arg )
       thread_entry_point( ( void* ) &thread[i] );
    }
 
-#elif FLA_MULTITHREADING_MODEL == FLA_PTHREADS
-
-   // Create each POSIX thread needed in addition to the main thread.
-   for ( i = 1; i < n_threads; i++ )
-   {
-      int pthread_e_val;
-
-      // Create thread i with default attributes.
-      pthread_e_val = pthread_create( &(thread[i].pthread_obj),
-                                      NULL,
-                                      thread_entry_point,
-                                      ( void* ) &thread[i] );
-
-#ifdef FLA_ENABLE_INTERNAL_ERROR_CHECKING
-      FLA_Error e_val = FLA_Check_pthread_create_result( pthread_e_val );
-      FLA_Check_error_code( e_val );
-#endif
-   }
+   FLA_free( thread );
 
-   // The main thread is assigned the role of thread 0. Here we manually
-   // execute it as a worker thread.
-   thread_entry_point( ( void* ) &thread[0] );
+#elif FLA_MULTITHREADING_MODEL == FLA_PTHREADS
 
-   // Wait for non-main threads to finish.
-   for ( i = 1; i < n_threads; i++ )
-   {
-      // These two variables are declared local to this for loop since this
-      // is the only place they are needed, and since they would show up as
-      // unused variables if FLA_MULTITHREADING_MODEL == FLA_PTHREADS.
-      // Strangely, the Intel compiler produces code that results in an
-      // "unaligned access" runtime message if thread_status is declared as
-      // an int. Declaring it as a long or void* appears to force the
-      // compiler (not surprisingly) into aligning it to an 8-byte boundary.
-      int   pthread_e_val;
-      void* thread_status;
-
-      // Wait for thread i to invoke its respective pthread_exit().
-      // The return value passed to pthread_exit() is provided to us
-      // via status, if one was given.
-      pthread_e_val = pthread_join( thread[i].pthread_obj,
-                                    ( void** ) &thread_status );
-      
-#ifdef FLA_ENABLE_INTERNAL_ERROR_CHECKING
-      FLA_Error e_val = FLA_Check_pthread_join_result( pthread_e_val );
-      FLA_Check_error_code( e_val );
-#endif
-   }
+   // Hand the work function to the persistent pool of POSIX threads, in
+   // which the main thread acts as thread 0. Every thread is needed, so wait
+   // for the pool if another job holds it. The call returns once every
+   // thread has finished the work function.
+   FLASH_Queue_pool_run_all( n_threads, thread_entry_point, arg );
    
 #endif
 
-   FLA_free( thread );
-
    return;
 }
 
@@ -3148,6 +3937,14 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
    int           n_cores   = FLASH_Queue_get_cores_per_cache();
    FLA_Bool      caching   = FLASH_Queue_get_caching();
    FLA_Bool      stealing  = FLASH_Queue_get_work_stealing();
+   int           n_idle    = 0;
+   int           epoch     = 0;
+   double        idle_start = 0.0;
+   double        idle_end;
+   double        task_start = 0.0;
+   FLA_Bool      stolen    = FALSE;
+   FLA_Bool      r_stolen  = FALSE;
+   FLA_Bool      deques;
    FLA_Bool      committed = TRUE;
    FLA_Bool      condition = TRUE;
    FLA_Bool      enabled   = FALSE;
@@ -3155,7 +3952,6 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
    FLASH_Task*   t = NULL;
    FLASH_Task*   r = NULL;
    FLASH_Thread* me;
-   //cpu_set_t     cpu_set;
 
    // Interpret the thread argument as what it really is--a pointer to an
    // FLASH_Thread structure.
@@ -3167,10 +3963,13 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
    // Figure out the id of the current thread.
    i = me->id;
 
-   // Set the CPU affinity; We want the current thread i to run only on CPU i.
-   //CPU_ZERO( &cpu_set );
-   //CPU_SET( i, &cpu_set );
-   //sched_setaffinity( syscall( __NR_gettid ), sizeof(cpu_set_t), &cpu_set );
+   // Determine whether each thread owns a lock-free deque.
+   deques = ( args->deque != NULL );
+
+   // Pin the thread to a core on its NUMA node when blocks are placed on
+   // NUMA nodes.
+   if ( args->numa_node != NULL )
+      FLASH_Queue_numa_pin_thread( i );
 
    // Determine to which queue this thread belongs.
    queue = i / ( n_threads / args->n_queues );
@@ -3217,8 +4016,29 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
       FLASH_Queue_flush_hip( i, ( void* ) args );
 #endif
 
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+      // Note the number of enqueued tasks before looking for one.
+      epoch = FLASH_ATOMIC_LOAD( &(args->epoch) );
+#endif
+
+      stolen = FALSE;
+
       // Dequeue a task if there has not been one binded to thread.
-      if ( r == NULL )
+      if ( r == NULL && deques )
+      {
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+         // Obtain the newest task on this thread's deque without locking.
+         t = FLASH_Deque_pop( &(args->deque[i]) );
+
+         // Steal the oldest task from another deque if this one is empty.
+         if ( t == NULL )
+         {
+            t = FLASH_Queue_work_stealing_deque( i, ( void* ) args );
+            stolen = ( t != NULL );
+         }
+#endif
+      }
+      else if ( r == NULL )
       {
          FLA_Lock_acquire( &(args->run_lock[queue]) ); // R ***
          
@@ -3232,11 +4052,23 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
          // Obtain the binded task.
          t = r;
          r = NULL;
+         stolen = r_stolen;
       }
 
       // Dequeued a task from the waiting queue.
       available = ( t != NULL );
 
+      // Record the end of an idle period.
+      if ( available && n_idle > 0 )
+      {
+         idle_end = FLA_Clock();
+         args->idle_time[i] += idle_end - idle_start;
+         n_idle = 0;
+
+         if ( args->tracing )
+            FLASH_Queue_trace_idle( i, idle_start, idle_end );
+      }
+
       if ( available )
       {
          // Save the thread and cache that executes the task.
@@ -3249,6 +4081,9 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
             FLASH_Queue_update_cache( t, ( void* ) args );
          }        
 
+         if ( args->tracing )
+            task_start = FLA_Clock();
+
 #ifdef FLA_ENABLE_GPU         
          // Execute the task on GPU.
          committed = FLASH_Queue_exec_gpu( t, ( void* ) args );
@@ -3260,11 +4095,30 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
          FLASH_Queue_exec_task( t );
 #endif
 
+         // Record the task before it may be freed.
+         if ( args->tracing )
+            FLASH_Queue_trace_task( i, t, stolen, task_start, FLA_Clock() );
+
+         // Count the accesses to blocks on this and other NUMA nodes.
+         if ( args->numa_node != NULL )
+            FLASH_Queue_numa_count_task( t, i, ( void* ) args );
+
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+         // Tag the blocks of the task as warm in the caches of this CPU.
+         if ( args->locality )
+         {
+            FLASH_ATOMIC_STORE_RELAXED( &(args->cpu[i]), 
+                                        FLASH_Queue_locality_cpu() );
+            FLASH_Queue_locality_visit( t, args->cpu[i], TRUE );
+         }
+#endif
+
          // If the task has executed or not.
          if ( committed )
          {
             // Update task dependencies.
             r = FLASH_Task_update_dependencies( t, ( void* ) args );
+            r_stolen = FALSE;
             
             // Free the task once it executes in parallel.
             FLASH_Task_free_parallel( t, ( void* ) args );
@@ -3276,9 +4130,23 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
          {
             // Perform work stealing if there are no tasks to dequeue.
             r = FLASH_Queue_work_stealing( queue, ( void* ) args );
+            r_stolen = ( r != NULL );
          }
       }
 
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+      // Increment program counter, and wake all idle threads to terminate
+      // once the last task has committed.
+      if ( available && committed )
+      {
+         if ( FLASH_ATOMIC_FETCH_ADD( &(args->pc), 1 ) + 1 == n_tasks )
+            FLASH_Queue_wake_idle( TRUE, ( void* ) args );
+      }
+
+      // Terminate loop.
+      if ( FLASH_ATOMIC_LOAD( &(args->pc) ) >= n_tasks )
+         condition = FALSE;
+#else
       FLA_Lock_acquire( args->all_lock ); // A ***
 
       // Increment program counter.
@@ -3290,8 +4158,33 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
          condition = FALSE;
       
       FLA_Lock_release( args->all_lock ); // A ***
+#endif
+
+      // Back off when there was no task to execute.
+      if ( condition && !available && r == NULL )
+      {
+         if ( n_idle == 0 )
+            idle_start = FLA_Clock();
+
+         FLASH_Queue_wait_idle( n_idle++, epoch, ( void* ) args );
+      }
    }
 
+   // Record the idle period before termination.
+   if ( n_idle > 0 )
+   {
+      idle_end = FLA_Clock();
+      args->idle_time[i] += idle_end - idle_start;
+
+      if ( args->tracing )
+         FLASH_Queue_trace_idle( i, idle_start, idle_end );
+   }
+
+   // Restore the CPU affinity of the thread, which outlives the tasks
+   // whether it is the main thread or a worker of the thread pool.
+   if ( args->numa_node != NULL )
+      FLASH_Queue_numa_unpin_thread( i );
+
 #ifdef FLA_ENABLE_GPU
    // Destroy and flush contents of GPU back to main memory.
    FLASH_Queue_destroy_gpu( i, ( void* ) args );
@@ -3302,16 +4195,9 @@ void* FLASH_Queue_exec_parallel_function( void* arg )
    FLASH_Queue_destroy_hip( i, ( void* ) args );
    FLASH_Queue_sync_hip( );
 #endif
-   
-#if FLA_MULTITHREADING_MODEL == FLA_PTHREADS
-   // If this is a non-main thread, then exit with a zero (normal) error code.
-   // The main thread cannot call pthread_exit() because this routine never
-   // returns. The main thread must proceed so it can oversee the joining of
-   // the exited non-main pthreads.
-   if ( i != 0 )
-      pthread_exit( ( void* ) NULL );
-#endif
 
+   // Non-main threads return to the persistent pool and wait for the next
+   // execution of the queue.
    return ( void* ) NULL;
 }
 
@@ -3327,11 +4213,17 @@ FLASH_Task* FLASH_Task_update_dependencies( FLASH_Task* t, void* arg )
    int         i;
    int         q = t->queue;
    int         queue;
+#ifndef FLASH_QUEUE_ENABLE_ATOMICS
    int         thread;
    int         n_threads = FLASH_Queue_get_num_threads();
+#endif
    FLA_Bool    caching   = FLASH_Queue_get_caching();
    FLA_Bool    stealing  = FLASH_Queue_get_work_stealing();
+   FLA_Bool    sorting   = FLASH_Queue_get_sorting();
+   FLA_Bool    deques    = ( args->deque != NULL );
    FLA_Bool    available;
+   int         score;
+   int         r_score = 0;
    FLASH_Task* task;
    FLASH_Task* r = NULL;
    FLASH_Dep*  d = t->dep_arg_head;
@@ -3350,14 +4242,25 @@ FLASH_Task* FLASH_Task_update_dependencies( FLASH_Task* t, void* arg )
    // Check each dependent task.
    for ( i = 0; i < t->n_dep_args; i++ )
    {
+      task   = d->task;
+      queue  = task->queue;
+
+      // Another predecessor of the task may finish at the same time, so its
+      // queue is only assigned below by the thread that makes it ready.
       if ( stealing )
       {
          // Place all dependent tasks onto same queue as predecessor task.
-         d->task->queue = q;
+         queue = q;
+      }
+      else if ( deques )
+      {
+         // Only the deque of the executing thread may be pushed onto.
+         queue = t->thread;
       }
 
-      task   = d->task;
-      queue  = task->queue;
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+      available = ( FLASH_ATOMIC_FETCH_ADD( &(task->n_ready), -1 ) == 1 );
+#else
       thread = task->order % n_threads;
 
       FLA_Lock_acquire( &(args->dep_lock[thread]) ); // D ***
@@ -3366,12 +4269,44 @@ FLASH_Task* FLASH_Task_update_dependencies( FLASH_Task* t, void* arg )
       available = ( task->n_ready == 0 );
       
       FLA_Lock_release( &(args->dep_lock[thread]) ); // D ***
+#endif
 
       // Place newly ready tasks on waiting queue.      
       if ( available )
       {
+         task->queue = queue;
+
+         if ( deques )
+         {
+            // Keep the highest-priority ready task bound to this thread so
+            // that it executes next, and push the rest onto this thread's
+            // deque.
+            if ( sorting && ( r == NULL || r->priority < task->priority ) )
+            {
+               if ( r != NULL )
+                  FLASH_Queue_wait_enqueue( r, arg );
+
+               r = task;
+            }
+            // Otherwise keep the ready task with the most blocks still warm
+            // in the caches of this thread.
+            else if ( !sorting && args->locality &&
+                      ( score = FLASH_Queue_locality_visit( task,
+                                   args->cpu[t->thread], FALSE ) ) > r_score )
+            {
+               if ( r != NULL )
+                  FLASH_Queue_wait_enqueue( r, arg );
+
+               r       = task;
+               r_score = score;
+            }
+            else
+            {
+               FLASH_Queue_wait_enqueue( task, arg );
+            }
+         }
          // If caching is enabled and the task belongs to this thread's queue.
-         if ( caching && q == queue )
+         else if ( caching && q == queue )
          {
             // Determine if there is a new binded task.
             r = FLASH_Task_update_binding( task, r, arg );
@@ -3414,7 +4349,7 @@ FLASH_Task* FLASH_Task_update_binding( FLASH_Task* t, FLASH_Task* r,
    else
    {
       // Swap the binded task for the new ready task.
-      if ( !r->hit || ( FLASH_Queue_get_sorting() && r->height < t->height ) )
+      if ( !r->hit || ( FLASH_Queue_get_sorting() && r->priority < t->priority ) )
       {
          queue = r->queue;
          r->hit = FALSE;
@@ -3523,7 +4458,7 @@ void FLASH_Task_free_parallel( FLASH_Task* t, void* arg )
                for ( j = 0; j < k; j++ )
                {
                   next_dep = d->next_dep;
-                  FLA_free( d );
+                  FLASH_Dep_free( d );
                   d = next_dep;
                }
             }
@@ -3547,7 +4482,7 @@ void FLASH_Task_free_parallel( FLASH_Task* t, void* arg )
          for ( j = 0; j < k; j++ )
          {
             next_dep = d->next_dep;
-            FLA_free( d );
+            FLASH_Dep_free( d );
             d = next_dep;
          }
       }
@@ -3559,24 +4494,12 @@ void FLASH_Task_free_parallel( FLASH_Task* t, void* arg )
    for ( i = 0; i < t->n_dep_args; i++ )
    {
       next_dep = d->next_dep;
-      FLA_free( d );
+      FLASH_Dep_free( d );
       d = next_dep;
    }
 
-   // Free the int_arg field of t.
-   FLA_free( t->int_arg );
-   
-   // Free the fla_arg field of t.
-   FLA_free( t->fla_arg );
-
-   // Free the input_arg field of t.
-   FLA_free( t->input_arg );
-
-   // Free the output_arg field of t.
-   FLA_free( t->output_arg );
-
-   // Finally, free the struct itself.
-   FLA_free( t );
+   // Free the argument arrays and the struct itself.
+   FLASH_Task_free_memory( t );
 
    return;
 }
@@ -3606,6 +4529,7 @@ void FLASH_Queue_exec_simulation( void* arg )
    int           n_threads = FLASH_Queue_get_num_threads();
    int           n_cores   = FLASH_Queue_get_cores_per_cache();
    FLASH_Verbose verbose   = FLASH_Queue_get_verbose_output();
+   double        task_start = 0.0;
    FLASH_Task*   task;
    FLASH_Task*   t;
    FLASH_Dep*    d;
@@ -3695,7 +4619,18 @@ void FLASH_Queue_exec_simulation( void* arg )
       {
          t = exec_array[i];
          FLASH_Queue_update_cache( t, arg );
+
+         if ( args->tracing && t != NULL )
+            task_start = FLA_Clock();
+
          FLASH_Queue_exec_task( t );
+
+         if ( args->tracing && t != NULL )
+            FLASH_Queue_trace_task( i, t, FALSE, task_start, FLA_Clock() );
+
+         // Count the accesses to blocks on this and other NUMA nodes.
+         if ( t != NULL && args->numa_node != NULL )
+            FLASH_Queue_numa_count_task( t, i, arg );
          
          if ( !verbose )
             printf( "%7s", ( t == NULL ? "     " : t->name ) );
@@ -0,0 +1,445 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+
+#ifdef FLA_ENABLE_SUPERMATRIX
+
+// The node of an operand hierarchy paired with its position in a depth-first
+// enumeration of that hierarchy.
+typedef struct FLASH_Graph_node_s
+{
+   FLA_Base_obj* base;
+   int           index;
+} FLASH_Graph_node;
+
+static FLA_Bool flash_graph_capturing = FALSE;
+static int      flash_graph_n_objs    = 0;
+static FLA_Obj* flash_graph_objs      = NULL;
+
+
+FLA_Error FLASH_Queue_capture_begin( int n_objs, FLA_Obj* objs )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_capture_begin
+
+----------------------------------------------------------------------------*/
+{
+   int i;
+
+   // Record the tasks enqueued by subsequent FLASH operations on the
+   // hierarchical matrices in objs instead of executing them. Any other
+   // object referenced by the recorded tasks, such as a global constant, is
+   // reused verbatim by every replay and so must outlive the graph.
+
+   // Capturing is only possible when no other tasks are pending.
+   if ( flash_graph_capturing == TRUE ||
+        FLASH_Queue_stack_depth() != 0 ||
+        FLASH_Queue_get_enabled() == FALSE )
+      return FLA_FAILURE;
+
+   flash_graph_capturing = TRUE;
+   flash_graph_n_objs    = n_objs;
+   flash_graph_objs      = ( FLA_Obj* ) FLA_malloc( n_objs * sizeof( FLA_Obj ) );
+
+   for ( i = 0; i < n_objs; i++ )
+      flash_graph_objs[i] = objs[i];
+
+   // Hold the queue open so that the tasks are only enqueued.
+   FLASH_Queue_set_capture( TRUE );
+   FLASH_Queue_begin();
+
+   return FLA_SUCCESS;
+}
+
+
+FLA_Error FLASH_Queue_capture_end( FLASH_Graph* graph )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_capture_end
+
+----------------------------------------------------------------------------*/
+{
+   int               i, j, k;
+   int               n_tasks;
+   int               n_int_args = 0;
+   int               n_obj_args = 0;
+   int               n_deps     = 0;
+   int               n_nodes    = 0;
+   FLASH_Task*       t;
+   FLASH_Task*       next;
+   FLASH_Dep*        d;
+   FLASH_Graph_node* node;
+   FLASH_Graph_node  key;
+   FLASH_Graph_node* match;
+   FLA_Obj*          obj;
+
+   if ( flash_graph_capturing == FALSE )
+      return FLA_FAILURE;
+
+   // Close the queue without executing the recorded tasks.
+   FLASH_Queue_end();
+   FLASH_Queue_set_capture( FALSE );
+
+   flash_graph_capturing = FALSE;
+
+   n_tasks = FLASH_Queue_get_num_tasks();
+
+   // Count the arguments and dependences of the recorded tasks.
+   for ( t = FLASH_Queue_get_head_task(); t != NULL; t = t->next_task )
+   {
+      n_int_args += t->n_int_args;
+      n_obj_args += t->n_fla_args + t->n_input_args + t->n_output_args;
+      n_deps     += t->n_dep_args;
+   }
+
+   graph->n_objs      = flash_graph_n_objs;
+   graph->n_obj_nodes = ( int* ) FLA_malloc( graph->n_objs * sizeof( int ) );
+
+   for ( i = 0; i < graph->n_objs; i++ )
+   {
+      graph->n_obj_nodes[i] = FLASH_Graph_count_nodes( flash_graph_objs[i] );
+      n_nodes += graph->n_obj_nodes[i];
+   }
+
+   // Enumerate the nodes of the operands and sort them by address so that
+   // the operands of each task can be located quickly.
+   node = ( FLASH_Graph_node* ) FLA_malloc( n_nodes * sizeof( FLASH_Graph_node ) );
+
+   graph->n_nodes           = n_nodes;
+   graph->node_m            = ( dim_t* ) FLA_malloc( n_nodes * sizeof( dim_t ) );
+   graph->node_n            = ( dim_t* ) FLA_malloc( n_nodes * sizeof( dim_t ) );
+   graph->node_read_blocks  = ( int* ) FLA_malloc( n_nodes * sizeof( int ) );
+   graph->node_write_blocks = ( int* ) FLA_malloc( n_nodes * sizeof( int ) );
+
+   for ( i = 0, k = 0; i < graph->n_objs; i++ )
+      FLASH_Graph_collect_nodes( flash_graph_objs[i], node, &k );
+
+   for ( i = 0; i < n_nodes; i++ )
+   {
+      node[i].index = i;
+
+      graph->node_m[i]            = node[i].base->m;
+      graph->node_n[i]            = node[i].base->n;
+      graph->node_read_blocks[i]  = node[i].base->n_read_blocks;
+      graph->node_write_blocks[i] = node[i].base->n_write_blocks;
+   }
+
+   qsort( node, n_nodes, sizeof( FLASH_Graph_node ), FLASH_Graph_compare_nodes );
+
+   // Record each task along with its arguments and dependences.
+   graph->n_tasks  = n_tasks;
+   graph->task     = ( FLASH_Task* ) FLA_malloc( n_tasks * sizeof( FLASH_Task ) );
+   graph->int_arg  = ( int* ) FLA_malloc( n_int_args * sizeof( int ) );
+   graph->obj_arg  = ( FLA_Obj* ) FLA_malloc( n_obj_args * sizeof( FLA_Obj ) );
+   graph->obj_node = ( int* ) FLA_malloc( n_obj_args * sizeof( int ) );
+   graph->dep      = ( int* ) FLA_malloc( n_deps * sizeof( int ) );
+
+   n_int_args = 0;
+   n_obj_args = 0;
+   n_deps     = 0;
+
+   for ( t = FLASH_Queue_get_head_task(), i = 0; t != NULL; t = t->next_task, i++ )
+   {
+      for ( j = 0; j < t->n_int_args; j++ )
+         graph->int_arg[n_int_args++] = t->int_arg[j];
+
+      for ( j = 0; j < t->n_fla_args + t->n_input_args + t->n_output_args; j++ )
+      {
+         if      ( j < t->n_fla_args )
+            obj = &(t->fla_arg[j]);
+         else if ( j < t->n_fla_args + t->n_input_args )
+            obj = &(t->input_arg[j - t->n_fla_args]);
+         else
+            obj = &(t->output_arg[j - t->n_fla_args - t->n_input_args]);
+
+         key.base = obj->base;
+         match    = ( FLASH_Graph_node* ) bsearch( &key, node, n_nodes,
+                                                   sizeof( FLASH_Graph_node ),
+                                                   FLASH_Graph_compare_nodes );
+
+         graph->obj_arg[n_obj_args]  = *obj;
+         graph->obj_node[n_obj_args] = ( match != NULL ? match->index : -1 );
+         n_obj_args++;
+      }
+
+      for ( j = 0, d = t->dep_arg_head; j < t->n_dep_args; j++, d = d->next_dep )
+         graph->dep[n_deps++] = d->task->order;
+
+      // Keep a copy of the task as a template, dropping all of its links.
+      graph->task[i]              = *t;
+      graph->task[i].int_arg      = NULL;
+      graph->task[i].fla_arg      = NULL;
+      graph->task[i].input_arg    = NULL;
+      graph->task[i].output_arg   = NULL;
+      graph->task[i].dep_arg_head = NULL;
+      graph->task[i].dep_arg_tail = NULL;
+      graph->task[i].prev_task    = NULL;
+      graph->task[i].next_task    = NULL;
+      graph->task[i].prev_wait    = NULL;
+      graph->task[i].next_wait    = NULL;
+   }
+
+   // Free the recorded tasks, which also clears the dependence information
+   // stored in the operands.
+   for ( t = FLASH_Queue_get_head_task(); t != NULL; t = next )
+   {
+      next = t->next_task;
+      FLASH_Task_free( t );
+   }
+
+   FLASH_Queue_reset();
+
+   FLA_free( node );
+   FLA_free( flash_graph_objs );
+
+   flash_graph_objs   = NULL;
+   flash_graph_n_objs = 0;
+
+   return FLA_SUCCESS;
+}
+
+
+FLA_Error FLASH_Graph_replay( FLASH_Graph graph, FLA_Obj* objs )
+/*----------------------------------------------------------------------------
+
+   FLASH_Graph_replay
+
+----------------------------------------------------------------------------*/
+{
+   int               i, j, k;
+   int               n_int_args = 0;
+   int               n_obj_args = 0;
+   int               n_deps     = 0;
+   FLASH_Task*       g;
+   FLASH_Task*       t;
+   FLASH_Task**      task;
+   FLASH_Dep*        d;
+   FLA_Obj           obj;
+   FLA_Base_obj**    base;
+   FLASH_Graph_node* node;
+
+   // Execute the recorded tasks on the hierarchical matrices in objs, which
+   // must be blocked exactly like the captured matrices. The graph may only
+   // be replayed outside of any other parallel region.
+   if ( flash_graph_capturing == TRUE ||
+        FLASH_Queue_stack_depth() != 0 ||
+        FLASH_Queue_get_num_tasks() != 0 )
+      return FLA_FAILURE;
+
+   // Check that the operands are blocked like the captured operands.
+   for ( i = 0; i < graph.n_objs; i++ )
+      if ( FLASH_Graph_count_nodes( objs[i] ) != graph.n_obj_nodes[i] )
+         return FLA_FAILURE;
+
+   node = ( FLASH_Graph_node* ) FLA_malloc( graph.n_nodes * sizeof( FLASH_Graph_node ) );
+   base = ( FLA_Base_obj** ) FLA_malloc( graph.n_nodes * sizeof( FLA_Base_obj* ) );
+
+   for ( i = 0, k = 0; i < graph.n_objs; i++ )
+      FLASH_Graph_collect_nodes( objs[i], node, &k );
+
+   for ( i = 0; i < graph.n_nodes; i++ )
+   {
+      base[i] = node[i].base;
+
+      if ( base[i]->m != graph.node_m[i] || base[i]->n != graph.node_n[i] )
+      {
+         FLA_free( node );
+         FLA_free( base );
+
+         return FLA_FAILURE;
+      }
+   }
+
+   FLA_free( node );
+
+   // Restore the block identifiers that were assigned during enqueueing.
+   for ( i = 0; i < graph.n_nodes; i++ )
+   {
+      base[i]->n_read_blocks  = graph.node_read_blocks[i];
+      base[i]->n_write_blocks = graph.node_write_blocks[i];
+   }
+
+   task = ( FLASH_Task** ) FLA_malloc( graph.n_tasks * sizeof( FLASH_Task* ) );
+
+   FLASH_Queue_begin();
+
+   // Instantiate each task from its template without any dependence
+   // analysis.
+   for ( i = 0; i < graph.n_tasks; i++ )
+   {
+      g = &(graph.task[i]);
+      t = FLASH_Task_alloc( g->func, g->cntl, g->name, g->enabled_gpu,
+                            g->enabled_hip, g->n_int_args, g->n_fla_args,
+                            g->n_input_args, g->n_output_args );
+
+      for ( j = 0; j < g->n_int_args; j++ )
+         t->int_arg[j] = graph.int_arg[n_int_args++];
+
+      for ( j = 0; j < g->n_fla_args + g->n_input_args + g->n_output_args; j++ )
+      {
+         obj = graph.obj_arg[n_obj_args];
+
+         // Redirect the view to the corresponding node of the new operands.
+         if ( graph.obj_node[n_obj_args] >= 0 )
+            obj.base = base[graph.obj_node[n_obj_args]];
+
+         n_obj_args++;
+
+         if      ( j < g->n_fla_args )
+            t->fla_arg[j] = obj;
+         else if ( j < g->n_fla_args + g->n_input_args )
+            t->input_arg[j - g->n_fla_args] = obj;
+         else
+            t->output_arg[j - g->n_fla_args - g->n_input_args] = obj;
+      }
+
+      t->n_ready      = g->n_ready;
+      t->queue        = g->queue;
+      t->n_macro_args = g->n_macro_args;
+      t->n_war_args   = g->n_war_args;
+
+      FLASH_Queue_push_task( t );
+
+      task[i] = t;
+   }
+
+   // Link the dependences now that every task exists.
+   for ( i = 0; i < graph.n_tasks; i++ )
+   {
+      t = task[i];
+
+      for ( j = 0; j < graph.task[i].n_dep_args; j++ )
+      {
+         d           = FLASH_Dep_alloc();
+         d->task     = task[graph.dep[n_deps++]];
+         d->next_dep = NULL;
+
+         if ( t->n_dep_args == 0 )
+            t->dep_arg_head = d;
+         else
+            t->dep_arg_tail->next_dep = d;
+
+         t->dep_arg_tail = d;
+         t->n_dep_args++;
+      }
+   }
+
+   FLA_free( task );
+   FLA_free( base );
+
+   // Execute the tasks.
+   FLASH_Queue_end();
+
+   return FLA_SUCCESS;
+}
+
+
+void FLASH_Graph_free( FLASH_Graph* graph )
+/*----------------------------------------------------------------------------
+
+   FLASH_Graph_free
+
+----------------------------------------------------------------------------*/
+{
+   FLA_free( graph->task );
+   FLA_free( graph->int_arg );
+   FLA_free( graph->obj_arg );
+   FLA_free( graph->obj_node );
+   FLA_free( graph->dep );
+   FLA_free( graph->n_obj_nodes );
+   FLA_free( graph->node_m );
+   FLA_free( graph->node_n );
+   FLA_free( graph->node_read_blocks );
+   FLA_free( graph->node_write_blocks );
+
+   graph->n_tasks = 0;
+   graph->n_objs  = 0;
+   graph->n_nodes = 0;
+
+   return;
+}
+
+
+// --- helper functions --- ===================================================
+
+
+int FLASH_Graph_count_nodes( FLA_Obj H )
+/*----------------------------------------------------------------------------
+
+   FLASH_Graph_count_nodes
+
+----------------------------------------------------------------------------*/
+{
+   FLA_Base_obj* b = H.base;
+   FLA_Obj*      buf;
+   dim_t         i, j;
+   int           n_nodes = 1;
+
+   // Count every node of the whole hierarchy, not just of the view.
+   if ( b->elemtype == FLA_MATRIX )
+   {
+      buf = ( FLA_Obj* ) b->buffer;
+
+      for ( j = 0; j < b->n; j++ )
+         for ( i = 0; i < b->m; i++ )
+            n_nodes += FLASH_Graph_count_nodes( buf[ j * b->cs + i * b->rs ] );
+   }
+
+   return n_nodes;
+}
+
+
+void FLASH_Graph_collect_nodes( FLA_Obj H, void* node, int* k )
+/*----------------------------------------------------------------------------
+
+   FLASH_Graph_collect_nodes
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Graph_node* n = ( FLASH_Graph_node* ) node;
+   FLA_Base_obj*     b = H.base;
+   FLA_Obj*          buf;
+   dim_t             i, j;
+
+   n[*k].base = b;
+   (*k)++;
+
+   if ( b->elemtype == FLA_MATRIX )
+   {
+      buf = ( FLA_Obj* ) b->buffer;
+
+      for ( j = 0; j < b->n; j++ )
+         for ( i = 0; i < b->m; i++ )
+            FLASH_Graph_collect_nodes( buf[ j * b->cs + i * b->rs ], node, k );
+   }
+
+   return;
+}
+
+
+int FLASH_Graph_compare_nodes( const void* a, const void* b )
+/*----------------------------------------------------------------------------
+
+   FLASH_Graph_compare_nodes
+
+----------------------------------------------------------------------------*/
+{
+   const FLASH_Graph_node* x = ( const FLASH_Graph_node* ) a;
+   const FLASH_Graph_node* y = ( const FLASH_Graph_node* ) b;
+
+   if ( x->base < y->base ) return -1;
+   if ( x->base > y->base ) return  1;
+
+   return 0;
+}
+
+#endif
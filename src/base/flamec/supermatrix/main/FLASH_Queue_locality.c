@@ -0,0 +1,350 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// The cache topology can only be read from sysfs, and the CPU of a thread
+// only be queried, on Linux.
+#if defined(__linux__) && defined(_GNU_SOURCE) && !defined(FLA_ENABLE_TIDSP)
+#define FLASH_QUEUE_ENABLE_SYSFS
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+
+#ifdef FLA_ENABLE_SUPERMATRIX
+
+// The routines below track which shared caches last touched each block.
+// Level 0 refers to the L2 caches and level 1 to the L3 caches. Each cache
+// group, i.e., the set of CPUs sharing one cache, keeps a clock of the bytes
+// its CPUs have touched. A block is tagged with the group and the clock when
+// last touched, and is considered warm while fewer bytes than the size of the
+// cache have been touched since. The tags and clocks are updated with atomic
+// operations, so no locks are needed.
+
+#define FLASH_LOCALITY_MAX_CPUS  4096
+
+static FLA_Bool       flash_queue_locality_discovered = FALSE;
+static int            flash_queue_locality_n_cpus     = 0;
+static int            flash_queue_locality_n_groups[FLASH_QUEUE_LOCALITY_LEVELS];
+static dim_t          flash_queue_locality_size[FLASH_QUEUE_LOCALITY_LEVELS];
+static int*           flash_queue_locality_group[FLASH_QUEUE_LOCALITY_LEVELS];
+static unsigned long* flash_queue_locality_clock[FLASH_QUEUE_LOCALITY_LEVELS];
+
+
+#ifdef FLASH_QUEUE_ENABLE_SYSFS
+
+static FLA_Bool FLASH_Queue_locality_read( int cpu, int index, char* name,
+                                           char* line, int n_line )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_locality_read
+
+----------------------------------------------------------------------------*/
+{
+   FILE* fp;
+   char  path[128];
+   char* r;
+
+   sprintf( path, "/sys/devices/system/cpu/cpu%d/cache/index%d/%s",
+            cpu, index, name );
+
+   fp = fopen( path, "r" );
+
+   if ( fp == NULL )
+      return FALSE;
+
+   r = fgets( line, n_line, fp );
+
+   fclose( fp );
+
+   return ( r != NULL );
+}
+
+#endif
+
+
+void FLASH_Queue_locality_init( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_locality_init
+
+----------------------------------------------------------------------------*/
+{
+   int   i, k, lv;
+   int*  leader[FLASH_QUEUE_LOCALITY_LEVELS];
+#ifdef FLASH_QUEUE_ENABLE_SYSFS
+   char  line[256];
+   int   level, first;
+   dim_t size;
+   char  unit;
+#endif
+
+   // Exit early if the topology was already discovered.
+   if ( flash_queue_locality_discovered == TRUE )
+      return;
+
+   flash_queue_locality_discovered = TRUE;
+
+#ifdef FLASH_QUEUE_ENABLE_SYSFS
+   flash_queue_locality_n_cpus = min( ( int ) sysconf( _SC_NPROCESSORS_CONF ),
+                                      FLASH_LOCALITY_MAX_CPUS );
+#else
+   flash_queue_locality_n_cpus = 1;
+#endif
+
+   for ( lv = 0; lv < FLASH_QUEUE_LOCALITY_LEVELS; lv++ )
+   {
+      flash_queue_locality_n_groups[lv] = 0;
+      flash_queue_locality_size[lv]     = 0;
+      flash_queue_locality_group[lv]    = ( int* ) FLA_malloc(
+                                flash_queue_locality_n_cpus * sizeof( int ) );
+      flash_queue_locality_clock[lv]    = NULL;
+
+      leader[lv] = ( int* ) FLA_malloc( flash_queue_locality_n_cpus *
+                                        sizeof( int ) );
+
+      // By default, each CPU is the only member of its group.
+      for ( i = 0; i < flash_queue_locality_n_cpus; i++ )
+         leader[lv][i] = i;
+   }
+
+#ifdef FLASH_QUEUE_ENABLE_SYSFS
+   // Find the size of the L2 and L3 caches and the lowest numbered CPU that
+   // shares each cache, which identifies the group of that cache.
+   for ( i = 0; i < flash_queue_locality_n_cpus; i++ )
+   {
+      for ( k = 0; FLASH_Queue_locality_read( i, k, "level", line, 256 ); k++ )
+      {
+         level = atoi( line );
+
+         if ( level < 2 || level > 1 + FLASH_QUEUE_LOCALITY_LEVELS )
+            continue;
+
+         // Skip instruction caches.
+         if ( FLASH_Queue_locality_read( i, k, "type", line, 256 ) &&
+              strncmp( line, "Instruction", 11 ) == 0 )
+            continue;
+
+         lv = level - 2;
+
+         if ( FLASH_Queue_locality_read( i, k, "size", line, 256 ) )
+         {
+            size = 0;
+            unit = 'K';
+            sscanf( line, "%lu%c", &size, &unit );
+
+            if      ( unit == 'K' ) size *= 1024;
+            else if ( unit == 'M' ) size *= 1024 * 1024;
+            else if ( unit == 'G' ) size *= 1024 * 1024 * 1024;
+
+            flash_queue_locality_size[lv] = max( flash_queue_locality_size[lv],
+                                                 size );
+         }
+
+         if ( FLASH_Queue_locality_read( i, k, "shared_cpu_list", line, 256 ) &&
+              sscanf( line, "%d", &first ) == 1 && first >= 0 && first <= i )
+            leader[lv][i] = first;
+      }
+   }
+#endif
+
+   // Without topology information, treat the cache size set by the user as
+   // the size of a private L2 cache.
+   if ( flash_queue_locality_size[0] == 0 )
+      flash_queue_locality_size[0] = FLASH_Queue_get_cache_size();
+
+   // Number the groups of each level consecutively.
+   for ( lv = 0; lv < FLASH_QUEUE_LOCALITY_LEVELS; lv++ )
+   {
+      for ( i = 0; i < flash_queue_locality_n_cpus; i++ )
+      {
+         if ( leader[lv][i] == i )
+            flash_queue_locality_group[lv][i] = flash_queue_locality_n_groups[lv]++;
+         else
+            flash_queue_locality_group[lv][i] =
+               flash_queue_locality_group[lv][leader[lv][i]];
+      }
+
+      flash_queue_locality_clock[lv] = ( unsigned long* ) FLA_malloc(
+               flash_queue_locality_n_groups[lv] * sizeof( unsigned long ) );
+
+      for ( i = 0; i < flash_queue_locality_n_groups[lv]; i++ )
+         flash_queue_locality_clock[lv][i] = 0;
+
+      FLA_free( leader[lv] );
+   }
+
+   return;
+}
+
+
+void FLASH_Queue_locality_finalize( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_locality_finalize
+
+----------------------------------------------------------------------------*/
+{
+   int lv;
+
+   if ( flash_queue_locality_discovered == FALSE )
+      return;
+
+   for ( lv = 0; lv < FLASH_QUEUE_LOCALITY_LEVELS; lv++ )
+   {
+      FLA_free( flash_queue_locality_group[lv] );
+      FLA_free( flash_queue_locality_clock[lv] );
+   }
+
+   flash_queue_locality_discovered = FALSE;
+
+   return;
+}
+
+
+int FLASH_Queue_locality_cpu( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_locality_cpu
+
+----------------------------------------------------------------------------*/
+{
+   int cpu = 0;
+
+   FLASH_Queue_locality_init();
+
+#ifdef FLASH_QUEUE_ENABLE_SYSFS
+   // Query the CPU on which the calling thread currently runs.
+   cpu = sched_getcpu();
+#endif
+
+   if ( cpu < 0 || cpu >= flash_queue_locality_n_cpus )
+      return -1;
+
+   return cpu;
+}
+
+
+FLA_Bool FLASH_Queue_locality_shared( int cpu_a, int cpu_b, int level )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_locality_shared
+
+----------------------------------------------------------------------------*/
+{
+   if ( cpu_a < 0 || cpu_b < 0 || flash_queue_locality_size[level] == 0 )
+      return FALSE;
+
+   return ( flash_queue_locality_group[level][cpu_a] ==
+            flash_queue_locality_group[level][cpu_b] );
+}
+
+
+int FLASH_Queue_locality_visit( FLASH_Task* t, int cpu, FLA_Bool touch )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_locality_visit
+
+----------------------------------------------------------------------------*/
+{
+   int            score = 0;
+#ifdef FLASH_QUEUE_ENABLE_ATOMICS
+   int            i, lv, g;
+   dim_t          jj, kk, m, n, cs;
+   unsigned long  bytes, clock, tag;
+   FLA_Obj        obj, blk;
+   FLA_Obj*       buf;
+
+   if ( cpu < 0 )
+      return score;
+
+   for ( i = 0; i < t->n_output_args + t->n_input_args; i++ )
+   {
+      // Find the correct input or output argument.
+      if ( i < t->n_output_args )
+         obj = t->output_arg[i];
+      else
+         obj = t->input_arg[i - t->n_output_args];
+
+      // Visit each block of a macroblock separately.
+      if ( FLA_Obj_elemtype( obj ) == FLA_MATRIX )
+      {
+         m   = FLA_Obj_length( obj );
+         n   = FLA_Obj_width( obj );
+         cs  = FLA_Obj_col_stride( obj );
+         buf = FLASH_OBJ_PTR_AT( obj );
+      }
+      else
+      {
+         m   = 1;
+         n   = 1;
+         cs  = 1;
+         buf = &obj;
+      }
+
+      for ( jj = 0; jj < n; jj++ )
+      {
+         for ( kk = 0; kk < m; kk++ )
+         {
+            blk   = *( buf + jj * cs + kk );
+            bytes = FLA_Obj_datatype_size( FLA_Obj_datatype( blk ) ) *
+                    FLA_Obj_length( blk ) * FLA_Obj_width( blk );
+
+            for ( lv = 0; lv < FLASH_QUEUE_LOCALITY_LEVELS; lv++ )
+            {
+               if ( flash_queue_locality_size[lv] == 0 )
+                  continue;
+
+               g = flash_queue_locality_group[lv][cpu];
+
+               if ( touch )
+               {
+                  // Advance the clock of the group and tag the block with it.
+                  clock = FLASH_ATOMIC_FETCH_ADD( &(flash_queue_locality_clock[lv][g]),
+                                                  bytes ) + bytes;
+                  tag   = ( ( unsigned long ) ( g + 1 ) <<
+                            FLASH_QUEUE_LOCALITY_STAMP_BITS ) |
+                          ( clock & FLASH_QUEUE_LOCALITY_STAMP_MASK );
+
+                  FLASH_ATOMIC_STORE_RELAXED( &(blk.base->cache_tag[lv]), tag );
+               }
+               else
+               {
+                  tag = FLASH_ATOMIC_LOAD_RELAXED( &(blk.base->cache_tag[lv]) );
+
+                  if ( ( tag >> FLASH_QUEUE_LOCALITY_STAMP_BITS ) !=
+                       ( unsigned long ) ( g + 1 ) )
+                     continue;
+
+                  clock = FLASH_ATOMIC_LOAD_RELAXED( &(flash_queue_locality_clock[lv][g]) );
+
+                  // The block is warm if it has not been evicted yet. A block
+                  // warm in the L2 cache counts more than one in the L3 cache.
+                  if ( ( ( clock - tag ) & FLASH_QUEUE_LOCALITY_STAMP_MASK ) <=
+                       flash_queue_locality_size[lv] )
+                  {
+                     score += FLASH_QUEUE_LOCALITY_LEVELS - lv;
+                     break;
+                  }
+               }
+            }
+         }
+      }
+   }
+#endif
+
+   return score;
+}
+
+#endif // FLA_ENABLE_SUPERMATRIX
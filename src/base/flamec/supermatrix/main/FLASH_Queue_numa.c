@@ -0,0 +1,315 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#include <stdio.h>
+
+// Threads can only be pinned and pages only be moved between NUMA nodes on
+// Linux. Elsewhere every thread is treated as belonging to a single node.
+#if defined(__linux__) && defined(_GNU_SOURCE) && !defined(FLA_ENABLE_TIDSP)
+#define FLASH_QUEUE_ENABLE_NUMA
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+
+#ifdef FLA_ENABLE_SUPERMATRIX
+
+#ifdef FLASH_QUEUE_ENABLE_NUMA
+
+// The mbind() policy and flag used to move the pages of a block, which are
+// defined here so that the NUMA library headers are not needed.
+#define FLASH_NUMA_MPOL_BIND     2
+#define FLASH_NUMA_MPOL_MF_MOVE  ( 1 << 1 )
+
+// The largest number of nodes and CPUs read from sysfs.
+#define FLASH_NUMA_MAX_NODES     1024
+#define FLASH_NUMA_MAX_CPUS      4096
+
+// The affinity of each pinned thread before it was pinned. The workers of
+// the thread pool outlive the execution of the tasks, as the main thread
+// does, so each thread saves its own affinity in order to restore it.
+static __thread cpu_set_t flash_queue_numa_saved_mask;
+static __thread FLA_Bool  flash_queue_numa_saved = FALSE;
+
+#endif
+
+static FLA_Bool       flash_queue_numa_discovered = FALSE;
+static int            flash_queue_numa_n_nodes  = 1;
+static int            flash_queue_numa_n_cpus   = 0;
+static int*           flash_queue_numa_cpu      = NULL;
+static int*           flash_queue_numa_node     = NULL;
+
+
+#ifdef FLASH_QUEUE_ENABLE_NUMA
+
+static int FLASH_Queue_numa_read_list( char* path, int* list, int n_max )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_numa_read_list
+
+----------------------------------------------------------------------------*/
+{
+   FILE* fp;
+   int   n = 0;
+   int   first, last, i;
+   char  sep;
+
+   fp = fopen( path, "r" );
+
+   if ( fp == NULL )
+      return 0;
+
+   // Parse a sysfs list such as "0-3,8-11" into its individual values.
+   while ( fscanf( fp, "%d", &first ) == 1 )
+   {
+      last = first;
+      sep  = ( char ) fgetc( fp );
+
+      if ( sep == '-' )
+      {
+         if ( fscanf( fp, "%d", &last ) != 1 )
+            break;
+
+         sep = ( char ) fgetc( fp );
+      }
+
+      for ( i = first; i <= last && n < n_max; i++ )
+         list[n++] = i;
+
+      if ( sep != ',' )
+         break;
+   }
+
+   fclose( fp );
+
+   return n;
+}
+
+#endif
+
+
+void FLASH_Queue_numa_init( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_numa_init
+
+----------------------------------------------------------------------------*/
+{
+#ifdef FLASH_QUEUE_ENABLE_NUMA
+   char  path[64];
+   int*  nodes;
+   int*  cpus;
+   int   n_nodes, n_cpus;
+   int   i, j;
+#endif
+
+   // Exit early if the topology was already discovered.
+   if ( flash_queue_numa_discovered == TRUE )
+      return;
+
+   flash_queue_numa_discovered = TRUE;
+   flash_queue_numa_n_nodes    = 1;
+   flash_queue_numa_n_cpus     = 0;
+
+#ifdef FLASH_QUEUE_ENABLE_NUMA
+   nodes = ( int* ) FLA_malloc( FLASH_NUMA_MAX_NODES * sizeof( int ) );
+   cpus  = ( int* ) FLA_malloc( FLASH_NUMA_MAX_CPUS  * sizeof( int ) );
+
+   flash_queue_numa_cpu  = ( int* ) FLA_malloc( FLASH_NUMA_MAX_CPUS * sizeof( int ) );
+   flash_queue_numa_node = ( int* ) FLA_malloc( FLASH_NUMA_MAX_CPUS * sizeof( int ) );
+
+   n_nodes = FLASH_Queue_numa_read_list( "/sys/devices/system/node/online",
+                                         nodes, FLASH_NUMA_MAX_NODES );
+
+   // List the CPUs of each node in turn, so that consecutive threads are
+   // pinned to the same node.
+   for ( i = 0; i < n_nodes; i++ )
+   {
+      sprintf( path, "/sys/devices/system/node/node%d/cpulist", nodes[i] );
+
+      n_cpus = FLASH_Queue_numa_read_list( path, cpus, FLASH_NUMA_MAX_CPUS -
+                                                       flash_queue_numa_n_cpus );
+
+      for ( j = 0; j < n_cpus; j++ )
+      {
+         flash_queue_numa_cpu[flash_queue_numa_n_cpus]  = cpus[j];
+         flash_queue_numa_node[flash_queue_numa_n_cpus] = nodes[i];
+         flash_queue_numa_n_cpus++;
+      }
+
+      flash_queue_numa_n_nodes = max( flash_queue_numa_n_nodes, nodes[i] + 1 );
+   }
+
+   // Fall back to a single node holding every online CPU.
+   if ( flash_queue_numa_n_cpus == 0 )
+   {
+      flash_queue_numa_n_nodes = 1;
+      flash_queue_numa_n_cpus  = min( ( int ) sysconf( _SC_NPROCESSORS_ONLN ),
+                                      FLASH_NUMA_MAX_CPUS );
+
+      for ( i = 0; i < flash_queue_numa_n_cpus; i++ )
+      {
+         flash_queue_numa_cpu[i]  = i;
+         flash_queue_numa_node[i] = 0;
+      }
+   }
+
+   FLA_free( nodes );
+   FLA_free( cpus );
+#endif
+
+   return;
+}
+
+
+void FLASH_Queue_numa_finalize( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_numa_finalize
+
+----------------------------------------------------------------------------*/
+{
+   if ( flash_queue_numa_cpu != NULL )
+      FLA_free( flash_queue_numa_cpu );
+
+   if ( flash_queue_numa_node != NULL )
+      FLA_free( flash_queue_numa_node );
+
+   flash_queue_numa_cpu        = NULL;
+   flash_queue_numa_node       = NULL;
+   flash_queue_numa_discovered = FALSE;
+
+   return;
+}
+
+
+int FLASH_Queue_numa_thread_node( int thread )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_numa_thread_node
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_numa_init();
+
+   // Thread i is pinned to the ith CPU in node order.
+   if ( flash_queue_numa_n_cpus == 0 )
+      return 0;
+
+   return flash_queue_numa_node[thread % flash_queue_numa_n_cpus];
+}
+
+
+void FLASH_Queue_numa_pin_thread( int thread )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_numa_pin_thread
+
+----------------------------------------------------------------------------*/
+{
+#ifdef FLASH_QUEUE_ENABLE_NUMA
+   cpu_set_t cpu_set;
+
+   FLASH_Queue_numa_init();
+
+   if ( flash_queue_numa_n_cpus == 0 )
+      return;
+
+   // Save the affinity of the thread in order to restore it once the tasks
+   // have executed.
+   flash_queue_numa_saved = ( sched_getaffinity( 0, sizeof( cpu_set_t ),
+                                       &flash_queue_numa_saved_mask ) == 0 );
+
+   CPU_ZERO( &cpu_set );
+   CPU_SET( flash_queue_numa_cpu[thread % flash_queue_numa_n_cpus], &cpu_set );
+
+   sched_setaffinity( 0, sizeof( cpu_set_t ), &cpu_set );
+#endif
+
+   return;
+}
+
+
+void FLASH_Queue_numa_unpin_thread( int thread )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_numa_unpin_thread
+
+----------------------------------------------------------------------------*/
+{
+#ifdef FLASH_QUEUE_ENABLE_NUMA
+   if ( flash_queue_numa_saved == TRUE )
+   {
+      sched_setaffinity( 0, sizeof( cpu_set_t ), &flash_queue_numa_saved_mask );
+
+      flash_queue_numa_saved = FALSE;
+   }
+#endif
+
+   return;
+}
+
+
+void FLASH_Queue_numa_place_block( FLA_Obj obj, int node )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_numa_place_block
+
+----------------------------------------------------------------------------*/
+{
+#ifdef FLASH_QUEUE_ENABLE_NUMA
+   unsigned long  mask[FLASH_NUMA_MAX_NODES / ( 8 * sizeof( unsigned long ) )];
+   unsigned long  bits = 8 * sizeof( unsigned long );
+   size_t         page = ( size_t ) sysconf( _SC_PAGESIZE );
+   size_t         size;
+   char*          begin;
+   char*          end;
+   int            i;
+#endif
+
+   // Skip a block that already resides on the node.
+   if ( obj.base == NULL || obj.base->numa_node == node )
+      return;
+
+#ifdef FLASH_QUEUE_ENABLE_NUMA
+   size  = FLA_Obj_datatype_size( FLA_Obj_datatype( obj ) ) *
+           obj.base->n_elem_alloc;
+   begin = ( char* ) obj.base->buffer;
+   end   = begin + size;
+
+   // Round inward to whole pages, since a page shared with a neighboring
+   // block cannot be moved without moving that block as well.
+   begin = ( char* ) ( ( ( size_t ) begin + page - 1 ) / page * page );
+   end   = ( char* ) ( ( size_t ) end / page * page );
+
+   // Move the pages of the block to the node if there is more than one.
+   if ( flash_queue_numa_n_nodes > 1 && begin < end && node >= 0 &&
+        node < FLASH_NUMA_MAX_NODES )
+   {
+      for ( i = 0; i < FLASH_NUMA_MAX_NODES / bits; i++ )
+         mask[i] = 0;
+
+      mask[node / bits] = 1UL << ( node % bits );
+
+      syscall( SYS_mbind, begin, ( unsigned long ) ( end - begin ),
+               FLASH_NUMA_MPOL_BIND, mask, FLASH_NUMA_MAX_NODES + 1,
+               FLASH_NUMA_MPOL_MF_MOVE );
+   }
+#endif
+
+   obj.base->numa_node = node;
+
+   return;
+}
+
+#endif // FLA_ENABLE_SUPERMATRIX
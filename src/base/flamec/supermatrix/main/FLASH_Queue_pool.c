@@ -0,0 +1,468 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+
+#ifdef FLA_ENABLE_SUPERMATRIX
+
+#if FLA_MULTITHREADING_MODEL == FLA_PTHREADS
+
+// The worker threads are created once and then sleep between jobs, instead
+// of being created and joined for every job. The main thread always acts as
+// thread 0, so a pool of n_threads threads holds n_threads - 1 workers. The
+// pool only grows: a job that asks for fewer threads than the pool holds
+// leaves the remaining workers asleep.
+//
+// The pool is shared by the whole process, so a job holds
+// flash_queue_pool_run_lock until all of its threads have finished. A call
+// to FLASH_Queue_pool_run() that finds the pool busy, whether it is made
+// from within a job or from another application thread, does not wait for
+// it, but runs the function on the calling thread alone, as thread 0 of a
+// team of one. The function must therefore divide its work according to the
+// n_threads field of its FLASH_Thread argument. FLASH_Queue_pool_run_all()
+// instead waits for the pool, since SuperMatrix needs all of its threads.
+//
+// Every thread running a job, including one that runs it alone, is marked
+// as such for the duration of the job. SuperMatrix does not enqueue the
+// FLASH operations that such a thread calls, but executes them at once on
+// that thread, so that they neither wait on the pool that the job holds nor
+// share the queue with the other threads of the job. Should
+// FLASH_Queue_pool_run_all() still be called from within a job, it runs the
+// function on threads created for the call rather than wait for itself.
+
+typedef struct FLASH_Queue_pool_worker_s
+{
+   // The worker's view of itself as a thread of the current job.
+   FLASH_Thread  thread;
+
+   // The last job the worker has seen.
+   unsigned long job;
+} FLASH_Queue_pool_worker;
+
+typedef struct FLASH_Queue_pool_transient_s
+{
+   // A thread created for a single job run from within another job.
+   FLASH_Thread  thread;
+
+   // The function the thread runs.
+   void*       (*func)( void* );
+} FLASH_Queue_pool_transient;
+
+static int                       flash_queue_pool_n_threads = 1;
+static FLASH_Queue_pool_worker** flash_queue_pool_worker    = NULL;
+static pthread_mutex_t           flash_queue_pool_run_lock  = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t           flash_queue_pool_lock      = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t            flash_queue_pool_start     = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t            flash_queue_pool_done      = PTHREAD_COND_INITIALIZER;
+static unsigned long             flash_queue_pool_job       = 0;
+static int                       flash_queue_pool_n_job     = 0;
+static int                       flash_queue_pool_n_running = 0;
+static FLA_Bool                  flash_queue_pool_shutdown  = FALSE;
+static void*                     flash_queue_pool_args      = NULL;
+static void*                   (*flash_queue_pool_func)( void* ) = NULL;
+static __thread FLA_Bool         flash_queue_pool_in_job    = FALSE;
+
+static void FLASH_Queue_pool_grow( int n_threads );
+static void FLASH_Queue_pool_exec( int n_threads, void* (*func)( void* ), void* args );
+static void FLASH_Queue_pool_exec_transient( int n_threads, void* (*func)( void* ), void* args );
+
+
+static void* FLASH_Queue_pool_worker_function( void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_worker_function
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_pool_worker* w  = ( FLASH_Queue_pool_worker* ) arg;
+   FLASH_Thread*            me = &(w->thread);
+   void*                  (*func)( void* );
+
+   pthread_mutex_lock( &flash_queue_pool_lock );
+
+   while ( TRUE )
+   {
+      // Sleep until the next job is posted or the pool shuts down.
+      while ( flash_queue_pool_job == w->job && !flash_queue_pool_shutdown )
+         pthread_cond_wait( &flash_queue_pool_start, &flash_queue_pool_lock );
+
+      if ( flash_queue_pool_shutdown )
+         break;
+
+      w->job = flash_queue_pool_job;
+
+      // Sit out a job that needs fewer threads than the pool holds.
+      if ( me->id >= flash_queue_pool_n_job )
+         continue;
+
+      me->args      = flash_queue_pool_args;
+      me->n_threads = flash_queue_pool_n_job;
+      func          = flash_queue_pool_func;
+
+      pthread_mutex_unlock( &flash_queue_pool_lock );
+
+      flash_queue_pool_in_job = TRUE;
+
+      func( ( void* ) me );
+
+      flash_queue_pool_in_job = FALSE;
+
+      pthread_mutex_lock( &flash_queue_pool_lock );
+
+      // The last worker to finish wakes the main thread.
+      if ( --flash_queue_pool_n_running == 0 )
+         pthread_cond_signal( &flash_queue_pool_done );
+   }
+
+   pthread_mutex_unlock( &flash_queue_pool_lock );
+
+   return ( void* ) NULL;
+}
+
+
+void FLASH_Queue_pool_init( int n_threads )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_init
+
+----------------------------------------------------------------------------*/
+{
+   // Create the workers ahead of the first job that needs them.
+   pthread_mutex_lock( &flash_queue_pool_run_lock );
+   FLASH_Queue_pool_grow( n_threads );
+   pthread_mutex_unlock( &flash_queue_pool_run_lock );
+
+   return;
+}
+
+
+static void FLASH_Queue_pool_grow( int n_threads )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_grow
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_pool_worker** worker;
+   int                       i;
+   int                       pthread_e_val;
+
+   // The caller holds flash_queue_pool_run_lock, so no job is in progress
+   // and the job count cannot change until the workers below have started.
+   if ( n_threads <= flash_queue_pool_n_threads )
+      return;
+
+   worker = ( FLASH_Queue_pool_worker** ) FLA_malloc( n_threads *
+                                         sizeof( FLASH_Queue_pool_worker* ) );
+
+   for ( i = 0; i < flash_queue_pool_n_threads; i++ )
+      worker[i] = ( flash_queue_pool_worker != NULL ?
+                    flash_queue_pool_worker[i] : NULL );
+
+   if ( flash_queue_pool_worker != NULL )
+      FLA_free( flash_queue_pool_worker );
+
+   flash_queue_pool_worker = worker;
+
+   // Create each POSIX thread needed in addition to the existing ones. A new
+   // worker waits for the job after the last one posted.
+   for ( i = flash_queue_pool_n_threads; i < n_threads; i++ )
+   {
+      worker[i] = ( FLASH_Queue_pool_worker* ) FLA_malloc( sizeof( FLASH_Queue_pool_worker ) );
+
+      worker[i]->thread.id        = i;
+      worker[i]->thread.n_threads = 0;
+      worker[i]->thread.args      = NULL;
+      worker[i]->job              = flash_queue_pool_job;
+
+      pthread_e_val = pthread_create( &(worker[i]->thread.pthread_obj),
+                                      NULL,
+                                      FLASH_Queue_pool_worker_function,
+                                      ( void* ) worker[i] );
+
+#ifdef FLA_ENABLE_INTERNAL_ERROR_CHECKING
+      FLA_Error e_val = FLA_Check_pthread_create_result( pthread_e_val );
+      FLA_Check_error_code( e_val );
+#endif
+   }
+
+   flash_queue_pool_n_threads = n_threads;
+
+   return;
+}
+
+
+void FLASH_Queue_pool_finalize( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_finalize
+
+----------------------------------------------------------------------------*/
+{
+   int   i;
+   int   pthread_e_val;
+   void* thread_status;
+
+   // Let any job in progress finish first.
+   pthread_mutex_lock( &flash_queue_pool_run_lock );
+
+   if ( flash_queue_pool_worker == NULL )
+   {
+      pthread_mutex_unlock( &flash_queue_pool_run_lock );
+      return;
+   }
+
+   // Wake every worker to terminate.
+   pthread_mutex_lock( &flash_queue_pool_lock );
+   flash_queue_pool_shutdown = TRUE;
+   pthread_cond_broadcast( &flash_queue_pool_start );
+   pthread_mutex_unlock( &flash_queue_pool_lock );
+
+   for ( i = 1; i < flash_queue_pool_n_threads; i++ )
+   {
+      pthread_e_val = pthread_join( flash_queue_pool_worker[i]->thread.pthread_obj,
+                                    ( void** ) &thread_status );
+
+#ifdef FLA_ENABLE_INTERNAL_ERROR_CHECKING
+      FLA_Error e_val = FLA_Check_pthread_join_result( pthread_e_val );
+      FLA_Check_error_code( e_val );
+#endif
+
+      FLA_free( flash_queue_pool_worker[i] );
+   }
+
+   FLA_free( flash_queue_pool_worker );
+
+   flash_queue_pool_worker    = NULL;
+   flash_queue_pool_n_threads = 1;
+   flash_queue_pool_shutdown  = FALSE;
+
+   pthread_mutex_unlock( &flash_queue_pool_run_lock );
+
+   return;
+}
+
+
+void FLASH_Queue_pool_run( int n_threads, void* (*func)( void* ), void* args )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_run
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Thread self;
+   FLA_Bool     in_job;
+
+   // Run the job on the pool if it is free.
+   if ( n_threads > 1 && pthread_mutex_trylock( &flash_queue_pool_run_lock ) == 0 )
+   {
+      FLASH_Queue_pool_exec( n_threads, func, args );
+
+      pthread_mutex_unlock( &flash_queue_pool_run_lock );
+
+      return;
+   }
+
+   // Otherwise run it serially on the calling thread, which may already be
+   // running a job of its own.
+   self.id        = 0;
+   self.n_threads = 1;
+   self.args      = args;
+
+   in_job                  = flash_queue_pool_in_job;
+   flash_queue_pool_in_job = TRUE;
+
+   func( ( void* ) &self );
+
+   flash_queue_pool_in_job = in_job;
+
+   return;
+}
+
+
+void FLASH_Queue_pool_run_all( int n_threads, void* (*func)( void* ), void* args )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_run_all
+
+----------------------------------------------------------------------------*/
+{
+   // A thread running a job would wait forever on the pool it holds.
+   if ( flash_queue_pool_in_job )
+   {
+      FLASH_Queue_pool_exec_transient( n_threads, func, args );
+      return;
+   }
+
+   pthread_mutex_lock( &flash_queue_pool_run_lock );
+
+   FLASH_Queue_pool_exec( n_threads, func, args );
+
+   pthread_mutex_unlock( &flash_queue_pool_run_lock );
+
+   return;
+}
+
+
+static void FLASH_Queue_pool_exec( int n_threads, void* (*func)( void* ), void* args )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_exec
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Thread self;
+
+   // Size the pool for the most threads SuperMatrix is set to use, so that
+   // jobs asking for varying numbers of threads do not grow it piecemeal.
+   FLASH_Queue_pool_grow( max( n_threads, FLASH_Queue_get_num_threads() ) );
+
+   // Post the job to the workers.
+   pthread_mutex_lock( &flash_queue_pool_lock );
+   flash_queue_pool_func      = func;
+   flash_queue_pool_args      = args;
+   flash_queue_pool_n_job     = n_threads;
+   flash_queue_pool_n_running = n_threads - 1;
+   flash_queue_pool_job++;
+   pthread_cond_broadcast( &flash_queue_pool_start );
+   pthread_mutex_unlock( &flash_queue_pool_lock );
+
+   // The calling thread is assigned the role of thread 0.
+   self.id        = 0;
+   self.n_threads = n_threads;
+   self.args      = args;
+
+   flash_queue_pool_in_job = TRUE;
+
+   func( ( void* ) &self );
+
+   flash_queue_pool_in_job = FALSE;
+
+   // Wait for the workers to finish the job.
+   pthread_mutex_lock( &flash_queue_pool_lock );
+   while ( flash_queue_pool_n_running > 0 )
+      pthread_cond_wait( &flash_queue_pool_done, &flash_queue_pool_lock );
+   pthread_mutex_unlock( &flash_queue_pool_lock );
+
+   return;
+}
+
+
+static void* FLASH_Queue_pool_transient_function( void* arg )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_transient_function
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_pool_transient* t = ( FLASH_Queue_pool_transient* ) arg;
+
+   flash_queue_pool_in_job = TRUE;
+
+   return t->func( ( void* ) &(t->thread) );
+}
+
+
+static void FLASH_Queue_pool_exec_transient( int n_threads, void* (*func)( void* ), void* args )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_exec_transient
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Queue_pool_transient* t;
+   int                         i;
+   int                         pthread_e_val;
+   void*                       thread_status;
+
+   t = ( FLASH_Queue_pool_transient* ) FLA_malloc( n_threads *
+                                       sizeof( FLASH_Queue_pool_transient ) );
+
+   for ( i = 0; i < n_threads; i++ )
+   {
+      t[i].thread.id        = i;
+      t[i].thread.n_threads = n_threads;
+      t[i].thread.args      = args;
+      t[i].func             = func;
+   }
+
+   // Create each POSIX thread needed in addition to the calling thread,
+   // which is already marked as running a job.
+   for ( i = 1; i < n_threads; i++ )
+   {
+      pthread_e_val = pthread_create( &(t[i].thread.pthread_obj),
+                                      NULL,
+                                      FLASH_Queue_pool_transient_function,
+                                      ( void* ) &t[i] );
+
+#ifdef FLA_ENABLE_INTERNAL_ERROR_CHECKING
+      FLA_Error e_val = FLA_Check_pthread_create_result( pthread_e_val );
+      FLA_Check_error_code( e_val );
+#endif
+   }
+
+   // The calling thread is assigned the role of thread 0.
+   func( ( void* ) &(t[0].thread) );
+
+   for ( i = 1; i < n_threads; i++ )
+   {
+      pthread_e_val = pthread_join( t[i].thread.pthread_obj,
+                                    ( void** ) &thread_status );
+
+#ifdef FLA_ENABLE_INTERNAL_ERROR_CHECKING
+      FLA_Error e_val = FLA_Check_pthread_join_result( pthread_e_val );
+      FLA_Check_error_code( e_val );
+#endif
+   }
+
+   FLA_free( t );
+
+   return;
+}
+
+
+FLA_Bool FLASH_Queue_pool_in_job( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_in_job
+
+----------------------------------------------------------------------------*/
+{
+   return flash_queue_pool_in_job;
+}
+
+#else
+
+void FLASH_Queue_pool_finalize( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_finalize
+
+----------------------------------------------------------------------------*/
+{
+   // Other threading models keep their own pool of threads.
+   return;
+}
+
+
+FLA_Bool FLASH_Queue_pool_in_job( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_pool_in_job
+
+----------------------------------------------------------------------------*/
+{
+   return FALSE;
+}
+
+#endif
+
+#endif // FLA_ENABLE_SUPERMATRIX
@@ -0,0 +1,1151 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+
+#ifdef FLA_ENABLE_SUPERMATRIX
+
+// Each task kind pairs the function that is enqueued with an invoker that
+// unpacks the arguments of the task and calls that function. The invoker is
+// looked up once when the task is created, so executing a task costs a
+// single indirect call regardless of its kind. The optional cost model
+// estimates the flops of a task for priority scheduling.
+typedef struct FLASH_Task_kind_s
+{
+   void*              func;
+   FLASH_Task_invoker invoker;
+   FLASH_Task_cost    cost;
+} FLASH_Task_kind;
+
+static FLASH_Task_kind flash_queue_task_kinds[FLASH_QUEUE_MAX_TASK_KINDS];
+static FLA_Bool        flash_queue_task_kinds_initialized = FALSE;
+
+
+// Define function pointer types for the built-in task kinds.
+
+// LAPACK-level
+typedef FLA_Error(*flash_lu_piv_macro_p)(FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
+typedef FLA_Error(*flash_apply_pivots_macro_p)(FLA_Side side, FLA_Trans trans, FLA_Obj p, FLA_Obj A, fla_appiv_t* cntl);
+typedef FLA_Error(*flash_lu_piv_p)(FLA_Obj A, FLA_Obj p, fla_lu_t* cntl);
+typedef FLA_Error(*flash_lu_piv_copy_p)(FLA_Obj A, FLA_Obj p, FLA_Obj U, fla_lu_t* cntl);
+typedef FLA_Error(*flash_trsm_piv_p)(FLA_Obj A, FLA_Obj C, FLA_Obj p, fla_trsm_t* cntl);
+typedef FLA_Error(*flash_sa_lu_p)(FLA_Obj U, FLA_Obj D, FLA_Obj p, FLA_Obj L, int nb_alg, fla_lu_t* cntl);
+typedef FLA_Error(*flash_sa_fs_p)(FLA_Obj L, FLA_Obj D, FLA_Obj p, FLA_Obj C, FLA_Obj E, int nb_alg, fla_gemm_t* cntl);
+typedef FLA_Error(*flash_lu_nopiv_p)(FLA_Obj A, fla_lu_t* cntl);
+typedef FLA_Error(*flash_ldlt_piv_panel_p)(FLA_Obj A, FLA_Obj p, FLA_Obj L, FLA_Obj W, FLA_Obj s, int offset, fla_ldlt_t* cntl);
+typedef FLA_Error(*flash_ldlt_piv_update_p)(FLA_Obj L, FLA_Obj W, FLA_Obj A, fla_gemm_t* cntl);
+typedef FLA_Error(*flash_trinv_p)(FLA_Uplo uplo, FLA_Diag diag, FLA_Obj A, fla_trinv_t* cntl);
+typedef FLA_Error(*flash_ttmm_p)(FLA_Uplo uplo, FLA_Obj A, fla_ttmm_t* cntl);
+typedef FLA_Error(*flash_chol_p)(FLA_Uplo uplo, FLA_Obj A, fla_chol_t* cntl);
+typedef FLA_Error(*flash_sylv_p)(FLA_Trans transa, FLA_Trans transb, FLA_Obj isgn, FLA_Obj A, FLA_Obj B, FLA_Obj C, FLA_Obj scale, fla_sylv_t* cntl);
+typedef FLA_Error(*flash_lyap_p)(FLA_Trans trans, FLA_Obj isgn, FLA_Obj A, FLA_Obj C, FLA_Obj scale, fla_lyap_t* cntl);
+typedef FLA_Error(*flash_qrut_macro_p)(FLA_Obj A, FLA_Obj T, fla_qrut_t* cntl);
+typedef FLA_Error(*flash_qrut_p)(FLA_Obj A, FLA_Obj T, fla_qrut_t* cntl);
+typedef FLA_Error(*flash_qrutc_p)(FLA_Obj A, FLA_Obj T, FLA_Obj U, fla_qrut_t* cntl);
+typedef FLA_Error(*flash_qr2ut_p)(FLA_Obj B, FLA_Obj D, FLA_Obj T, fla_qr2ut_t* cntl);
+typedef FLA_Error(*flash_lqut_macro_p)(FLA_Obj A, FLA_Obj T, fla_lqut_t* cntl);
+typedef FLA_Error(*flash_caqr2ut_p)(FLA_Obj B, FLA_Obj D, FLA_Obj T, fla_caqr2ut_t* cntl);
+typedef FLA_Error(*flash_uddateut_p)(FLA_Obj R, FLA_Obj C, FLA_Obj D, FLA_Obj T, fla_uddateut_t* cntl);
+typedef FLA_Error(*flash_apqut_p)(FLA_Side side, FLA_Trans trans, FLA_Direct direct, FLA_Store storev, FLA_Obj A, FLA_Obj T, FLA_Obj W, FLA_Obj B, fla_apqut_t* cntl);
+typedef FLA_Error(*flash_apq2ut_p)(FLA_Side side, FLA_Trans trans, FLA_Direct direct, FLA_Store storev, FLA_Obj D, FLA_Obj T, FLA_Obj W, FLA_Obj C, FLA_Obj E, fla_apq2ut_t* cntl);
+typedef FLA_Error(*flash_apcaq2ut_p)(FLA_Side side, FLA_Trans trans, FLA_Direct direct, FLA_Store storev, FLA_Obj D, FLA_Obj T, FLA_Obj W, FLA_Obj C, FLA_Obj E, fla_apcaq2ut_t* cntl);
+typedef FLA_Error(*flash_apqudut_p)(FLA_Side side, FLA_Trans trans, FLA_Direct direct, FLA_Store storev, FLA_Obj T, FLA_Obj W, FLA_Obj R, FLA_Obj U, FLA_Obj C, FLA_Obj V, FLA_Obj D, fla_apqudut_t* cntl);
+typedef FLA_Error(*flash_eig_gest_p)(FLA_Inv inv, FLA_Uplo uplo, FLA_Obj A, FLA_Obj Y, FLA_Obj B, fla_eig_gest_t* cntl);
+
+// Level-3 BLAS
+typedef FLA_Error(*flash_gemm_p)(FLA_Trans transa, FLA_Trans transb, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_gemm_t* cntl);
+typedef FLA_Error(*flash_hemm_p)(FLA_Side side, FLA_Uplo uplo, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_hemm_t* cntl);
+typedef FLA_Error(*flash_herk_p)(FLA_Uplo uplo, FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj beta, FLA_Obj C, fla_herk_t* cntl);
+typedef FLA_Error(*flash_her2k_p)(FLA_Uplo uplo, FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_her2k_t* cntl);
+typedef FLA_Error(*flash_symm_p)(FLA_Side side, FLA_Uplo uplo, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_symm_t* cntl);
+typedef FLA_Error(*flash_syrk_p)(FLA_Uplo uplo, FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj beta, FLA_Obj C, fla_syrk_t* cntl);
+typedef FLA_Error(*flash_syr2k_p)(FLA_Uplo uplo, FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, FLA_Obj beta, FLA_Obj C, fla_syr2k_t* cntl);
+typedef FLA_Error(*flash_trmm_p)(FLA_Side side, FLA_Uplo uplo, FLA_Trans trans, FLA_Diag diag, FLA_Obj alpha, FLA_Obj A, FLA_Obj C, fla_trmm_t* cntl);
+typedef FLA_Error(*flash_trsm_p)(FLA_Side side, FLA_Uplo uplo, FLA_Trans trans, FLA_Diag diag, FLA_Obj alpha, FLA_Obj A, FLA_Obj C, fla_trsm_t* cntl);
+
+// Level-2 BLAS
+typedef FLA_Error(*flash_gemv_p)(FLA_Trans transa, FLA_Obj alpha, FLA_Obj A, FLA_Obj x, FLA_Obj beta, FLA_Obj y, fla_gemv_t* cntl);
+typedef FLA_Error(*flash_trsv_p)(FLA_Uplo uplo, FLA_Trans trans, FLA_Diag diag, FLA_Obj A, FLA_Obj x, fla_trsv_t* cntl);
+
+// Level-1 BLAS
+typedef FLA_Error(*flash_axpy_p)(FLA_Obj alpha, FLA_Obj A, FLA_Obj B, fla_axpy_t* cntl);
+typedef FLA_Error(*flash_axpyt_p)(FLA_Trans trans, FLA_Obj alpha, FLA_Obj A, FLA_Obj B, fla_axpyt_t* cntl);
+typedef FLA_Error(*flash_copy_p)(FLA_Obj A, FLA_Obj B, fla_copy_t* cntl);
+typedef FLA_Error(*flash_copyt_p)(FLA_Trans trans, FLA_Obj A, FLA_Obj B, fla_copyt_t* cntl);
+typedef FLA_Error(*flash_copyr_p)(FLA_Uplo uplo, FLA_Obj A, FLA_Obj B, fla_copyr_t* cntl);
+typedef FLA_Error(*flash_scal_p)(FLA_Obj alpha, FLA_Obj A, fla_scal_t* cntl);
+typedef FLA_Error(*flash_scalr_p)(FLA_Uplo uplo, FLA_Obj alpha, FLA_Obj A, fla_scalr_t* cntl);
+
+// Base
+typedef FLA_Error(*flash_obj_create_buffer_p)(dim_t rs, dim_t cs, FLA_Obj A, void* cntl);
+typedef FLA_Error(*flash_obj_free_buffer_p)(FLA_Obj A, void* cntl);
+
+
+// --- built-in invokers ------------------------------------------------------
+
+// FLA_LU_piv_macro
+static void FLASH_Task_invoke_LU_piv_macro( FLASH_Task* t )
+{
+   flash_lu_piv_macro_p func = (flash_lu_piv_macro_p) t->func;
+
+   func(               t->output_arg[0],
+                       t->output_arg[1],
+         ( fla_lu_t* ) t->cntl );
+}
+
+
+// FLA_Apply_pivots_macro
+static void FLASH_Task_invoke_Apply_pivots_macro( FLASH_Task* t )
+{
+   flash_apply_pivots_macro_p func = (flash_apply_pivots_macro_p) t->func;
+
+   func( ( FLA_Side  )    t->int_arg[0],
+         ( FLA_Trans )    t->int_arg[1],
+                          t->input_arg[0],
+                          t->output_arg[0],
+         ( fla_appiv_t* ) t->cntl );
+}
+
+
+// FLA_LU_piv
+static void FLASH_Task_invoke_LU_piv( FLASH_Task* t )
+{
+   flash_lu_piv_p func = (flash_lu_piv_p) t->func;
+
+   func(               t->output_arg[0],
+                       t->fla_arg[0],
+         ( fla_lu_t* ) t->cntl );
+}
+
+
+// FLA_LU_piv_copy
+static void FLASH_Task_invoke_LU_piv_copy( FLASH_Task* t )
+{
+   flash_lu_piv_copy_p func = (flash_lu_piv_copy_p) t->func;
+
+   func(               t->output_arg[0],
+                       t->fla_arg[0],
+                       t->output_arg[1],
+         ( fla_lu_t* ) t->cntl );
+}
+
+
+// FLA_Trsm_piv
+static void FLASH_Task_invoke_Trsm_piv( FLASH_Task* t )
+{
+   flash_trsm_piv_p func = (flash_trsm_piv_p) t->func;
+
+   func(                 t->input_arg[0],
+                         t->output_arg[0],
+                         t->fla_arg[0],
+         ( fla_trsm_t* ) t->cntl );
+}
+
+
+// FLA_SA_LU
+static void FLASH_Task_invoke_SA_LU( FLASH_Task* t )
+{
+   flash_sa_lu_p func = (flash_sa_lu_p) t->func;
+
+   func(               t->output_arg[1],
+                       t->output_arg[0],
+                       t->fla_arg[0],
+                       t->fla_arg[1],
+                       t->int_arg[0],
+         ( fla_lu_t* ) t->cntl );
+}
+
+
+// FLA_SA_FS
+static void FLASH_Task_invoke_SA_FS( FLASH_Task* t )
+{
+   flash_sa_fs_p func = (flash_sa_fs_p) t->func;
+
+   func(                 t->fla_arg[0],
+                         t->input_arg[0],
+                         t->fla_arg[1],                          
+                         t->output_arg[1],
+                         t->output_arg[0],
+                         t->int_arg[0],
+         ( fla_gemm_t* ) t->cntl );
+}
+
+
+// FLA_LU_nopiv
+static void FLASH_Task_invoke_LU_nopiv( FLASH_Task* t )
+{
+   flash_lu_nopiv_p func = (flash_lu_nopiv_p) t->func;
+
+   func(               t->output_arg[0],
+         ( fla_lu_t* ) t->cntl );
+}
+
+
+// FLA_LDLT_piv_panel
+static void FLASH_Task_invoke_LDLT_piv_panel( FLASH_Task* t )
+{
+   flash_ldlt_piv_panel_p func = (flash_ldlt_piv_panel_p) t->func;
+
+   func(                 t->output_arg[0],
+                         t->output_arg[1],
+                         t->output_arg[2],
+                         t->output_arg[3],
+                         t->output_arg[4],
+                         t->int_arg[0],
+         ( fla_ldlt_t* ) t->cntl );
+}
+
+
+// FLA_LDLT_piv_update
+static void FLASH_Task_invoke_LDLT_piv_update( FLASH_Task* t )
+{
+   flash_ldlt_piv_update_p func = (flash_ldlt_piv_update_p) t->func;
+
+   func(                 t->input_arg[0],
+                         t->input_arg[1],
+                         t->output_arg[0],
+         ( fla_gemm_t* ) t->cntl );
+}
+
+
+// FLA_Trinv
+static void FLASH_Task_invoke_Trinv( FLASH_Task* t )
+{
+   flash_trinv_p func = (flash_trinv_p) t->func;
+
+   func( ( FLA_Uplo     ) t->int_arg[0],
+         ( FLA_Diag     ) t->int_arg[1],
+                          t->output_arg[0],
+         ( fla_trinv_t* ) t->cntl );
+}
+
+
+// FLA_Ttmm
+static void FLASH_Task_invoke_Ttmm( FLASH_Task* t )
+{
+   flash_ttmm_p func = (flash_ttmm_p) t->func;
+
+   func( ( FLA_Uplo    ) t->int_arg[0],
+                         t->output_arg[0],
+         ( fla_ttmm_t* ) t->cntl );
+}
+
+
+// FLA_Chol
+static void FLASH_Task_invoke_Chol( FLASH_Task* t )
+{
+   flash_chol_p func = (flash_chol_p) t->func;
+
+   func( ( FLA_Uplo    ) t->int_arg[0],
+                         t->output_arg[0],
+         ( fla_chol_t* ) t->cntl );
+}
+
+
+// FLA_Sylv
+static void FLASH_Task_invoke_Sylv( FLASH_Task* t )
+{
+   flash_sylv_p func = (flash_sylv_p) t->func;
+
+   func( ( FLA_Trans   ) t->int_arg[0],
+         ( FLA_Trans   ) t->int_arg[1],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->input_arg[1],
+                         t->output_arg[0],
+                         t->fla_arg[1],
+         ( fla_sylv_t* ) t->cntl );
+}
+
+
+// FLA_Lyap
+static void FLASH_Task_invoke_Lyap( FLASH_Task* t )
+{
+   flash_lyap_p func = (flash_lyap_p) t->func;
+
+   func( ( FLA_Trans   ) t->int_arg[0],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->output_arg[0],
+                         t->fla_arg[1],
+         ( fla_lyap_t* ) t->cntl );
+}
+
+
+// FLA_QR_UT_macro
+static void FLASH_Task_invoke_QR_UT_macro( FLASH_Task* t )
+{
+   flash_qrut_macro_p func = (flash_qrut_macro_p) t->func;
+
+   func(                 t->output_arg[0],
+                         t->output_arg[1],
+         ( fla_qrut_t* ) t->cntl );
+}
+
+
+// FLA_QR_UT
+static void FLASH_Task_invoke_QR_UT( FLASH_Task* t )
+{
+   flash_qrut_p func = (flash_qrut_p) t->func;
+
+   func(                 t->output_arg[0],
+                         t->fla_arg[0],
+         ( fla_qrut_t* ) t->cntl );
+}
+
+
+// FLA_QR_UT_copy
+static void FLASH_Task_invoke_QR_UT_copy( FLASH_Task* t )
+{
+   flash_qrutc_p func = (flash_qrutc_p) t->func;
+
+   func(                 t->output_arg[0],
+                         t->fla_arg[0],
+                         t->output_arg[1],
+         ( fla_qrut_t* ) t->cntl );
+}
+
+
+// FLA_QR2_UT
+static void FLASH_Task_invoke_QR2_UT( FLASH_Task* t )
+{
+   flash_qr2ut_p func = (flash_qr2ut_p) t->func;
+
+   func(                 t->output_arg[1],
+                         t->output_arg[0],
+                         t->fla_arg[0],
+        ( fla_qr2ut_t* ) t->cntl );
+}
+
+
+// FLA_LQ_UT_macro
+static void FLASH_Task_invoke_LQ_UT_macro( FLASH_Task* t )
+{
+   flash_lqut_macro_p func = (flash_lqut_macro_p) t->func;
+
+   func(                 t->output_arg[0],
+                         t->output_arg[1],
+         ( fla_lqut_t* ) t->cntl );
+}
+
+
+// FLA_CAQR2_UT
+static void FLASH_Task_invoke_CAQR2_UT( FLASH_Task* t )
+{
+   flash_caqr2ut_p func = (flash_caqr2ut_p) t->func;
+
+   func(                 t->output_arg[1],
+                         t->output_arg[0],
+                         t->fla_arg[0],
+      ( fla_caqr2ut_t* ) t->cntl );
+}
+
+
+// FLA_UDdate_UT
+static void FLASH_Task_invoke_UDdate_UT( FLASH_Task* t )
+{
+   flash_uddateut_p func = (flash_uddateut_p) t->func;
+
+   func(                 t->output_arg[0],
+                         t->output_arg[1],
+                         t->output_arg[2],
+                         t->output_arg[3],
+     ( fla_uddateut_t* ) t->cntl );
+}
+
+
+// FLA_Apply_Q_UT
+static void FLASH_Task_invoke_Apply_Q_UT( FLASH_Task* t )
+{
+   flash_apqut_p func = (flash_apqut_p) t->func;
+
+   func( ( FLA_Side     ) t->int_arg[0],
+         ( FLA_Trans    ) t->int_arg[1],
+         ( FLA_Direct   ) t->int_arg[2],
+         ( FLA_Store    ) t->int_arg[3],
+                          t->input_arg[0],
+                          t->fla_arg[0],
+                          t->output_arg[1],
+                          t->output_arg[0],
+         ( fla_apqut_t* ) t->cntl );
+}
+
+
+// FLA_Apply_Q2_UT
+static void FLASH_Task_invoke_Apply_Q2_UT( FLASH_Task* t )
+{
+   flash_apq2ut_p func = (flash_apq2ut_p) t->func;
+
+   func( ( FLA_Side      ) t->int_arg[0],
+         ( FLA_Trans     ) t->int_arg[1],
+         ( FLA_Direct    ) t->int_arg[2],
+         ( FLA_Store     ) t->int_arg[3],
+                           t->input_arg[0],
+                           t->fla_arg[0],
+                           t->output_arg[2],
+                           t->output_arg[1],
+                           t->output_arg[0],
+         ( fla_apq2ut_t* ) t->cntl );
+}
+
+
+// FLA_Apply_CAQ2_UT
+static void FLASH_Task_invoke_Apply_CAQ2_UT( FLASH_Task* t )
+{
+   flash_apcaq2ut_p func = (flash_apcaq2ut_p) t->func;
+
+   func( ( FLA_Side      ) t->int_arg[0],
+         ( FLA_Trans     ) t->int_arg[1],
+         ( FLA_Direct    ) t->int_arg[2],
+         ( FLA_Store     ) t->int_arg[3],
+                           t->input_arg[0],
+                           t->fla_arg[0],
+                           t->output_arg[2],
+                           t->output_arg[1],
+                           t->output_arg[0],
+       ( fla_apcaq2ut_t* ) t->cntl );
+}
+
+
+// FLA_Apply_QUD_UT
+static void FLASH_Task_invoke_Apply_QUD_UT( FLASH_Task* t )
+{
+   flash_apqudut_p func = (flash_apqudut_p) t->func;
+
+   func( ( FLA_Side       ) t->int_arg[0],
+         ( FLA_Trans      ) t->int_arg[1],
+         ( FLA_Direct     ) t->int_arg[2],
+         ( FLA_Store      ) t->int_arg[3],
+                            t->input_arg[0],
+                            t->output_arg[0],
+                            t->output_arg[1],
+                            t->input_arg[1],
+                            t->output_arg[2],
+                            t->input_arg[2],
+                            t->output_arg[3],
+         ( fla_apqudut_t* ) t->cntl );
+}
+
+
+// FLA_Eig_gest
+static void FLASH_Task_invoke_Eig_gest( FLASH_Task* t )
+{
+   flash_eig_gest_p func = (flash_eig_gest_p) t->func;
+
+   func( ( FLA_Inv         ) t->int_arg[0],
+         ( FLA_Uplo        ) t->int_arg[1],
+                             t->output_arg[1],
+                             t->output_arg[0],
+                             t->input_arg[0],
+         ( fla_eig_gest_t* ) t->cntl );
+}
+
+
+// FLA_Gemm
+static void FLASH_Task_invoke_Gemm( FLASH_Task* t )
+{
+   flash_gemm_p func = (flash_gemm_p) t->func;
+
+   func( ( FLA_Trans   ) t->int_arg[0],
+         ( FLA_Trans   ) t->int_arg[1],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->input_arg[1],
+                         t->fla_arg[1],
+                         t->output_arg[0],
+         ( fla_gemm_t* ) t->cntl );
+}
+
+
+// FLA_Hemm
+static void FLASH_Task_invoke_Hemm( FLASH_Task* t )
+{
+   flash_hemm_p func = (flash_hemm_p) t->func;
+
+   func( ( FLA_Side    ) t->int_arg[0],
+         ( FLA_Uplo    ) t->int_arg[1],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->input_arg[1],
+                         t->fla_arg[1],
+                         t->output_arg[0],
+         ( fla_hemm_t* ) t->cntl );
+}
+
+
+// FLA_Herk
+static void FLASH_Task_invoke_Herk( FLASH_Task* t )
+{
+   flash_herk_p func = (flash_herk_p) t->func;
+
+   func( ( FLA_Uplo    ) t->int_arg[0],
+         ( FLA_Trans   ) t->int_arg[1],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->fla_arg[1],
+                         t->output_arg[0],
+         ( fla_herk_t* ) t->cntl );
+}
+
+
+// FLA_Her2k
+static void FLASH_Task_invoke_Her2k( FLASH_Task* t )
+{
+   flash_her2k_p func = (flash_her2k_p) t->func;
+
+   func( ( FLA_Uplo     ) t->int_arg[0],
+         ( FLA_Trans    ) t->int_arg[1],
+                          t->fla_arg[0],
+                          t->input_arg[0],
+                          t->input_arg[1],
+                          t->fla_arg[1],
+                          t->output_arg[0],
+         ( fla_her2k_t* ) t->cntl );
+}
+
+
+// FLA_Symm
+static void FLASH_Task_invoke_Symm( FLASH_Task* t )
+{
+   flash_symm_p func = (flash_symm_p) t->func;
+
+   func( ( FLA_Side    ) t->int_arg[0],
+         ( FLA_Uplo    ) t->int_arg[1],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->input_arg[1],
+                         t->fla_arg[1],
+                         t->output_arg[0],
+         ( fla_symm_t* ) t->cntl );
+}
+
+
+// FLA_Syrk
+static void FLASH_Task_invoke_Syrk( FLASH_Task* t )
+{
+   flash_syrk_p func = (flash_syrk_p) t->func;
+
+   func( ( FLA_Uplo    ) t->int_arg[0],
+         ( FLA_Trans   ) t->int_arg[1],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->fla_arg[1],
+                         t->output_arg[0],
+         ( fla_syrk_t* ) t->cntl );
+}
+
+
+// FLA_Syr2k
+static void FLASH_Task_invoke_Syr2k( FLASH_Task* t )
+{
+   flash_syr2k_p func = (flash_syr2k_p) t->func;
+
+   func( ( FLA_Uplo     ) t->int_arg[0],
+         ( FLA_Trans    ) t->int_arg[1],
+                          t->fla_arg[0],
+                          t->input_arg[0],
+                          t->input_arg[1],
+                          t->fla_arg[1],
+                          t->output_arg[0],
+         ( fla_syr2k_t* ) t->cntl );
+}
+
+
+// FLA_Trmm
+static void FLASH_Task_invoke_Trmm( FLASH_Task* t )
+{
+   flash_trmm_p func = (flash_trmm_p) t->func;
+
+   func( ( FLA_Side    ) t->int_arg[0],
+         ( FLA_Uplo    ) t->int_arg[1],
+         ( FLA_Trans   ) t->int_arg[2],
+         ( FLA_Diag    ) t->int_arg[3],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->output_arg[0],
+         ( fla_trmm_t* ) t->cntl );
+}
+
+
+// FLA_Trsm
+static void FLASH_Task_invoke_Trsm( FLASH_Task* t )
+{
+   flash_trsm_p func = (flash_trsm_p) t->func;
+
+   func( ( FLA_Side    ) t->int_arg[0],
+         ( FLA_Uplo    ) t->int_arg[1],
+         ( FLA_Trans   ) t->int_arg[2],
+         ( FLA_Diag    ) t->int_arg[3],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->output_arg[0],
+         ( fla_trsm_t* ) t->cntl );
+}
+
+
+// FLA_Gemv
+static void FLASH_Task_invoke_Gemv( FLASH_Task* t )
+{
+   flash_gemv_p func = (flash_gemv_p) t->func;
+
+   func( ( FLA_Trans   ) t->int_arg[0],
+                         t->fla_arg[0],
+                         t->input_arg[0],
+                         t->input_arg[1],
+                         t->fla_arg[1],
+                         t->output_arg[0],
+         ( fla_gemv_t* ) t->cntl );
+}
+
+
+// FLA_Trsv
+static void FLASH_Task_invoke_Trsv( FLASH_Task* t )
+{
+   flash_trsv_p func = (flash_trsv_p) t->func;
+
+   func( ( FLA_Uplo    ) t->int_arg[0],
+         ( FLA_Trans   ) t->int_arg[1],
+         ( FLA_Diag    ) t->int_arg[2],
+                         t->input_arg[0],
+                         t->output_arg[0],
+         ( fla_trsv_t* ) t->cntl );
+}
+
+
+// FLA_Axpy
+static void FLASH_Task_invoke_Axpy( FLASH_Task* t )
+{
+   flash_axpy_p func = (flash_axpy_p) t->func;
+
+   func(                 t->fla_arg[0],
+                         t->input_arg[0],
+                         t->output_arg[0],
+         ( fla_axpy_t* ) t->cntl );
+}
+
+
+// FLA_Axpyt
+static void FLASH_Task_invoke_Axpyt( FLASH_Task* t )
+{
+   flash_axpyt_p func = (flash_axpyt_p) t->func;
+
+   func( ( FLA_Trans    ) t->int_arg[0],
+                          t->fla_arg[0],
+                          t->input_arg[0],
+                          t->output_arg[0],
+         ( fla_axpyt_t* ) t->cntl );
+}
+
+
+// FLA_Copy
+static void FLASH_Task_invoke_Copy( FLASH_Task* t )
+{
+   flash_copy_p func = (flash_copy_p) t->func;
+
+   func(                 t->input_arg[0],
+                         t->output_arg[0],
+         ( fla_copy_t* ) t->cntl );
+}
+
+
+// FLA_Copyt
+static void FLASH_Task_invoke_Copyt( FLASH_Task* t )
+{
+   flash_copyt_p func = (flash_copyt_p) t->func;
+
+   func( ( FLA_Trans    ) t->int_arg[0],
+                          t->input_arg[0],
+                          t->output_arg[0],
+         ( fla_copyt_t* ) t->cntl );
+}
+
+
+// FLA_Copyr
+static void FLASH_Task_invoke_Copyr( FLASH_Task* t )
+{
+   flash_copyr_p func = (flash_copyr_p) t->func;
+
+   func( ( FLA_Uplo     ) t->int_arg[0],
+                          t->input_arg[0],
+                          t->output_arg[0],
+         ( fla_copyr_t* ) t->cntl );
+}
+
+
+// FLA_Scal
+static void FLASH_Task_invoke_Scal( FLASH_Task* t )
+{
+   flash_scal_p func = (flash_scal_p) t->func;
+
+   func(                 t->fla_arg[0],
+                         t->output_arg[0],
+         ( fla_scal_t* ) t->cntl );
+}
+
+
+// FLA_Scalr
+static void FLASH_Task_invoke_Scalr( FLASH_Task* t )
+{
+   flash_scalr_p func = (flash_scalr_p) t->func;
+
+   func( ( FLA_Uplo     ) t->int_arg[0],
+                          t->fla_arg[0],
+                          t->output_arg[0],
+         ( fla_scalr_t* ) t->cntl );
+}
+
+
+// FLA_Obj_create_buffer
+static void FLASH_Task_invoke_Obj_create_buffer( FLASH_Task* t )
+{
+   flash_obj_create_buffer_p func = (flash_obj_create_buffer_p) t->func;
+
+   func( ( dim_t       ) t->int_arg[0],
+         ( dim_t       ) t->int_arg[1],
+                         t->output_arg[0],
+                         t->cntl );
+}
+
+
+// FLA_Obj_free_buffer
+static void FLASH_Task_invoke_Obj_free_buffer( FLASH_Task* t )
+{
+   flash_obj_free_buffer_p func = (flash_obj_free_buffer_p) t->func;
+
+   func(                 t->output_arg[0],
+                         t->cntl );
+}
+
+
+// --- built-in cost models ---------------------------------------------------
+
+// The cost models below count flops in terms of the scalar dimensions of the
+// operands, so they apply equally to blocks and macroblocks.
+
+#define FLASH_TASK_M( A ) ( ( double ) FLASH_Obj_scalar_length( A ) )
+#define FLASH_TASK_N( A ) ( ( double ) FLASH_Obj_scalar_width( A ) )
+
+// Cholesky factorization, triangular inversion, and triangular-transpose
+// matrix multiply
+static double FLASH_Task_cost_Chol( FLASH_Task* t )
+{
+   double n = FLASH_TASK_N( t->output_arg[0] );
+
+   return n * n * n / 3.0;
+}
+
+// LU factorization of an m x n matrix
+static double FLASH_Task_cost_LU( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+   double k = min( m, n );
+
+   return m * n * k - ( m + n ) * k * k / 2.0 + k * k * k / 3.0;
+}
+
+// Pivoted triangular solve with the lower triangular factor of LU
+static double FLASH_Task_cost_Trsm_piv( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+
+   return m * m * n;
+}
+
+// Panel factorization of a symmetric indefinite matrix, which searches
+// all of ABR for the pivots of at most b + 1 columns
+static double FLASH_Task_cost_LDLT_piv_panel( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double b = FLASH_TASK_N( t->output_arg[3] );
+
+   return 2.0 * m * b * b;
+}
+
+// Update of a diagonal block by the columns of L and L D of a panel
+static double FLASH_Task_cost_LDLT_piv_update( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double k = FLASH_TASK_N( t->input_arg[0] );
+
+   return 2.0 * m * m * k;
+}
+
+// LU factorization of an upper triangular block stacked on a full block
+static double FLASH_Task_cost_SA_LU( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+
+   return m * n * n + n * n * n / 3.0;
+}
+
+// Forward substitution and update after SA_LU
+static double FLASH_Task_cost_SA_FS( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+   double k = FLASH_TASK_N( t->input_arg[0] );
+
+   return 2.0 * m * n * k;
+}
+
+// Triangular Sylvester equation
+static double FLASH_Task_cost_Sylv( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+
+   return m * n * ( m + n );
+}
+
+// Triangular Lyapunov equation
+static double FLASH_Task_cost_Lyap( FLASH_Task* t )
+{
+   double n = FLASH_TASK_N( t->output_arg[0] );
+
+   return n * n * n;
+}
+
+// Reduction of a generalized eigenproblem to standard form
+static double FLASH_Task_cost_Eig_gest( FLASH_Task* t )
+{
+   double n = FLASH_TASK_N( t->output_arg[1] );
+
+   return n * n * n;
+}
+
+// QR or LQ factorization of an m x n matrix
+static double FLASH_Task_cost_QR( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+   double k = min( m, n );
+
+   return 2.0 * m * n * k - ( m + n ) * k * k + 2.0 * k * k * k / 3.0;
+}
+
+// QR factorization of a triangular block stacked on another block
+static double FLASH_Task_cost_QR2( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+
+   return 2.0 * m * n * n;
+}
+
+// Up-and-downdate of a triangular factor
+static double FLASH_Task_cost_UDdate( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[1] ) + FLASH_TASK_M( t->output_arg[2] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+
+   return 2.0 * m * n * n;
+}
+
+// Application of a block of Householder transforms
+static double FLASH_Task_cost_Apply_Q( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+   double k = min( FLASH_TASK_M( t->input_arg[0] ), 
+                   FLASH_TASK_N( t->input_arg[0] ) );
+
+   return 4.0 * m * n * k;
+}
+
+// Application of the transforms of a stacked QR factorization
+static double FLASH_Task_cost_Apply_Q2( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+   double k = FLASH_TASK_N( t->input_arg[0] );
+
+   return 4.0 * m * n * k;
+}
+
+// Application of the transforms of an up-and-downdate
+static double FLASH_Task_cost_Apply_QUD( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->input_arg[1] ) + FLASH_TASK_M( t->input_arg[2] );
+   double n = FLASH_TASK_N( t->output_arg[1] );
+   double k = FLASH_TASK_N( t->input_arg[1] );
+
+   return 4.0 * m * n * k;
+}
+
+// General matrix-matrix multiply
+static double FLASH_Task_cost_Gemm( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+   double k = ( ( FLA_Trans ) t->int_arg[0] == FLA_NO_TRANSPOSE ||
+                ( FLA_Trans ) t->int_arg[0] == FLA_CONJ_NO_TRANSPOSE ?
+                FLASH_TASK_N( t->input_arg[0] ) :
+                FLASH_TASK_M( t->input_arg[0] ) );
+
+   return 2.0 * m * n * k;
+}
+
+// Hermitian or symmetric matrix-matrix multiply
+static double FLASH_Task_cost_Symm( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+
+   return 2.0 * m * n * ( ( FLA_Side ) t->int_arg[0] == FLA_LEFT ? m : n );
+}
+
+// Hermitian or symmetric rank-k update
+static double FLASH_Task_cost_Syrk( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double k = ( ( FLA_Trans ) t->int_arg[1] == FLA_NO_TRANSPOSE ?
+                FLASH_TASK_N( t->input_arg[0] ) :
+                FLASH_TASK_M( t->input_arg[0] ) );
+
+   return m * m * k;
+}
+
+// Hermitian or symmetric rank-2k update
+static double FLASH_Task_cost_Syr2k( FLASH_Task* t )
+{
+   return 2.0 * FLASH_Task_cost_Syrk( t );
+}
+
+// Triangular matrix-matrix multiply or solve
+static double FLASH_Task_cost_Trsm( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->output_arg[0] );
+   double n = FLASH_TASK_N( t->output_arg[0] );
+
+   return m * n * ( ( FLA_Side ) t->int_arg[0] == FLA_LEFT ? m : n );
+}
+
+// General matrix-vector multiply
+static double FLASH_Task_cost_Gemv( FLASH_Task* t )
+{
+   double m = FLASH_TASK_M( t->input_arg[0] );
+   double n = FLASH_TASK_N( t->input_arg[0] );
+
+   return 2.0 * m * n;
+}
+
+// Triangular solve with a vector
+static double FLASH_Task_cost_Trsv( FLASH_Task* t )
+{
+   double n = FLASH_TASK_N( t->input_arg[0] );
+
+   return n * n;
+}
+
+
+static FLASH_Task_kind flash_queue_builtin_task_kinds[] =
+{
+   { (void *) FLA_LU_piv_macro_task, FLASH_Task_invoke_LU_piv_macro, FLASH_Task_cost_LU },
+   { (void *) FLA_Apply_pivots_macro_task, FLASH_Task_invoke_Apply_pivots_macro, NULL },
+   { (void *) FLA_LU_piv_task, FLASH_Task_invoke_LU_piv, FLASH_Task_cost_LU },
+   { (void *) FLA_LU_piv_copy_task, FLASH_Task_invoke_LU_piv_copy, FLASH_Task_cost_LU },
+   { (void *) FLA_Trsm_piv_task, FLASH_Task_invoke_Trsm_piv, FLASH_Task_cost_Trsm_piv },
+   { (void *) FLA_SA_LU_task, FLASH_Task_invoke_SA_LU, FLASH_Task_cost_SA_LU },
+   { (void *) FLA_SA_FS_task, FLASH_Task_invoke_SA_FS, FLASH_Task_cost_SA_FS },
+   { (void *) FLA_LU_nopiv_task, FLASH_Task_invoke_LU_nopiv, FLASH_Task_cost_LU },
+   { (void *) FLA_LDLT_piv_panel_task, FLASH_Task_invoke_LDLT_piv_panel, FLASH_Task_cost_LDLT_piv_panel },
+   { (void *) FLA_LDLT_piv_update_task, FLASH_Task_invoke_LDLT_piv_update, FLASH_Task_cost_LDLT_piv_update },
+   { (void *) FLA_Trinv_task, FLASH_Task_invoke_Trinv, FLASH_Task_cost_Chol },
+   { (void *) FLA_Ttmm_task, FLASH_Task_invoke_Ttmm, FLASH_Task_cost_Chol },
+   { (void *) FLA_Chol_task, FLASH_Task_invoke_Chol, FLASH_Task_cost_Chol },
+   { (void *) FLA_Sylv_task, FLASH_Task_invoke_Sylv, FLASH_Task_cost_Sylv },
+   { (void *) FLA_Lyap_task, FLASH_Task_invoke_Lyap, FLASH_Task_cost_Lyap },
+   { (void *) FLA_QR_UT_macro_task, FLASH_Task_invoke_QR_UT_macro, FLASH_Task_cost_QR },
+   { (void *) FLA_QR_UT_task, FLASH_Task_invoke_QR_UT, FLASH_Task_cost_QR },
+   { (void *) FLA_QR_UT_copy_task, FLASH_Task_invoke_QR_UT_copy, FLASH_Task_cost_QR },
+   { (void *) FLA_QR2_UT_task, FLASH_Task_invoke_QR2_UT, FLASH_Task_cost_QR2 },
+   { (void *) FLA_LQ_UT_macro_task, FLASH_Task_invoke_LQ_UT_macro, FLASH_Task_cost_QR },
+   { (void *) FLA_CAQR2_UT_task, FLASH_Task_invoke_CAQR2_UT, FLASH_Task_cost_QR2 },
+   { (void *) FLA_UDdate_UT_task, FLASH_Task_invoke_UDdate_UT, FLASH_Task_cost_UDdate },
+   { (void *) FLA_Apply_Q_UT_task, FLASH_Task_invoke_Apply_Q_UT, FLASH_Task_cost_Apply_Q },
+   { (void *) FLA_Apply_Q2_UT_task, FLASH_Task_invoke_Apply_Q2_UT, FLASH_Task_cost_Apply_Q2 },
+   { (void *) FLA_Apply_CAQ2_UT_task, FLASH_Task_invoke_Apply_CAQ2_UT, FLASH_Task_cost_Apply_Q2 },
+   { (void *) FLA_Apply_QUD_UT_task, FLASH_Task_invoke_Apply_QUD_UT, FLASH_Task_cost_Apply_QUD },
+   { (void *) FLA_Eig_gest_task, FLASH_Task_invoke_Eig_gest, FLASH_Task_cost_Eig_gest },
+   { (void *) FLA_Gemm_task, FLASH_Task_invoke_Gemm, FLASH_Task_cost_Gemm },
+   { (void *) FLA_Hemm_task, FLASH_Task_invoke_Hemm, FLASH_Task_cost_Symm },
+   { (void *) FLA_Herk_task, FLASH_Task_invoke_Herk, FLASH_Task_cost_Syrk },
+   { (void *) FLA_Her2k_task, FLASH_Task_invoke_Her2k, FLASH_Task_cost_Syr2k },
+   { (void *) FLA_Symm_task, FLASH_Task_invoke_Symm, FLASH_Task_cost_Symm },
+   { (void *) FLA_Syrk_task, FLASH_Task_invoke_Syrk, FLASH_Task_cost_Syrk },
+   { (void *) FLA_Syr2k_task, FLASH_Task_invoke_Syr2k, FLASH_Task_cost_Syr2k },
+   { (void *) FLA_Trmm_task, FLASH_Task_invoke_Trmm, FLASH_Task_cost_Trsm },
+   { (void *) FLA_Trsm_task, FLASH_Task_invoke_Trsm, FLASH_Task_cost_Trsm },
+   { (void *) FLA_Gemv_task, FLASH_Task_invoke_Gemv, FLASH_Task_cost_Gemv },
+   { (void *) FLA_Trsv_task, FLASH_Task_invoke_Trsv, FLASH_Task_cost_Trsv },
+   { (void *) FLA_Axpy_task, FLASH_Task_invoke_Axpy, NULL },
+   { (void *) FLA_Axpyt_task, FLASH_Task_invoke_Axpyt, NULL },
+   { (void *) FLA_Copy_task, FLASH_Task_invoke_Copy, NULL },
+   { (void *) FLA_Copyt_task, FLASH_Task_invoke_Copyt, NULL },
+   { (void *) FLA_Copyr_task, FLASH_Task_invoke_Copyr, NULL },
+   { (void *) FLA_Scal_task, FLASH_Task_invoke_Scal, NULL },
+   { (void *) FLA_Scalr_task, FLASH_Task_invoke_Scalr, NULL },
+   { (void *) FLA_Obj_create_buffer_task, FLASH_Task_invoke_Obj_create_buffer, NULL },
+   { (void *) FLA_Obj_free_buffer_task, FLASH_Task_invoke_Obj_free_buffer, NULL }
+};
+
+
+void FLASH_Queue_init_task_kinds( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_init_task_kinds
+
+----------------------------------------------------------------------------*/
+{
+   int i;
+   int n_kinds = sizeof( flash_queue_builtin_task_kinds ) / 
+                 sizeof( FLASH_Task_kind );
+
+   // Exit early if the built-in task kinds were already registered.
+   if ( flash_queue_task_kinds_initialized == TRUE )
+      return;
+
+   flash_queue_task_kinds_initialized = TRUE;
+
+   for ( i = 0; i < FLASH_QUEUE_MAX_TASK_KINDS; i++ )
+   {
+      flash_queue_task_kinds[i].func    = NULL;
+      flash_queue_task_kinds[i].invoker = NULL;
+      flash_queue_task_kinds[i].cost    = NULL;
+   }
+
+   for ( i = 0; i < n_kinds; i++ )
+   {
+      FLASH_Queue_register_task( flash_queue_builtin_task_kinds[i].func,
+                                 flash_queue_builtin_task_kinds[i].invoker );
+      FLASH_Queue_set_task_cost( flash_queue_builtin_task_kinds[i].func,
+                                 flash_queue_builtin_task_kinds[i].cost );
+   }
+
+   return;
+}
+
+
+FLA_Error FLASH_Queue_register_task( void* func, FLASH_Task_invoker invoker )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_register_task
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Task_kind* kind;
+
+   if ( func == NULL || invoker == NULL )
+      return FLA_FAILURE;
+
+   // Registering a function a second time replaces its invoker.
+   kind = ( FLASH_Task_kind* ) FLASH_Queue_find_task_kind( func );
+
+   // The table of task kinds is full.
+   if ( kind == NULL )
+      return FLA_FAILURE;
+
+   kind->func    = func;
+   kind->invoker = invoker;
+
+   return FLA_SUCCESS;
+}
+
+
+FLA_Error FLASH_Queue_set_task_cost( void* func, FLASH_Task_cost cost )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_set_task_cost
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Task_kind* kind = ( FLASH_Task_kind* ) FLASH_Queue_find_task_kind( func );
+
+   // Only registered task kinds may be given a cost model.
+   if ( kind == NULL || kind->func != func )
+      return FLA_FAILURE;
+
+   kind->cost = cost;
+
+   return FLA_SUCCESS;
+}
+
+
+FLASH_Task_invoker FLASH_Queue_get_task_invoker( void* func )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_get_task_invoker
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Task_kind* kind = ( FLASH_Task_kind* ) FLASH_Queue_find_task_kind( func );
+
+   // The function was never registered as a task kind.
+   if ( kind == NULL || kind->func != func )
+      return NULL;
+
+   return kind->invoker;
+}
+
+
+double FLASH_Task_cost_estimate( FLASH_Task* t )
+/*----------------------------------------------------------------------------
+
+   FLASH_Task_cost_estimate
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Task_kind* kind = ( FLASH_Task_kind* ) FLASH_Queue_find_task_kind( t->func );
+
+   if ( kind != NULL && kind->func == t->func && kind->cost != NULL )
+      return kind->cost( t );
+
+   // Without a cost model, charge one flop per element of the first output
+   // operand as for a level-1 operation.
+   if ( t->n_output_args > 0 )
+      return max( FLASH_TASK_M( t->output_arg[0] ) *
+                  FLASH_TASK_N( t->output_arg[0] ), 1.0 );
+
+   return 1.0;
+}
+
+
+void* FLASH_Queue_find_task_kind( void* func )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_find_task_kind
+
+----------------------------------------------------------------------------*/
+{
+   int i, k;
+
+   FLASH_Queue_init_task_kinds();
+
+   // Return the slot of func, or the empty slot where it belongs, using
+   // linear probing.
+   k = FLASH_QUEUE_TASK_KIND_HASH( func );
+
+   for ( i = 0; i < FLASH_QUEUE_MAX_TASK_KINDS; i++ )
+   {
+      if ( flash_queue_task_kinds[k].func == func ||
+           flash_queue_task_kinds[k].func == NULL )
+         return ( void* ) &(flash_queue_task_kinds[k]);
+
+      k = ( k + 1 ) & ( FLASH_QUEUE_MAX_TASK_KINDS - 1 );
+   }
+
+   return NULL;
+}
+
+#endif
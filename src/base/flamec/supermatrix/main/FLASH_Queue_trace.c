@@ -0,0 +1,274 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+
+#ifdef FLA_ENABLE_SUPERMATRIX
+
+// Each thread records its tasks and idle periods into its own ring buffer,
+// so that no locks or atomic operations are needed while tasks execute.
+// Once a ring buffer is full, its oldest events are overwritten.
+
+typedef struct FLASH_Trace_event_s
+{
+   // Time at which the event began and ended
+   double        start;
+   double        end;
+
+   // Name of the task, or NULL for an idle period
+   char*         name;
+
+   // Labels of the task
+   int           order;
+   int           queue;
+   double        priority;
+   FLA_Bool      stolen;
+   FLA_Bool      hit;
+
+} FLASH_Trace_event;
+
+typedef struct FLASH_Trace_ring_s
+{
+   // Number of events ever recorded by the thread
+   unsigned long      n_events;
+
+   // Circular array of the most recent events
+   FLASH_Trace_event* event;
+
+   // Keep the counters of different threads on different cache lines
+   char               pad[64 - sizeof(unsigned long) - sizeof(void*)];
+
+} FLASH_Trace_ring;
+
+static int               flash_queue_trace_n_threads = 0;
+static FLASH_Trace_ring* flash_queue_trace_ring      = NULL;
+static double            flash_queue_trace_origin    = 0.0;
+
+
+void FLASH_Queue_trace_init( int n_threads )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_trace_init
+
+----------------------------------------------------------------------------*/
+{
+   int i;
+
+   // Measure all times from the first execution that is traced.
+   if ( flash_queue_trace_ring == NULL )
+      flash_queue_trace_origin = FLA_Clock();
+
+   // Exit early if every thread already has a ring buffer.
+   if ( n_threads <= flash_queue_trace_n_threads )
+      return;
+
+   flash_queue_trace_ring = ( FLASH_Trace_ring* ) FLA_realloc( 
+                                flash_queue_trace_ring,
+                                n_threads * sizeof( FLASH_Trace_ring ) );
+
+   for ( i = flash_queue_trace_n_threads; i < n_threads; i++ )
+   {
+      flash_queue_trace_ring[i].n_events = 0;
+      flash_queue_trace_ring[i].event    = ( FLASH_Trace_event* ) FLA_malloc(
+                         FLASH_QUEUE_TRACE_SIZE * sizeof( FLASH_Trace_event ) );
+   }
+
+   flash_queue_trace_n_threads = n_threads;
+
+   return;
+}
+
+
+void FLASH_Queue_trace_finalize( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_trace_finalize
+
+----------------------------------------------------------------------------*/
+{
+   int i;
+
+   for ( i = 0; i < flash_queue_trace_n_threads; i++ )
+      FLA_free( flash_queue_trace_ring[i].event );
+
+   if ( flash_queue_trace_ring != NULL )
+      FLA_free( flash_queue_trace_ring );
+
+   flash_queue_trace_ring      = NULL;
+   flash_queue_trace_n_threads = 0;
+
+   return;
+}
+
+
+void FLASH_Queue_trace_reset( void )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_trace_reset
+
+----------------------------------------------------------------------------*/
+{
+   int i;
+
+   for ( i = 0; i < flash_queue_trace_n_threads; i++ )
+      flash_queue_trace_ring[i].n_events = 0;
+
+   flash_queue_trace_origin = FLA_Clock();
+
+   return;
+}
+
+
+void FLASH_Queue_trace_task( int thread, FLASH_Task* t, FLA_Bool stolen,
+                             double start, double end )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_trace_task
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Trace_ring*  ring = &(flash_queue_trace_ring[thread]);
+   FLASH_Trace_event* e    = &(ring->event[ring->n_events % 
+                                           FLASH_QUEUE_TRACE_SIZE]);
+
+   e->start    = start;
+   e->end      = end;
+   e->name     = t->name;
+   e->order    = t->order;
+   e->queue    = t->queue;
+   e->priority = t->priority;
+   e->stolen   = stolen;
+   e->hit      = t->hit;
+
+   ring->n_events++;
+
+   return;
+}
+
+
+void FLASH_Queue_trace_idle( int thread, double start, double end )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_trace_idle
+
+----------------------------------------------------------------------------*/
+{
+   FLASH_Trace_ring*  ring = &(flash_queue_trace_ring[thread]);
+   FLASH_Trace_event* e    = &(ring->event[ring->n_events % 
+                                           FLASH_QUEUE_TRACE_SIZE]);
+
+   e->start    = start;
+   e->end      = end;
+   e->name     = NULL;
+   e->order    = -1;
+   e->queue    = -1;
+   e->priority = 0.0;
+   e->stolen   = FALSE;
+   e->hit      = FALSE;
+
+   ring->n_events++;
+
+   return;
+}
+
+
+FLA_Error FLASH_Queue_write_trace( char* file_name )
+/*----------------------------------------------------------------------------
+
+   FLASH_Queue_write_trace
+
+----------------------------------------------------------------------------*/
+{
+   FILE*              fp;
+   FLASH_Trace_event* e;
+   unsigned long      k, first;
+   unsigned long      n_dropped = 0;
+   int                i, len;
+   char*              sep = "";
+   char               priority[32];
+
+   fp = fopen( file_name, "w" );
+
+   if ( fp == NULL )
+      return FLA_FAILURE;
+
+   // Write the events in the Chrome trace event format, which the Chrome
+   // tracing and Perfetto viewers display as one timeline per thread. Times
+   // are given in microseconds.
+   fprintf( fp, "{\"traceEvents\":[\n" );
+
+   for ( i = 0; i < flash_queue_trace_n_threads; i++ )
+   {
+      fprintf( fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                   "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}", 
+               sep, i, i );
+      sep = ",\n";
+
+      // Only the most recent events remain once a ring buffer wraps around.
+      first = 0;
+      if ( flash_queue_trace_ring[i].n_events > FLASH_QUEUE_TRACE_SIZE )
+      {
+         first      = flash_queue_trace_ring[i].n_events - FLASH_QUEUE_TRACE_SIZE;
+         n_dropped += first;
+      }
+
+      for ( k = first; k < flash_queue_trace_ring[i].n_events; k++ )
+      {
+         e = &(flash_queue_trace_ring[i].event[k % FLASH_QUEUE_TRACE_SIZE]);
+
+         if ( e->name == NULL )
+         {
+            fprintf( fp, "%s{\"name\":\"idle\",\"cat\":\"idle\",\"ph\":\"X\","
+                         "\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                     sep, i, 1e6 * ( e->start - flash_queue_trace_origin ),
+                     1e6 * ( e->end - e->start ) );
+         }
+         else
+         {
+            // Drop the padding of the task name.
+            len = strlen( e->name );
+            while ( len > 0 && e->name[len - 1] == ' ' )
+               len--;
+
+            // JSON has no infinite or NaN numbers, so write such a
+            // priority as null.
+            if ( isfinite( e->priority ) )
+               sprintf( priority, "%g", e->priority );
+            else
+               strcpy( priority, "null" );
+
+            fprintf( fp, "%s{\"name\":\"%.*s\",\"cat\":\"task\",\"ph\":\"X\","
+                         "\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,"
+                         "\"args\":{\"order\":%d,\"queue\":%d,"
+                         "\"priority\":%s,\"stolen\":%s,\"hit\":%s}}",
+                     sep, len, e->name, i, 
+                     1e6 * ( e->start - flash_queue_trace_origin ),
+                     1e6 * ( e->end - e->start ),
+                     e->order, e->queue, priority,
+                     ( e->stolen ? "true" : "false" ),
+                     ( e->hit ? "true" : "false" ) );
+         }
+      }
+   }
+
+   fprintf( fp, "\n],\"displayTimeUnit\":\"ms\","
+                "\"otherData\":{\"dropped_events\":%lu}}\n", n_dropped );
+
+   fclose( fp );
+
+   return FLA_SUCCESS;
+}
+
+#endif // FLA_ENABLE_SUPERMATRIX
@@ -0,0 +1,227 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h" 
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <math.h> 
+
+
+#define OUTPUT_PATH "./results"
+#define OUTPUT_FILE "async"
+
+
+int main( int argc, char *argv[] ) 
+{ 
+   int
+      i, j, k, m,
+      n_threads,
+      n_repeats,
+      n_trials,
+      n_matrices,
+      increment,
+      begin;
+
+   dim_t
+      size,
+      nb_alg = 0;
+
+   FLA_Datatype
+      datatype = FLA_DOUBLE;
+
+   FLA_Obj 
+      *A, *AH, B, BH, diff;
+   
+   FLASH_Queue_handle
+      *handle;
+
+   double 
+      length,
+      dtime, 
+      *dtimes,
+      diff_value,
+      max_diff,
+      flops[2];
+
+#ifndef FLA_ENABLE_WINDOWS_BUILD
+   char
+      output_file_m[100];
+   
+   FILE
+      *fpp;
+#endif
+
+   fprintf( stdout, "%c Enter number of repeats: ", '%' );
+   scanf( "%d", &n_repeats );
+   fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+   fprintf( stdout, "%c Enter blocksize: ", '%' );
+   scanf( "%u", &nb_alg );
+   fprintf( stdout, "%c %u\n", '%', nb_alg );
+
+   fprintf( stdout, "%c Enter problem size parameters: first, inc, num: ", '%' );
+   scanf( "%d%d%d", &begin, &increment, &n_trials );
+   fprintf( stdout, "%c %d %d %d\n", '%', begin, increment, n_trials );
+
+   fprintf( stdout, "%c Enter number of matrices: ", '%' );
+   scanf( "%d", &n_matrices );
+   fprintf( stdout, "%c %d\n", '%', n_matrices );
+
+   fprintf( stdout, "%c Enter number of threads: ", '%' );
+   scanf( "%d", &n_threads );
+   fprintf( stdout, "%c %d\n\n", '%', n_threads );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#else
+   sprintf( output_file_m, "%s/%s_output.m", OUTPUT_PATH, OUTPUT_FILE );
+   fpp = fopen( output_file_m, "a" );
+
+   fprintf( fpp, "%%\n" );
+   fprintf( fpp, "%% | Matrix Size |  synchronous GFlops  |    deferred GFlops    |\n" );
+   fprintf( fpp, "%% -------------------------------------------------------------\n" );
+   fprintf( fpp, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#endif
+
+   FLA_Init();
+
+   dtimes = ( double * ) FLA_malloc( n_repeats * sizeof( double ) );
+   A      = ( FLA_Obj * ) FLA_malloc( n_matrices * sizeof( FLA_Obj ) );
+   AH     = ( FLA_Obj * ) FLA_malloc( n_matrices * sizeof( FLA_Obj ) );
+   handle = ( FLASH_Queue_handle * ) FLA_malloc( n_matrices * 
+                                                 sizeof( FLASH_Queue_handle ) );
+   
+   FLASH_Queue_set_num_threads( n_threads );
+
+   for ( i = 0; i < n_trials; i++ )
+   {
+      size = begin + i * increment;
+      
+      for ( m = 0; m < n_matrices; m++ )
+         FLA_Obj_create( datatype, size, size, 0, 0, &A[m] ); 
+      FLA_Obj_create( datatype, size, size, 0, 0, &B ); 
+      FLA_Obj_create( datatype, 1,    1,    0, 0, &diff ); 
+
+      max_diff = 0.0;
+
+      // Time the Cholesky factorizations of several matrices, first one
+      // after the other and then with their submission deferred until they
+      // are waited on, so that their tasks execute together as one graph.
+      for ( k = 0; k < 2; k++ )
+      {
+         for ( j = 0; j < n_repeats; j++ )
+         {
+            for ( m = 0; m < n_matrices; m++ )
+            {
+               FLA_Random_matrix( A[m] );
+
+               length = ( double ) FLA_Obj_length( A[m] );
+               FLA_Add_to_diag( &length, A[m] );
+
+               FLASH_Obj_create_hier_copy_of_flat( A[m], 1, &nb_alg, &AH[m] );
+            }
+            
+            dtime = FLA_Clock();
+            
+            for ( m = 0; m < n_matrices; m++ )
+            {
+               if ( k == 0 )
+               {
+                  FLASH_Chol( FLA_LOWER_TRIANGULAR, AH[m] );
+               }
+               else
+               {
+                  FLASH_Queue_begin();
+                  FLASH_Chol( FLA_LOWER_TRIANGULAR, AH[m] );
+                  handle[m] = FLASH_Queue_end_async();
+               }
+            }
+
+            if ( k == 1 )
+            {
+               for ( m = 0; m < n_matrices; m++ )
+                  FLASH_Queue_wait( handle[m] );
+            }
+
+            dtimes[j] = FLA_Clock() - dtime;
+            
+            // Check each deferred factorization against a synchronous one
+            // of the same matrix. The blocks of each matrix are updated by
+            // the same tasks in the same order either way.
+            if ( k == 1 )
+            {
+               for ( m = 0; m < n_matrices; m++ )
+               {
+                  FLASH_Obj_create_hier_copy_of_flat( A[m], 1, &nb_alg, &BH );
+
+                  FLASH_Chol( FLA_LOWER_TRIANGULAR, BH );
+
+                  FLASH_Obj_flatten( AH[m], A[m] );
+                  FLASH_Obj_flatten( BH, B );
+
+                  FLA_Axpy( FLA_MINUS_ONE, A[m], B );
+                  FLA_Max_abs_value( B, diff );
+                  FLA_Obj_extract_real_scalar( diff, &diff_value );
+
+                  max_diff = max( max_diff, diff_value );
+
+                  FLASH_Obj_free( &BH );
+               }
+            }
+
+            for ( m = 0; m < n_matrices; m++ )
+               FLASH_Obj_free( &AH[m] );
+         }
+
+         dtime = dtimes[0];
+         for ( j = 1; j < n_repeats; j++ )
+            dtime = min( dtime, dtimes[j] );
+         flops[k] = n_matrices * 1.0 / 3.0 * size * size * size / dtime / 1e9;
+      }
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD      
+      fprintf( stdout, "   %d   %6.3f   %6.3f   %le\n", 
+               size, flops[0], flops[1], max_diff );
+#else
+      fprintf( fpp, "   %d   %6.3f   %6.3f\n", 
+               size, flops[0], flops[1] );
+      
+      fprintf( stdout, "Matrix size: %u x %u  |  nb_alg: %u  |  matrices: %d\n", 
+               size, size, nb_alg, n_matrices ); 
+      fprintf( stdout, "synchronous:  %6.3f GFlops\n", flops[0] );
+      fprintf( stdout, "deferred:     %6.3f GFlops  |  Max difference: %le\n\n",
+               flops[1], max_diff );
+#endif
+ 
+      for ( m = 0; m < n_matrices; m++ )
+         FLA_Obj_free( &A[m] ); 
+      FLA_Obj_free( &B ); 
+      FLA_Obj_free( &diff ); 
+   }
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "];\n\n" );
+#else
+   fprintf( fpp, "];\n" );
+   
+   fflush( fpp );
+   fclose( fpp );
+#endif
+
+   FLA_free( dtimes );
+   FLA_free( A );
+   FLA_free( AH );
+   FLA_free( handle );
+
+   FLA_Finalize(); 
+   
+   return 0; 
+}
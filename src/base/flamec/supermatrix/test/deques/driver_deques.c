@@ -0,0 +1,195 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+
+#define OUTPUT_PATH "./results"
+#define OUTPUT_FILE "deques"
+
+
+int main( int argc, char *argv[] )
+{
+   int
+      i, j, k,
+      n_threads,
+      n_repeats,
+      n_trials,
+      increment,
+      begin;
+
+   dim_t
+      size,
+      nb_alg = 0;
+
+   FLA_Datatype
+      datatype = FLA_DOUBLE;
+
+   FLA_Obj
+      A, AH, x, b, b_norm;
+
+   double
+      length,
+      dtime,
+      *dtimes,
+      b_norm_value,
+      flops[3],
+      resid[3];
+
+#ifndef FLA_ENABLE_WINDOWS_BUILD
+   char
+      output_file_m[100];
+
+   FILE
+      *fpp;
+#endif
+
+   fprintf( stdout, "%c Enter number of repeats: ", '%' );
+   scanf( "%d", &n_repeats );
+   fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+   fprintf( stdout, "%c Enter blocksize: ", '%' );
+   scanf( "%u", &nb_alg );
+   fprintf( stdout, "%c %u\n", '%', nb_alg );
+
+   fprintf( stdout, "%c Enter problem size parameters: first, inc, num: ", '%' );
+   scanf( "%d%d%d", &begin, &increment, &n_trials );
+   fprintf( stdout, "%c %d %d %d\n", '%', begin, increment, n_trials );
+
+   fprintf( stdout, "%c Enter number of threads: ", '%' );
+   scanf( "%d", &n_threads );
+   fprintf( stdout, "%c %d\n\n", '%', n_threads );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#else
+   sprintf( output_file_m, "%s/%s_output.m", OUTPUT_PATH, OUTPUT_FILE );
+   fpp = fopen( output_file_m, "a" );
+
+   fprintf( fpp, "%%\n" );
+   fprintf( fpp, "%% | Matrix Size |              deques GFlops              |\n" );
+   fprintf( fpp, "%% |             |  default  |  sorting    |  locality   |\n" );
+   fprintf( fpp, "%% ---------------------------------------------------------\n" );
+   fprintf( fpp, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#endif
+
+   FLA_Init();
+
+   dtimes = ( double * ) FLA_malloc( n_repeats * sizeof( double ) );
+
+   FLASH_Queue_set_num_threads( n_threads );
+   FLASH_Queue_set_deques( TRUE );
+
+   for ( i = 0; i < n_trials; i++ )
+   {
+      size = begin + i * increment;
+
+      FLA_Obj_create( datatype, size, size, 0, 0, &A );
+      FLA_Obj_create( datatype, size, 1,    0, 0, &x );
+      FLA_Obj_create( datatype, size, 1,    0, 0, &b );
+      FLA_Obj_create( datatype, 1,    1,    0, 0, &b_norm );
+
+      // Factor with the work-stealing deques alone, then with the tallest
+      // ready task kept by the thread that made it ready, and then with the
+      // task whose blocks are warmest in its caches. Each repeat is checked,
+      // since the tasks are dealt out differently every time.
+      for ( k = 0; k < 3; k++ )
+      {
+         FLASH_Queue_set_sorting( k == 1 );
+         FLASH_Queue_set_locality( k == 2 );
+
+         resid[k] = 0.0;
+
+         for ( j = 0; j < n_repeats; j++ )
+         {
+            FLA_Random_matrix( A );
+            FLA_Random_matrix( x );
+
+            length = ( double ) FLA_Obj_length( A );
+            FLA_Add_to_diag( &length, A );
+
+            FLA_Symv_external( FLA_LOWER_TRIANGULAR, FLA_ONE, A, x, FLA_ZERO, b );
+
+            FLASH_Obj_create_hier_copy_of_flat( A, 1, &nb_alg, &AH );
+
+            dtime = FLA_Clock();
+
+            FLASH_Chol( FLA_LOWER_TRIANGULAR, AH );
+
+            dtimes[j] = FLA_Clock() - dtime;
+
+            FLASH_Obj_flatten( AH, A );
+            FLASH_Obj_free( &AH );
+
+            FLA_Trsv_external( FLA_LOWER_TRIANGULAR, FLA_NO_TRANSPOSE,
+                               FLA_NONUNIT_DIAG, A, b );
+            FLA_Trsv_external( FLA_LOWER_TRIANGULAR, FLA_TRANSPOSE,
+                               FLA_NONUNIT_DIAG, A, b );
+            FLA_Axpy_external( FLA_MINUS_ONE, x, b );
+            FLA_Nrm2_external( b, b_norm );
+            FLA_Obj_extract_real_scalar( b_norm, &b_norm_value );
+
+            resid[k] = max( resid[k], b_norm_value );
+         }
+
+         dtime = dtimes[0];
+         for ( j = 1; j < n_repeats; j++ )
+            dtime = min( dtime, dtimes[j] );
+         flops[k] = 1.0 / 3.0 * size * size * size / dtime / 1e9;
+      }
+
+      FLASH_Queue_set_sorting( FALSE );
+      FLASH_Queue_set_locality( FALSE );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+      fprintf( stdout, "   %d   %6.3f   %6.3f   %6.3f   %le   %le   %le\n",
+               size, flops[0], flops[1], flops[2],
+               resid[0], resid[1], resid[2] );
+#else
+      fprintf( fpp, "   %d   %6.3f   %6.3f   %6.3f\n",
+               size, flops[0], flops[1], flops[2] );
+
+      fprintf( stdout, "Matrix size: %u x %u  |  nb_alg: %u\n",
+               size, size, nb_alg );
+      fprintf( stdout, "default:  %6.3f GFlops  |  Norm of difference: %le\n",
+               flops[0], resid[0] );
+      fprintf( stdout, "sorting:  %6.3f GFlops  |  Norm of difference: %le\n",
+               flops[1], resid[1] );
+      fprintf( stdout, "locality: %6.3f GFlops  |  Norm of difference: %le\n\n",
+               flops[2], resid[2] );
+#endif
+
+      FLA_Obj_free( &A );
+      FLA_Obj_free( &x );
+      FLA_Obj_free( &b );
+      FLA_Obj_free( &b_norm );
+   }
+
+   FLASH_Queue_set_deques( FALSE );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "];\n\n" );
+#else
+   fprintf( fpp, "];\n" );
+
+   fflush( fpp );
+   fclose( fpp );
+#endif
+
+   FLA_free( dtimes );
+
+   FLA_Finalize();
+
+   return 0;
+}
@@ -0,0 +1,251 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h" 
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <math.h> 
+
+
+#define OUTPUT_PATH "./results"
+#define OUTPUT_FILE "enqueue"
+
+
+int main( int argc, char *argv[] ) 
+{ 
+   int
+      i, j, k,
+      n_threads,
+      n_repeats,
+      n_trials,
+      increment,
+      begin;
+
+   unsigned int
+      n_tasks;
+
+   dim_t
+      size,
+      nb_alg = 0;
+
+   FLA_Datatype
+      datatype = FLA_DOUBLE;
+
+   FLA_Obj 
+      A, AH, B, BH, diff;
+
+   FLASH_Graph
+      graph;
+   
+   double 
+      length,
+      dtime, 
+      dtime_enq,
+      diff_value,
+      max_diff,
+      *dtimes,
+      *dtimes_enq,
+      rate[2],
+      total[3];
+
+#ifndef FLA_ENABLE_WINDOWS_BUILD
+   char
+      output_file_m[100];
+   
+   FILE
+      *fpp;
+#endif
+
+   fprintf( stdout, "%c Enter number of repeats: ", '%' );
+   scanf( "%d", &n_repeats );
+   fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+   fprintf( stdout, "%c Enter blocksize: ", '%' );
+   scanf( "%u", &nb_alg );
+   fprintf( stdout, "%c %u\n", '%', nb_alg );
+
+   fprintf( stdout, "%c Enter problem size parameters: first, inc, num: ", '%' );
+   scanf( "%d%d%d", &begin, &increment, &n_trials );
+   fprintf( stdout, "%c %d %d %d\n", '%', begin, increment, n_trials );
+
+   fprintf( stdout, "%c Enter number of threads: ", '%' );
+   scanf( "%d", &n_threads );
+   fprintf( stdout, "%c %d\n\n", '%', n_threads );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#else
+   sprintf( output_file_m, "%s/%s_output.m", OUTPUT_PATH, OUTPUT_FILE );
+   fpp = fopen( output_file_m, "a" );
+
+   fprintf( fpp, "%%\n" );
+   fprintf( fpp, "%% | Matrix Size |   Tasks   |  malloc Mtasks/s  total |   arena Mtasks/s  total | replay total |\n" );
+   fprintf( fpp, "%% ----------------------------------------------------------------------------------------------\n" );
+   fprintf( fpp, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#endif
+
+   FLA_Init();
+
+   dtimes     = ( double * ) FLA_malloc( n_repeats * sizeof( double ) );
+   dtimes_enq = ( double * ) FLA_malloc( n_repeats * sizeof( double ) );
+   
+   FLASH_Queue_set_num_threads( n_threads );
+
+   for ( i = 0; i < n_trials; i++ )
+   {
+      size = begin + i * increment;
+      
+      FLA_Obj_create( datatype, size, size, 0, 0, &A ); 
+      FLA_Obj_create( datatype, size, size, 0, 0, &B ); 
+      FLA_Obj_create( datatype, 1,    1,    0, 0, &diff ); 
+
+      n_tasks = 0;
+
+      // Time the enqueueing of the tasks of a Cholesky factorization, first
+      // with every task allocated individually and then with the arena.
+      for ( k = 0; k < 2; k++ )
+      {
+         FLASH_Queue_set_task_arena( k == 1 );
+
+         for ( j = 0; j < n_repeats; j++ )
+         {
+            FLA_Random_matrix( A );
+
+            length = ( double ) FLA_Obj_length( A );
+            FLA_Add_to_diag( &length, A );
+
+            FLASH_Obj_create_hier_copy_of_flat( A, 1, &nb_alg, &AH );  
+            
+            dtime = FLA_Clock();
+            
+            // Hold the queue open so that only the enqueueing is timed.
+            FLASH_Queue_begin();
+
+            FLASH_Chol( FLA_LOWER_TRIANGULAR, AH );
+
+            dtime_enq = FLA_Clock() - dtime;
+            n_tasks   = FLASH_Queue_get_num_tasks();
+
+            FLASH_Queue_end();
+            
+            dtime = FLA_Clock() - dtime;
+
+            dtimes[j]     = dtime;
+            dtimes_enq[j] = dtime_enq;
+            
+            FLASH_Obj_free( &AH );
+         }
+         
+         dtime     = dtimes[0];
+         dtime_enq = dtimes_enq[0];
+         for ( j = 1; j < n_repeats; j++ )
+         {
+            dtime     = min( dtime, dtimes[j] );
+            dtime_enq = min( dtime_enq, dtimes_enq[j] );
+         }
+
+         rate[k]  = n_tasks / dtime_enq / 1e6;
+         total[k] = dtime;
+      }
+
+      // Capture the tasks once and then replay them, which skips both the
+      // enqueueing and the dependence analysis.
+      FLASH_Obj_create_hier_copy_of_flat( A, 1, &nb_alg, &AH );  
+
+      FLASH_Queue_capture_begin( 1, &AH );
+      FLASH_Chol( FLA_LOWER_TRIANGULAR, AH );
+      FLASH_Queue_capture_end( &graph );
+
+      FLASH_Obj_free( &AH );
+
+      max_diff = 0.0;
+
+      for ( j = 0; j < n_repeats; j++ )
+      {
+         FLA_Random_matrix( A );
+
+         length = ( double ) FLA_Obj_length( A );
+         FLA_Add_to_diag( &length, A );
+
+         FLASH_Obj_create_hier_copy_of_flat( A, 1, &nb_alg, &AH );  
+         FLASH_Obj_create_hier_copy_of_flat( A, 1, &nb_alg, &BH );  
+
+         dtime = FLA_Clock();
+
+         FLASH_Graph_replay( graph, &AH );
+
+         dtimes[j] = FLA_Clock() - dtime;
+
+         // The replayed tasks perform the same operations on each block, in
+         // the same order, as those enqueued by FLASH_Chol(), so the two
+         // factors should agree to the last bit.
+         FLASH_Chol( FLA_LOWER_TRIANGULAR, BH );
+
+         FLASH_Obj_flatten( AH, A );
+         FLASH_Obj_flatten( BH, B );
+
+         FLA_Axpy( FLA_MINUS_ONE, A, B );
+         FLA_Max_abs_value( B, diff );
+         FLA_Obj_extract_real_scalar( diff, &diff_value );
+
+         max_diff = max( max_diff, diff_value );
+
+         FLASH_Obj_free( &AH );
+         FLASH_Obj_free( &BH );
+      }
+
+      FLASH_Graph_free( &graph );
+
+      total[2] = dtimes[0];
+      for ( j = 1; j < n_repeats; j++ )
+         total[2] = min( total[2], dtimes[j] );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD      
+      fprintf( stdout, "   %d   %u   %6.3f   %e   %6.3f   %e   %e   %le\n", 
+               size, n_tasks, rate[0], total[0], rate[1], total[1], total[2],
+               max_diff );
+#else
+      fprintf( fpp, "   %d   %u   %6.3f   %e   %6.3f   %e   %e\n", 
+               size, n_tasks, rate[0], total[0], rate[1], total[1], total[2] );
+      
+      fprintf( stdout, "Matrix size: %u x %u  |  nb_alg: %u  |  tasks: %u\n", 
+               size, size, nb_alg, n_tasks ); 
+      fprintf( stdout, "malloc: %6.3f Mtasks/s enqueued  |  total time: %e\n", 
+               rate[0], total[0] );
+      fprintf( stdout, "arena:  %6.3f Mtasks/s enqueued  |  total time: %e\n", 
+               rate[1], total[1] );
+      fprintf( stdout, "replay:                            |  total time: %e\n", 
+               total[2] );
+      fprintf( stdout, "Max difference of replay from FLASH_Chol: %le\n\n", 
+               max_diff );
+#endif
+ 
+      FLA_Obj_free( &A ); 
+      FLA_Obj_free( &B ); 
+      FLA_Obj_free( &diff ); 
+   }
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "];\n\n" );
+#else
+   fprintf( fpp, "];\n" );
+   
+   fflush( fpp );
+   fclose( fpp );
+#endif
+
+   FLA_free( dtimes );
+   FLA_free( dtimes_enq );
+
+   FLA_Finalize(); 
+   
+   return 0; 
+}
@@ -0,0 +1,166 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h" 
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <math.h> 
+
+
+#define OUTPUT_PATH "./results"
+#define OUTPUT_FILE "locality"
+
+
+int main( int argc, char *argv[] ) 
+{ 
+   int
+      i, j, k,
+      n_threads,
+      n_repeats,
+      n_trials,
+      increment,
+      begin;
+
+   dim_t
+      size,
+      nb_alg = 0;
+
+   FLA_Datatype
+      datatype = FLA_DOUBLE;
+
+   FLA_Obj 
+      A, AH;
+   
+   double 
+      length,
+      dtime, 
+      *dtimes,
+      flops[4];
+
+#ifndef FLA_ENABLE_WINDOWS_BUILD
+   char
+      output_file_m[100];
+   
+   FILE
+      *fpp;
+#endif
+
+   fprintf( stdout, "%c Enter number of repeats: ", '%' );
+   scanf( "%d", &n_repeats );
+   fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+   fprintf( stdout, "%c Enter blocksize: ", '%' );
+   scanf( "%u", &nb_alg );
+   fprintf( stdout, "%c %u\n", '%', nb_alg );
+
+   fprintf( stdout, "%c Enter problem size parameters: first, inc, num: ", '%' );
+   scanf( "%d%d%d", &begin, &increment, &n_trials );
+   fprintf( stdout, "%c %d %d %d\n", '%', begin, increment, n_trials );
+
+   fprintf( stdout, "%c Enter number of threads: ", '%' );
+   scanf( "%d", &n_threads );
+   fprintf( stdout, "%c %d\n\n", '%', n_threads );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#else
+   sprintf( output_file_m, "%s/%s_output.m", OUTPUT_PATH, OUTPUT_FILE );
+   fpp = fopen( output_file_m, "a" );
+
+   fprintf( fpp, "%%\n" );
+   fprintf( fpp, "%% | Matrix Size |      deques GFlops      |     stealing GFlops     |\n" );
+   fprintf( fpp, "%% |             |  default  |  locality   |  default  |  locality   |\n" );
+   fprintf( fpp, "%% ---------------------------------------------------------------------\n" );
+   fprintf( fpp, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#endif
+
+   FLA_Init();
+
+   dtimes = ( double * ) FLA_malloc( n_repeats * sizeof( double ) );
+   
+   FLASH_Queue_set_num_threads( n_threads );
+
+   for ( i = 0; i < n_trials; i++ )
+   {
+      size = begin + i * increment;
+      
+      FLA_Obj_create( datatype, size, size, 0, 0, &A ); 
+
+      // Time a Cholesky factorization with work-stealing deques and with
+      // work-stealing queues, each without and then with the scheduling of
+      // tasks by the blocks warm in the shared caches.
+      for ( k = 0; k < 4; k++ )
+      {
+         FLASH_Queue_set_deques( k < 2 );
+         FLASH_Queue_set_work_stealing( k >= 2 );
+         FLASH_Queue_set_locality( k % 2 == 1 );
+
+         for ( j = 0; j < n_repeats; j++ )
+         {
+            FLA_Random_matrix( A );
+
+            length = ( double ) FLA_Obj_length( A );
+            FLA_Add_to_diag( &length, A );
+
+            FLASH_Obj_create_hier_copy_of_flat( A, 1, &nb_alg, &AH );  
+            
+            dtime = FLA_Clock();
+            
+            FLASH_Chol( FLA_LOWER_TRIANGULAR, AH );
+
+            dtimes[j] = FLA_Clock() - dtime;
+            
+            FLASH_Obj_free( &AH );
+         }
+
+         dtime = dtimes[0];
+         for ( j = 1; j < n_repeats; j++ )
+            dtime = min( dtime, dtimes[j] );
+         flops[k] = 1.0 / 3.0 * size * size * size / dtime / 1e9;
+      }
+
+      FLASH_Queue_set_deques( FALSE );
+      FLASH_Queue_set_work_stealing( FALSE );
+      FLASH_Queue_set_locality( FALSE );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD      
+      fprintf( stdout, "   %d   %6.3f   %6.3f   %6.3f   %6.3f\n", 
+               size, flops[0], flops[1], flops[2], flops[3] );
+#else
+      fprintf( fpp, "   %d   %6.3f   %6.3f   %6.3f   %6.3f\n", 
+               size, flops[0], flops[1], flops[2], flops[3] );
+      
+      fprintf( stdout, "Matrix size: %u x %u  |  nb_alg: %u\n", 
+               size, size, nb_alg ); 
+      fprintf( stdout, "deques:   %6.3f GFlops  |  with locality: %6.3f GFlops\n", 
+               flops[0], flops[1] );
+      fprintf( stdout, "stealing: %6.3f GFlops  |  with locality: %6.3f GFlops\n\n", 
+               flops[2], flops[3] );
+#endif
+ 
+      FLA_Obj_free( &A ); 
+   }
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "];\n\n" );
+#else
+   fprintf( fpp, "];\n" );
+   
+   fflush( fpp );
+   fclose( fpp );
+#endif
+
+   FLA_free( dtimes );
+
+   FLA_Finalize(); 
+   
+   return 0; 
+}
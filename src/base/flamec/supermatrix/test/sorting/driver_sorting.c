@@ -0,0 +1,213 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h" 
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <math.h> 
+
+
+#define OUTPUT_PATH "./results"
+#define OUTPUT_FILE "sorting"
+
+
+int main( int argc, char *argv[] ) 
+{ 
+   int
+      i, j, k,
+      n_threads,
+      n_repeats,
+      n_trials,
+      increment,
+      begin;
+
+   dim_t
+      size,
+      nb_alg   = 0,
+      nb_flash = 0;
+
+   FLA_Datatype
+      datatype = FLA_DOUBLE;
+
+   FLA_Obj 
+      A, AH, pH, TW, LU[2], QR[2], diff;
+   
+   double 
+      dtime, 
+      *dtimes,
+      flops[4],
+      resid[2];
+
+#ifndef FLA_ENABLE_WINDOWS_BUILD
+   char
+      output_file_m[100];
+   
+   FILE
+      *fpp;
+#endif
+
+   fprintf( stdout, "%c Enter number of repeats: ", '%' );
+   scanf( "%d", &n_repeats );
+   fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+   fprintf( stdout, "%c Enter storage blocksize: ", '%' );
+   scanf( "%u", &nb_flash );
+   fprintf( stdout, "%c %u\n", '%', nb_flash );
+
+   fprintf( stdout, "%c Enter algorithmic (inner) blocksize for QR: ", '%' );
+   scanf( "%u", &nb_alg );
+   fprintf( stdout, "%c %u\n", '%', nb_alg );
+
+   fprintf( stdout, "%c Enter problem size parameters: first, inc, num: ", '%' );
+   scanf( "%d%d%d", &begin, &increment, &n_trials );
+   fprintf( stdout, "%c %d %d %d\n", '%', begin, increment, n_trials );
+
+   fprintf( stdout, "%c Enter number of threads: ", '%' );
+   scanf( "%d", &n_threads );
+   fprintf( stdout, "%c %d\n\n", '%', n_threads );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "%s_%u = [\n", OUTPUT_FILE, nb_flash );
+#else
+   sprintf( output_file_m, "%s/%s_output.m", OUTPUT_PATH, OUTPUT_FILE );
+   fpp = fopen( output_file_m, "a" );
+
+   fprintf( fpp, "%%\n" );
+   fprintf( fpp, "%% | Matrix Size |     LU_piv GFlops     |   QR_UT_inc GFlops    |\n" );
+   fprintf( fpp, "%% |    n x n    |   FIFO   | priority   |   FIFO   | priority   |\n" );
+   fprintf( fpp, "%% --------------------------------------------------------------\n" );
+   fprintf( fpp, "%s_%u = [\n", OUTPUT_FILE, nb_flash );
+#endif
+
+   FLA_Init();
+
+   dtimes = ( double * ) FLA_malloc( n_repeats * sizeof( double ) );
+   
+   FLASH_Queue_set_num_threads( n_threads );
+
+   for ( i = 0; i < n_trials; i++ )
+   {
+      size = begin + i * increment;
+      
+      FLA_Obj_create( datatype, size, size, 0, 0, &A );
+      FLA_Obj_create( datatype, size, size, 0, 0, &LU[0] );
+      FLA_Obj_create( datatype, size, size, 0, 0, &LU[1] );
+      FLA_Obj_create( datatype, size, size, 0, 0, &QR[0] );
+      FLA_Obj_create( datatype, size, size, 0, 0, &QR[1] );
+      FLA_Obj_create( datatype, 1,    1,    0, 0, &diff );
+
+      // Every repeat factors the same matrix, so that the factors computed
+      // under each ordering may be compared.
+      FLA_Random_matrix( A );
+
+      // Time each factorization with the ready tasks executed in the order
+      // they became ready and then with the critical path prioritized.
+      for ( k = 0; k < 2; k++ )
+      {
+         FLASH_Queue_set_sorting( k == 1 );
+
+         for ( j = 0; j < n_repeats; j++ )
+         {
+            FLASH_Obj_create_hier_copy_of_flat( A, 1, &nb_flash, &AH );
+            FLASH_Obj_create( FLA_INT, size, 1, 1, &nb_flash, &pH );
+
+            dtime = FLA_Clock();
+
+            FLASH_LU_piv( AH, pH );
+
+            dtimes[j] = FLA_Clock() - dtime;
+
+            FLASH_Obj_flatten( AH, LU[k] );
+
+            FLASH_Obj_free( &AH );
+            FLASH_Obj_free( &pH );
+         }
+
+         dtime = dtimes[0];
+         for ( j = 1; j < n_repeats; j++ )
+            dtime = min( dtime, dtimes[j] );
+         flops[k] = 2.0 / 3.0 * size * size * size / dtime / 1e9;
+
+         for ( j = 0; j < n_repeats; j++ )
+         {
+            FLASH_QR_UT_inc_create_hier_matrices( A, 1, &nb_flash, nb_alg,
+                                                  &AH, &TW );
+
+            dtime = FLA_Clock();
+
+            FLASH_QR_UT_inc( AH, TW );
+
+            dtimes[j] = FLA_Clock() - dtime;
+
+            FLASH_Obj_flatten( AH, QR[k] );
+
+            FLASH_Obj_free( &AH );
+            FLASH_Obj_free( &TW );
+         }
+
+         dtime = dtimes[0];
+         for ( j = 1; j < n_repeats; j++ )
+            dtime = min( dtime, dtimes[j] );
+         flops[k + 2] = 4.0 / 3.0 * size * size * size / dtime / 1e9;
+      }
+
+      FLASH_Queue_set_sorting( FALSE );
+
+      // Prioritizing the critical path only changes the order in which
+      // independent tasks execute, while each block is still updated by the
+      // same tasks in the same order, so the factors should agree exactly.
+      FLA_Axpy( FLA_MINUS_ONE, LU[0], LU[1] );
+      FLA_Max_abs_value( LU[1], diff );
+      FLA_Obj_extract_real_scalar( diff, &resid[0] );
+
+      FLA_Axpy( FLA_MINUS_ONE, QR[0], QR[1] );
+      FLA_Max_abs_value( QR[1], diff );
+      FLA_Obj_extract_real_scalar( diff, &resid[1] );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD      
+      fprintf( stdout, "   %d   %6.3f   %6.3f   %6.3f   %6.3f   %le   %le\n", 
+               size, flops[0], flops[1], flops[2], flops[3],
+               resid[0], resid[1] );
+#else
+      fprintf( fpp, "   %d   %6.3f   %6.3f   %6.3f   %6.3f\n", 
+               size, flops[0], flops[1], flops[2], flops[3] );
+      
+      fprintf( stdout, "Matrix size: %u x %u  |  nb_flash: %u  |  nb_alg: %u\n", 
+               size, size, nb_flash, nb_alg ); 
+      fprintf( stdout, "LU_piv     GFlops: %6.3f FIFO  |  %6.3f priority  |  Max difference: %le\n", 
+               flops[0], flops[1], resid[0] );
+      fprintf( stdout, "QR_UT_inc  GFlops: %6.3f FIFO  |  %6.3f priority  |  Max difference: %le\n\n", 
+               flops[2], flops[3], resid[1] );
+#endif
+ 
+      FLA_Obj_free( &A ); 
+      FLA_Obj_free( &LU[0] ); 
+      FLA_Obj_free( &LU[1] ); 
+      FLA_Obj_free( &QR[0] ); 
+      FLA_Obj_free( &QR[1] ); 
+      FLA_Obj_free( &diff ); 
+   }
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "];\n\n" );
+#else
+   fprintf( fpp, "];\n" );
+   
+   fflush( fpp );
+   fclose( fpp );
+#endif
+
+   FLA_free( dtimes );
+
+   FLA_Finalize(); 
+   
+   return 0; 
+}
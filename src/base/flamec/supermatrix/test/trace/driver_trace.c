@@ -0,0 +1,165 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h" 
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <math.h> 
+
+
+#define OUTPUT_PATH "./results"
+#define OUTPUT_FILE "trace"
+
+
+int main( int argc, char *argv[] ) 
+{ 
+   int
+      i, j, k,
+      n_threads,
+      n_repeats,
+      n_trials,
+      increment,
+      begin;
+
+   dim_t
+      size,
+      nb_alg = 0;
+
+   FLA_Datatype
+      datatype = FLA_DOUBLE;
+
+   FLA_Obj 
+      A, AH, pH;
+   
+   double 
+      dtime, 
+      *dtimes,
+      flops[2];
+
+   char
+      trace_file[100];
+
+#ifndef FLA_ENABLE_WINDOWS_BUILD
+   char
+      output_file_m[100];
+   
+   FILE
+      *fpp;
+#endif
+
+   fprintf( stdout, "%c Enter number of repeats: ", '%' );
+   scanf( "%d", &n_repeats );
+   fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+   fprintf( stdout, "%c Enter blocksize: ", '%' );
+   scanf( "%u", &nb_alg );
+   fprintf( stdout, "%c %u\n", '%', nb_alg );
+
+   fprintf( stdout, "%c Enter problem size parameters: first, inc, num: ", '%' );
+   scanf( "%d%d%d", &begin, &increment, &n_trials );
+   fprintf( stdout, "%c %d %d %d\n", '%', begin, increment, n_trials );
+
+   fprintf( stdout, "%c Enter number of threads: ", '%' );
+   scanf( "%d", &n_threads );
+   fprintf( stdout, "%c %d\n\n", '%', n_threads );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#else
+   sprintf( output_file_m, "%s/%s_output.m", OUTPUT_PATH, OUTPUT_FILE );
+   fpp = fopen( output_file_m, "a" );
+
+   fprintf( fpp, "%%\n" );
+   fprintf( fpp, "%% | Matrix Size |  untraced GFlops  |  traced GFlops  |\n" );
+   fprintf( fpp, "%% ---------------------------------------------------\n" );
+   fprintf( fpp, "%s_%u = [\n", OUTPUT_FILE, nb_alg );
+#endif
+
+   FLA_Init();
+
+   dtimes = ( double * ) FLA_malloc( n_repeats * sizeof( double ) );
+   
+   FLASH_Queue_set_num_threads( n_threads );
+
+   for ( i = 0; i < n_trials; i++ )
+   {
+      size = begin + i * increment;
+      
+      FLA_Obj_create( datatype, size, size, 0, 0, &A ); 
+
+      // Time an LU factorization without and then with tracing, which shows
+      // the overhead of recording the trace.
+      for ( k = 0; k < 2; k++ )
+      {
+         for ( j = 0; j < n_repeats; j++ )
+         {
+            FLA_Random_matrix( A );
+
+            FLASH_Obj_create_hier_copy_of_flat( A, 1, &nb_alg, &AH );  
+            FLASH_Obj_create( FLA_INT, size, 1, 1, &nb_alg, &pH );
+
+            // Keep only the trace of the last repeat.
+            FLASH_Queue_set_tracing( k == 1 );
+
+            dtime = FLA_Clock();
+            
+            FLASH_LU_piv( AH, pH );
+
+            dtimes[j] = FLA_Clock() - dtime;
+
+            FLASH_Queue_set_tracing( FALSE );
+            
+            FLASH_Obj_free( &AH );
+            FLASH_Obj_free( &pH );
+         }
+
+         dtime = dtimes[0];
+         for ( j = 1; j < n_repeats; j++ )
+            dtime = min( dtime, dtimes[j] );
+         flops[k] = 2.0 / 3.0 * size * size * size / dtime / 1e9;
+      }
+
+      // Export the timeline of the last traced factorization.
+      sprintf( trace_file, "%s/%s_%u.json", OUTPUT_PATH, OUTPUT_FILE, size );
+      FLASH_Queue_write_trace( trace_file );
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD      
+      fprintf( stdout, "   %d   %6.3f   %6.3f\n", 
+               size, flops[0], flops[1] );
+#else
+      fprintf( fpp, "   %d   %6.3f   %6.3f\n", 
+               size, flops[0], flops[1] );
+      
+      fprintf( stdout, "Matrix size: %u x %u  |  nb_alg: %u\n", 
+               size, size, nb_alg ); 
+      fprintf( stdout, "untraced: %6.3f GFlops\n", flops[0] );
+      fprintf( stdout, "traced:   %6.3f GFlops  |  timeline: %s\n\n", 
+               flops[1], trace_file );
+#endif
+ 
+      FLA_Obj_free( &A ); 
+   }
+
+#ifdef FLA_ENABLE_WINDOWS_BUILD
+   fprintf( stdout, "];\n\n" );
+#else
+   fprintf( fpp, "];\n" );
+   
+   fflush( fpp );
+   fclose( fpp );
+#endif
+
+   FLA_free( dtimes );
+
+   FLA_Finalize(); 
+   
+   return 0; 
+}
@@ -0,0 +1,120 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_ldlt_t* fla_ldlt_piv_cntl_leaf;
+
+// Factor the panel of FLASH_LDLT_piv_var1() that begins s( 0 ) columns into
+// the top-left block of the hierarchical matrix A, which begins offset rows
+// into the matrix that p describes. The panel ends with the last column of
+// that block, or the first column of the next block when its last pivot is
+// a 2 x 2 block. The columns of L and L D that the trailing updates need
+// are left in the flat workspaces L and W, which span all of the matrix.
+
+FLA_Error FLA_LDLT_piv_panel_task( FLA_Obj A, FLA_Obj p, FLA_Obj L, FLA_Obj W, FLA_Obj s, int offset, fla_ldlt_t* cntl )
+{
+   FLA_Error r_val = FLA_SUCCESS;
+   FLA_Obj   A_flat, ATL, ATR, ABL, ABR;
+   FLA_Obj   A1, A2, A11, A21, AB1;
+   FLA_Obj   p_panel, p1, p2;
+   FLA_Obj   W_panel, W1, W2, W11, W21;
+   FLA_Obj   LT, LB, LL, LR;
+   FLA_Obj   WT, WB, WL, WR;
+   int*      buff_s = FLA_INT_PTR( s );
+   int       start  = buff_s[0];
+   int       b, m_p, nb, kb;
+
+   b = FLA_Obj_width( *FLASH_OBJ_PTR_AT( A ) );
+
+   FLASH_Obj_create_flat_copy_of_hier( A, &A_flat );
+
+   FLA_Set( FLA_ZERO, L );
+   FLA_Set( FLA_ZERO, W );
+
+   FLA_Part_2x2( A_flat,   &ATL, &ATR,
+                           &ABL, &ABR,     start, start, FLA_TL );
+
+   m_p = FLA_Obj_length( ABR );
+   nb  = b - start + 1;
+   kb  = 0;
+
+   if ( m_p > 0 )
+   {
+      FLA_Obj_create( FLA_INT, m_p, 1, 0, 0, &p_panel );
+
+      if ( m_p > nb )
+      {
+         FLA_Obj_create( FLA_Obj_datatype( A_flat ), m_p, nb, 0, 0, &W_panel );
+
+         r_val = FLA_LDLT_piv_panel( ABR, p_panel, W_panel, &kb );
+
+         // Save the factored columns of L below the panel, whose rows
+         // still match those of the trailing submatrix, and those of L D.
+         FLA_Part_1x2( ABR,       &A1, &A2,       kb, FLA_LEFT );
+         FLA_Part_2x1( A1,        &A11,
+                                  &A21,           kb, FLA_TOP );
+
+         FLA_Part_1x2( W_panel,   &W1, &W2,       kb, FLA_LEFT );
+         FLA_Part_2x1( W1,        &W11,
+                                  &W21,           kb, FLA_TOP );
+
+         FLA_Part_2x1( L,         &LT,
+                                  &LB,            offset + start + kb, FLA_TOP );
+         FLA_Part_1x2( LB,        &LL, &LR,       kb, FLA_LEFT );
+
+         FLA_Part_2x1( W,         &WT,
+                                  &WB,            offset + start + kb, FLA_TOP );
+         FLA_Part_1x2( WB,        &WL, &WR,       kb, FLA_LEFT );
+
+         FLA_Copy( A21, LL );
+         FLA_Copy( W21, WL );
+
+         FLA_Merge_2x1( A11,
+                        A21,      &AB1 );
+
+         FLA_Part_2x1( p_panel,   &p1,
+                                  &p2,            kb, FLA_TOP );
+
+         FLA_LDLT_piv_unswap( AB1, p1 );
+
+         FLA_Obj_free( &W_panel );
+      }
+      else
+      {
+         r_val = FLA_LDLT_piv_internal( ABR, p_panel,
+                                        fla_ldlt_piv_cntl_leaf );
+         kb    = m_p;
+      }
+
+      FLA_Part_2x1( p_panel,   &p1,
+                               &p2,            kb, FLA_TOP );
+
+      FLA_LDLT_piv_shift_pivots( offset + start, p1 );
+
+      FLASH_Copy_flat_to_hier( p1, offset + start, 0, p );
+
+      FLA_Obj_free( &p_panel );
+   }
+
+   // Record the first zero pivot, since the panels execute in order.
+   if ( buff_s[1] == FLA_SUCCESS && r_val >= 0 )
+      buff_s[1] = offset + start + r_val;
+
+   // Record how far into the next block the panel reached.
+   buff_s[0] = start + kb - b;
+
+   FLASH_Copy_flat_to_hier( A_flat, 0, 0, A );
+
+   FLA_Obj_free( &A_flat );
+
+   return FLA_SUCCESS;
+}
+
@@ -0,0 +1,20 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_gemm_t* fla_gemm_cntl_blas;
+
+FLA_Error FLA_LDLT_piv_update_task( FLA_Obj L, FLA_Obj W, FLA_Obj A, fla_gemm_t* cntl )
+{
+  return FLA_LDLT_piv_update( L, W, A,
+                              fla_gemm_cntl_blas );
+}
+
@@ -16,8 +16,9 @@ FLA_Error FLA_Bsvd( FLA_Uplo uplo, FLA_Obj d, FLA_Obj e,
                     FLA_Svd_type jobv, FLA_Obj V )
 {
   FLA_Error r_val      = FLA_SUCCESS;
-  dim_t     n_iter_max = 30;
-  dim_t     b_alg      = 512;
+  dim_t     n_iter_max;
+  dim_t     b_alg;
+  FLA_Datatype dt_tune;
   dim_t     m_d        = FLA_Obj_vector_dim( d );
   FLA_Obj   C; // dummy variable
 
@@ -25,6 +26,14 @@ FLA_Error FLA_Bsvd( FLA_Uplo uplo, FLA_Obj d, FLA_Obj e,
   if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
     FLA_Bsvd_check( uplo, d, e, G, H, jobu, U, jobv, V );
 
+  // Query the (possibly tuned) parameters of the QR algorithm. These are
+  // kept by the datatype of the singular vectors, which the rotations are
+  // applied to, and by the datatype of d when no vectors are wanted.
+  dt_tune    = ( jobu != FLA_SVD_VECTORS_NONE ? FLA_Obj_datatype( U )
+                                              : FLA_Obj_datatype( d ) );
+  n_iter_max = FLA_Tune_get( dt_tune, FLA_TUNE_BSVD, FLA_TUNE_N_ITER_MAX );
+  b_alg      = FLA_Tune_get( dt_tune, FLA_TUNE_BSVD, FLA_TUNE_B_ALG );
+
   // Partition U and V properly to account for the diagonal dimension.
   if ( jobu == FLA_SVD_VECTORS_MIN_COPY || 
        jobu == FLA_SVD_VECTORS_MIN_OVERWRITE )
@@ -0,0 +1,43 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_chol_t* flash_chol_cntl;
+
+FLA_Error FLASH_Chol_band( FLA_Uplo uplo, dim_t kd, FLA_Obj A )
+{
+  FLA_Error r_val;
+  dim_t     b, kd_b;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_Chol_check( uplo, A );
+
+  // Unlike FLA_Chol_band(), every block of A is stored, and the elements
+  // outside of the band must be zero. A block is within the band when it
+  // holds any of its elements, which is when it lies within kd_b blocks of
+  // the diagonal.
+  b    = FLASH_Obj_scalar_width_tl( A );
+  kd_b = ( b == 0 ? 0 : ( kd + b - 1 ) / b );
+
+  // Begin a parallel region.
+  FLASH_Queue_begin();
+
+  // Enqueue tasks for the blocks within the band via a SuperMatrix-aware
+  // control tree.
+  r_val = FLA_Chol_band_internal( uplo, kd_b, A, flash_chol_cntl );
+
+  // End the parallel region.
+  FLASH_Queue_end();
+
+  return r_val;
+}
+
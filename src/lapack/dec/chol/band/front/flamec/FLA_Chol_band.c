@@ -0,0 +1,40 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_chol_t* fla_chol_band_cntl;
+extern fla_chol_t* fla_chol_band_cntl_leaf;
+
+FLA_Error FLA_Chol_band( FLA_Uplo uplo, dim_t kd, FLA_Obj A )
+{
+  FLA_Error   r_val;
+  dim_t       b_alg;
+  fla_chol_t* cntl;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_Chol_band_check( uplo, kd, A );
+
+  b_alg = FLA_Blocksize_extract( FLA_Obj_datatype( A ),
+                                 FLA_Cntl_blocksize( fla_chol_band_cntl ) );
+
+  // The blocked variant factors b_alg columns at a time, so it is used only
+  // when the band holds at least that many subdiagonals. Narrower bands are
+  // factored one column at a time.
+  if ( kd < b_alg ) cntl = fla_chol_band_cntl_leaf;
+  else              cntl = fla_chol_band_cntl;
+
+  // Invoke FLA_Chol_band_internal() with the appropriate control tree.
+  r_val = FLA_Chol_band_internal( uplo, kd, A, cntl );
+
+  return r_val;
+}
+
@@ -0,0 +1,13 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLA_Chol_band_vars.h"
+
+FLA_Error FLA_Chol_band_internal( FLA_Uplo uplo, dim_t kd, FLA_Obj A, fla_chol_t* cntl );
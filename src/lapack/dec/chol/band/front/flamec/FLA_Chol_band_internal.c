@@ -0,0 +1,52 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Chol_band_internal( FLA_Uplo uplo, dim_t kd, FLA_Obj A, fla_chol_t* cntl )
+{
+	FLA_Error r_val = FLA_SUCCESS;
+
+	if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+	{
+		FLA_Error e_val = FLA_Check_null_pointer( ( void* ) cntl );
+		FLA_Check_error_code( e_val );
+	}
+
+	if      ( FLA_Cntl_matrix_type( cntl ) == FLA_HIER )
+	{
+		// For hierarchical matrices, kd counts blocks.
+		if ( uplo == FLA_LOWER_TRIANGULAR )
+			r_val = FLASH_Chol_band_l_var3( kd, A, cntl );
+		else
+			r_val = FLASH_Chol_band_u_var3( kd, A, cntl );
+	}
+	else if ( FLA_Cntl_variant( cntl ) == FLA_UNB_OPT_VARIANT3 )
+	{
+		if ( uplo == FLA_LOWER_TRIANGULAR )
+			r_val = FLA_Chol_band_l_opt_var3( kd, A );
+		else
+			r_val = FLA_Chol_band_u_opt_var3( kd, A );
+	}
+	else if ( FLA_Cntl_variant( cntl ) == FLA_BLOCKED_VARIANT3 )
+	{
+		if ( uplo == FLA_LOWER_TRIANGULAR )
+			r_val = FLA_Chol_band_l_blk_var3( kd, A, cntl );
+		else
+			r_val = FLA_Chol_band_u_blk_var3( kd, A, cntl );
+	}
+	else
+	{
+		FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+	}
+
+	return r_val;
+}
+
@@ -0,0 +1,135 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#define N_UPLO_COMBOS     2
+
+#define FLA_ALG_REFERENCE 0
+#define FLA_ALG_FRONT     1
+
+char* pc_str[N_UPLO_COMBOS] = { "l", "u" };
+
+void time_Chol_band(
+              FLA_Uplo uplo, int type, int n_repeats, int n, int kd,
+              FLA_Obj A, FLA_Obj AB, FLA_Obj A_ref,
+              double *dtime, double *diff, double *gflops );
+
+
+int main(int argc, char *argv[])
+{
+  int 
+    datatype,
+    kd_input,
+    n, kd,
+    p_first, p_last, p_inc,
+    pp,
+    uplo_combo,
+    n_repeats,
+    i, j, k,
+    n_uplo_combos = N_UPLO_COMBOS;
+  
+  FLA_Uplo
+    uplo;
+
+  double
+    dtime,
+    gflops,
+    diff;
+
+  double*
+    buff_A;
+
+  FLA_Obj
+    A, AB, A_ref;
+  
+
+  FLA_Init();
+
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c enter problem size first, last, inc:", '%' );
+  scanf( "%d%d%d", &p_first, &p_last, &p_inc );
+  fprintf( stdout, "%c %d %d %d\n", '%', p_first, p_last, p_inc );
+
+  fprintf( stdout, "%c enter kd (-1 means bind to problem size): ", '%' );
+  scanf( "%d", &kd_input );
+  fprintf( stdout, "%c %d\n", '%', kd_input );
+
+
+  fprintf( stdout, "\nclear all;\n\n" );
+
+
+  //datatype = FLA_FLOAT;
+  datatype = FLA_DOUBLE;
+
+  for ( pp = p_first, i = 1; pp <= p_last; pp += p_inc, i += 1 )
+  {
+    n  = pp;
+    kd = kd_input;
+
+    if( kd < 0 ) kd = pp / f2c_abs(kd_input);
+    kd = min( kd, n - 1 );
+
+    for ( uplo_combo = 0; uplo_combo < n_uplo_combos; uplo_combo++ ){
+      
+      uplo = ( uplo_combo == 0 ? FLA_LOWER_TRIANGULAR : FLA_UPPER_TRIANGULAR );
+
+      FLA_Obj_create( datatype, n, n, 0, 0, &A );
+      FLA_Obj_create( datatype, n, n, 0, 0, &A_ref );
+      FLA_Obj_create( datatype, kd + 1, n, 0, 0, &AB );
+
+      // Generate a symmetric positive definite matrix with kd sub- and
+      // superdiagonals, and keep its triangle in band storage.
+      FLA_Random_matrix( A );
+      FLA_Symmetrize( uplo, A );
+
+      buff_A = FLA_DOUBLE_PTR( A );
+      for ( j = 0; j < n; ++j )
+        for ( k = 0; k < n; ++k )
+          if ( k - j > kd || j - k > kd ) buff_A[ j * n + k ] = 0.0;
+      FLA_Shift_diag( FLA_NO_CONJUGATE, FLA_TWO, A );
+      for ( j = 0; j < n; ++j )
+        buff_A[ j * n + j ] *= ( double ) kd + 1.0;
+
+      fprintf( stdout, "data_chol_band_%s( %d, 1:5 ) = [ %d  ", pc_str[uplo_combo], i, n );
+      fflush( stdout );
+
+      time_Chol_band( uplo, FLA_ALG_REFERENCE, n_repeats, n, kd,
+                      A, AB, A_ref, &dtime, &diff, &gflops );
+
+      fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
+      fflush( stdout );
+
+      time_Chol_band( uplo, FLA_ALG_FRONT, n_repeats, n, kd,
+                      A, AB, A_ref, &dtime, &diff, &gflops );
+
+      fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
+      fflush( stdout );
+
+      fprintf( stdout, " ]; \n" );
+      fflush( stdout );
+
+      FLA_Obj_free( &A );
+      FLA_Obj_free( &AB );
+      FLA_Obj_free( &A_ref );
+    }
+
+    fprintf( stdout, "\n" );
+  }
+
+  FLA_Finalize( );
+
+  return 0;
+}
+
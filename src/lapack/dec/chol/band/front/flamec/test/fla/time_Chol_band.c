@@ -0,0 +1,128 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#define FLA_ALG_REFERENCE 0
+#define FLA_ALG_FRONT     1
+
+
+FLA_Error REF_Chol_band( FLA_Uplo uplo, FLA_Obj A );
+void time_Chol_band(
+              FLA_Uplo uplo, int type, int nrepeats, int n, int kd,
+              FLA_Obj A, FLA_Obj AB, FLA_Obj A_ref,
+              double *dtime, double *diff, double *gflops );
+void copy_band( FLA_Uplo uplo, int kd, FLA_Obj A, FLA_Obj B );
+
+
+void time_Chol_band(
+              FLA_Uplo uplo, int type, int nrepeats, int n, int kd,
+              FLA_Obj A, FLA_Obj AB, FLA_Obj A_ref,
+              double *dtime, double *diff, double *gflops )
+{
+  int
+    irep;
+
+  double
+    dtime_old = 1.0e9;
+
+  FLA_Obj
+    A_save, A_band, A_diff;
+
+  FLA_Obj_create_conf_to( FLA_NO_TRANSPOSE, A, &A_save );
+  FLA_Copy_external( A, A_save );
+
+  // View the band storage AB as an n x n matrix.
+  FLA_Obj_create_without_buffer( FLA_Obj_datatype( A ), n, n, &A_band );
+  FLA_Obj_attach_band_buffer( FLA_Obj_buffer_at_view( AB ),
+                              ( uplo == FLA_UPPER_TRIANGULAR ? kd : 0 ),
+                              FLA_Obj_col_stride( AB ), &A_band );
+
+
+  for ( irep = 0 ; irep < nrepeats; irep++ ){
+
+    FLA_Copy_external( A_save, A );
+    copy_band( uplo, kd, A_save, A_band );
+
+    *dtime = FLA_Clock();
+
+    switch( type ){
+    case FLA_ALG_REFERENCE:
+      REF_Chol_band( uplo, A );
+      break;
+    case FLA_ALG_FRONT:
+      FLA_Chol_band( uplo, kd, A_band );
+      break;
+    default:
+      printf("trouble\n");
+    }
+
+    *dtime = FLA_Clock() - *dtime;
+    dtime_old = min( *dtime, dtime_old );
+  }
+
+  if ( type == FLA_ALG_REFERENCE )
+  {
+    FLA_Copy_external( A, A_ref );
+    *diff = 0.0;
+  }
+  else
+  {
+    FLA_Obj_create_conf_to( FLA_NO_TRANSPOSE, A, &A_diff );
+
+    // Compare the factors only within the band.
+    FLA_Set( FLA_ZERO, A );
+    FLA_Set( FLA_ZERO, A_diff );
+    copy_band( uplo, kd, A_band, A );
+    copy_band( uplo, kd, A_ref, A_diff );
+    *diff = FLA_Max_elemwise_diff( A, A_diff );
+
+    FLA_Obj_free( &A_diff );
+  }
+
+  // Count the flops of the band factorization for both algorithms, so
+  // that the rates compare their times.
+  *gflops = 1.0 * 
+            n * 
+            kd * 
+            ( kd + 3.0 ) / 
+            dtime_old / 1e9;
+
+  *dtime = dtime_old;
+
+  FLA_Copy_external( A_save, A );
+
+  FLA_Obj_free_without_buffer( &A_band );
+  FLA_Obj_free( &A_save );
+}
+
+
+// Copy the kd diagonals of the uplo triangle of A to B, leaving the other
+// elements of B untouched, as those of a band view may not be referenced.
+void copy_band( FLA_Uplo uplo, int kd, FLA_Obj A, FLA_Obj B )
+{
+  int     n      = FLA_Obj_length( A );
+  int     cs_A   = FLA_Obj_col_stride( A );
+  int     cs_B   = FLA_Obj_col_stride( B );
+  double* buff_A = FLA_Obj_buffer_at_view( A );
+  double* buff_B = FLA_Obj_buffer_at_view( B );
+  int     i, j;
+
+  for ( j = 0; j < n; ++j )
+  {
+    if ( uplo == FLA_LOWER_TRIANGULAR )
+      for ( i = j; i < min( j + kd + 1, n ); ++i )
+        buff_B[ j * cs_B + i ] = buff_A[ j * cs_A + i ];
+    else
+      for ( i = max( j - kd, 0 ); i <= j; ++i )
+        buff_B[ j * cs_B + i ] = buff_A[ j * cs_A + i ];
+  }
+}
+
@@ -0,0 +1,80 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLASH_Chol_band_u_var3( dim_t kd_b, FLA_Obj A, fla_chol_t* cntl )
+{
+   FLA_Obj ATL,   ATR,      A00, A01, A02,
+           ABL,   ABR,      A10, A11, A12,
+                            A20, A21, A22;
+
+   FLA_Obj A12_1, A12_2;
+   FLA_Obj A22_TL, A22_TR, A22_BL, A22_BR;
+
+   dim_t b, i2;
+
+   int r_val = FLA_SUCCESS;
+
+   FLA_Part_2x2( A,    &ATL, &ATR,
+                       &ABL, &ABR,     0, 0, FLA_TL );
+
+   while ( FLA_Obj_length( ATL ) < FLA_Obj_length( A ) )
+   {
+      b = FLA_Determine_blocksize( ABR, FLA_BR, FLA_Cntl_blocksize( cntl ) );
+
+      FLA_Repart_2x2_to_3x3( ATL, /**/ ATR,       &A00, /**/ &A01, &A02,
+                          /* ************* */   /* ******************** */
+                                                  &A10, /**/ &A11, &A12,
+                             ABL, /**/ ABR,       &A20, /**/ &A21, &A22,
+                             b, b, FLA_BR );
+
+      /*------------------------------------------------------------*/
+
+      // Every block of A is stored, so the blocks of A12 within kd_b blocks
+      // of the diagonal are updated whole and the rest, which are zero, are
+      // skipped together with the blocks of A22 that they would update.
+      i2 = min( kd_b + b - 1, FLA_Obj_width( A12 ) );
+
+      FLA_Part_1x2( A12,    &A12_1, &A12_2,     i2, FLA_LEFT );
+
+      FLA_Part_2x2( A22,    &A22_TL, &A22_TR,
+                            &A22_BL, &A22_BR,     i2, i2, FLA_TL );
+
+      // A11 = chol( A11 )
+      r_val = FLA_Chol_internal( FLA_UPPER_TRIANGULAR, A11,
+                                 FLA_Cntl_sub_chol( cntl ) );
+
+      if ( r_val != FLA_SUCCESS )
+         return ( FLA_Obj_length( A00 ) + r_val );
+
+      // A12_1 = inv( triu( A11 )' ) * A12_1
+      FLA_Trsm_internal( FLA_LEFT, FLA_UPPER_TRIANGULAR,
+                         FLA_CONJ_TRANSPOSE, FLA_NONUNIT_DIAG,
+                         FLA_ONE, A11, A12_1,
+                         FLA_Cntl_sub_trsm( cntl ) );
+
+      // A22_TL = A22_TL - A12_1' * A12_1
+      FLA_Herk_internal( FLA_UPPER_TRIANGULAR, FLA_CONJ_TRANSPOSE,
+                         FLA_MINUS_ONE, A12_1, FLA_ONE, A22_TL,
+                         FLA_Cntl_sub_herk( cntl ) );
+
+      /*------------------------------------------------------------*/
+
+      FLA_Cont_with_3x3_to_2x2( &ATL, /**/ &ATR,       A00, A01, /**/ A02,
+                                                       A10, A11, /**/ A12,
+                              /* ************** */  /* ****************** */
+                                &ABL, /**/ &ABR,       A20, A21, /**/ A22,
+                                FLA_TL );
+   }
+
+   return r_val;
+}
+
@@ -0,0 +1,133 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Chol_band_l_blk_var3( dim_t kd, FLA_Obj A, fla_chol_t* cntl )
+{
+  FLA_Obj ATL,   ATR,      A00, A01, A02,
+          ABL,   ABR,      A10, A11, A12,
+                           A20, A21, A22;
+
+  FLA_Obj A21_1, A21_2, A31, A41;
+  FLA_Obj A22_TL, A22_TR, A22_BL, A22_BR;
+  FLA_Obj A32, A42, A33, A34, A43, A44;
+  FLA_Obj W, W1, WTR, WBL, WBR;
+
+  dim_t b, b_max, i2, i3;
+
+  int r_val = FLA_SUCCESS;
+
+  // The block of A31 that lies within the band is upper triangular, and is
+  // updated through a copy W whose strictly lower triangle remains zero.
+  b_max = min( FLA_Blocksize_extract( FLA_Obj_datatype( A ),
+                                      FLA_Cntl_blocksize( cntl ) ), kd );
+
+  FLA_Obj_create( FLA_Obj_datatype( A ), b_max, b_max, 0, 0, &W );
+  FLA_Set( FLA_ZERO, W );
+
+  FLA_Part_2x2( A,    &ATL, &ATR,
+                      &ABL, &ABR,     0, 0, FLA_TL );
+
+  while ( FLA_Obj_length( ATL ) < FLA_Obj_length( A ) ){
+
+    b = min( FLA_Obj_length( ABR ), b_max );
+
+    FLA_Repart_2x2_to_3x3( ATL, /**/ ATR,       &A00, /**/ &A01, &A02,
+                        /* ************* */   /* ******************** */
+                                                &A10, /**/ &A11, &A12,
+                           ABL, /**/ ABR,       &A20, /**/ &A21, &A22,
+                           b, b, FLA_BR );
+
+    /*------------------------------------------------------------*/
+
+    // Only the first kd - b rows of A21, and the upper triangle of the b
+    // rows below them, A31, lie within the band.
+    i2 = min( kd - b, FLA_Obj_length( A21 ) );
+    i3 = min( b, FLA_Obj_length( A21 ) - i2 );
+
+    FLA_Part_2x1( A21,    &A21_1,
+                          &A21_2,     i2, FLA_TOP );
+
+    FLA_Part_2x1( A21_2,  &A31,
+                          &A41,       i3, FLA_TOP );
+
+    FLA_Part_2x2( A22,    &A22_TL, &A22_TR,
+                          &A22_BL, &A22_BR,     i2, i2, FLA_TL );
+
+    FLA_Part_2x1( A22_BL, &A32,
+                          &A42,       i3, FLA_TOP );
+
+    FLA_Part_2x2( A22_BR, &A33, &A34,
+                          &A43, &A44,     i3, i3, FLA_TL );
+
+    // A11 = chol( A11 )
+    r_val = FLA_Chol_internal( FLA_LOWER_TRIANGULAR, A11,
+                               FLA_Cntl_sub_chol( cntl ) );
+
+    if ( r_val != FLA_SUCCESS )
+    {
+      FLA_Obj_free( &W );
+      return ( FLA_Obj_length( A00 ) + r_val );
+    }
+
+    // A21_1 = A21_1 * inv( tril( A11 )' )
+    FLA_Trsm_internal( FLA_RIGHT, FLA_LOWER_TRIANGULAR,
+                       FLA_CONJ_TRANSPOSE, FLA_NONUNIT_DIAG,
+                       FLA_ONE, A11, A21_1,
+                       FLA_Cntl_sub_trsm( cntl ) );
+
+    // A22_TL = A22_TL - A21_1 * A21_1'
+    FLA_Herk_internal( FLA_LOWER_TRIANGULAR, FLA_NO_TRANSPOSE,
+                       FLA_MINUS_ONE, A21_1, FLA_ONE, A22_TL,
+                       FLA_Cntl_sub_herk( cntl ) );
+
+    if ( i3 > 0 )
+    {
+      FLA_Part_2x2( W,    &W1,  &WTR,
+                          &WBL, &WBR,     i3, b, FLA_TL );
+
+      // W1 = triu( A31 )
+      FLA_Copyr( FLA_UPPER_TRIANGULAR, A31, W1 );
+
+      // W1 = W1 * inv( tril( A11 )' )
+      FLA_Trsm_internal( FLA_RIGHT, FLA_LOWER_TRIANGULAR,
+                         FLA_CONJ_TRANSPOSE, FLA_NONUNIT_DIAG,
+                         FLA_ONE, A11, W1,
+                         FLA_Cntl_sub_trsm( cntl ) );
+
+      // A32 = A32 - W1 * A21_1'
+      FLA_Gemm_internal( FLA_NO_TRANSPOSE, FLA_CONJ_TRANSPOSE,
+                         FLA_MINUS_ONE, W1, A21_1, FLA_ONE, A32,
+                         FLA_Cntl_sub_gemm( cntl ) );
+
+      // A33 = A33 - W1 * W1'
+      FLA_Herk_internal( FLA_LOWER_TRIANGULAR, FLA_NO_TRANSPOSE,
+                         FLA_MINUS_ONE, W1, FLA_ONE, A33,
+                         FLA_Cntl_sub_herk( cntl ) );
+
+      // triu( A31 ) = W1
+      FLA_Copyr( FLA_UPPER_TRIANGULAR, W1, A31 );
+    }
+
+    /*------------------------------------------------------------*/
+
+    FLA_Cont_with_3x3_to_2x2( &ATL, /**/ &ATR,       A00, A01, /**/ A02,
+                                                     A10, A11, /**/ A12,
+                            /* ************** */  /* ****************** */
+                              &ABL, /**/ &ABR,       A20, A21, /**/ A22,
+                              FLA_TL );
+  }
+
+  FLA_Obj_free( &W );
+
+  return r_val;
+}
+
@@ -0,0 +1,45 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Chol_band_l_blk_var3( dim_t kd, FLA_Obj A, fla_chol_t* cntl );
+FLA_Error FLA_Chol_band_u_blk_var3( dim_t kd, FLA_Obj A, fla_chol_t* cntl );
+
+FLA_Error FLASH_Chol_band_l_var3( dim_t kd_b, FLA_Obj A, fla_chol_t* cntl );
+FLA_Error FLASH_Chol_band_u_var3( dim_t kd_b, FLA_Obj A, fla_chol_t* cntl );
+
+FLA_Error FLA_Chol_band_l_opt_var3( dim_t kd, FLA_Obj A );
+FLA_Error FLA_Chol_band_l_ops_var3( int kd,
+                                    int mn_A,
+                                    float*    A, int rs_A, int cs_A );
+FLA_Error FLA_Chol_band_l_opd_var3( int kd,
+                                    int mn_A,
+                                    double*   A, int rs_A, int cs_A );
+FLA_Error FLA_Chol_band_l_opc_var3( int kd,
+                                    int mn_A,
+                                    scomplex* A, int rs_A, int cs_A );
+FLA_Error FLA_Chol_band_l_opz_var3( int kd,
+                                    int mn_A,
+                                    dcomplex* A, int rs_A, int cs_A );
+
+FLA_Error FLA_Chol_band_u_opt_var3( dim_t kd, FLA_Obj A );
+FLA_Error FLA_Chol_band_u_ops_var3( int kd,
+                                    int mn_A,
+                                    float*    A, int rs_A, int cs_A );
+FLA_Error FLA_Chol_band_u_opd_var3( int kd,
+                                    int mn_A,
+                                    double*   A, int rs_A, int cs_A );
+FLA_Error FLA_Chol_band_u_opc_var3( int kd,
+                                    int mn_A,
+                                    scomplex* A, int rs_A, int cs_A );
+FLA_Error FLA_Chol_band_u_opz_var3( int kd,
+                                    int mn_A,
+                                    dcomplex* A, int rs_A, int cs_A );
@@ -12,18 +12,65 @@
 
 extern fla_chol_t* fla_chol_cntl;
 extern fla_chol_t* fla_chol_cntl2;
+extern fla_chol_t* fla_chol_cntl_leaf;
+extern double      fla_chol_var3_in_to_ou_bsize_ratio;
 
 FLA_Error FLA_Chol( FLA_Uplo uplo, FLA_Obj A )
 {
-  FLA_Error r_val;
+  FLA_Error       r_val;
+  FLA_Datatype    datatype;
+  dim_t           m_A, n_levels;
+  dim_t           b_alg, b_alg_in;
+  fla_chol_t*     cntl;
+  fla_chol_t      cntl_size, cntl_size_in;
+  fla_blocksize_t bsize, bsize_in;
 
   // Check parameters.
   if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
     FLA_Chol_check( uplo, A );
 
+  datatype = FLA_Obj_datatype( A );
+  m_A      = FLA_Obj_length( A );
+
+  // Look up the number of algorithmic levels and the blocksize for a
+  // problem of this size in the (possibly tuned) decision table.
+  n_levels = FLA_Tune_get_for_size( datatype, FLA_TUNE_CHOL, FLA_TUNE_N_LEVELS, m_A );
+  b_alg    = FLA_Tune_get_for_size( datatype, FLA_TUNE_CHOL, FLA_TUNE_B_ALG,    m_A );
+
+  // Small problems go straight to the unblocked variant, while larger ones
+  // are blocked once, or twice with a smaller inner blocksize.
+  if      ( n_levels <= 1 ) cntl = fla_chol_cntl_leaf;
+  else if ( n_levels == 2 ) cntl = fla_chol_cntl;
+  else                      cntl = fla_chol_cntl2;
+
+  // When the table gives this problem a blocksize other than the one the
+  // control tree was created with, use a copy of the tree whose blocked
+  // levels block accordingly.
+  if ( n_levels >= 2 &&
+       b_alg != FLA_Blocksize_extract( datatype, FLA_Cntl_blocksize( cntl ) ) )
+  {
+    FLA_Blocksize_set( &bsize, b_alg, b_alg, b_alg, b_alg );
+
+    cntl_size           = *cntl;
+    cntl_size.blocksize = &bsize;
+
+    if ( n_levels >= 3 )
+    {
+      b_alg_in = max( ( dim_t )( ( double ) b_alg * fla_chol_var3_in_to_ou_bsize_ratio ), 1 );
+
+      FLA_Blocksize_set( &bsize_in, b_alg_in, b_alg_in, b_alg_in, b_alg_in );
+
+      cntl_size_in           = *FLA_Cntl_sub_chol( cntl );
+      cntl_size_in.blocksize = &bsize_in;
+
+      cntl_size.sub_chol     = &cntl_size_in;
+    }
+
+    cntl = &cntl_size;
+  }
+
   // Invoke FLA_Chol_internal() with the appropriate control tree.
-  r_val = FLA_Chol_internal( uplo, A, fla_chol_cntl2 );
-  //r_val = FLA_Chol_internal( uplo, A, fla_chol_cntl );
+  r_val = FLA_Chol_internal( uplo, A, cntl );
 
   return r_val;
 }
@@ -11,6 +11,11 @@
 #include "FLA_Chol_l.h"
 #include "FLA_Chol_u.h"
 
+// The number of problems that FLA_Chol_batched() factors together, and the
+// largest problem that it factors this way.
+#define FLA_CHOL_BATCHED_N_LANES          8
+#define FLA_CHOL_BATCHED_MAX_INTERLEAVE  12
+
 FLA_Error FLA_Chol_internal( FLA_Uplo uplo, FLA_Obj A, fla_chol_t* cntl );
 FLA_Error FLA_Chol_l( FLA_Obj A, fla_chol_t* cntl );
 FLA_Error FLA_Chol_u( FLA_Obj A, fla_chol_t* cntl );
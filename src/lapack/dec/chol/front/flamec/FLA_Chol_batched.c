@@ -0,0 +1,409 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// A batch is given either as arrays of sizes, buffers and leading
+// dimensions (buff_A != NULL), or as buff_A_s with one size and leading
+// dimension and a fixed stride, in elements, between the problems.
+
+typedef struct FLA_Chol_batched_vars_s
+{
+  FLA_Uplo     uplo;
+  FLA_Datatype datatype;
+  dim_t        elem_size;
+  int*         mn_A;
+  void**       buff_A;
+  int*         ldim_A;
+  int          mn_A_s;
+  void*        buff_A_s;
+  int          ldim_A_s;
+  int          stride_A;
+  FLA_Error*   r_val;
+} FLA_Chol_batched_vars;
+
+static FLA_Error FLA_Chol_batched_run( FLA_Chol_batched_vars* vars, int n_batch );
+static void      FLA_Chol_batched_range( int i_first, int n_batch, void* args );
+static FLA_Error FLA_Chol_batched_single( FLA_Chol_batched_vars* vars, int i );
+static void      FLA_Chol_batched_ilv_ops( FLA_Chol_batched_vars* vars, int i_first, float* buff_W );
+static void      FLA_Chol_batched_ilv_opd( FLA_Chol_batched_vars* vars, int i_first, double* buff_W );
+
+static int FLA_Chol_batched_mn( FLA_Chol_batched_vars* vars, int i )
+{
+  return ( vars->buff_A != NULL ? vars->mn_A[i] : vars->mn_A_s );
+}
+
+static int FLA_Chol_batched_ldim( FLA_Chol_batched_vars* vars, int i )
+{
+  return ( vars->buff_A != NULL ? vars->ldim_A[i] : vars->ldim_A_s );
+}
+
+static void* FLA_Chol_batched_buff( FLA_Chol_batched_vars* vars, int i )
+{
+  return ( vars->buff_A != NULL ? vars->buff_A[i]
+                                : ( char* ) vars->buff_A_s +
+                                  ( size_t ) i * vars->stride_A * vars->elem_size );
+}
+
+
+FLA_Error FLA_Chol_batched( FLA_Uplo uplo, FLA_Datatype datatype, int n_batch, int* mn_A, void** buff_A, int* ldim_A, FLA_Error* r_val )
+{
+  FLA_Chol_batched_vars vars;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+  {
+    FLA_Check_error_code( FLA_Check_valid_uplo( uplo ) );
+    FLA_Check_error_code( FLA_Check_floating_datatype( datatype ) );
+
+    if ( n_batch > 0 )
+    {
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) mn_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) buff_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) ldim_A ) );
+    }
+  }
+
+  vars.uplo      = uplo;
+  vars.datatype  = datatype;
+  vars.elem_size = FLA_Obj_datatype_size( datatype );
+  vars.mn_A      = mn_A;
+  vars.buff_A    = buff_A;
+  vars.ldim_A    = ldim_A;
+  vars.r_val     = r_val;
+
+  return FLA_Chol_batched_run( &vars, n_batch );
+}
+
+
+FLA_Error FLA_Chol_batched_strided( FLA_Uplo uplo, FLA_Datatype datatype, int n_batch, int mn_A, void* buff_A, int ldim_A, int stride_A, FLA_Error* r_val )
+{
+  FLA_Chol_batched_vars vars;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+  {
+    FLA_Check_error_code( FLA_Check_valid_uplo( uplo ) );
+    FLA_Check_error_code( FLA_Check_floating_datatype( datatype ) );
+
+    if ( n_batch > 0 )
+      FLA_Check_error_code( FLA_Check_null_pointer( buff_A ) );
+  }
+
+  vars.uplo      = uplo;
+  vars.datatype  = datatype;
+  vars.elem_size = FLA_Obj_datatype_size( datatype );
+  vars.buff_A    = NULL;
+  vars.mn_A_s    = mn_A;
+  vars.buff_A_s  = buff_A;
+  vars.ldim_A_s  = ldim_A;
+  vars.stride_A  = stride_A;
+  vars.r_val     = r_val;
+
+  return FLA_Chol_batched_run( &vars, n_batch );
+}
+
+
+static FLA_Error FLA_Chol_batched_run( FLA_Chol_batched_vars* vars, int n_batch )
+{
+  FLA_Error* r_val_user = vars->r_val;
+  FLA_Error  r_val      = FLA_SUCCESS;
+  int        i;
+
+  if ( n_batch <= 0 ) return FLA_SUCCESS;
+
+  if ( r_val_user == NULL )
+    vars->r_val = ( FLA_Error* ) FLA_malloc( n_batch * sizeof( FLA_Error ) );
+
+  FLA_Batch_run( n_batch, FLA_CHOL_BATCHED_N_LANES, FLA_Chol_batched_range, ( void* ) vars );
+
+  for ( i = 0; i < n_batch; ++i )
+    if ( vars->r_val[i] != FLA_SUCCESS ) r_val = FLA_FAILURE;
+
+  if ( r_val_user == NULL )
+    FLA_free( vars->r_val );
+
+  return r_val;
+}
+
+
+static void FLA_Chol_batched_range( int i_first, int n_batch, void* args )
+{
+  FLA_Chol_batched_vars* vars    = ( FLA_Chol_batched_vars* ) args;
+  int                    n_lanes = FLA_CHOL_BATCHED_N_LANES;
+  int                    i_last  = i_first + n_batch;
+  int                    i, k, mn, is_uniform;
+  void*                  buff_W  = NULL;
+
+  // Only real problems are interleaved; complex ones go one at a time to
+  // the unblocked kernels.
+  if ( vars->datatype == FLA_FLOAT || vars->datatype == FLA_DOUBLE )
+    buff_W = FLA_malloc( n_lanes * FLA_CHOL_BATCHED_MAX_INTERLEAVE *
+                         FLA_CHOL_BATCHED_MAX_INTERLEAVE * vars->elem_size );
+
+  i = i_first;
+
+  while ( i < i_last )
+  {
+    // Factor the next n_lanes problems together if they are the same size
+    // and small enough that the interleaved copy stays in cache.
+    mn         = FLA_Chol_batched_mn( vars, i );
+    is_uniform = ( buff_W != NULL && i + n_lanes <= i_last &&
+                   mn > 1 && mn <= FLA_CHOL_BATCHED_MAX_INTERLEAVE );
+
+    for ( k = 1; k < n_lanes && is_uniform; ++k )
+      is_uniform = ( FLA_Chol_batched_mn( vars, i + k ) == mn );
+
+    if ( is_uniform )
+    {
+      if ( vars->datatype == FLA_FLOAT )
+        FLA_Chol_batched_ilv_ops( vars, i, ( float* ) buff_W );
+      else
+        FLA_Chol_batched_ilv_opd( vars, i, ( double* ) buff_W );
+
+      i += n_lanes;
+    }
+    else
+    {
+      vars->r_val[i] = FLA_Chol_batched_single( vars, i );
+
+      i += 1;
+    }
+  }
+
+  if ( buff_W != NULL )
+    FLA_free( buff_W );
+}
+
+
+static FLA_Error FLA_Chol_batched_single( FLA_Chol_batched_vars* vars, int i )
+{
+  FLA_Error r_val  = FLA_SUCCESS;
+  int       mn_A   = FLA_Chol_batched_mn( vars, i );
+  int       cs_A   = FLA_Chol_batched_ldim( vars, i );
+  void*     buff_A = FLA_Chol_batched_buff( vars, i );
+
+  switch ( vars->datatype )
+  {
+    case FLA_FLOAT:
+    {
+      if ( vars->uplo == FLA_LOWER_TRIANGULAR )
+        r_val = FLA_Chol_l_ops_var2( mn_A, ( float* ) buff_A, 1, cs_A );
+      else
+        r_val = FLA_Chol_u_ops_var2( mn_A, ( float* ) buff_A, 1, cs_A );
+
+      break;
+    }
+
+    case FLA_DOUBLE:
+    {
+      if ( vars->uplo == FLA_LOWER_TRIANGULAR )
+        r_val = FLA_Chol_l_opd_var2( mn_A, ( double* ) buff_A, 1, cs_A );
+      else
+        r_val = FLA_Chol_u_opd_var2( mn_A, ( double* ) buff_A, 1, cs_A );
+
+      break;
+    }
+
+    case FLA_COMPLEX:
+    {
+      if ( vars->uplo == FLA_LOWER_TRIANGULAR )
+        r_val = FLA_Chol_l_opc_var2( mn_A, ( scomplex* ) buff_A, 1, cs_A );
+      else
+        r_val = FLA_Chol_u_opc_var2( mn_A, ( scomplex* ) buff_A, 1, cs_A );
+
+      break;
+    }
+
+    case FLA_DOUBLE_COMPLEX:
+    {
+      if ( vars->uplo == FLA_LOWER_TRIANGULAR )
+        r_val = FLA_Chol_l_opz_var2( mn_A, ( dcomplex* ) buff_A, 1, cs_A );
+      else
+        r_val = FLA_Chol_u_opz_var2( mn_A, ( dcomplex* ) buff_A, 1, cs_A );
+
+      break;
+    }
+  }
+
+  return r_val;
+}
+
+
+// The interleaved kernels copy the lower triangles of n_lanes problems into
+// W so that element (i,j) of every problem lies in n_lanes consecutive
+// entries, and then factor all of them with the right-looking algorithm
+// (variant 3), with every operation vectorized across the problems. An
+// upper triangular problem is real, so it is factored as the lower
+// triangle of its transpose. A problem that is not positive definite is
+// left untouched in W and factored again on its own, so that it fails
+// exactly as it does in FLA_Chol().
+
+static void FLA_Chol_batched_ilv_ops( FLA_Chol_batched_vars* vars, int i_first, float* buff_W )
+{
+  int    n_lanes = FLA_CHOL_BATCHED_N_LANES;
+  int    mn_A    = FLA_Chol_batched_mn( vars, i_first );
+  float* buff_A[FLA_CHOL_BATCHED_N_LANES];
+  int    rs_A[FLA_CHOL_BATCHED_N_LANES];
+  int    cs_A[FLA_CHOL_BATCHED_N_LANES];
+  int    e_val[FLA_CHOL_BATCHED_N_LANES];
+  float  inv_alpha11[FLA_CHOL_BATCHED_N_LANES];
+  int    i, j, l, k;
+
+  for ( k = 0; k < n_lanes; ++k )
+  {
+    buff_A[k] = ( float* ) FLA_Chol_batched_buff( vars, i_first + k );
+    rs_A[k]   = ( vars->uplo == FLA_LOWER_TRIANGULAR ? 1 : FLA_Chol_batched_ldim( vars, i_first + k ) );
+    cs_A[k]   = ( vars->uplo == FLA_LOWER_TRIANGULAR ? FLA_Chol_batched_ldim( vars, i_first + k ) : 1 );
+    e_val[k]  = FLA_SUCCESS;
+  }
+
+  for ( j = 0; j < mn_A; ++j )
+    for ( i = j; i < mn_A; ++i )
+      for ( k = 0; k < n_lanes; ++k )
+        buff_W[ ( j*mn_A + i )*n_lanes + k ] = buff_A[k][ i*rs_A[k] + j*cs_A[k] ];
+
+  for ( j = 0; j < mn_A; ++j )
+  {
+    float* alpha11 = buff_W + ( j*mn_A + j )*n_lanes;
+
+    // alpha11 = sqrt( alpha11 )
+    for ( k = 0; k < n_lanes; ++k )
+      if ( !( alpha11[k] > 0.0F ) && e_val[k] == FLA_SUCCESS ) e_val[k] = j;
+
+    for ( k = 0; k < n_lanes; ++k )
+    {
+      alpha11[k]     = sqrtf( alpha11[k] );
+      inv_alpha11[k] = 1.0F / alpha11[k];
+    }
+
+    // a21 = a21 / alpha11
+    for ( i = j + 1; i < mn_A; ++i )
+    {
+      float* alpha21 = buff_W + ( j*mn_A + i )*n_lanes;
+
+      for ( k = 0; k < n_lanes; ++k )
+        alpha21[k] *= inv_alpha11[k];
+    }
+
+    // A22 = A22 - a21 * a21'
+    for ( l = j + 1; l < mn_A; ++l )
+    {
+      float* lambda21 = buff_W + ( j*mn_A + l )*n_lanes;
+
+      for ( i = l; i < mn_A; ++i )
+      {
+        float* alpha21 = buff_W + ( j*mn_A + i )*n_lanes;
+        float* alpha22 = buff_W + ( l*mn_A + i )*n_lanes;
+
+        for ( k = 0; k < n_lanes; ++k )
+          alpha22[k] -= alpha21[k] * lambda21[k];
+      }
+    }
+  }
+
+  for ( k = 0; k < n_lanes; ++k )
+  {
+    if ( e_val[k] == FLA_SUCCESS )
+    {
+      for ( j = 0; j < mn_A; ++j )
+        for ( i = j; i < mn_A; ++i )
+          buff_A[k][ i*rs_A[k] + j*cs_A[k] ] = buff_W[ ( j*mn_A + i )*n_lanes + k ];
+
+      vars->r_val[ i_first + k ] = FLA_SUCCESS;
+    }
+    else
+    {
+      vars->r_val[ i_first + k ] = FLA_Chol_batched_single( vars, i_first + k );
+    }
+  }
+}
+
+
+static void FLA_Chol_batched_ilv_opd( FLA_Chol_batched_vars* vars, int i_first, double* buff_W )
+{
+  int     n_lanes = FLA_CHOL_BATCHED_N_LANES;
+  int     mn_A    = FLA_Chol_batched_mn( vars, i_first );
+  double* buff_A[FLA_CHOL_BATCHED_N_LANES];
+  int     rs_A[FLA_CHOL_BATCHED_N_LANES];
+  int     cs_A[FLA_CHOL_BATCHED_N_LANES];
+  int     e_val[FLA_CHOL_BATCHED_N_LANES];
+  double  inv_alpha11[FLA_CHOL_BATCHED_N_LANES];
+  int     i, j, l, k;
+
+  for ( k = 0; k < n_lanes; ++k )
+  {
+    buff_A[k] = ( double* ) FLA_Chol_batched_buff( vars, i_first + k );
+    rs_A[k]   = ( vars->uplo == FLA_LOWER_TRIANGULAR ? 1 : FLA_Chol_batched_ldim( vars, i_first + k ) );
+    cs_A[k]   = ( vars->uplo == FLA_LOWER_TRIANGULAR ? FLA_Chol_batched_ldim( vars, i_first + k ) : 1 );
+    e_val[k]  = FLA_SUCCESS;
+  }
+
+  for ( j = 0; j < mn_A; ++j )
+    for ( i = j; i < mn_A; ++i )
+      for ( k = 0; k < n_lanes; ++k )
+        buff_W[ ( j*mn_A + i )*n_lanes + k ] = buff_A[k][ i*rs_A[k] + j*cs_A[k] ];
+
+  for ( j = 0; j < mn_A; ++j )
+  {
+    double* alpha11 = buff_W + ( j*mn_A + j )*n_lanes;
+
+    // alpha11 = sqrt( alpha11 )
+    for ( k = 0; k < n_lanes; ++k )
+      if ( !( alpha11[k] > 0.0 ) && e_val[k] == FLA_SUCCESS ) e_val[k] = j;
+
+    for ( k = 0; k < n_lanes; ++k )
+    {
+      alpha11[k]     = sqrt( alpha11[k] );
+      inv_alpha11[k] = 1.0 / alpha11[k];
+    }
+
+    // a21 = a21 / alpha11
+    for ( i = j + 1; i < mn_A; ++i )
+    {
+      double* alpha21 = buff_W + ( j*mn_A + i )*n_lanes;
+
+      for ( k = 0; k < n_lanes; ++k )
+        alpha21[k] *= inv_alpha11[k];
+    }
+
+    // A22 = A22 - a21 * a21'
+    for ( l = j + 1; l < mn_A; ++l )
+    {
+      double* lambda21 = buff_W + ( j*mn_A + l )*n_lanes;
+
+      for ( i = l; i < mn_A; ++i )
+      {
+        double* alpha21 = buff_W + ( j*mn_A + i )*n_lanes;
+        double* alpha22 = buff_W + ( l*mn_A + i )*n_lanes;
+
+        for ( k = 0; k < n_lanes; ++k )
+          alpha22[k] -= alpha21[k] * lambda21[k];
+      }
+    }
+  }
+
+  for ( k = 0; k < n_lanes; ++k )
+  {
+    if ( e_val[k] == FLA_SUCCESS )
+    {
+      for ( j = 0; j < mn_A; ++j )
+        for ( i = j; i < mn_A; ++i )
+          buff_A[k][ i*rs_A[k] + j*cs_A[k] ] = buff_W[ ( j*mn_A + i )*n_lanes + k ];
+
+      vars->r_val[ i_first + k ] = FLA_SUCCESS;
+    }
+    else
+    {
+      vars->r_val[ i_first + k ] = FLA_Chol_batched_single( vars, i_first + k );
+    }
+  }
+}
+
@@ -13,20 +13,34 @@
 FLA_Error FLA_Hevd( FLA_Evd_type jobz, FLA_Uplo uplo, FLA_Obj A, FLA_Obj l )
 {
   FLA_Error r_val      = FLA_SUCCESS;
-  dim_t     n_iter_max = 30;
-  dim_t     k_accum    = 32;
-  dim_t     b_alg      = 512;
+  dim_t     n_iter_max;
+  dim_t     k_accum;
+  dim_t     b_alg;
+  dim_t     m_dc;
+  dim_t     m_2s;
 
   // Check parameters.
   if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
     FLA_Hevd_check( jobz, uplo, A, l );
 
-  // Invoke FLA_Hevd_external() for now.
+  // Query the (possibly tuned) parameters of the QR algorithm.
+  n_iter_max = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_HEVD, FLA_TUNE_N_ITER_MAX );
+  k_accum    = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_HEVD, FLA_TUNE_K_ACCUM );
+  b_alg      = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_HEVD, FLA_TUNE_B_ALG );
+  m_dc       = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_HEVD, FLA_TUNE_M_DC );
+  m_2s       = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_HEVD, FLA_TUNE_M_2S );
+
+  // Dispatch to lv_unb_var1/var3 by m_dc, or to ln_unb_var1/var2 by m_2s.
   if ( jobz == FLA_EVD_WITH_VECTORS )
   {
     if ( uplo == FLA_LOWER_TRIANGULAR )
     {
-      r_val = FLA_Hevd_lv_unb_var1( n_iter_max, A, l, k_accum, b_alg );
+      // Divide and conquer casts most of its work in terms of FLA_Gemm, and
+      // so it outperforms the QR algorithm unless the matrix is small.
+      if ( FLA_Obj_length( A ) >= m_dc )
+        r_val = FLA_Hevd_lv_unb_var3( n_iter_max, A, l, k_accum, b_alg );
+      else
+        r_val = FLA_Hevd_lv_unb_var1( n_iter_max, A, l, k_accum, b_alg );
     }
     else // if ( uplo == FLA_UPPER_TRIANGULAR )
     {
@@ -35,14 +49,18 @@ FLA_Error FLA_Hevd( FLA_Evd_type jobz, FLA_Uplo uplo, FLA_Obj A, FLA_Obj l )
   }
   else // if ( jobz == FLA_EVD_WITHOUT_VECTORS )
   {
-    if ( uplo == FLA_LOWER_TRIANGULAR )
-    {
-      FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
-    }
-    else // if ( uplo == FLA_UPPER_TRIANGULAR )
-    {
-      FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
-    }
+    // A is overwritten when only eigenvalues are requested, so the upper
+    // triangle may be reflected into the lower triangle.
+    if ( uplo == FLA_UPPER_TRIANGULAR )
+      FLA_Hermitianize( FLA_UPPER_TRIANGULAR, A );
+
+    // Once A no longer fits in cache, the memory-bound half of the one-stage
+    // reduction dominates, and reducing A first to band form with level-3
+    // operations pays off.
+    if ( FLA_Obj_length( A ) >= m_2s )
+      r_val = FLA_Hevd_ln_unb_var2( n_iter_max, A, l );
+    else
+      r_val = FLA_Hevd_ln_unb_var1( n_iter_max, A, l );
   }
 
   return r_val;
@@ -8,4 +8,5 @@
 
 */
 
-FLA_Error FLA_Hevd_ln_unb_var1( FLA_Obj A, FLA_Obj l );
+FLA_Error FLA_Hevd_ln_unb_var1( dim_t n_iter_max, FLA_Obj A, FLA_Obj l );
+FLA_Error FLA_Hevd_ln_unb_var2( dim_t n_iter_max, FLA_Obj A, FLA_Obj l );
@@ -35,7 +35,7 @@ int main(int argc, char *argv[])
     n_repeats,
     i,
     datatype,
-    n_variants = 1;
+    n_variants = 2;
   
   char *colors = "brkgmcbrkg";
   char *ticks  = "o+*xso+*xs";
@@ -47,6 +47,7 @@ int main(int argc, char *argv[])
 
   double
     dtime,
+    dtime_lv,
     gflops,
     diff;
 
@@ -143,6 +144,12 @@ printf( "eps fla = %23.15e\n", FLA_EPSILON_D );
     fprintf( stdout, "data_REFd( %d, 1:2 ) = [ %d %6.3lf %6.2le ]; \n", i, p, gflops, diff );
     fflush( stdout );
 
+    time_Hevd_ln( -2, FLA_ALG_REFERENCE, n_repeats, m, b_alg,
+                  A, l, &dtime_lv, &diff, &gflops );
+
+    fprintf( stdout, "data_lv( %d, 1:3 ) = [ %d %6.3lf %6.2le ]; \n", i, p, gflops, diff );
+    fflush( stdout );
+
 
     for ( variant = 1; variant <= n_variants; variant++ ){
       
@@ -155,6 +162,10 @@ printf( "eps fla = %23.15e\n", FLA_EPSILON_D );
       fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
       fflush( stdout );
 
+      // Report the speedup over computing the eigenvectors as well.
+      fprintf( stdout, "%6.2lf ", dtime_lv / dtime );
+      fflush( stdout );
+
       //time_Hevd_ln( variant, FLA_ALG_UNB_OPT, n_repeats, m, b_alg,
       //              A, l, &dtime, &diff, &gflops );
 
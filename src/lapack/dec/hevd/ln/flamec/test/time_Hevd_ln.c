@@ -28,6 +28,8 @@ void time_Hevd_ln(
                double *dtime, double *diff, double *gflops )
 {
   int irep;
+  int n_iter_max = 30;
+  int k_accum    = 32;
 
   double
     k, dtime_old = 1.0e9;
@@ -76,15 +78,31 @@ void time_Hevd_ln(
       REF_Hevdd_ln( A, l );
       break;
 
+    // Time the eigenvector path for comparison.
+    case -2:
+      FLA_Hevd_lv_unb_var1( n_iter_max, A, l, k_accum, b_alg );
+      break;
+
     // Time variant 1
     case 1:
     {
       switch( type ){
       case FLA_ALG_UNBLOCKED:
-        FLA_Hevd_ln_unb_var1( A, l );
+        FLA_Hevd_ln_unb_var1( n_iter_max, A, l );
         break;
       case FLA_ALG_UNB_OPT:
-        FLA_Hevd_ln_unb_var1( A, l );
+        FLA_Hevd_ln_unb_var1( n_iter_max, A, l );
+        break;
+      }
+      break;
+    }
+
+    // Time variant 2
+    case 2:
+    {
+      switch( type ){
+      case FLA_ALG_UNBLOCKED:
+        FLA_Hevd_ln_unb_var2( n_iter_max, A, l );
         break;
       }
       break;
@@ -105,7 +123,7 @@ void time_Hevd_ln(
 
     FLA_Obj_create_copy_of( FLA_NO_TRANSPOSE, A_save, &Av ); 
     FLA_Obj_create_conf_to( FLA_NO_TRANSPOSE, l, &lv ); 
-    FLA_Hevd_lv_unb_var1( Av, lv );
+    FLA_Hevd_lv_unb_var1( n_iter_max, Av, lv, k_accum, b_alg );
 
 //FLA_Obj_show( "l", l, "%9.2e", "" );
 //FLA_Obj_show( "lv", lv, "%9.2e", "" );
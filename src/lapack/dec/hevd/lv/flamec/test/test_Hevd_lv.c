@@ -36,7 +36,7 @@ int main(int argc, char *argv[])
     n_repeats,
     i,
     k_perf,
-    n_variants = 2;
+    n_variants = 4;
   
   char *colors = "brkgmcbrkg";
   char *ticks  = "o+*xso+*xs";
@@ -103,6 +103,28 @@ void time_Hevd_lv(
       break;
     }
 
+    // Time variant 3
+    case 3:
+    {
+      switch( type ){
+      case FLA_ALG_UNBLOCKED:
+        *k_perf = FLA_Hevd_lv_unb_var3( n_iter_max, A, l, k_accum, b_alg );
+        break;
+      }
+      break;
+    }
+
+    // Time variant 4
+    case 4:
+    {
+      switch( type ){
+      case FLA_ALG_UNBLOCKED:
+        *k_perf = FLA_Hevd_lv_unb_var4( n_iter_max, A, l, k_accum, b_alg );
+        break;
+      }
+      break;
+    }
+
     }
 
     *dtime = FLA_Clock() - *dtime;
@@ -0,0 +1,83 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_ldlt_t* flash_ldlt_piv_cntl;
+
+FLA_Error FLASH_LDLT_piv( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p )
+{
+  FLA_Error r_val = FLA_SUCCESS;
+  FLA_Obj   A_flat, p_flat, L, W, s;
+  dim_t     b;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_LDLT_piv_check( uplo, A, p );
+
+  // *** The current LDLT_piv algorithm implemented assumes that
+  // the matrix has a hierarchical depth of 1. We check for that here, because
+  // we anticipate that we'll use a more general algorithm in the future, and
+  // we don't want to forget to remove the constraint. ***
+  if ( FLASH_Obj_depth( A ) != 1 )
+  {
+    FLA_Print_message( "FLASH_LDLT_piv() currently only supports matrices of depth 1",
+                       __FILE__, __LINE__ );
+    FLA_Abort();
+  }
+
+  if ( uplo == FLA_LOWER_TRIANGULAR )
+  {
+    // The tasks share flat workspaces for the columns of L and L D that
+    // the trailing updates need, and a pair of integers for the offset of
+    // each panel and the first zero pivot.
+    b = FLASH_Obj_scalar_width_tl( A );
+
+    FLA_Obj_create( FLA_Obj_datatype( A ), FLASH_Obj_scalar_length( A ), b + 1, 0, 0, &L );
+    FLA_Obj_create( FLA_Obj_datatype( A ), FLASH_Obj_scalar_length( A ), b + 1, 0, 0, &W );
+    FLA_Obj_create( FLA_INT, 2, 1, 0, 0, &s );
+
+    FLA_INT_PTR( s )[0] = 0;
+    FLA_INT_PTR( s )[1] = FLA_SUCCESS;
+
+    // Begin a parallel region.
+    FLASH_Queue_begin();
+
+    // Invoke FLASH_LDLT_piv_var1() with large control tree.
+    FLASH_LDLT_piv_var1( A, p, L, W, s, flash_ldlt_piv_cntl );
+
+    // End the parallel region.
+    FLASH_Queue_end();
+
+    r_val = FLA_INT_PTR( s )[1];
+
+    FLA_Obj_free( &L );
+    FLA_Obj_free( &W );
+    FLA_Obj_free( &s );
+  }
+  else
+  {
+    // The upper triangle is only factored through a flat copy, which
+    // FLA_LDLT_piv() reverses into a lower triangle.
+    FLASH_Obj_create_flat_copy_of_hier( A, &A_flat );
+    FLASH_Obj_create_flat_copy_of_hier( p, &p_flat );
+
+    r_val = FLA_LDLT_piv( uplo, A_flat, p_flat );
+
+    FLASH_Copy_flat_to_hier( A_flat, 0, 0, A );
+    FLASH_Copy_flat_to_hier( p_flat, 0, 0, p );
+
+    FLA_Obj_free( &A_flat );
+    FLA_Obj_free( &p_flat );
+  }
+
+  return r_val;
+}
+
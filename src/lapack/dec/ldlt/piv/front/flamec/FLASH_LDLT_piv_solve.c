@@ -0,0 +1,38 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLASH_LDLT_piv_solve( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p, FLA_Obj B, FLA_Obj X )
+{
+  FLA_Obj A_flat, p_flat, X_flat;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_LDLT_piv_solve_check( uplo, A, p, B, X );
+
+  // The interchanges of each pivot block are applied between the updates
+  // of the pivot blocks on either side of it, so the solve is performed
+  // on flat copies of the operands.
+  FLASH_Obj_create_flat_copy_of_hier( A, &A_flat );
+  FLASH_Obj_create_flat_copy_of_hier( p, &p_flat );
+  FLASH_Obj_create_flat_copy_of_hier( B, &X_flat );
+
+  FLA_LDLT_piv_solve( uplo, A_flat, p_flat, X_flat, X_flat );
+
+  FLASH_Copy_flat_to_hier( X_flat, 0, 0, X );
+
+  FLA_Obj_free( &A_flat );
+  FLA_Obj_free( &p_flat );
+  FLA_Obj_free( &X_flat );
+
+  return FLA_SUCCESS;
+}
+
@@ -0,0 +1,133 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_ldlt_t* fla_ldlt_piv_cntl;
+
+static void FLA_LDLT_piv_reverse( FLA_Uplo uplo, FLA_Obj A, FLA_Obj B );
+static void FLA_LDLT_piv_reverse_pivots( FLA_Obj p );
+
+FLA_Error FLA_LDLT_piv( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p )
+{
+  FLA_Error r_val = FLA_SUCCESS;
+  FLA_Obj   B;
+  dim_t     m_A;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_LDLT_piv_check( uplo, A, p );
+
+  if ( uplo == FLA_LOWER_TRIANGULAR )
+  {
+    // Invoke FLA_LDLT_piv_internal() with the standard control tree.
+    r_val = FLA_LDLT_piv_internal( A, p, fla_ldlt_piv_cntl );
+  }
+  else
+  {
+    // Reversing the order of the rows and columns of A turns its upper
+    // triangle into the lower triangle of B = J A J, where J is the exchange
+    // matrix. If P' B P = L D L', then the factors J L J and J D J, with
+    // the pivots J P J, are those of the factorization A = U D U' that
+    // LAPACK computes from the upper triangle, so the lower triangle of B
+    // is factored and the result is reversed back into A.
+    m_A = FLA_Obj_length( A );
+
+    FLA_Obj_create_conf_to( FLA_NO_TRANSPOSE, A, &B );
+
+    FLA_LDLT_piv_reverse( FLA_UPPER_TRIANGULAR, A, B );
+
+    r_val = FLA_LDLT_piv_internal( B, p, fla_ldlt_piv_cntl );
+
+    FLA_LDLT_piv_reverse( FLA_LOWER_TRIANGULAR, B, A );
+
+    FLA_LDLT_piv_reverse_pivots( p );
+
+    if ( r_val >= 0 ) r_val = m_A - 1 - r_val;
+
+    FLA_Obj_free( &B );
+  }
+
+  return r_val;
+}
+
+
+
+static void FLA_LDLT_piv_reverse( FLA_Uplo uplo, FLA_Obj A, FLA_Obj B )
+{
+  FLA_Datatype datatype = FLA_Obj_datatype( A );
+  int          m_A      = FLA_Obj_length( A );
+  int          rs_A     = FLA_Obj_row_stride( A );
+  int          cs_A     = FLA_Obj_col_stride( A );
+  int          rs_B     = FLA_Obj_row_stride( B );
+  int          cs_B     = FLA_Obj_col_stride( B );
+  int          i, j, i_first, i_last;
+
+  // B( m-1-i, m-1-j ) = A( i, j ) for the ( i, j ) in the uplo triangle of A.
+  for ( j = 0; j < m_A; ++j )
+  {
+    i_first = ( uplo == FLA_LOWER_TRIANGULAR ? j       : 0 );
+    i_last  = ( uplo == FLA_LOWER_TRIANGULAR ? m_A - 1 : j );
+
+    switch ( datatype )
+    {
+      case FLA_FLOAT:
+      {
+        float* buff_A = FLA_FLOAT_PTR( A );
+        float* buff_B = FLA_FLOAT_PTR( B );
+
+        for ( i = i_first; i <= i_last; ++i )
+          buff_B[ (m_A-1-j)*cs_B + (m_A-1-i)*rs_B ] = buff_A[ j*cs_A + i*rs_A ];
+
+        break;
+      }
+
+      case FLA_DOUBLE:
+      {
+        double* buff_A = FLA_DOUBLE_PTR( A );
+        double* buff_B = FLA_DOUBLE_PTR( B );
+
+        for ( i = i_first; i <= i_last; ++i )
+          buff_B[ (m_A-1-j)*cs_B + (m_A-1-i)*rs_B ] = buff_A[ j*cs_A + i*rs_A ];
+
+        break;
+      }
+    }
+  }
+}
+
+
+
+static void FLA_LDLT_piv_reverse_pivots( FLA_Obj p )
+{
+  int* buff_p = FLA_INT_PTR( p );
+  int  m_p    = FLA_Obj_vector_dim( p );
+  int  inc_p  = FLA_Obj_vector_inc( p );
+  int  i, t;
+
+  // Reverse the order of the pivots and map each row index i, counted from
+  // one, to m_p + 1 - i, keeping the sign that marks a 2 x 2 pivot block.
+  for ( i = 0; i < m_p; ++i )
+  {
+    int* pi = buff_p + i*inc_p;
+
+    if ( *pi > 0 ) *pi = m_p + 1 - *pi;
+    else           *pi = -( m_p + 1 + *pi );
+  }
+
+  for ( i = 0; i < m_p / 2; ++i )
+  {
+    int* pi = buff_p + (i      )*inc_p;
+    int* pj = buff_p + (m_p-1-i)*inc_p;
+
+    t = *pi; *pi = *pj; *pj = t;
+  }
+}
+
@@ -0,0 +1,15 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLA_LDLT_piv_vars.h"
+
+FLA_Error FLA_LDLT_piv_internal( FLA_Obj A, FLA_Obj p, fla_ldlt_t* cntl );
+
+FLA_Error FLA_LDLT_piv_solve( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p, FLA_Obj B, FLA_Obj X );
@@ -0,0 +1,600 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+static void FLA_LDLT_piv_solve_ops( FLA_Uplo uplo,
+                                    int m_A,
+                                    int n_B,
+                                    float*    buff_A, int rs_A, int cs_A,
+                                    int*      buff_p, int inc_p,
+                                    float*    buff_B, int rs_B, int cs_B );
+static void FLA_LDLT_piv_solve_opd( FLA_Uplo uplo,
+                                    int m_A,
+                                    int n_B,
+                                    double*   buff_A, int rs_A, int cs_A,
+                                    int*      buff_p, int inc_p,
+                                    double*   buff_B, int rs_B, int cs_B );
+
+// Solve A X = B with the factors of A that FLA_LDLT_piv() computes, as
+// LAPACK's ?sytrs does, applying the interchanges of each pivot block in
+// turn.
+
+FLA_Error FLA_LDLT_piv_solve( FLA_Uplo uplo, FLA_Obj A, FLA_Obj p, FLA_Obj B, FLA_Obj X )
+{
+  FLA_Datatype datatype;
+  int          m_A, n_X;
+  int          rs_A, cs_A;
+  int          rs_X, cs_X;
+  int          inc_p;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_LDLT_piv_solve_check( uplo, A, p, B, X );
+
+  if ( FLA_Obj_is_identical( B, X ) == FALSE ) 
+    FLA_Copy_external( B, X );
+
+  datatype = FLA_Obj_datatype( A );
+
+  m_A      = FLA_Obj_length( A );
+  n_X      = FLA_Obj_width( X );
+  rs_A     = FLA_Obj_row_stride( A );
+  cs_A     = FLA_Obj_col_stride( A );
+  rs_X     = FLA_Obj_row_stride( X );
+  cs_X     = FLA_Obj_col_stride( X );
+
+  inc_p    = FLA_Obj_vector_inc( p );
+
+
+  switch ( datatype )
+  {
+    case FLA_FLOAT:
+    {
+      float* buff_A = FLA_FLOAT_PTR( A );
+      float* buff_X = FLA_FLOAT_PTR( X );
+      int*   buff_p = FLA_INT_PTR( p );
+
+      FLA_LDLT_piv_solve_ops( uplo,
+                              m_A,
+                              n_X,
+                              buff_A, rs_A, cs_A,
+                              buff_p, inc_p,
+                              buff_X, rs_X, cs_X );
+
+      break;
+    }
+
+    case FLA_DOUBLE:
+    {
+      double* buff_A = FLA_DOUBLE_PTR( A );
+      double* buff_X = FLA_DOUBLE_PTR( X );
+      int*    buff_p = FLA_INT_PTR( p );
+
+      FLA_LDLT_piv_solve_opd( uplo,
+                              m_A,
+                              n_X,
+                              buff_A, rs_A, cs_A,
+                              buff_p, inc_p,
+                              buff_X, rs_X, cs_X );
+
+      break;
+    }
+  }
+
+  return FLA_SUCCESS;
+}
+
+
+
+static void FLA_LDLT_piv_solve_ops( FLA_Uplo uplo,
+                                    int m_A,
+                                    int n_B,
+                                    float*    buff_A, int rs_A, int cs_A,
+                                    int*      buff_p, int inc_p,
+                                    float*    buff_B, int rs_B, int cs_B )
+{
+  float*    buff_1  = FLA_FLOAT_PTR( FLA_ONE );
+  float*    buff_m1 = FLA_FLOAT_PTR( FLA_MINUS_ONE );
+  float     akm1k, akm1, ak, denom, bkm1, bk, r1;
+  int       k, kp, j;
+
+  if ( uplo == FLA_LOWER_TRIANGULAR )
+  {
+    // Solve L D Y = P' B, from the first pivot block to the last.
+    k = 0;
+
+    while ( k < m_A )
+    {
+      if ( buff_p[ k*inc_p ] > 0 )
+      {
+        kp = buff_p[ k*inc_p ] - 1;
+
+        if ( kp != k )
+          bl1_sswap( n_B,
+                     buff_B + (k )*rs_B, cs_B,
+                     buff_B + (kp)*rs_B, cs_B );
+
+        bl1_sger( BLIS1_NO_CONJUGATE,
+                  BLIS1_NO_CONJUGATE,
+                  m_A - k - 1,
+                  n_B,
+                  buff_m1,
+                  buff_A + (k  )*cs_A + (k+1)*rs_A, rs_A,
+                  buff_B + (k  )*rs_B, cs_B,
+                  buff_B + (k+1)*rs_B, rs_B, cs_B );
+
+        r1 = 1.0F / buff_A[ k*cs_A + k*rs_A ];
+
+        bl1_sscalv( BLIS1_NO_CONJUGATE,
+                    n_B,
+                    &r1,
+                    buff_B + k*rs_B, cs_B );
+
+        k += 1;
+      }
+      else
+      {
+        kp = -buff_p[ k*inc_p ] - 1;
+
+        if ( kp != k + 1 )
+          bl1_sswap( n_B,
+                     buff_B + (k+1)*rs_B, cs_B,
+                     buff_B + (kp )*rs_B, cs_B );
+
+        if ( k < m_A - 2 )
+        {
+          bl1_sger( BLIS1_NO_CONJUGATE,
+                    BLIS1_NO_CONJUGATE,
+                    m_A - k - 2,
+                    n_B,
+                    buff_m1,
+                    buff_A + (k  )*cs_A + (k+2)*rs_A, rs_A,
+                    buff_B + (k  )*rs_B, cs_B,
+                    buff_B + (k+2)*rs_B, rs_B, cs_B );
+
+          bl1_sger( BLIS1_NO_CONJUGATE,
+                    BLIS1_NO_CONJUGATE,
+                    m_A - k - 2,
+                    n_B,
+                    buff_m1,
+                    buff_A + (k+1)*cs_A + (k+2)*rs_A, rs_A,
+                    buff_B + (k+1)*rs_B, cs_B,
+                    buff_B + (k+2)*rs_B, rs_B, cs_B );
+        }
+
+        akm1k = buff_A[ (k  )*cs_A + (k+1)*rs_A ];
+        akm1  = buff_A[ (k  )*cs_A + (k  )*rs_A ] / akm1k;
+        ak    = buff_A[ (k+1)*cs_A + (k+1)*rs_A ] / akm1k;
+        denom = akm1 * ak - 1.0F;
+
+        for ( j = 0; j < n_B; ++j )
+        {
+          float*  bkm1j = buff_B + j*cs_B + (k  )*rs_B;
+          float*  bkj   = buff_B + j*cs_B + (k+1)*rs_B;
+
+          bkm1   = *bkm1j / akm1k;
+          bk     = *bkj   / akm1k;
+          *bkm1j = ( ak   * bkm1 - bk   ) / denom;
+          *bkj   = ( akm1 * bk   - bkm1 ) / denom;
+        }
+
+        k += 2;
+      }
+    }
+
+    // Solve L' P' X = Y, from the last pivot block to the first.
+    k = m_A - 1;
+
+    while ( k >= 0 )
+    {
+      bl1_sgemv( BLIS1_TRANSPOSE,
+                 BLIS1_NO_CONJUGATE,
+                 m_A - k - 1,
+                 n_B,
+                 buff_m1,
+                 buff_B + (k+1)*rs_B, rs_B, cs_B,
+                 buff_A + (k  )*cs_A + (k+1)*rs_A, rs_A,
+                 buff_1,
+                 buff_B + (k  )*rs_B, cs_B );
+
+      if ( buff_p[ k*inc_p ] < 0 )
+        bl1_sgemv( BLIS1_TRANSPOSE,
+                   BLIS1_NO_CONJUGATE,
+                   m_A - k - 1,
+                   n_B,
+                   buff_m1,
+                   buff_B + (k+1)*rs_B, rs_B, cs_B,
+                   buff_A + (k-1)*cs_A + (k+1)*rs_A, rs_A,
+                   buff_1,
+                   buff_B + (k-1)*rs_B, cs_B );
+
+      kp = f2c_abs( buff_p[ k*inc_p ] ) - 1;
+
+      if ( kp != k )
+        bl1_sswap( n_B,
+                   buff_B + (k )*rs_B, cs_B,
+                   buff_B + (kp)*rs_B, cs_B );
+
+      k -= ( buff_p[ k*inc_p ] > 0 ? 1 : 2 );
+    }
+  }
+  else // if ( uplo == FLA_UPPER_TRIANGULAR )
+  {
+    // Solve U D Y = P' B, from the last pivot block to the first.
+    k = m_A - 1;
+
+    while ( k >= 0 )
+    {
+      if ( buff_p[ k*inc_p ] > 0 )
+      {
+        kp = buff_p[ k*inc_p ] - 1;
+
+        if ( kp != k )
+          bl1_sswap( n_B,
+                     buff_B + (k )*rs_B, cs_B,
+                     buff_B + (kp)*rs_B, cs_B );
+
+        bl1_sger( BLIS1_NO_CONJUGATE,
+                  BLIS1_NO_CONJUGATE,
+                  k,
+                  n_B,
+                  buff_m1,
+                  buff_A + k*cs_A, rs_A,
+                  buff_B + k*rs_B, cs_B,
+                  buff_B, rs_B, cs_B );
+
+        r1 = 1.0F / buff_A[ k*cs_A + k*rs_A ];
+
+        bl1_sscalv( BLIS1_NO_CONJUGATE,
+                    n_B,
+                    &r1,
+                    buff_B + k*rs_B, cs_B );
+
+        k -= 1;
+      }
+      else
+      {
+        kp = -buff_p[ k*inc_p ] - 1;
+
+        if ( kp != k - 1 )
+          bl1_sswap( n_B,
+                     buff_B + (k-1)*rs_B, cs_B,
+                     buff_B + (kp )*rs_B, cs_B );
+
+        bl1_sger( BLIS1_NO_CONJUGATE,
+                  BLIS1_NO_CONJUGATE,
+                  k - 1,
+                  n_B,
+                  buff_m1,
+                  buff_A + (k  )*cs_A, rs_A,
+                  buff_B + (k  )*rs_B, cs_B,
+                  buff_B, rs_B, cs_B );
+
+        bl1_sger( BLIS1_NO_CONJUGATE,
+                  BLIS1_NO_CONJUGATE,
+                  k - 1,
+                  n_B,
+                  buff_m1,
+                  buff_A + (k-1)*cs_A, rs_A,
+                  buff_B + (k-1)*rs_B, cs_B,
+                  buff_B, rs_B, cs_B );
+
+        akm1k = buff_A[ (k  )*cs_A + (k-1)*rs_A ];
+        akm1  = buff_A[ (k-1)*cs_A + (k-1)*rs_A ] / akm1k;
+        ak    = buff_A[ (k  )*cs_A + (k  )*rs_A ] / akm1k;
+        denom = akm1 * ak - 1.0F;
+
+        for ( j = 0; j < n_B; ++j )
+        {
+          float*  bkm1j = buff_B + j*cs_B + (k-1)*rs_B;
+          float*  bkj   = buff_B + j*cs_B + (k  )*rs_B;
+
+          bkm1   = *bkm1j / akm1k;
+          bk     = *bkj   / akm1k;
+          *bkm1j = ( ak   * bkm1 - bk   ) / denom;
+          *bkj   = ( akm1 * bk   - bkm1 ) / denom;
+        }
+
+        k -= 2;
+      }
+    }
+
+    // Solve U' P' X = Y, from the first pivot block to the last.
+    k = 0;
+
+    while ( k < m_A )
+    {
+      bl1_sgemv( BLIS1_TRANSPOSE,
+                 BLIS1_NO_CONJUGATE,
+                 k,
+                 n_B,
+                 buff_m1,
+                 buff_B, rs_B, cs_B,
+                 buff_A + k*cs_A, rs_A,
+                 buff_1,
+                 buff_B + k*rs_B, cs_B );
+
+      if ( buff_p[ k*inc_p ] < 0 )
+        bl1_sgemv( BLIS1_TRANSPOSE,
+                   BLIS1_NO_CONJUGATE,
+                   k,
+                   n_B,
+                   buff_m1,
+                   buff_B, rs_B, cs_B,
+                   buff_A + (k+1)*cs_A, rs_A,
+                   buff_1,
+                   buff_B + (k+1)*rs_B, cs_B );
+
+      kp = f2c_abs( buff_p[ k*inc_p ] ) - 1;
+
+      if ( kp != k )
+        bl1_sswap( n_B,
+                   buff_B + (k )*rs_B, cs_B,
+                   buff_B + (kp)*rs_B, cs_B );
+
+      k += ( buff_p[ k*inc_p ] > 0 ? 1 : 2 );
+    }
+  }
+}
+
+
+
+static void FLA_LDLT_piv_solve_opd( FLA_Uplo uplo,
+                                    int m_A,
+                                    int n_B,
+                                    double*   buff_A, int rs_A, int cs_A,
+                                    int*      buff_p, int inc_p,
+                                    double*   buff_B, int rs_B, int cs_B )
+{
+  double*   buff_1  = FLA_DOUBLE_PTR( FLA_ONE );
+  double*   buff_m1 = FLA_DOUBLE_PTR( FLA_MINUS_ONE );
+  double    akm1k, akm1, ak, denom, bkm1, bk, r1;
+  int       k, kp, j;
+
+  if ( uplo == FLA_LOWER_TRIANGULAR )
+  {
+    // Solve L D Y = P' B, from the first pivot block to the last.
+    k = 0;
+
+    while ( k < m_A )
+    {
+      if ( buff_p[ k*inc_p ] > 0 )
+      {
+        kp = buff_p[ k*inc_p ] - 1;
+
+        if ( kp != k )
+          bl1_dswap( n_B,
+                     buff_B + (k )*rs_B, cs_B,
+                     buff_B + (kp)*rs_B, cs_B );
+
+        bl1_dger( BLIS1_NO_CONJUGATE,
+                  BLIS1_NO_CONJUGATE,
+                  m_A - k - 1,
+                  n_B,
+                  buff_m1,
+                  buff_A + (k  )*cs_A + (k+1)*rs_A, rs_A,
+                  buff_B + (k  )*rs_B, cs_B,
+                  buff_B + (k+1)*rs_B, rs_B, cs_B );
+
+        r1 = 1.0 / buff_A[ k*cs_A + k*rs_A ];
+
+        bl1_dscalv( BLIS1_NO_CONJUGATE,
+                    n_B,
+                    &r1,
+                    buff_B + k*rs_B, cs_B );
+
+        k += 1;
+      }
+      else
+      {
+        kp = -buff_p[ k*inc_p ] - 1;
+
+        if ( kp != k + 1 )
+          bl1_dswap( n_B,
+                     buff_B + (k+1)*rs_B, cs_B,
+                     buff_B + (kp )*rs_B, cs_B );
+
+        if ( k < m_A - 2 )
+        {
+          bl1_dger( BLIS1_NO_CONJUGATE,
+                    BLIS1_NO_CONJUGATE,
+                    m_A - k - 2,
+                    n_B,
+                    buff_m1,
+                    buff_A + (k  )*cs_A + (k+2)*rs_A, rs_A,
+                    buff_B + (k  )*rs_B, cs_B,
+                    buff_B + (k+2)*rs_B, rs_B, cs_B );
+
+          bl1_dger( BLIS1_NO_CONJUGATE,
+                    BLIS1_NO_CONJUGATE,
+                    m_A - k - 2,
+                    n_B,
+                    buff_m1,
+                    buff_A + (k+1)*cs_A + (k+2)*rs_A, rs_A,
+                    buff_B + (k+1)*rs_B, cs_B,
+                    buff_B + (k+2)*rs_B, rs_B, cs_B );
+        }
+
+        akm1k = buff_A[ (k  )*cs_A + (k+1)*rs_A ];
+        akm1  = buff_A[ (k  )*cs_A + (k  )*rs_A ] / akm1k;
+        ak    = buff_A[ (k+1)*cs_A + (k+1)*rs_A ] / akm1k;
+        denom = akm1 * ak - 1.0;
+
+        for ( j = 0; j < n_B; ++j )
+        {
+          double* bkm1j = buff_B + j*cs_B + (k  )*rs_B;
+          double* bkj   = buff_B + j*cs_B + (k+1)*rs_B;
+
+          bkm1   = *bkm1j / akm1k;
+          bk     = *bkj   / akm1k;
+          *bkm1j = ( ak   * bkm1 - bk   ) / denom;
+          *bkj   = ( akm1 * bk   - bkm1 ) / denom;
+        }
+
+        k += 2;
+      }
+    }
+
+    // Solve L' P' X = Y, from the last pivot block to the first.
+    k = m_A - 1;
+
+    while ( k >= 0 )
+    {
+      bl1_dgemv( BLIS1_TRANSPOSE,
+                 BLIS1_NO_CONJUGATE,
+                 m_A - k - 1,
+                 n_B,
+                 buff_m1,
+                 buff_B + (k+1)*rs_B, rs_B, cs_B,
+                 buff_A + (k  )*cs_A + (k+1)*rs_A, rs_A,
+                 buff_1,
+                 buff_B + (k  )*rs_B, cs_B );
+
+      if ( buff_p[ k*inc_p ] < 0 )
+        bl1_dgemv( BLIS1_TRANSPOSE,
+                   BLIS1_NO_CONJUGATE,
+                   m_A - k - 1,
+                   n_B,
+                   buff_m1,
+                   buff_B + (k+1)*rs_B, rs_B, cs_B,
+                   buff_A + (k-1)*cs_A + (k+1)*rs_A, rs_A,
+                   buff_1,
+                   buff_B + (k-1)*rs_B, cs_B );
+
+      kp = f2c_abs( buff_p[ k*inc_p ] ) - 1;
+
+      if ( kp != k )
+        bl1_dswap( n_B,
+                   buff_B + (k )*rs_B, cs_B,
+                   buff_B + (kp)*rs_B, cs_B );
+
+      k -= ( buff_p[ k*inc_p ] > 0 ? 1 : 2 );
+    }
+  }
+  else // if ( uplo == FLA_UPPER_TRIANGULAR )
+  {
+    // Solve U D Y = P' B, from the last pivot block to the first.
+    k = m_A - 1;
+
+    while ( k >= 0 )
+    {
+      if ( buff_p[ k*inc_p ] > 0 )
+      {
+        kp = buff_p[ k*inc_p ] - 1;
+
+        if ( kp != k )
+          bl1_dswap( n_B,
+                     buff_B + (k )*rs_B, cs_B,
+                     buff_B + (kp)*rs_B, cs_B );
+
+        bl1_dger( BLIS1_NO_CONJUGATE,
+                  BLIS1_NO_CONJUGATE,
+                  k,
+                  n_B,
+                  buff_m1,
+                  buff_A + k*cs_A, rs_A,
+                  buff_B + k*rs_B, cs_B,
+                  buff_B, rs_B, cs_B );
+
+        r1 = 1.0 / buff_A[ k*cs_A + k*rs_A ];
+
+        bl1_dscalv( BLIS1_NO_CONJUGATE,
+                    n_B,
+                    &r1,
+                    buff_B + k*rs_B, cs_B );
+
+        k -= 1;
+      }
+      else
+      {
+        kp = -buff_p[ k*inc_p ] - 1;
+
+        if ( kp != k - 1 )
+          bl1_dswap( n_B,
+                     buff_B + (k-1)*rs_B, cs_B,
+                     buff_B + (kp )*rs_B, cs_B );
+
+        bl1_dger( BLIS1_NO_CONJUGATE,
+                  BLIS1_NO_CONJUGATE,
+                  k - 1,
+                  n_B,
+                  buff_m1,
+                  buff_A + (k  )*cs_A, rs_A,
+                  buff_B + (k  )*rs_B, cs_B,
+                  buff_B, rs_B, cs_B );
+
+        bl1_dger( BLIS1_NO_CONJUGATE,
+                  BLIS1_NO_CONJUGATE,
+                  k - 1,
+                  n_B,
+                  buff_m1,
+                  buff_A + (k-1)*cs_A, rs_A,
+                  buff_B + (k-1)*rs_B, cs_B,
+                  buff_B, rs_B, cs_B );
+
+        akm1k = buff_A[ (k  )*cs_A + (k-1)*rs_A ];
+        akm1  = buff_A[ (k-1)*cs_A + (k-1)*rs_A ] / akm1k;
+        ak    = buff_A[ (k  )*cs_A + (k  )*rs_A ] / akm1k;
+        denom = akm1 * ak - 1.0;
+
+        for ( j = 0; j < n_B; ++j )
+        {
+          double* bkm1j = buff_B + j*cs_B + (k-1)*rs_B;
+          double* bkj   = buff_B + j*cs_B + (k  )*rs_B;
+
+          bkm1   = *bkm1j / akm1k;
+          bk     = *bkj   / akm1k;
+          *bkm1j = ( ak   * bkm1 - bk   ) / denom;
+          *bkj   = ( akm1 * bk   - bkm1 ) / denom;
+        }
+
+        k -= 2;
+      }
+    }
+
+    // Solve U' P' X = Y, from the first pivot block to the last.
+    k = 0;
+
+    while ( k < m_A )
+    {
+      bl1_dgemv( BLIS1_TRANSPOSE,
+                 BLIS1_NO_CONJUGATE,
+                 k,
+                 n_B,
+                 buff_m1,
+                 buff_B, rs_B, cs_B,
+                 buff_A + k*cs_A, rs_A,
+                 buff_1,
+                 buff_B + k*rs_B, cs_B );
+
+      if ( buff_p[ k*inc_p ] < 0 )
+        bl1_dgemv( BLIS1_TRANSPOSE,
+                   BLIS1_NO_CONJUGATE,
+                   k,
+                   n_B,
+                   buff_m1,
+                   buff_B, rs_B, cs_B,
+                   buff_A + (k+1)*cs_A, rs_A,
+                   buff_1,
+                   buff_B + (k+1)*rs_B, cs_B );
+
+      kp = f2c_abs( buff_p[ k*inc_p ] ) - 1;
+
+      if ( kp != k )
+        bl1_dswap( n_B,
+                   buff_B + (k )*rs_B, cs_B,
+                   buff_B + (kp)*rs_B, cs_B );
+
+      k += ( buff_p[ k*inc_p ] > 0 ? 1 : 2 );
+    }
+  }
+}
+
@@ -0,0 +1,19 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// LU with partial pivoting, which ignores the symmetry of A, is the
+// reference against which the LDL^T factorization is timed.
+FLA_Error REF_LDLT_piv( FLA_Obj A, FLA_Obj p )
+{
+  return FLA_LU_piv( A, p );
+}
+
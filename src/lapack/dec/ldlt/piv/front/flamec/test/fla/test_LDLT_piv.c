@@ -0,0 +1,132 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#define N_UPLO_COMBOS     2
+
+#define FLA_ALG_REFERENCE 0
+#define FLA_ALG_FRONT     1
+
+char* pc_str[N_UPLO_COMBOS] = { "l", "u" };
+
+void time_LDLT(
+              FLA_Uplo uplo, int type, int n_repeats, int n,
+              FLA_Obj A, FLA_Obj p, FLA_Obj b, FLA_Obj b_ref, FLA_Obj b_norm,
+              double *dtime, double *diff, double *gflops );
+
+
+int main(int argc, char *argv[])
+{
+  int 
+    datatype,
+    n_input,
+    n,
+    p_first, p_last, p_inc,
+    pp,
+    uplo_combo,
+    n_repeats,
+    i,
+    n_uplo_combos = N_UPLO_COMBOS;
+  
+  FLA_Uplo
+    uplo;
+
+  double
+    dtime,
+    gflops,
+    diff;
+
+  FLA_Obj
+    A, p, b, b_ref, b_norm;
+  
+
+  FLA_Init();
+
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c enter problem size first, last, inc:", '%' );
+  scanf( "%d%d%d", &p_first, &p_last, &p_inc );
+  fprintf( stdout, "%c %d %d %d\n", '%', p_first, p_last, p_inc );
+
+  fprintf( stdout, "%c enter n (-1 means bind to problem size): ", '%' );
+  scanf( "%d", &n_input );
+  fprintf( stdout, "%c %d\n", '%', n_input );
+
+
+  fprintf( stdout, "\nclear all;\n\n" );
+
+
+  //datatype = FLA_FLOAT;
+  datatype = FLA_DOUBLE;
+
+  for ( pp = p_first, i = 1; pp <= p_last; pp += p_inc, i += 1 )
+  {
+    n = n_input;
+
+    if( n < 0 ) n = pp / f2c_abs(n_input);
+
+    for ( uplo_combo = 0; uplo_combo < n_uplo_combos; uplo_combo++ ){
+      
+      uplo = ( uplo_combo == 0 ? FLA_LOWER_TRIANGULAR : FLA_UPPER_TRIANGULAR );
+
+      FLA_Obj_create( datatype, n, n, 0, 0, &A );
+      FLA_Obj_create( datatype, n, 1, 0, 0, &b );
+      FLA_Obj_create( datatype, n, 1, 0, 0, &b_ref );
+      FLA_Obj_create( FLA_INT, n, 1, 0, 0, &p );
+
+      if ( FLA_Obj_is_single_precision( A ) )
+        FLA_Obj_create( FLA_FLOAT, 1, 1, 0, 0, &b_norm );
+      else
+        FLA_Obj_create( FLA_DOUBLE, 1, 1, 0, 0, &b_norm );
+
+      // Generate a symmetric indefinite matrix.
+      FLA_Random_matrix( A );
+      FLA_Symmetrize( uplo, A );
+      FLA_Random_matrix( b );
+
+      FLA_Copy_external( b, b_ref );
+
+      fprintf( stdout, "data_ldlt_%s( %d, 1:5 ) = [ %d  ", pc_str[uplo_combo], i, pp );
+      fflush( stdout );
+
+      time_LDLT( uplo, FLA_ALG_REFERENCE, n_repeats, n,
+                 A, p, b, b_ref, b_norm, &dtime, &diff, &gflops );
+
+      fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
+      fflush( stdout );
+
+      time_LDLT( uplo, FLA_ALG_FRONT, n_repeats, n,
+                 A, p, b, b_ref, b_norm, &dtime, &diff, &gflops );
+
+      fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
+      fflush( stdout );
+
+      fprintf( stdout, " ]; \n" );
+      fflush( stdout );
+
+      FLA_Obj_free( &A );
+      FLA_Obj_free( &p );
+      FLA_Obj_free( &b );
+      FLA_Obj_free( &b_ref );
+      FLA_Obj_free( &b_norm );
+    }
+
+    fprintf( stdout, "\n" );
+  }
+
+  FLA_Finalize( );
+
+  return 0;
+}
+
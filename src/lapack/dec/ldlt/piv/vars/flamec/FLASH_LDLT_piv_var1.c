@@ -0,0 +1,258 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// The blocked Bunch-Kaufman factorization of FLA_LDLT_piv_blk_var1() for a
+// hierarchical matrix of depth 1. Each panel factorization searches the
+// whole of ABR for its pivots and so is one task that writes all of ABR,
+// while the update of the lower triangle of A22 is one task per block.
+//
+// A panel factors the columns of its block column, and the first column of
+// the next block column too when the last pivot of the block is a 2 x 2
+// block; s( 0 ) holds the number of columns of the next block column that
+// the panel consumed this way and s( 1 ) the first zero pivot. The caller
+// creates L and W, m x ( b + 1 ), and s, and frees them once the tasks have
+// executed. Since the flat workspaces L and W hold the columns of L and L D that the
+// update needs in the rows below the panel, and zeros elsewhere, each
+// update task may subtract all b + 1 columns of L W' from its block.
+
+static FLA_Error FLASH_LDLT_piv_update( FLA_Obj L, FLA_Obj W, FLA_Obj A, fla_ldlt_t* cntl );
+
+FLA_Error FLASH_LDLT_piv_var1( FLA_Obj A, FLA_Obj p, FLA_Obj L, FLA_Obj W, FLA_Obj s, fla_ldlt_t* cntl )
+{
+   FLA_Obj ATL,   ATR,      A00, A01, A02,
+           ABL,   ABR,      A10, A11, A12,
+                            A20, A21, A22;
+
+   FLA_Obj LT,              L0,
+           LB,              L1,
+                            L2;
+
+   FLA_Obj WT,              W0,
+           WB,              W1,
+                            W2;
+
+   FLA_Part_2x2( A,    &ATL, &ATR,
+                       &ABL, &ABR,     0, 0, FLA_TL );
+
+   FLA_Part_2x1( L,    &LT,
+                       &LB,            0, FLA_TOP );
+
+   FLA_Part_2x1( W,    &WT,
+                       &WB,            0, FLA_TOP );
+
+   while ( FLA_Obj_length( ATL ) < FLA_Obj_length( A ) )
+   {
+      /*------------------------------------------------------------*/
+
+      // Factor the next panel, which begins s( 0 ) columns into ABR.
+      if ( FLASH_Queue_get_enabled( ) )
+      {
+         // Enqueue
+         ENQUEUE_FLASH_LDLT_piv_panel( ABR, p, L, W, s,
+                                       ( int ) FLA_Obj_length( LT ),
+                                       cntl );
+      }
+      else
+      {
+         // Execute leaf
+         FLA_LDLT_piv_panel_task( ABR, p, L, W, s,
+                                  ( int ) FLA_Obj_length( LT ),
+                                  cntl );
+      }
+
+      /*------------------------------------------------------------*/
+
+      FLA_Repart_2x2_to_3x3( ATL, /**/ ATR,       &A00, /**/ &A01, &A02,
+                          /* ************* */   /* ******************** */
+                                                  &A10, /**/ &A11, &A12,
+                             ABL, /**/ ABR,       &A20, /**/ &A21, &A22,
+                             1, 1, FLA_BR );
+
+      FLA_Repart_2x1_to_3x1( LT,                &L0,
+                          /* ** */            /* ** */
+                                                &L1,
+                             LB,                &L2,
+                             FLA_Obj_length( *FLASH_OBJ_PTR_AT( A11 ) ), FLA_BOTTOM );
+
+      FLA_Repart_2x1_to_3x1( WT,                &W0,
+                          /* ** */            /* ** */
+                                                &W1,
+                             WB,                &W2,
+                             FLA_Obj_length( *FLASH_OBJ_PTR_AT( A11 ) ), FLA_BOTTOM );
+
+      /*------------------------------------------------------------*/
+
+      // A22 = A22 - L2 * W2';
+      FLASH_LDLT_piv_update( L2, W2, A22, cntl );
+
+      /*------------------------------------------------------------*/
+
+      FLA_Cont_with_3x3_to_2x2( &ATL, /**/ &ATR,       A00, A01, /**/ A02,
+                                                       A10, A11, /**/ A12,
+                             /* ************** */  /* ****************** */
+                                &ABL, /**/ &ABR,       A20, A21, /**/ A22,
+                                FLA_TL );
+
+      FLA_Cont_with_3x1_to_2x1( &LT,                L0,
+                                                    L1,
+                              /* ** */           /* ** */
+                                &LB,                L2,     FLA_TOP );
+
+      FLA_Cont_with_3x1_to_2x1( &WT,                W0,
+                                                    W1,
+                              /* ** */           /* ** */
+                                &WB,                W2,     FLA_TOP );
+   }
+
+   return FLA_SUCCESS;
+}
+
+
+static FLA_Error FLASH_LDLT_piv_update( FLA_Obj L, FLA_Obj W, FLA_Obj A, fla_ldlt_t* cntl )
+{
+   FLA_Obj ATL,   ATR,      A00, A01, A02,
+           ABL,   ABR,      A10, A11, A12,
+                            A20, A21, A22;
+
+   FLA_Obj LT,              L0,
+           LB,              L1,
+                            L2;
+
+   FLA_Obj WT,              W0,
+           WB,              W1,
+                            W2;
+
+   FLA_Obj A21T,            A21_0,
+           A21B,            A21_1,
+                            A21_2;
+
+   FLA_Obj L2T,             L2_0,
+           L2B,             L2_1,
+                            L2_2;
+
+   dim_t   b;
+
+   FLA_Part_2x2( A,    &ATL, &ATR,
+                       &ABL, &ABR,     0, 0, FLA_TL );
+
+   FLA_Part_2x1( L,    &LT,
+                       &LB,            0, FLA_TOP );
+
+   FLA_Part_2x1( W,    &WT,
+                       &WB,            0, FLA_TOP );
+
+   while ( FLA_Obj_length( ATL ) < FLA_Obj_length( A ) )
+   {
+      FLA_Repart_2x2_to_3x3( ATL, /**/ ATR,       &A00, /**/ &A01, &A02,
+                          /* ************* */   /* ******************** */
+                                                  &A10, /**/ &A11, &A12,
+                             ABL, /**/ ABR,       &A20, /**/ &A21, &A22,
+                             1, 1, FLA_BR );
+
+      b = FLA_Obj_length( *FLASH_OBJ_PTR_AT( A11 ) );
+
+      FLA_Repart_2x1_to_3x1( LT,                &L0,
+                          /* ** */            /* ** */
+                                                &L1,
+                             LB,                &L2,        b, FLA_BOTTOM );
+
+      FLA_Repart_2x1_to_3x1( WT,                &W0,
+                          /* ** */            /* ** */
+                                                &W1,
+                             WB,                &W2,        b, FLA_BOTTOM );
+
+      /*------------------------------------------------------------*/
+
+      // A11 = A11 - tril( L1 * W1' );
+      if ( FLASH_Queue_get_enabled( ) )
+      {
+         // Enqueue
+         ENQUEUE_FLASH_LDLT_piv_update( L1, W1, *FLASH_OBJ_PTR_AT( A11 ),
+                                        FLA_Cntl_sub_gemm( cntl ) );
+      }
+      else
+      {
+         // Execute leaf
+         FLA_LDLT_piv_update_task( L1, W1, *FLASH_OBJ_PTR_AT( A11 ),
+                                   FLA_Cntl_sub_gemm( cntl ) );
+      }
+
+      // A21 = A21 - L2 * W1';
+      FLA_Part_2x1( A21,   &A21T,
+                           &A21B,         0, FLA_TOP );
+
+      FLA_Part_2x1( L2,    &L2T,
+                           &L2B,          0, FLA_TOP );
+
+      while ( FLA_Obj_length( A21T ) < FLA_Obj_length( A21 ) )
+      {
+         FLA_Repart_2x1_to_3x1( A21T,              &A21_0,
+                             /* ** */           /* ***** */
+                                                   &A21_1,
+                                A21B,              &A21_2,        1, FLA_BOTTOM );
+
+         FLA_Repart_2x1_to_3x1( L2T,               &L2_0,
+                             /* ** */           /* **** */
+                                                   &L2_1,
+                                L2B,               &L2_2,
+                                FLA_Obj_length( *FLASH_OBJ_PTR_AT( A21_1 ) ), FLA_BOTTOM );
+
+         if ( FLASH_Queue_get_enabled( ) )
+         {
+            // Enqueue
+            ENQUEUE_FLASH_Gemm( FLA_NO_TRANSPOSE, FLA_TRANSPOSE,
+                                FLA_MINUS_ONE, L2_1, W1,
+                                FLA_ONE, *FLASH_OBJ_PTR_AT( A21_1 ),
+                                FLA_Cntl_sub_gemm( cntl ) );
+         }
+         else
+         {
+            // Execute leaf
+            FLA_Gemm_task( FLA_NO_TRANSPOSE, FLA_TRANSPOSE,
+                           FLA_MINUS_ONE, L2_1, W1,
+                           FLA_ONE, *FLASH_OBJ_PTR_AT( A21_1 ),
+                           FLA_Cntl_sub_gemm( cntl ) );
+         }
+
+         FLA_Cont_with_3x1_to_2x1( &A21T,              A21_0,
+                                                       A21_1,
+                                /* ** */           /* ***** */
+                                   &A21B,              A21_2,     FLA_TOP );
+
+         FLA_Cont_with_3x1_to_2x1( &L2T,               L2_0,
+                                                       L2_1,
+                                /* ** */           /* **** */
+                                   &L2B,               L2_2,      FLA_TOP );
+      }
+
+      /*------------------------------------------------------------*/
+
+      FLA_Cont_with_3x3_to_2x2( &ATL, /**/ &ATR,       A00, A01, /**/ A02,
+                                                       A10, A11, /**/ A12,
+                             /* ************** */  /* ****************** */
+                                &ABL, /**/ &ABR,       A20, A21, /**/ A22,
+                                FLA_TL );
+
+      FLA_Cont_with_3x1_to_2x1( &LT,                L0,
+                                                    L1,
+                              /* ** */           /* ** */
+                                &LB,                L2,     FLA_TOP );
+
+      FLA_Cont_with_3x1_to_2x1( &WT,                W0,
+                                                    W1,
+                              /* ** */           /* ** */
+                                &WB,                W2,     FLA_TOP );
+   }
+
+   return FLA_SUCCESS;
+}
+
@@ -0,0 +1,133 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// The blocked Bunch-Kaufman factorization of LAPACK's dsytrf for the lower
+// triangle. Since a 2 x 2 pivot may not be split between two panels, the
+// panel factorization decides how many columns it factors and the loop
+// advances by that many rather than by the blocksize.
+
+FLA_Error FLA_LDLT_piv_blk_var1( FLA_Obj A, FLA_Obj p, fla_ldlt_t* cntl )
+{
+  FLA_Error r_val = FLA_SUCCESS, r_val_sub = FLA_SUCCESS;
+  FLA_Obj ATL,   ATR,      A00, A01, A02, 
+          ABL,   ABR,      A10, A11, A12,
+                           A20, A21, A22;
+
+  FLA_Obj pT,              p0,
+          pB,              p1,
+                           p2;
+
+  FLA_Obj W, WT, 
+             WB;
+  FLA_Obj WL, WR;
+  FLA_Obj W1, W21;
+
+  FLA_Obj AB1;
+
+  dim_t b, b_alg;
+  int   kb;
+
+  b_alg = FLA_Blocksize_extract( FLA_Obj_datatype( A ),
+                                 FLA_Cntl_blocksize( cntl ) );
+
+  FLA_Obj_create( FLA_Obj_datatype( A ), FLA_Obj_length( A ), b_alg, 0, 0, &W );
+
+  FLA_Part_2x2( A,    &ATL, &ATR,
+                      &ABL, &ABR,     0, 0, FLA_TL );
+
+  FLA_Part_2x1( p,    &pT, 
+                      &pB,            0, FLA_TOP );
+
+  while ( FLA_Obj_length( ATL ) < FLA_Obj_length( A ) ){
+
+    b = FLA_Determine_blocksize( ABR, FLA_BR, FLA_Cntl_blocksize( cntl ) );
+
+    // Factor the next kb columns of ABR, with a panel factorization that
+    // leaves L21 * D in W when there is a trailing submatrix to update
+    // and with the unblocked algorithm otherwise.
+    if ( FLA_Obj_length( ABR ) > b )
+    {
+      FLA_Part_2x1( W,    &WT, 
+                          &WB,            FLA_Obj_length( ABR ), FLA_TOP );
+
+      r_val_sub = FLA_LDLT_piv_panel( ABR, pB, WT, &kb );
+    }
+    else
+    {
+      r_val_sub = FLA_LDLT_piv_internal( ABR, pB,
+                                         FLA_Cntl_sub_ldlt( cntl ) );
+      kb = FLA_Obj_length( ABR );
+    }
+
+    // If the panel encountered a zero pivot, return the first one.
+    if ( r_val == FLA_SUCCESS && r_val_sub >= 0 )
+    {
+      r_val = FLA_Obj_length( ATL ) + r_val_sub;
+    }
+
+    FLA_Repart_2x2_to_3x3( ATL, /**/ ATR,       &A00, /**/ &A01, &A02,
+                        /* ************* */   /* ******************** */
+                                                &A10, /**/ &A11, &A12,
+                           ABL, /**/ ABR,       &A20, /**/ &A21, &A22,
+                           kb, kb, FLA_BR );
+
+    FLA_Repart_2x1_to_3x1( pT,                &p0, 
+                        /* ** */            /* ** */
+                                              &p1, 
+                           pB,                &p2,        kb, FLA_BOTTOM );
+
+    /*------------------------------------------------------------*/
+
+    if ( FLA_Obj_length( A22 ) > 0 )
+    {
+      // W21 = the rows of W below the panel, for the kb columns that the
+      // panel factored.
+      FLA_Part_1x2( WT,    &WL, &WR,      kb, FLA_LEFT );
+
+      FLA_Part_2x1( WL,    &W1, 
+                           &W21,          kb, FLA_TOP );
+
+      // A22 = A22 - A21 * W21';
+      FLA_LDLT_piv_update( A21, W21, A22,
+                           FLA_Cntl_sub_gemm( cntl ) );
+
+      // AB1 = / A11 \
+      //       \ A21 /
+      FLA_Merge_2x1( A11,
+                     A21,      &AB1 );
+
+      // Restore the rows of L in AB1 that the panel left interchanged.
+      FLA_LDLT_piv_unswap( AB1, p1 );
+    }
+
+    // Make the pivots of p1 relative to the top of A.
+    FLA_LDLT_piv_shift_pivots( FLA_Obj_length( A00 ), p1 );
+
+    /*------------------------------------------------------------*/
+
+    FLA_Cont_with_3x3_to_2x2( &ATL, /**/ &ATR,       A00, A01, /**/ A02,
+                                                     A10, A11, /**/ A12,
+                            /* ************** */  /* ****************** */
+                              &ABL, /**/ &ABR,       A20, A21, /**/ A22,
+                              FLA_TL );
+
+    FLA_Cont_with_3x1_to_2x1( &pT,                p0, 
+                                                  p1, 
+                            /* ** */           /* ** */
+                              &pB,                p2,     FLA_TOP );
+  }
+
+  FLA_Obj_free( &W );
+
+  return r_val;
+}
+
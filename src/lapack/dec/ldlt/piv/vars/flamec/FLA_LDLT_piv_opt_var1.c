@@ -0,0 +1,425 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// The unblocked right-looking Bunch-Kaufman factorization of LAPACK's
+// dsytf2, which factors the lower triangle of A as P L D L' P', with D
+// block diagonal with 1 x 1 and 2 x 2 blocks. The pivots are stored as
+// LAPACK stores them, so that the factors may be passed to ?sytrs, ?sytri
+// and ?sycon.
+
+FLA_Error FLA_LDLT_piv_opt_var1( FLA_Obj A, FLA_Obj p )
+{
+  FLA_Error    r_val = FLA_SUCCESS;
+  FLA_Datatype datatype;
+  int          m_A;
+  int          rs_A, cs_A;
+  int          inc_p;
+
+  datatype = FLA_Obj_datatype( A );
+
+  m_A      = FLA_Obj_length( A );
+  rs_A     = FLA_Obj_row_stride( A );
+  cs_A     = FLA_Obj_col_stride( A );
+
+  inc_p    = FLA_Obj_vector_inc( p );
+
+
+  switch ( datatype )
+  {
+    case FLA_FLOAT:
+    {
+      float* buff_A = FLA_FLOAT_PTR( A );
+      int*   buff_p = FLA_INT_PTR( p );
+
+      r_val = FLA_LDLT_piv_ops_var1( m_A,
+                                     buff_A, rs_A, cs_A,
+                                     buff_p, inc_p );
+
+      break;
+    }
+
+    case FLA_DOUBLE:
+    {
+      double* buff_A = FLA_DOUBLE_PTR( A );
+      int*    buff_p = FLA_INT_PTR( p );
+
+      r_val = FLA_LDLT_piv_opd_var1( m_A,
+                                     buff_A, rs_A, cs_A,
+                                     buff_p, inc_p );
+
+      break;
+    }
+  }
+
+  return r_val;
+}
+
+
+
+FLA_Error FLA_LDLT_piv_ops_var1( int m_A,
+                                 float*    buff_A, int rs_A, int cs_A,
+                                 int*      buff_p, int inc_p )
+{
+  FLA_Error r_val  = FLA_SUCCESS;
+  float     alpha  = ( 1.0F + sqrtf( 17.0F ) ) / 8.0F;
+  float     absakk, colmax, rowmax;
+  float     d11, d21, d22, t, wk, wkp1, minus_r1;
+  int       k, kk, kp, kstep, imax, jmax, i, j;
+
+  k = 0;
+
+  while ( k < m_A )
+  {
+    float*    alpha11 = buff_A + (k  )*cs_A + (k  )*rs_A;
+    float*    a21     = buff_A + (k  )*cs_A + (k+1)*rs_A;
+    float*    A22     = buff_A + (k+1)*cs_A + (k+1)*rs_A;
+
+    int       m_ahead = m_A - k - 1;
+
+    kstep  = 1;
+    absakk = fabsf( *alpha11 );
+
+    // Find the largest off-diagonal element in column k.
+    if ( m_ahead > 0 )
+    {
+      bl1_samax( m_ahead,
+                 a21, rs_A,
+                 &imax );
+      imax  += k + 1;
+      colmax = fabsf( buff_A[ k*cs_A + imax*rs_A ] );
+    }
+    else
+    {
+      colmax = fzero;
+    }
+
+    if ( max( absakk, colmax ) == fzero || absakk != absakk )
+    {
+      // Column k is zero or contains a NaN. Record the first such column
+      // and move on without pivoting.
+      if ( r_val == FLA_SUCCESS ) r_val = k;
+      kp = k;
+    }
+    else
+    {
+      if ( absakk >= alpha * colmax )
+      {
+        kp = k;
+      }
+      else
+      {
+        // Find the largest off-diagonal element in row imax, which is
+        // stored partly in row imax and partly in column imax.
+        bl1_samax( imax - k,
+                   buff_A + (k   )*cs_A + (imax)*rs_A, cs_A,
+                   &jmax );
+        jmax  += k;
+        rowmax = fabsf( buff_A[ jmax*cs_A + imax*rs_A ] );
+
+        if ( imax < m_A - 1 )
+        {
+          bl1_samax( m_A - imax - 1,
+                     buff_A + (imax)*cs_A + (imax+1)*rs_A, rs_A,
+                     &jmax );
+          jmax  += imax + 1;
+          rowmax = max( rowmax, fabsf( buff_A[ imax*cs_A + jmax*rs_A ] ) );
+        }
+
+        if      ( absakk >= alpha * colmax * ( colmax / rowmax ) )
+          kp = k;
+        else if ( fabsf( buff_A[ imax*cs_A + imax*rs_A ] ) >= alpha * rowmax )
+          kp = imax;
+        else
+        {
+          kp    = imax;
+          kstep = 2;
+        }
+      }
+
+      // Interchange rows and columns kk and kp of the trailing submatrix.
+      kk = k + kstep - 1;
+
+      if ( kp != kk )
+      {
+        float*  akk = buff_A + kk*cs_A + kk*rs_A;
+        float*  akp = buff_A + kp*cs_A + kp*rs_A;
+
+        if ( kp < m_A - 1 )
+          bl1_sswap( m_A - kp - 1,
+                     buff_A + (kk)*cs_A + (kp+1)*rs_A, rs_A,
+                     akp + rs_A,                       rs_A );
+
+        bl1_sswap( kp - kk - 1,
+                   akk + rs_A,                          rs_A,
+                   buff_A + (kk+1)*cs_A + (kp)*rs_A,    cs_A );
+
+        t = *akk; *akk = *akp; *akp = t;
+
+        if ( kstep == 2 )
+        {
+          float*  a1 = buff_A + k*cs_A + (k+1)*rs_A;
+          float*  a2 = buff_A + k*cs_A + (kp )*rs_A;
+
+          t = *a1; *a1 = *a2; *a2 = t;
+        }
+      }
+
+      if ( kstep == 1 )
+      {
+        // A22 = A22 - a21 * a21' / alpha11;
+        // a21 = a21 / alpha11;
+        if ( m_ahead > 0 )
+        {
+          d11      = 1.0F / *alpha11;
+          minus_r1 = -d11;
+
+          bl1_ssyr( BLIS1_LOWER_TRIANGULAR,
+                    m_ahead,
+                    &minus_r1,
+                    a21, rs_A,
+                    A22, rs_A, cs_A );
+
+          bl1_sscalv( BLIS1_NO_CONJUGATE,
+                      m_ahead,
+                      &d11,
+                      a21, rs_A );
+        }
+      }
+      else
+      {
+        // Update the trailing submatrix with the 2 x 2 pivot block D in
+        // place of columns k and k+1, and overwrite those columns with
+        // the corresponding columns of L.
+        if ( k < m_A - 2 )
+        {
+          d21 = buff_A[ k*cs_A + (k+1)*rs_A ];
+          d11 = buff_A[ (k+1)*cs_A + (k+1)*rs_A ] / d21;
+          d22 = buff_A[ k*cs_A + k*rs_A ] / d21;
+          t   = 1.0F / ( d11 * d22 - 1.0F );
+          d21 = t / d21;
+
+          for ( j = k + 2; j < m_A; ++j )
+          {
+            float*  ajk   = buff_A + (k  )*cs_A + j*rs_A;
+            float*  ajkp1 = buff_A + (k+1)*cs_A + j*rs_A;
+
+            wk   = d21 * ( d11 * *ajk   - *ajkp1 );
+            wkp1 = d21 * ( d22 * *ajkp1 - *ajk   );
+
+            for ( i = j; i < m_A; ++i )
+              buff_A[ j*cs_A + i*rs_A ] -= buff_A[ (k  )*cs_A + i*rs_A ] * wk +
+                                           buff_A[ (k+1)*cs_A + i*rs_A ] * wkp1;
+
+            *ajk   = wk;
+            *ajkp1 = wkp1;
+          }
+        }
+      }
+    }
+
+    // Record the interchange in LAPACK's format.
+    if ( kstep == 1 )
+    {
+      buff_p[ (k  )*inc_p ] = kp + 1;
+    }
+    else
+    {
+      buff_p[ (k  )*inc_p ] = -( kp + 1 );
+      buff_p[ (k+1)*inc_p ] = -( kp + 1 );
+    }
+
+    k += kstep;
+  }
+
+  return r_val;
+}
+
+
+
+FLA_Error FLA_LDLT_piv_opd_var1( int m_A,
+                                 double*   buff_A, int rs_A, int cs_A,
+                                 int*      buff_p, int inc_p )
+{
+  FLA_Error r_val  = FLA_SUCCESS;
+  double    alpha  = ( 1.0 + sqrt( 17.0 ) ) / 8.0;
+  double    absakk, colmax, rowmax;
+  double    d11, d21, d22, t, wk, wkp1, minus_r1;
+  int       k, kk, kp, kstep, imax, jmax, i, j;
+
+  k = 0;
+
+  while ( k < m_A )
+  {
+    double*   alpha11 = buff_A + (k  )*cs_A + (k  )*rs_A;
+    double*   a21     = buff_A + (k  )*cs_A + (k+1)*rs_A;
+    double*   A22     = buff_A + (k+1)*cs_A + (k+1)*rs_A;
+
+    int       m_ahead = m_A - k - 1;
+
+    kstep  = 1;
+    absakk = fabs( *alpha11 );
+
+    // Find the largest off-diagonal element in column k.
+    if ( m_ahead > 0 )
+    {
+      bl1_damax( m_ahead,
+                 a21, rs_A,
+                 &imax );
+      imax  += k + 1;
+      colmax = fabs( buff_A[ k*cs_A + imax*rs_A ] );
+    }
+    else
+    {
+      colmax = dzero;
+    }
+
+    if ( max( absakk, colmax ) == dzero || absakk != absakk )
+    {
+      // Column k is zero or contains a NaN. Record the first such column
+      // and move on without pivoting.
+      if ( r_val == FLA_SUCCESS ) r_val = k;
+      kp = k;
+    }
+    else
+    {
+      if ( absakk >= alpha * colmax )
+      {
+        kp = k;
+      }
+      else
+      {
+        // Find the largest off-diagonal element in row imax, which is
+        // stored partly in row imax and partly in column imax.
+        bl1_damax( imax - k,
+                   buff_A + (k   )*cs_A + (imax)*rs_A, cs_A,
+                   &jmax );
+        jmax  += k;
+        rowmax = fabs( buff_A[ jmax*cs_A + imax*rs_A ] );
+
+        if ( imax < m_A - 1 )
+        {
+          bl1_damax( m_A - imax - 1,
+                     buff_A + (imax)*cs_A + (imax+1)*rs_A, rs_A,
+                     &jmax );
+          jmax  += imax + 1;
+          rowmax = max( rowmax, fabs( buff_A[ imax*cs_A + jmax*rs_A ] ) );
+        }
+
+        if      ( absakk >= alpha * colmax * ( colmax / rowmax ) )
+          kp = k;
+        else if ( fabs( buff_A[ imax*cs_A + imax*rs_A ] ) >= alpha * rowmax )
+          kp = imax;
+        else
+        {
+          kp    = imax;
+          kstep = 2;
+        }
+      }
+
+      // Interchange rows and columns kk and kp of the trailing submatrix.
+      kk = k + kstep - 1;
+
+      if ( kp != kk )
+      {
+        double* akk = buff_A + kk*cs_A + kk*rs_A;
+        double* akp = buff_A + kp*cs_A + kp*rs_A;
+
+        if ( kp < m_A - 1 )
+          bl1_dswap( m_A - kp - 1,
+                     buff_A + (kk)*cs_A + (kp+1)*rs_A, rs_A,
+                     akp + rs_A,                       rs_A );
+
+        bl1_dswap( kp - kk - 1,
+                   akk + rs_A,                          rs_A,
+                   buff_A + (kk+1)*cs_A + (kp)*rs_A,    cs_A );
+
+        t = *akk; *akk = *akp; *akp = t;
+
+        if ( kstep == 2 )
+        {
+          double* a1 = buff_A + k*cs_A + (k+1)*rs_A;
+          double* a2 = buff_A + k*cs_A + (kp )*rs_A;
+
+          t = *a1; *a1 = *a2; *a2 = t;
+        }
+      }
+
+      if ( kstep == 1 )
+      {
+        // A22 = A22 - a21 * a21' / alpha11;
+        // a21 = a21 / alpha11;
+        if ( m_ahead > 0 )
+        {
+          d11      = 1.0 / *alpha11;
+          minus_r1 = -d11;
+
+          bl1_dsyr( BLIS1_LOWER_TRIANGULAR,
+                    m_ahead,
+                    &minus_r1,
+                    a21, rs_A,
+                    A22, rs_A, cs_A );
+
+          bl1_dscalv( BLIS1_NO_CONJUGATE,
+                      m_ahead,
+                      &d11,
+                      a21, rs_A );
+        }
+      }
+      else
+      {
+        // Update the trailing submatrix with the 2 x 2 pivot block D in
+        // place of columns k and k+1, and overwrite those columns with
+        // the corresponding columns of L.
+        if ( k < m_A - 2 )
+        {
+          d21 = buff_A[ k*cs_A + (k+1)*rs_A ];
+          d11 = buff_A[ (k+1)*cs_A + (k+1)*rs_A ] / d21;
+          d22 = buff_A[ k*cs_A + k*rs_A ] / d21;
+          t   = 1.0 / ( d11 * d22 - 1.0 );
+          d21 = t / d21;
+
+          for ( j = k + 2; j < m_A; ++j )
+          {
+            double* ajk   = buff_A + (k  )*cs_A + j*rs_A;
+            double* ajkp1 = buff_A + (k+1)*cs_A + j*rs_A;
+
+            wk   = d21 * ( d11 * *ajk   - *ajkp1 );
+            wkp1 = d21 * ( d22 * *ajkp1 - *ajk   );
+
+            for ( i = j; i < m_A; ++i )
+              buff_A[ j*cs_A + i*rs_A ] -= buff_A[ (k  )*cs_A + i*rs_A ] * wk +
+                                           buff_A[ (k+1)*cs_A + i*rs_A ] * wkp1;
+
+            *ajk   = wk;
+            *ajkp1 = wkp1;
+          }
+        }
+      }
+    }
+
+    // Record the interchange in LAPACK's format.
+    if ( kstep == 1 )
+    {
+      buff_p[ (k  )*inc_p ] = kp + 1;
+    }
+    else
+    {
+      buff_p[ (k  )*inc_p ] = -( kp + 1 );
+      buff_p[ (k+1)*inc_p ] = -( kp + 1 );
+    }
+
+    k += kstep;
+  }
+
+  return r_val;
+}
+
@@ -0,0 +1,697 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// The panel factorization of LAPACK's dlasyf. It factors the leading nb-1
+// or nb columns of the lower triangle of A, returning their number in kb,
+// and leaves in the same columns of W the product of the factored columns
+// of L with D, so that the caller may update the trailing submatrix with
+//
+//   A22 := A22 - L21 W21'
+//
+// The rows of the factored columns of L are left interchanged by all of
+// the pivots of the panel, so that they match the rows of A22 and W21, and
+// should be restored with FLA_LDLT_piv_unswap() once A22 is updated. The
+// pivots are stored as LAPACK stores them, relative to the top of A.
+
+FLA_Error FLA_LDLT_piv_panel( FLA_Obj A, FLA_Obj p, FLA_Obj W, int* kb )
+{
+  FLA_Error    r_val = FLA_SUCCESS;
+  FLA_Datatype datatype;
+  int          m_A, nb;
+  int          rs_A, cs_A;
+  int          rs_W, cs_W;
+  int          inc_p;
+
+  datatype = FLA_Obj_datatype( A );
+
+  m_A      = FLA_Obj_length( A );
+  nb       = FLA_Obj_width( W );
+  rs_A     = FLA_Obj_row_stride( A );
+  cs_A     = FLA_Obj_col_stride( A );
+  rs_W     = FLA_Obj_row_stride( W );
+  cs_W     = FLA_Obj_col_stride( W );
+
+  inc_p    = FLA_Obj_vector_inc( p );
+
+
+  switch ( datatype )
+  {
+    case FLA_FLOAT:
+    {
+      float* buff_A = FLA_FLOAT_PTR( A );
+      float* buff_W = FLA_FLOAT_PTR( W );
+      int*   buff_p = FLA_INT_PTR( p );
+
+      r_val = FLA_LDLT_piv_panel_ops( m_A,
+                                      nb,
+                                      buff_A, rs_A, cs_A,
+                                      buff_p, inc_p,
+                                      buff_W, rs_W, cs_W,
+                                      kb );
+
+      break;
+    }
+
+    case FLA_DOUBLE:
+    {
+      double* buff_A = FLA_DOUBLE_PTR( A );
+      double* buff_W = FLA_DOUBLE_PTR( W );
+      int*    buff_p = FLA_INT_PTR( p );
+
+      r_val = FLA_LDLT_piv_panel_opd( m_A,
+                                      nb,
+                                      buff_A, rs_A, cs_A,
+                                      buff_p, inc_p,
+                                      buff_W, rs_W, cs_W,
+                                      kb );
+
+      break;
+    }
+  }
+
+  return r_val;
+}
+
+
+
+FLA_Error FLA_LDLT_piv_panel_ops( int m_A,
+                                  int nb,
+                                  float*    buff_A, int rs_A, int cs_A,
+                                  int*      buff_p, int inc_p,
+                                  float*    buff_W, int rs_W, int cs_W,
+                                  int*      kb )
+{
+  FLA_Error r_val   = FLA_SUCCESS;
+  float*    buff_1  = FLA_FLOAT_PTR( FLA_ONE );
+  float*    buff_m1 = FLA_FLOAT_PTR( FLA_MINUS_ONE );
+  float     alpha   = ( 1.0F + sqrtf( 17.0F ) ) / 8.0F;
+  float     absakk, colmax, rowmax;
+  float     d11, d21, d22, t, r1;
+  int       k, kk, kp, kstep, imax, jmax, j;
+
+  k = 0;
+
+  while ( !( ( k >= nb - 1 && nb < m_A ) || k >= m_A ) )
+  {
+    float*    a1k     = buff_A + (k  )*cs_A + (k  )*rs_A;
+    float*    a10t    = buff_A + (0  )*cs_A + (k  )*rs_A;
+    float*    w1k     = buff_W + (k  )*cs_W + (k  )*rs_W;
+    float*    w1kp1   = buff_W + (k+1)*cs_W + (k  )*rs_W;
+    float*    w10t    = buff_W + (0  )*cs_W + (k  )*rs_W;
+
+    int       m_ahead = m_A - k - 1;
+
+    // w1k = a1k - A10 * w10t';
+    bl1_scopyv( BLIS1_NO_CONJUGATE,
+                m_ahead + 1,
+                a1k, rs_A,
+                w1k, rs_W );
+
+    bl1_sgemv( BLIS1_NO_TRANSPOSE,
+               BLIS1_NO_CONJUGATE,
+               m_ahead + 1,
+               k,
+               buff_m1,
+               a10t, rs_A, cs_A,
+               w10t, cs_W,
+               buff_1,
+               w1k, rs_W );
+
+    kstep  = 1;
+    absakk = fabsf( *w1k );
+
+    // Find the largest off-diagonal element in column k.
+    if ( m_ahead > 0 )
+    {
+      bl1_samax( m_ahead,
+                 w1k + rs_W, rs_W,
+                 &imax );
+      imax  += k + 1;
+      colmax = fabsf( buff_W[ k*cs_W + imax*rs_W ] );
+    }
+    else
+    {
+      colmax = fzero;
+    }
+
+    if ( max( absakk, colmax ) == fzero || absakk != absakk )
+    {
+      // Column k is zero or contains a NaN. Record the first such column
+      // and move on without pivoting.
+      if ( r_val == FLA_SUCCESS ) r_val = k;
+      kp = k;
+
+      bl1_scopyv( BLIS1_NO_CONJUGATE,
+                  m_ahead + 1,
+                  w1k, rs_W,
+                  a1k, rs_A );
+    }
+    else
+    {
+      if ( absakk >= alpha * colmax )
+      {
+        kp = k;
+      }
+      else
+      {
+        // Copy column imax of the lower triangle, which is stored partly
+        // in row imax, to column k+1 of W and update it.
+        bl1_scopyv( BLIS1_NO_CONJUGATE,
+                    imax - k,
+                    buff_A + (k   )*cs_A + (imax)*rs_A, cs_A,
+                    w1kp1, rs_W );
+
+        bl1_scopyv( BLIS1_NO_CONJUGATE,
+                    m_A - imax,
+                    buff_A + (imax)*cs_A + (imax)*rs_A, rs_A,
+                    buff_W + (k+1 )*cs_W + (imax)*rs_W, rs_W );
+
+        bl1_sgemv( BLIS1_NO_TRANSPOSE,
+                   BLIS1_NO_CONJUGATE,
+                   m_ahead + 1,
+                   k,
+                   buff_m1,
+                   a10t, rs_A, cs_A,
+                   buff_W + (0   )*cs_W + (imax)*rs_W, cs_W,
+                   buff_1,
+                   w1kp1, rs_W );
+
+        // Find the largest off-diagonal element in row imax.
+        bl1_samax( imax - k,
+                   w1kp1, rs_W,
+                   &jmax );
+        jmax  += k;
+        rowmax = fabsf( buff_W[ (k+1)*cs_W + jmax*rs_W ] );
+
+        if ( imax < m_A - 1 )
+        {
+          bl1_samax( m_A - imax - 1,
+                     buff_W + (k+1)*cs_W + (imax+1)*rs_W, rs_W,
+                     &jmax );
+          jmax  += imax + 1;
+          rowmax = max( rowmax, fabsf( buff_W[ (k+1)*cs_W + jmax*rs_W ] ) );
+        }
+
+        if      ( absakk >= alpha * colmax * ( colmax / rowmax ) )
+        {
+          kp = k;
+        }
+        else if ( fabsf( buff_W[ (k+1)*cs_W + imax*rs_W ] ) >= alpha * rowmax )
+        {
+          kp = imax;
+
+          bl1_scopyv( BLIS1_NO_CONJUGATE,
+                      m_ahead + 1,
+                      w1kp1, rs_W,
+                      w1k,   rs_W );
+        }
+        else
+        {
+          kp    = imax;
+          kstep = 2;
+        }
+      }
+
+      // Interchange rows and columns kk and kp. The updated column kp is
+      // already in column kk of W, and columns k (and k+1) of A are
+      // overwritten below, so only the rest of the trailing submatrix of
+      // A, the first k columns of A and the first kk+1 columns of W are
+      // interchanged.
+      kk = k + kstep - 1;
+
+      if ( kp != kk )
+      {
+        buff_A[ kp*cs_A + kp*rs_A ] = buff_A[ kk*cs_A + kk*rs_A ];
+
+        bl1_scopyv( BLIS1_NO_CONJUGATE,
+                    kp - kk - 1,
+                    buff_A + (kk  )*cs_A + (kk+1)*rs_A, rs_A,
+                    buff_A + (kk+1)*cs_A + (kp  )*rs_A, cs_A );
+
+        if ( kp < m_A - 1 )
+          bl1_scopyv( BLIS1_NO_CONJUGATE,
+                      m_A - kp - 1,
+                      buff_A + (kk)*cs_A + (kp+1)*rs_A, rs_A,
+                      buff_A + (kp)*cs_A + (kp+1)*rs_A, rs_A );
+
+        bl1_sswap( k,
+                   buff_A + kk*rs_A, cs_A,
+                   buff_A + kp*rs_A, cs_A );
+
+        bl1_sswap( kk + 1,
+                   buff_W + kk*rs_W, cs_W,
+                   buff_W + kp*rs_W, cs_W );
+      }
+
+      if ( kstep == 1 )
+      {
+        // Column k of W now holds L(k) D(k). Store D(k) and the rest of
+        // L(k) in column k of A.
+        bl1_scopyv( BLIS1_NO_CONJUGATE,
+                    m_ahead + 1,
+                    w1k, rs_W,
+                    a1k, rs_A );
+
+        if ( m_ahead > 0 )
+        {
+          r1 = 1.0F / *a1k;
+
+          bl1_sscalv( BLIS1_NO_CONJUGATE,
+                      m_ahead,
+                      &r1,
+                      a1k + rs_A, rs_A );
+        }
+      }
+      else
+      {
+        // Columns k and k+1 of W now hold ( L(k) L(k+1) ) D(k). Store the
+        // 2 x 2 block D(k) and the rest of ( L(k) L(k+1) ), computed with
+        // the inverse of D(k), in columns k and k+1 of A.
+        if ( k < m_A - 2 )
+        {
+          d21 = buff_W[ k*cs_W + (k+1)*rs_W ];
+          d11 = buff_W[ (k+1)*cs_W + (k+1)*rs_W ] / d21;
+          d22 = buff_W[ k*cs_W + k*rs_W ] / d21;
+          t   = 1.0F / ( d11 * d22 - 1.0F );
+          d21 = t / d21;
+
+          for ( j = k + 2; j < m_A; ++j )
+          {
+            float  wjk   = buff_W[ (k  )*cs_W + j*rs_W ];
+            float  wjkp1 = buff_W[ (k+1)*cs_W + j*rs_W ];
+
+            buff_A[ (k  )*cs_A + j*rs_A ] = d21 * ( d11 * wjk   - wjkp1 );
+            buff_A[ (k+1)*cs_A + j*rs_A ] = d21 * ( d22 * wjkp1 - wjk   );
+          }
+        }
+
+        buff_A[ (k  )*cs_A + (k  )*rs_A ] = buff_W[ (k  )*cs_W + (k  )*rs_W ];
+        buff_A[ (k  )*cs_A + (k+1)*rs_A ] = buff_W[ (k  )*cs_W + (k+1)*rs_W ];
+        buff_A[ (k+1)*cs_A + (k+1)*rs_A ] = buff_W[ (k+1)*cs_W + (k+1)*rs_W ];
+      }
+    }
+
+    // Record the interchange in LAPACK's format.
+    if ( kstep == 1 )
+    {
+      buff_p[ (k  )*inc_p ] = kp + 1;
+    }
+    else
+    {
+      buff_p[ (k  )*inc_p ] = -( kp + 1 );
+      buff_p[ (k+1)*inc_p ] = -( kp + 1 );
+    }
+
+    k += kstep;
+  }
+
+  *kb = k;
+
+  return r_val;
+}
+
+
+
+FLA_Error FLA_LDLT_piv_panel_opd( int m_A,
+                                  int nb,
+                                  double*   buff_A, int rs_A, int cs_A,
+                                  int*      buff_p, int inc_p,
+                                  double*   buff_W, int rs_W, int cs_W,
+                                  int*      kb )
+{
+  FLA_Error r_val   = FLA_SUCCESS;
+  double*   buff_1  = FLA_DOUBLE_PTR( FLA_ONE );
+  double*   buff_m1 = FLA_DOUBLE_PTR( FLA_MINUS_ONE );
+  double    alpha   = ( 1.0 + sqrt( 17.0 ) ) / 8.0;
+  double    absakk, colmax, rowmax;
+  double    d11, d21, d22, t, r1;
+  int       k, kk, kp, kstep, imax, jmax, j;
+
+  k = 0;
+
+  while ( !( ( k >= nb - 1 && nb < m_A ) || k >= m_A ) )
+  {
+    double*   a1k     = buff_A + (k  )*cs_A + (k  )*rs_A;
+    double*   a10t    = buff_A + (0  )*cs_A + (k  )*rs_A;
+    double*   w1k     = buff_W + (k  )*cs_W + (k  )*rs_W;
+    double*   w1kp1   = buff_W + (k+1)*cs_W + (k  )*rs_W;
+    double*   w10t    = buff_W + (0  )*cs_W + (k  )*rs_W;
+
+    int       m_ahead = m_A - k - 1;
+
+    // w1k = a1k - A10 * w10t';
+    bl1_dcopyv( BLIS1_NO_CONJUGATE,
+                m_ahead + 1,
+                a1k, rs_A,
+                w1k, rs_W );
+
+    bl1_dgemv( BLIS1_NO_TRANSPOSE,
+               BLIS1_NO_CONJUGATE,
+               m_ahead + 1,
+               k,
+               buff_m1,
+               a10t, rs_A, cs_A,
+               w10t, cs_W,
+               buff_1,
+               w1k, rs_W );
+
+    kstep  = 1;
+    absakk = fabs( *w1k );
+
+    // Find the largest off-diagonal element in column k.
+    if ( m_ahead > 0 )
+    {
+      bl1_damax( m_ahead,
+                 w1k + rs_W, rs_W,
+                 &imax );
+      imax  += k + 1;
+      colmax = fabs( buff_W[ k*cs_W + imax*rs_W ] );
+    }
+    else
+    {
+      colmax = dzero;
+    }
+
+    if ( max( absakk, colmax ) == dzero || absakk != absakk )
+    {
+      // Column k is zero or contains a NaN. Record the first such column
+      // and move on without pivoting.
+      if ( r_val == FLA_SUCCESS ) r_val = k;
+      kp = k;
+
+      bl1_dcopyv( BLIS1_NO_CONJUGATE,
+                  m_ahead + 1,
+                  w1k, rs_W,
+                  a1k, rs_A );
+    }
+    else
+    {
+      if ( absakk >= alpha * colmax )
+      {
+        kp = k;
+      }
+      else
+      {
+        // Copy column imax of the lower triangle, which is stored partly
+        // in row imax, to column k+1 of W and update it.
+        bl1_dcopyv( BLIS1_NO_CONJUGATE,
+                    imax - k,
+                    buff_A + (k   )*cs_A + (imax)*rs_A, cs_A,
+                    w1kp1, rs_W );
+
+        bl1_dcopyv( BLIS1_NO_CONJUGATE,
+                    m_A - imax,
+                    buff_A + (imax)*cs_A + (imax)*rs_A, rs_A,
+                    buff_W + (k+1 )*cs_W + (imax)*rs_W, rs_W );
+
+        bl1_dgemv( BLIS1_NO_TRANSPOSE,
+                   BLIS1_NO_CONJUGATE,
+                   m_ahead + 1,
+                   k,
+                   buff_m1,
+                   a10t, rs_A, cs_A,
+                   buff_W + (0   )*cs_W + (imax)*rs_W, cs_W,
+                   buff_1,
+                   w1kp1, rs_W );
+
+        // Find the largest off-diagonal element in row imax.
+        bl1_damax( imax - k,
+                   w1kp1, rs_W,
+                   &jmax );
+        jmax  += k;
+        rowmax = fabs( buff_W[ (k+1)*cs_W + jmax*rs_W ] );
+
+        if ( imax < m_A - 1 )
+        {
+          bl1_damax( m_A - imax - 1,
+                     buff_W + (k+1)*cs_W + (imax+1)*rs_W, rs_W,
+                     &jmax );
+          jmax  += imax + 1;
+          rowmax = max( rowmax, fabs( buff_W[ (k+1)*cs_W + jmax*rs_W ] ) );
+        }
+
+        if      ( absakk >= alpha * colmax * ( colmax / rowmax ) )
+        {
+          kp = k;
+        }
+        else if ( fabs( buff_W[ (k+1)*cs_W + imax*rs_W ] ) >= alpha * rowmax )
+        {
+          kp = imax;
+
+          bl1_dcopyv( BLIS1_NO_CONJUGATE,
+                      m_ahead + 1,
+                      w1kp1, rs_W,
+                      w1k,   rs_W );
+        }
+        else
+        {
+          kp    = imax;
+          kstep = 2;
+        }
+      }
+
+      // Interchange rows and columns kk and kp. The updated column kp is
+      // already in column kk of W, and columns k (and k+1) of A are
+      // overwritten below, so only the rest of the trailing submatrix of
+      // A, the first k columns of A and the first kk+1 columns of W are
+      // interchanged.
+      kk = k + kstep - 1;
+
+      if ( kp != kk )
+      {
+        buff_A[ kp*cs_A + kp*rs_A ] = buff_A[ kk*cs_A + kk*rs_A ];
+
+        bl1_dcopyv( BLIS1_NO_CONJUGATE,
+                    kp - kk - 1,
+                    buff_A + (kk  )*cs_A + (kk+1)*rs_A, rs_A,
+                    buff_A + (kk+1)*cs_A + (kp  )*rs_A, cs_A );
+
+        if ( kp < m_A - 1 )
+          bl1_dcopyv( BLIS1_NO_CONJUGATE,
+                      m_A - kp - 1,
+                      buff_A + (kk)*cs_A + (kp+1)*rs_A, rs_A,
+                      buff_A + (kp)*cs_A + (kp+1)*rs_A, rs_A );
+
+        bl1_dswap( k,
+                   buff_A + kk*rs_A, cs_A,
+                   buff_A + kp*rs_A, cs_A );
+
+        bl1_dswap( kk + 1,
+                   buff_W + kk*rs_W, cs_W,
+                   buff_W + kp*rs_W, cs_W );
+      }
+
+      if ( kstep == 1 )
+      {
+        // Column k of W now holds L(k) D(k). Store D(k) and the rest of
+        // L(k) in column k of A.
+        bl1_dcopyv( BLIS1_NO_CONJUGATE,
+                    m_ahead + 1,
+                    w1k, rs_W,
+                    a1k, rs_A );
+
+        if ( m_ahead > 0 )
+        {
+          r1 = 1.0 / *a1k;
+
+          bl1_dscalv( BLIS1_NO_CONJUGATE,
+                      m_ahead,
+                      &r1,
+                      a1k + rs_A, rs_A );
+        }
+      }
+      else
+      {
+        // Columns k and k+1 of W now hold ( L(k) L(k+1) ) D(k). Store the
+        // 2 x 2 block D(k) and the rest of ( L(k) L(k+1) ), computed with
+        // the inverse of D(k), in columns k and k+1 of A.
+        if ( k < m_A - 2 )
+        {
+          d21 = buff_W[ k*cs_W + (k+1)*rs_W ];
+          d11 = buff_W[ (k+1)*cs_W + (k+1)*rs_W ] / d21;
+          d22 = buff_W[ k*cs_W + k*rs_W ] / d21;
+          t   = 1.0 / ( d11 * d22 - 1.0 );
+          d21 = t / d21;
+
+          for ( j = k + 2; j < m_A; ++j )
+          {
+            double wjk   = buff_W[ (k  )*cs_W + j*rs_W ];
+            double wjkp1 = buff_W[ (k+1)*cs_W + j*rs_W ];
+
+            buff_A[ (k  )*cs_A + j*rs_A ] = d21 * ( d11 * wjk   - wjkp1 );
+            buff_A[ (k+1)*cs_A + j*rs_A ] = d21 * ( d22 * wjkp1 - wjk   );
+          }
+        }
+
+        buff_A[ (k  )*cs_A + (k  )*rs_A ] = buff_W[ (k  )*cs_W + (k  )*rs_W ];
+        buff_A[ (k  )*cs_A + (k+1)*rs_A ] = buff_W[ (k  )*cs_W + (k+1)*rs_W ];
+        buff_A[ (k+1)*cs_A + (k+1)*rs_A ] = buff_W[ (k+1)*cs_W + (k+1)*rs_W ];
+      }
+    }
+
+    // Record the interchange in LAPACK's format.
+    if ( kstep == 1 )
+    {
+      buff_p[ (k  )*inc_p ] = kp + 1;
+    }
+    else
+    {
+      buff_p[ (k  )*inc_p ] = -( kp + 1 );
+      buff_p[ (k+1)*inc_p ] = -( kp + 1 );
+    }
+
+    k += kstep;
+  }
+
+  *kb = k;
+
+  return r_val;
+}
+
+
+
+FLA_Error FLA_LDLT_piv_unswap( FLA_Obj A, FLA_Obj p )
+{
+  FLA_Datatype datatype;
+  int          n_A;
+  int          rs_A, cs_A;
+  int          inc_p;
+
+  datatype = FLA_Obj_datatype( A );
+
+  n_A      = FLA_Obj_width( A );
+  rs_A     = FLA_Obj_row_stride( A );
+  cs_A     = FLA_Obj_col_stride( A );
+
+  inc_p    = FLA_Obj_vector_inc( p );
+
+
+  switch ( datatype )
+  {
+    case FLA_FLOAT:
+    {
+      float* buff_A = FLA_FLOAT_PTR( A );
+      int*   buff_p = FLA_INT_PTR( p );
+
+      FLA_LDLT_piv_unswap_ops( n_A,
+                               buff_A, rs_A, cs_A,
+                               buff_p, inc_p );
+
+      break;
+    }
+
+    case FLA_DOUBLE:
+    {
+      double* buff_A = FLA_DOUBLE_PTR( A );
+      int*    buff_p = FLA_INT_PTR( p );
+
+      FLA_LDLT_piv_unswap_opd( n_A,
+                               buff_A, rs_A, cs_A,
+                               buff_p, inc_p );
+
+      break;
+    }
+  }
+
+  return FLA_SUCCESS;
+}
+
+
+
+FLA_Error FLA_LDLT_piv_unswap_ops( int n_A,
+                                   float*    buff_A, int rs_A, int cs_A,
+                                   int*      buff_p, int inc_p )
+{
+  int j, jj, jp;
+
+  // Walk back over the pivots, undoing the interchange of each step in
+  // the columns to its left. Here j counts columns from one.
+  j = n_A;
+
+  while ( j > 1 )
+  {
+    jj = j;
+    jp = buff_p[ (j-1)*inc_p ];
+
+    if ( jp < 0 )
+    {
+      jp = -jp;
+      --j;
+    }
+
+    --j;
+
+    if ( jp != jj && j >= 1 )
+      bl1_sswap( j,
+                 buff_A + (jp-1)*rs_A, cs_A,
+                 buff_A + (jj-1)*rs_A, cs_A );
+  }
+
+  return FLA_SUCCESS;
+}
+
+
+
+FLA_Error FLA_LDLT_piv_unswap_opd( int n_A,
+                                   double*   buff_A, int rs_A, int cs_A,
+                                   int*      buff_p, int inc_p )
+{
+  int j, jj, jp;
+
+  // Walk back over the pivots, undoing the interchange of each step in
+  // the columns to its left. Here j counts columns from one.
+  j = n_A;
+
+  while ( j > 1 )
+  {
+    jj = j;
+    jp = buff_p[ (j-1)*inc_p ];
+
+    if ( jp < 0 )
+    {
+      jp = -jp;
+      --j;
+    }
+
+    --j;
+
+    if ( jp != jj && j >= 1 )
+      bl1_dswap( j,
+                 buff_A + (jp-1)*rs_A, cs_A,
+                 buff_A + (jj-1)*rs_A, cs_A );
+  }
+
+  return FLA_SUCCESS;
+}
+
+
+
+FLA_Error FLA_LDLT_piv_shift_pivots( int offset, FLA_Obj p )
+{
+  int* buff_p = FLA_INT_PTR( p );
+  int  m_p    = FLA_Obj_vector_dim( p );
+  int  inc_p  = FLA_Obj_vector_inc( p );
+  int  i;
+
+  // Add offset to each pivot index, keeping the sign that marks the rows
+  // of a 2 x 2 pivot block.
+  for ( i = 0; i < m_p; ++i )
+  {
+    int* pi = buff_p + i*inc_p;
+
+    if ( *pi > 0 ) *pi += offset;
+    else           *pi -= offset;
+  }
+
+  return FLA_SUCCESS;
+}
+
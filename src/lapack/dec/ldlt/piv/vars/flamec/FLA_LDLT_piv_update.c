@@ -0,0 +1,116 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// Update the lower triangle of A as A := A - L W', where W holds L D, a
+// block of columns of W at a time. Each diagonal block is formed in full
+// in a temporary matrix so that the strictly upper triangle of A is left
+// untouched, and the rest of each block of columns is one gemm.
+
+FLA_Error FLA_LDLT_piv_update( FLA_Obj L, FLA_Obj W, FLA_Obj A, fla_gemm_t* cntl )
+{
+  FLA_Obj ATL,   ATR,      A00, A01, A02, 
+          ABL,   ABR,      A10, A11, A12,
+                           A20, A21, A22;
+
+  FLA_Obj LT,              L0,
+          LB,              L1,
+                           L2;
+
+  FLA_Obj WT,              W0,
+          WB,              W1,
+                           W2;
+
+  FLA_Obj T, TTL, TTR,
+             TBL, TBR;
+
+  dim_t b, b_max;
+
+  b_max = FLA_Obj_width( W );
+
+  if ( b_max == 0 || FLA_Obj_length( A ) == 0 ) return FLA_SUCCESS;
+
+  b_max = min( b_max, FLA_Obj_length( A ) );
+
+  FLA_Obj_create( FLA_Obj_datatype( A ), b_max, b_max, 0, 0, &T );
+
+  FLA_Part_2x2( A,    &ATL, &ATR,
+                      &ABL, &ABR,     0, 0, FLA_TL );
+
+  FLA_Part_2x1( L,    &LT, 
+                      &LB,            0, FLA_TOP );
+
+  FLA_Part_2x1( W,    &WT, 
+                      &WB,            0, FLA_TOP );
+
+  while ( FLA_Obj_length( ATL ) < FLA_Obj_length( A ) ){
+
+    b = min( FLA_Obj_length( ABR ), b_max );
+
+    FLA_Repart_2x2_to_3x3( ATL, /**/ ATR,       &A00, /**/ &A01, &A02,
+                        /* ************* */   /* ******************** */
+                                                &A10, /**/ &A11, &A12,
+                           ABL, /**/ ABR,       &A20, /**/ &A21, &A22,
+                           b, b, FLA_BR );
+
+    FLA_Repart_2x1_to_3x1( LT,                &L0, 
+                        /* ** */            /* ** */
+                                              &L1, 
+                           LB,                &L2,        b, FLA_BOTTOM );
+
+    FLA_Repart_2x1_to_3x1( WT,                &W0, 
+                        /* ** */            /* ** */
+                                              &W1, 
+                           WB,                &W2,        b, FLA_BOTTOM );
+
+    /*------------------------------------------------------------*/
+
+    FLA_Part_2x2( T,    &TTL, &TTR,
+                        &TBL, &TBR,     b, b, FLA_TL );
+
+    // TTL = L1 * W1';
+    // A11 = A11 - tril( TTL );
+    FLA_Gemm_internal( FLA_NO_TRANSPOSE, FLA_TRANSPOSE,
+                       FLA_ONE, L1, W1, FLA_ZERO, TTL,
+                       cntl );
+
+    FLA_Axpyrt( FLA_LOWER_TRIANGULAR, FLA_NO_TRANSPOSE,
+                FLA_MINUS_ONE, TTL, A11 );
+
+    // A21 = A21 - L2 * W1';
+    FLA_Gemm_internal( FLA_NO_TRANSPOSE, FLA_TRANSPOSE,
+                       FLA_MINUS_ONE, L2, W1, FLA_ONE, A21,
+                       cntl );
+
+    /*------------------------------------------------------------*/
+
+    FLA_Cont_with_3x3_to_2x2( &ATL, /**/ &ATR,       A00, A01, /**/ A02,
+                                                     A10, A11, /**/ A12,
+                            /* ************** */  /* ****************** */
+                              &ABL, /**/ &ABR,       A20, A21, /**/ A22,
+                              FLA_TL );
+
+    FLA_Cont_with_3x1_to_2x1( &LT,                L0, 
+                                                  L1, 
+                            /* ** */           /* ** */
+                              &LB,                L2,     FLA_TOP );
+
+    FLA_Cont_with_3x1_to_2x1( &WT,                W0, 
+                                                  W1, 
+                            /* ** */           /* ** */
+                              &WB,                W2,     FLA_TOP );
+  }
+
+  FLA_Obj_free( &T );
+
+  return FLA_SUCCESS;
+}
+
@@ -0,0 +1,49 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_LDLT_piv_blk_var1( FLA_Obj A, FLA_Obj p, fla_ldlt_t* cntl );
+
+FLA_Error FLASH_LDLT_piv_var1( FLA_Obj A, FLA_Obj p, FLA_Obj L, FLA_Obj W, FLA_Obj s, fla_ldlt_t* cntl );
+
+FLA_Error FLA_LDLT_piv_opt_var1( FLA_Obj A, FLA_Obj p );
+FLA_Error FLA_LDLT_piv_ops_var1( int m_A,
+                                 float*    buff_A, int rs_A, int cs_A,
+                                 int*      buff_p, int inc_p );
+FLA_Error FLA_LDLT_piv_opd_var1( int m_A,
+                                 double*   buff_A, int rs_A, int cs_A,
+                                 int*      buff_p, int inc_p );
+
+FLA_Error FLA_LDLT_piv_panel( FLA_Obj A, FLA_Obj p, FLA_Obj W, int* kb );
+FLA_Error FLA_LDLT_piv_panel_ops( int m_A,
+                                  int nb,
+                                  float*    buff_A, int rs_A, int cs_A,
+                                  int*      buff_p, int inc_p,
+                                  float*    buff_W, int rs_W, int cs_W,
+                                  int*      kb );
+FLA_Error FLA_LDLT_piv_panel_opd( int m_A,
+                                  int nb,
+                                  double*   buff_A, int rs_A, int cs_A,
+                                  int*      buff_p, int inc_p,
+                                  double*   buff_W, int rs_W, int cs_W,
+                                  int*      kb );
+
+FLA_Error FLA_LDLT_piv_unswap( FLA_Obj A, FLA_Obj p );
+FLA_Error FLA_LDLT_piv_unswap_ops( int n_A,
+                                   float*    buff_A, int rs_A, int cs_A,
+                                   int*      buff_p, int inc_p );
+FLA_Error FLA_LDLT_piv_unswap_opd( int n_A,
+                                   double*   buff_A, int rs_A, int cs_A,
+                                   int*      buff_p, int inc_p );
+
+FLA_Error FLA_LDLT_piv_update( FLA_Obj L, FLA_Obj W, FLA_Obj A, fla_gemm_t* cntl );
+
+FLA_Error FLA_LDLT_piv_shift_pivots( int offset, FLA_Obj p );
@@ -0,0 +1,67 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_lu_t* fla_lu_piv_band_cntl;
+extern fla_lu_t* fla_lu_piv_band_cntl_leaf;
+
+static void FLA_LU_piv_band_zero_fill( dim_t kl, dim_t ku, FLA_Obj A );
+
+FLA_Error FLA_LU_piv_band( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p )
+{
+  FLA_Error r_val;
+  dim_t     b_alg;
+  fla_lu_t* cntl;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_LU_piv_band_check( kl, ku, A, p );
+
+  // The row swaps fill in the kl superdiagonals above the ku-th, which
+  // need not be set on entry.
+  FLA_LU_piv_band_zero_fill( kl, ku, A );
+
+  b_alg = FLA_Blocksize_extract( FLA_Obj_datatype( A ),
+                                 FLA_Cntl_blocksize( fla_lu_piv_band_cntl ) );
+
+  // The blocked variant factors each panel together with the kl rows below
+  // it, so it needs kl >= b_alg to cast most of its work in terms of
+  // level-3 operations. Narrower bands are factored one column at a time.
+  if ( kl < b_alg ) cntl = fla_lu_piv_band_cntl_leaf;
+  else              cntl = fla_lu_piv_band_cntl;
+
+  // Invoke FLA_LU_piv_band_internal() with the appropriate control tree.
+  r_val = FLA_LU_piv_band_internal( kl, ku, A, p, cntl );
+
+  return r_val;
+}
+
+
+
+static void FLA_LU_piv_band_zero_fill( dim_t kl, dim_t ku, FLA_Obj A )
+{
+  dim_t elem_size = FLA_Obj_elem_size( A );
+  dim_t m_A       = FLA_Obj_length( A );
+  dim_t n_A       = FLA_Obj_width( A );
+  dim_t cs_A      = FLA_Obj_col_stride( A );
+  char* buff_A    = ( char* ) FLA_Obj_buffer_at_view( A );
+  dim_t i_first, i_last, j;
+
+  for ( j = ku + 1; j < n_A; ++j )
+  {
+    i_first = min( ( j > ku + kl ? j - ku - kl : 0 ), m_A );
+    i_last  = min( j - ku, m_A );
+
+    memset( buff_A + ( j * cs_A + i_first ) * elem_size, 0,
+            ( i_last - i_first ) * elem_size );
+  }
+}
+
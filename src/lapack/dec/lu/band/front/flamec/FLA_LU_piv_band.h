@@ -0,0 +1,13 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLA_LU_piv_band_vars.h"
+
+FLA_Error FLA_LU_piv_band_internal( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
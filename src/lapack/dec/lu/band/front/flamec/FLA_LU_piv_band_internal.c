@@ -0,0 +1,38 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_LU_piv_band_internal( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p, fla_lu_t* cntl )
+{
+	FLA_Error r_val = FLA_SUCCESS;
+
+	if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+	{
+		FLA_Error e_val = FLA_Check_null_pointer( ( void* ) cntl );
+		FLA_Check_error_code( e_val );
+	}
+
+	if      ( FLA_Cntl_variant( cntl ) == FLA_UNB_OPT_VARIANT5 )
+	{
+		r_val = FLA_LU_piv_band_opt_var5( kl, ku, A, p );
+	}
+	else if ( FLA_Cntl_variant( cntl ) == FLA_BLOCKED_VARIANT5 )
+	{
+		r_val = FLA_LU_piv_band_blk_var5( kl, ku, A, p, cntl );
+	}
+	else
+	{
+		FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+	}
+
+	return r_val;
+}
+
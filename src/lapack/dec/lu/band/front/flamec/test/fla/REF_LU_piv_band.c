@@ -0,0 +1,19 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// The dense LU factorization, which ignores the band structure of A, is
+// the reference against which the band factorization is timed.
+FLA_Error REF_LU_piv_band( FLA_Obj A, FLA_Obj p )
+{
+  return FLA_LU_piv( A, p );
+}
+
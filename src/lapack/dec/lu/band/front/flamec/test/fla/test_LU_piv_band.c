@@ -0,0 +1,123 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#define FLA_ALG_REFERENCE 0
+#define FLA_ALG_FRONT     1
+
+void time_LU_piv_band(
+              int type, int n_repeats, int n, int kl, int ku,
+              FLA_Obj A, FLA_Obj AB, FLA_Obj p, FLA_Obj A_ref,
+              double *dtime, double *diff, double *gflops );
+
+
+int main(int argc, char *argv[])
+{
+  int 
+    datatype,
+    kl_input, ku_input,
+    n, kl, ku,
+    p_first, p_last, p_inc,
+    pp,
+    n_repeats,
+    i, j, k;
+  
+  double
+    dtime,
+    gflops,
+    diff;
+
+  double*
+    buff_A;
+
+  FLA_Obj
+    A, AB, p, A_ref;
+  
+
+  FLA_Init();
+
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c enter problem size first, last, inc:", '%' );
+  scanf( "%d%d%d", &p_first, &p_last, &p_inc );
+  fprintf( stdout, "%c %d %d %d\n", '%', p_first, p_last, p_inc );
+
+  fprintf( stdout, "%c enter kl (-1 means bind to problem size): ", '%' );
+  scanf( "%d", &kl_input );
+  fprintf( stdout, "%c %d\n", '%', kl_input );
+
+  fprintf( stdout, "%c enter ku (-1 means bind to problem size): ", '%' );
+  scanf( "%d", &ku_input );
+  fprintf( stdout, "%c %d\n", '%', ku_input );
+
+
+  fprintf( stdout, "\nclear all;\n\n" );
+
+
+  //datatype = FLA_FLOAT;
+  datatype = FLA_DOUBLE;
+
+  for ( pp = p_first, i = 1; pp <= p_last; pp += p_inc, i += 1 )
+  {
+    n  = pp;
+    kl = kl_input;
+    ku = ku_input;
+
+    if( kl < 0 ) kl = pp / f2c_abs(kl_input);
+    if( ku < 0 ) ku = pp / f2c_abs(ku_input);
+    kl = min( kl, n - 1 );
+    ku = min( ku, n - 1 );
+
+    FLA_Obj_create( datatype, n, n, 0, 0, &A );
+    FLA_Obj_create( datatype, n, n, 0, 0, &A_ref );
+    FLA_Obj_create( datatype, 2 * kl + ku + 1, n, 0, 0, &AB );
+    FLA_Obj_create( FLA_INT, n, 1, 0, 0, &p );
+
+    // Generate a matrix with kl subdiagonals and ku superdiagonals.
+    FLA_Random_matrix( A );
+
+    buff_A = FLA_DOUBLE_PTR( A );
+    for ( j = 0; j < n; ++j )
+      for ( k = 0; k < n; ++k )
+        if ( k - j > kl || j - k > ku ) buff_A[ j * n + k ] = 0.0;
+
+    fprintf( stdout, "data_lu_piv_band( %d, 1:5 ) = [ %d  ", i, n );
+    fflush( stdout );
+
+    time_LU_piv_band( FLA_ALG_REFERENCE, n_repeats, n, kl, ku,
+                      A, AB, p, A_ref, &dtime, &diff, &gflops );
+
+    fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
+    fflush( stdout );
+
+    time_LU_piv_band( FLA_ALG_FRONT, n_repeats, n, kl, ku,
+                      A, AB, p, A_ref, &dtime, &diff, &gflops );
+
+    fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
+    fflush( stdout );
+
+    fprintf( stdout, " ]; \n" );
+    fflush( stdout );
+
+    FLA_Obj_free( &A );
+    FLA_Obj_free( &AB );
+    FLA_Obj_free( &p );
+    FLA_Obj_free( &A_ref );
+  }
+
+  FLA_Finalize( );
+
+  return 0;
+}
+
@@ -0,0 +1,239 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+static void FLA_LU_piv_band_copy( dim_t ku, dim_t kl, FLA_Obj A, FLA_Obj B, FLA_Bool zero_rest );
+static void FLA_LU_piv_band_unswap( FLA_Obj A, FLA_Obj p );
+
+FLA_Error FLA_LU_piv_band_blk_var5( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p, fla_lu_t* cntl )
+{
+  FLA_Error r_val = FLA_SUCCESS, r_val_sub = FLA_SUCCESS;
+  FLA_Obj ATL,   ATR,      A00, A01, A02,
+          ABL,   ABR,      A10, A11, A12,
+                           A20, A21, A22;
+
+  FLA_Obj pT,              p0,
+          pB,              p1,
+                           p2;
+
+  FLA_Obj AW, AWR, AWB, AWBR;
+  FLA_Obj AW1, AW2, AW3, AW2T, AW2B;
+  FLA_Obj DL, DLW, DLR, DLB, DLBR, DL1, DL2;
+  FLA_Obj DR, DRW, DRR, DRB, DRBR, DR1, DR2;
+
+  dim_t b, b_max, m_w, n_w, n_2;
+
+  // Each panel of b columns, with the kl rows below it, is factored in a
+  // dense copy DL. The row swaps fill in the upper bandwidth of U up to
+  // kl + ku, and the b columns that lie beyond it, whose top rows straddle
+  // the edge of the band, are updated in a dense copy DR. The columns in
+  // between lie entirely within the band and are updated in place. Since
+  // b <= kl, only 2 ( b + kl ) b elements are copied for each panel.
+  b_max = FLA_Blocksize_extract( FLA_Obj_datatype( A ),
+                                 FLA_Cntl_blocksize( cntl ) );
+
+  FLA_Obj_create( FLA_Obj_datatype( A ), b_max + kl, b_max, 0, 0, &DL );
+  FLA_Obj_create( FLA_Obj_datatype( A ), b_max + kl, b_max, 0, 0, &DR );
+
+  FLA_Part_2x2( A,    &ATL, &ATR,
+                      &ABL, &ABR,     0, 0, FLA_TL );
+
+  FLA_Part_2x1( p,    &pT,
+                      &pB,            0, FLA_TOP );
+
+  while ( FLA_Obj_length( ATL ) < FLA_Obj_length( A ) &&
+          FLA_Obj_width( ATL ) < FLA_Obj_width( A )){
+
+    b = FLA_Determine_blocksize( ABR, FLA_BR, FLA_Cntl_blocksize( cntl ) );
+
+    FLA_Repart_2x2_to_3x3( ATL, /**/ ATR,       &A00, /**/ &A01, &A02,
+                        /* ************* */   /* ******************** */
+                                                &A10, /**/ &A11, &A12,
+                           ABL, /**/ ABR,       &A20, /**/ &A21, &A22,
+                           b, b, FLA_BR );
+
+    FLA_Repart_2x1_to_3x1( pT,                &p0,
+                        /* ** */            /* ** */
+                                              &p1,
+                           pB,                &p2,        b, FLA_BOTTOM );
+
+    /*------------------------------------------------------------*/
+
+    // The window of A that the panel reaches.
+    m_w = min( b + kl,      FLA_Obj_length( ABR ) );
+    n_w = min( b + kl + ku, FLA_Obj_width( ABR ) );
+    n_2 = min( kl + ku - b, n_w - b );
+
+    FLA_Part_2x2( ABR,    &AW,  &AWR,
+                          &AWB, &AWBR,     m_w, n_w, FLA_TL );
+
+    FLA_Part_1x2( AW,     &AW1, &AW2,      b, FLA_LEFT );
+
+    FLA_Part_1x2( AW2,    &AW2, &AW3,      n_2, FLA_LEFT );
+
+    FLA_Part_2x1( AW2,    &AW2T,
+                          &AW2B,           b, FLA_TOP );
+
+    FLA_Part_2x2( DL,     &DLW, &DLR,
+                          &DLB, &DLBR,     m_w, b, FLA_TL );
+
+    FLA_Part_2x1( DLW,    &DL1,
+                          &DL2,            b, FLA_TOP );
+
+    FLA_Part_2x2( DR,     &DRW, &DRR,
+                          &DRB, &DRBR,     m_w, FLA_Obj_width( AW3 ), FLA_TL );
+
+    FLA_Part_2x1( DRW,    &DR1,
+                          &DR2,            b, FLA_TOP );
+
+    // DLW = band( AW1 ), DRW = band( AW3 )
+    FLA_LU_piv_band_copy( b, kl, AW1, DLW, TRUE );
+    FLA_LU_piv_band_copy( 0, m_w, AW3, DRW, TRUE );
+
+    // DLW, p1 = LU_piv( DLW )
+    r_val_sub = FLA_LU_piv_internal( DLW, p1,
+                                     FLA_Cntl_sub_lu( cntl ) );
+
+    // If the unblocked algorithm returns a null pivot,
+    // update the pivot index and return it.
+    if ( r_val == FLA_SUCCESS && r_val_sub >= 0 )
+    {
+        r_val = FLA_Obj_length( A01 ) + r_val_sub;
+    }
+
+    // Apply computed pivots to AW2 and DRW
+    FLA_Apply_pivots_internal( FLA_LEFT, FLA_NO_TRANSPOSE, p1, AW2,
+                               FLA_Cntl_sub_appiv1( cntl ) );
+
+    FLA_Apply_pivots_internal( FLA_LEFT, FLA_NO_TRANSPOSE, p1, DRW,
+                               FLA_Cntl_sub_appiv1( cntl ) );
+
+    // AW2T = trilu( DL1 ) \ AW2T
+    FLA_Trsm_internal( FLA_LEFT, FLA_LOWER_TRIANGULAR,
+                       FLA_NO_TRANSPOSE, FLA_UNIT_DIAG,
+                       FLA_ONE, DL1, AW2T,
+                       FLA_Cntl_sub_trsm1( cntl ) );
+
+    // DR1 = trilu( DL1 ) \ DR1
+    FLA_Trsm_internal( FLA_LEFT, FLA_LOWER_TRIANGULAR,
+                       FLA_NO_TRANSPOSE, FLA_UNIT_DIAG,
+                       FLA_ONE, DL1, DR1,
+                       FLA_Cntl_sub_trsm1( cntl ) );
+
+    // AW2B = AW2B - DL2 * AW2T
+    FLA_Gemm_internal( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+                       FLA_MINUS_ONE, DL2, AW2T, FLA_ONE, AW2B,
+                       FLA_Cntl_sub_gemm1( cntl ) );
+
+    // DR2 = DR2 - DL2 * DR1
+    FLA_Gemm_internal( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+                       FLA_MINUS_ONE, DL2, DR1, FLA_ONE, DR2,
+                       FLA_Cntl_sub_gemm1( cntl ) );
+
+    // As in LAPACK's band factorization, each column of L keeps its kl
+    // multipliers in the order in which they were computed, so undo the
+    // swaps that later pivots of the panel applied to it.
+    FLA_LU_piv_band_unswap( DLW, p1 );
+
+    // band( AW1 ) = DLW, band( AW3 ) = DRW
+    FLA_LU_piv_band_copy( b, kl, DLW, AW1, FALSE );
+    FLA_LU_piv_band_copy( 0, m_w, DRW, AW3, FALSE );
+
+    /*------------------------------------------------------------*/
+
+    FLA_Cont_with_3x3_to_2x2( &ATL, /**/ &ATR,       A00, A01, /**/ A02,
+                                                     A10, A11, /**/ A12,
+                            /* ************** */  /* ****************** */
+                              &ABL, /**/ &ABR,       A20, A21, /**/ A22,
+                              FLA_TL );
+
+    FLA_Cont_with_3x1_to_2x1( &pT,                p0,
+                                                  p1,
+                            /* ** */           /* ** */
+                              &pB,                p2,     FLA_TOP );
+
+  }
+
+  FLA_Obj_free( &DL );
+  FLA_Obj_free( &DR );
+
+  return r_val;
+}
+
+
+
+static void FLA_LU_piv_band_copy( dim_t ku, dim_t kl, FLA_Obj A, FLA_Obj B, FLA_Bool zero_rest )
+{
+  dim_t elem_size = FLA_Obj_elem_size( A );
+  dim_t m_A       = FLA_Obj_length( A );
+  dim_t n_A       = FLA_Obj_width( A );
+  dim_t cs_A      = FLA_Obj_col_stride( A );
+  dim_t cs_B      = FLA_Obj_col_stride( B );
+  char* buff_A    = ( char* ) FLA_Obj_buffer_at_view( A );
+  char* buff_B    = ( char* ) FLA_Obj_buffer_at_view( B );
+  dim_t i_first, i_last, j;
+
+  // Copy the elements from the ku-th superdiagonal to the kl-th subdiagonal
+  // of A, whose columns are contiguous, to B. The elements outside of the
+  // band of B are set to zero if requested.
+  for ( j = 0; j < n_A; ++j )
+  {
+    char* a_j = buff_A + j * cs_A * elem_size;
+    char* b_j = buff_B + j * cs_B * elem_size;
+
+    i_first = min( ( j > ku ? j - ku : 0 ), m_A );
+    i_last  = max( min( j + kl + 1, m_A ), i_first );
+
+    if ( zero_rest )
+    {
+      memset( b_j, 0, i_first * elem_size );
+      memset( b_j + i_last * elem_size, 0, ( m_A - i_last ) * elem_size );
+    }
+
+    memcpy( b_j + i_first * elem_size,
+            a_j + i_first * elem_size,
+            ( i_last - i_first ) * elem_size );
+  }
+}
+
+
+
+static void FLA_LU_piv_band_unswap( FLA_Obj A, FLA_Obj p )
+{
+  dim_t elem_size = FLA_Obj_elem_size( A );
+  dim_t n_A       = FLA_Obj_width( A );
+  dim_t cs_A      = FLA_Obj_col_stride( A );
+  char* buff_A    = ( char* ) FLA_Obj_buffer_at_view( A );
+  int*  buff_p    = FLA_INT_PTR( p );
+  int   inc_p     = FLA_Obj_vector_inc( p );
+  char  temp[ sizeof( dcomplex ) ];
+  dim_t j, k;
+
+  // Undo the swap of rows k and k + p( k ) in the columns to the left of k,
+  // from the last pivot to the first.
+  for ( k = n_A; k-- > 1; )
+  {
+    int r = buff_p[ k * inc_p ];
+
+    if ( r == 0 ) continue;
+
+    for ( j = 0; j < k; ++j )
+    {
+      char* alpha1 = buff_A + ( j * cs_A + k     ) * elem_size;
+      char* alpha2 = buff_A + ( j * cs_A + k + r ) * elem_size;
+
+      memcpy( temp,   alpha1, elem_size );
+      memcpy( alpha1, alpha2, elem_size );
+      memcpy( alpha2, temp,   elem_size );
+    }
+  }
+}
+
@@ -0,0 +1,405 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_LU_piv_band_opt_var5( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p )
+{
+  FLA_Error    r_val = FLA_SUCCESS;
+  FLA_Datatype datatype;
+  int          m_A, n_A;
+  int          rs_A, cs_A;
+  int          inc_p;
+
+  datatype = FLA_Obj_datatype( A );
+
+  m_A      = FLA_Obj_length( A );
+  n_A      = FLA_Obj_width( A );
+  rs_A     = FLA_Obj_row_stride( A );
+  cs_A     = FLA_Obj_col_stride( A );
+
+  inc_p    = FLA_Obj_vector_inc( p );
+
+  switch ( datatype )
+  {
+    case FLA_FLOAT:
+    {
+      float* buff_A = FLA_FLOAT_PTR( A );
+      int*   buff_p = FLA_INT_PTR( p );
+
+      r_val = FLA_LU_piv_band_ops_var5( kl,
+                                        ku,
+                                        m_A,
+                                        n_A,
+                                        buff_A, rs_A, cs_A,
+                                        buff_p, inc_p );
+
+      break;
+    }
+
+    case FLA_DOUBLE:
+    {
+      double* buff_A = FLA_DOUBLE_PTR( A );
+      int*    buff_p = FLA_INT_PTR( p );
+
+      r_val = FLA_LU_piv_band_opd_var5( kl,
+                                        ku,
+                                        m_A,
+                                        n_A,
+                                        buff_A, rs_A, cs_A,
+                                        buff_p, inc_p );
+
+      break;
+    }
+
+    case FLA_COMPLEX:
+    {
+      scomplex* buff_A = FLA_COMPLEX_PTR( A );
+      int*      buff_p = FLA_INT_PTR( p );
+
+      r_val = FLA_LU_piv_band_opc_var5( kl,
+                                        ku,
+                                        m_A,
+                                        n_A,
+                                        buff_A, rs_A, cs_A,
+                                        buff_p, inc_p );
+
+      break;
+    }
+
+    case FLA_DOUBLE_COMPLEX:
+    {
+      dcomplex* buff_A = FLA_DOUBLE_COMPLEX_PTR( A );
+      int*      buff_p = FLA_INT_PTR( p );
+
+      r_val = FLA_LU_piv_band_opz_var5( kl,
+                                        ku,
+                                        m_A,
+                                        n_A,
+                                        buff_A, rs_A, cs_A,
+                                        buff_p, inc_p );
+
+      break;
+    }
+  }
+
+  return r_val;
+}
+
+
+
+FLA_Error FLA_LU_piv_band_ops_var5( int kl,
+                                    int ku,
+                                    int m_A,
+                                    int n_A,
+                                    float*    buff_A, int rs_A, int cs_A,
+                                    int*      buff_p, int inc_p )
+{
+  FLA_Error r_val   = FLA_SUCCESS;
+  float*    buff_m1 = FLA_FLOAT_PTR( FLA_MINUS_ONE );
+  int       min_m_n = min( m_A, n_A );
+  int       j_last  = 0;
+  int       i;
+
+  for ( i = 0; i < min_m_n; ++i )
+  {
+    float*    alpha11   = buff_A + (i  )*cs_A + (i  )*rs_A;
+    float*    a21       = buff_A + (i  )*cs_A + (i+1)*rs_A;
+    float*    a12t      = buff_A + (i+1)*cs_A + (i  )*rs_A;
+    float*    A22       = buff_A + (i+1)*cs_A + (i+1)*rs_A;
+
+    int*      pi1       = buff_p + i*inc_p;
+
+    int       m_ahead   = min( kl, m_A - i - 1 );
+    int       n_ahead;
+
+    /*------------------------------------------------------------*/
+
+    // Search the kl elements below the diagonal for the pivot.
+    bl1_samax( m_ahead + 1,
+               alpha11, rs_A,
+               pi1 );
+
+    // If a null pivot is encountered, record its index and leave the
+    // column as it is.
+    if ( *( alpha11 + *pi1*rs_A ) == fzero )
+    {
+      if ( r_val == FLA_SUCCESS ) r_val = i;
+      continue;
+    }
+
+    // Each row swapped up so far reaches at most ku columns past its
+    // original diagonal, which bounds the columns that row i of U and the
+    // update of A22 must cover.
+    j_last  = max( j_last, min( i + ku + *pi1, n_A - 1 ) );
+    n_ahead = j_last - i;
+
+    // Swap the pivot row with row i across the columns it reaches.
+    if ( *pi1 != 0 )
+      bl1_sswapv( n_ahead + 1,
+                  alpha11, cs_A,
+                  alpha11 + *pi1*rs_A, cs_A );
+
+    // FLA_Inv_scal_external( alpha11, a21 );
+    bl1_sinvscalv( BLIS1_NO_CONJUGATE,
+                   m_ahead,
+                   alpha11,
+                   a21, rs_A );
+
+    // FLA_Ger_external( FLA_MINUS_ONE, a21, a12t, A22 );
+    bl1_sger( BLIS1_NO_CONJUGATE,
+              BLIS1_NO_CONJUGATE,
+              m_ahead,
+              n_ahead,
+              buff_m1,
+              a21, rs_A,
+              a12t, cs_A,
+              A22, rs_A, cs_A );
+
+    /*------------------------------------------------------------*/
+
+  }
+
+  return r_val;
+}
+
+
+
+FLA_Error FLA_LU_piv_band_opd_var5( int kl,
+                                    int ku,
+                                    int m_A,
+                                    int n_A,
+                                    double*   buff_A, int rs_A, int cs_A,
+                                    int*      buff_p, int inc_p )
+{
+  FLA_Error r_val   = FLA_SUCCESS;
+  double*   buff_m1 = FLA_DOUBLE_PTR( FLA_MINUS_ONE );
+  int       min_m_n = min( m_A, n_A );
+  int       j_last  = 0;
+  int       i;
+
+  for ( i = 0; i < min_m_n; ++i )
+  {
+    double*   alpha11   = buff_A + (i  )*cs_A + (i  )*rs_A;
+    double*   a21       = buff_A + (i  )*cs_A + (i+1)*rs_A;
+    double*   a12t      = buff_A + (i+1)*cs_A + (i  )*rs_A;
+    double*   A22       = buff_A + (i+1)*cs_A + (i+1)*rs_A;
+
+    int*      pi1       = buff_p + i*inc_p;
+
+    int       m_ahead   = min( kl, m_A - i - 1 );
+    int       n_ahead;
+
+    /*------------------------------------------------------------*/
+
+    // Search the kl elements below the diagonal for the pivot.
+    bl1_damax( m_ahead + 1,
+               alpha11, rs_A,
+               pi1 );
+
+    // If a null pivot is encountered, record its index and leave the
+    // column as it is.
+    if ( *( alpha11 + *pi1*rs_A ) == dzero )
+    {
+      if ( r_val == FLA_SUCCESS ) r_val = i;
+      continue;
+    }
+
+    // Each row swapped up so far reaches at most ku columns past its
+    // original diagonal, which bounds the columns that row i of U and the
+    // update of A22 must cover.
+    j_last  = max( j_last, min( i + ku + *pi1, n_A - 1 ) );
+    n_ahead = j_last - i;
+
+    // Swap the pivot row with row i across the columns it reaches.
+    if ( *pi1 != 0 )
+      bl1_dswapv( n_ahead + 1,
+                  alpha11, cs_A,
+                  alpha11 + *pi1*rs_A, cs_A );
+
+    // FLA_Inv_scal_external( alpha11, a21 );
+    bl1_dinvscalv( BLIS1_NO_CONJUGATE,
+                   m_ahead,
+                   alpha11,
+                   a21, rs_A );
+
+    // FLA_Ger_external( FLA_MINUS_ONE, a21, a12t, A22 );
+    bl1_dger( BLIS1_NO_CONJUGATE,
+              BLIS1_NO_CONJUGATE,
+              m_ahead,
+              n_ahead,
+              buff_m1,
+              a21, rs_A,
+              a12t, cs_A,
+              A22, rs_A, cs_A );
+
+    /*------------------------------------------------------------*/
+
+  }
+
+  return r_val;
+}
+
+
+
+FLA_Error FLA_LU_piv_band_opc_var5( int kl,
+                                    int ku,
+                                    int m_A,
+                                    int n_A,
+                                    scomplex* buff_A, int rs_A, int cs_A,
+                                    int*      buff_p, int inc_p )
+{
+  FLA_Error r_val   = FLA_SUCCESS;
+  scomplex* buff_m1 = FLA_COMPLEX_PTR( FLA_MINUS_ONE );
+  int       min_m_n = min( m_A, n_A );
+  int       j_last  = 0;
+  int       i;
+
+  for ( i = 0; i < min_m_n; ++i )
+  {
+    scomplex* alpha11   = buff_A + (i  )*cs_A + (i  )*rs_A;
+    scomplex* a21       = buff_A + (i  )*cs_A + (i+1)*rs_A;
+    scomplex* a12t      = buff_A + (i+1)*cs_A + (i  )*rs_A;
+    scomplex* A22       = buff_A + (i+1)*cs_A + (i+1)*rs_A;
+
+    int*      pi1       = buff_p + i*inc_p;
+
+    int       m_ahead   = min( kl, m_A - i - 1 );
+    int       n_ahead;
+
+    /*------------------------------------------------------------*/
+
+    // Search the kl elements below the diagonal for the pivot.
+    bl1_camax( m_ahead + 1,
+               alpha11, rs_A,
+               pi1 );
+
+    // If a null pivot is encountered, record its index and leave the
+    // column as it is.
+    if ( ( alpha11 + *pi1*rs_A )->real == czero.real &&
+         ( alpha11 + *pi1*rs_A )->imag == czero.imag )
+    {
+      if ( r_val == FLA_SUCCESS ) r_val = i;
+      continue;
+    }
+
+    // Each row swapped up so far reaches at most ku columns past its
+    // original diagonal, which bounds the columns that row i of U and the
+    // update of A22 must cover.
+    j_last  = max( j_last, min( i + ku + *pi1, n_A - 1 ) );
+    n_ahead = j_last - i;
+
+    // Swap the pivot row with row i across the columns it reaches.
+    if ( *pi1 != 0 )
+      bl1_cswapv( n_ahead + 1,
+                  alpha11, cs_A,
+                  alpha11 + *pi1*rs_A, cs_A );
+
+    // FLA_Inv_scal_external( alpha11, a21 );
+    bl1_cinvscalv( BLIS1_NO_CONJUGATE,
+                   m_ahead,
+                   alpha11,
+                   a21, rs_A );
+
+    // FLA_Ger_external( FLA_MINUS_ONE, a21, a12t, A22 );
+    bl1_cger( BLIS1_NO_CONJUGATE,
+              BLIS1_NO_CONJUGATE,
+              m_ahead,
+              n_ahead,
+              buff_m1,
+              a21, rs_A,
+              a12t, cs_A,
+              A22, rs_A, cs_A );
+
+    /*------------------------------------------------------------*/
+
+  }
+
+  return r_val;
+}
+
+
+
+FLA_Error FLA_LU_piv_band_opz_var5( int kl,
+                                    int ku,
+                                    int m_A,
+                                    int n_A,
+                                    dcomplex* buff_A, int rs_A, int cs_A,
+                                    int*      buff_p, int inc_p )
+{
+  FLA_Error r_val   = FLA_SUCCESS;
+  dcomplex* buff_m1 = FLA_DOUBLE_COMPLEX_PTR( FLA_MINUS_ONE );
+  int       min_m_n = min( m_A, n_A );
+  int       j_last  = 0;
+  int       i;
+
+  for ( i = 0; i < min_m_n; ++i )
+  {
+    dcomplex* alpha11   = buff_A + (i  )*cs_A + (i  )*rs_A;
+    dcomplex* a21       = buff_A + (i  )*cs_A + (i+1)*rs_A;
+    dcomplex* a12t      = buff_A + (i+1)*cs_A + (i  )*rs_A;
+    dcomplex* A22       = buff_A + (i+1)*cs_A + (i+1)*rs_A;
+
+    int*      pi1       = buff_p + i*inc_p;
+
+    int       m_ahead   = min( kl, m_A - i - 1 );
+    int       n_ahead;
+
+    /*------------------------------------------------------------*/
+
+    // Search the kl elements below the diagonal for the pivot.
+    bl1_zamax( m_ahead + 1,
+               alpha11, rs_A,
+               pi1 );
+
+    // If a null pivot is encountered, record its index and leave the
+    // column as it is.
+    if ( ( alpha11 + *pi1*rs_A )->real == zzero.real &&
+         ( alpha11 + *pi1*rs_A )->imag == zzero.imag )
+    {
+      if ( r_val == FLA_SUCCESS ) r_val = i;
+      continue;
+    }
+
+    // Each row swapped up so far reaches at most ku columns past its
+    // original diagonal, which bounds the columns that row i of U and the
+    // update of A22 must cover.
+    j_last  = max( j_last, min( i + ku + *pi1, n_A - 1 ) );
+    n_ahead = j_last - i;
+
+    // Swap the pivot row with row i across the columns it reaches.
+    if ( *pi1 != 0 )
+      bl1_zswapv( n_ahead + 1,
+                  alpha11, cs_A,
+                  alpha11 + *pi1*rs_A, cs_A );
+
+    // FLA_Inv_scal_external( alpha11, a21 );
+    bl1_zinvscalv( BLIS1_NO_CONJUGATE,
+                   m_ahead,
+                   alpha11,
+                   a21, rs_A );
+
+    // FLA_Ger_external( FLA_MINUS_ONE, a21, a12t, A22 );
+    bl1_zger( BLIS1_NO_CONJUGATE,
+              BLIS1_NO_CONJUGATE,
+              m_ahead,
+              n_ahead,
+              buff_m1,
+              a21, rs_A,
+              a12t, cs_A,
+              A22, rs_A, cs_A );
+
+    /*------------------------------------------------------------*/
+
+  }
+
+  return r_val;
+}
+
@@ -0,0 +1,39 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_LU_piv_band_blk_var5( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
+
+FLA_Error FLA_LU_piv_band_opt_var5( dim_t kl, dim_t ku, FLA_Obj A, FLA_Obj p );
+FLA_Error FLA_LU_piv_band_ops_var5( int kl,
+                                    int ku,
+                                    int m_A,
+                                    int n_A,
+                                    float*    A, int rs_A, int cs_A,
+                                    int*      p, int inc_p );
+FLA_Error FLA_LU_piv_band_opd_var5( int kl,
+                                    int ku,
+                                    int m_A,
+                                    int n_A,
+                                    double*   A, int rs_A, int cs_A,
+                                    int*      p, int inc_p );
+FLA_Error FLA_LU_piv_band_opc_var5( int kl,
+                                    int ku,
+                                    int m_A,
+                                    int n_A,
+                                    scomplex* A, int rs_A, int cs_A,
+                                    int*      p, int inc_p );
+FLA_Error FLA_LU_piv_band_opz_var5( int kl,
+                                    int ku,
+                                    int m_A,
+                                    int n_A,
+                                    dcomplex* A, int rs_A, int cs_A,
+                                    int*      p, int inc_p );
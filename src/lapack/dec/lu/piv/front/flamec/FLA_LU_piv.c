@@ -12,17 +12,65 @@
 
 extern fla_lu_t* fla_lu_piv_cntl;
 extern fla_lu_t* fla_lu_piv_cntl2;
+extern fla_lu_t* fla_lu_piv_cntl_leaf;
+extern double    fla_lu_piv_var5_in_to_ou_bsize_ratio;
 
 FLA_Error FLA_LU_piv( FLA_Obj A, FLA_Obj p )
 {
-  FLA_Error r_val = FLA_SUCCESS;
+  FLA_Error       r_val = FLA_SUCCESS;
+  FLA_Datatype    datatype;
+  dim_t           min_m_n, n_levels;
+  dim_t           b_alg, b_alg_in;
+  fla_lu_t*       cntl;
+  fla_lu_t        cntl_size, cntl_size_in;
+  fla_blocksize_t bsize, bsize_in;
 
   // Check parameters.
   if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
     FLA_LU_piv_check( A, p );
 
-  // Invoke FLA_LU_piv_internal() with large control tree.
-  r_val = FLA_LU_piv_internal( A, p, fla_lu_piv_cntl2 );
+  datatype = FLA_Obj_datatype( A );
+  min_m_n  = FLA_Obj_min_dim( A );
+
+  // Look up the number of algorithmic levels and the blocksize for a
+  // problem of this size in the (possibly tuned) decision table.
+  n_levels = FLA_Tune_get_for_size( datatype, FLA_TUNE_LU_PIV, FLA_TUNE_N_LEVELS, min_m_n );
+  b_alg    = FLA_Tune_get_for_size( datatype, FLA_TUNE_LU_PIV, FLA_TUNE_B_ALG,    min_m_n );
+
+  // Small problems go straight to the unblocked variant, while larger ones
+  // are blocked once, or twice with a smaller inner blocksize.
+  if      ( n_levels <= 1 ) cntl = fla_lu_piv_cntl_leaf;
+  else if ( n_levels == 2 ) cntl = fla_lu_piv_cntl;
+  else                      cntl = fla_lu_piv_cntl2;
+
+  // When the table gives this problem a blocksize other than the one the
+  // control tree was created with, use a copy of the tree whose blocked
+  // levels block accordingly.
+  if ( n_levels >= 2 &&
+       b_alg != FLA_Blocksize_extract( datatype, FLA_Cntl_blocksize( cntl ) ) )
+  {
+    FLA_Blocksize_set( &bsize, b_alg, b_alg, b_alg, b_alg );
+
+    cntl_size           = *cntl;
+    cntl_size.blocksize = &bsize;
+
+    if ( n_levels >= 3 )
+    {
+      b_alg_in = max( ( dim_t )( ( double ) b_alg * fla_lu_piv_var5_in_to_ou_bsize_ratio ), 1 );
+
+      FLA_Blocksize_set( &bsize_in, b_alg_in, b_alg_in, b_alg_in, b_alg_in );
+
+      cntl_size_in           = *FLA_Cntl_sub_lu( cntl );
+      cntl_size_in.blocksize = &bsize_in;
+
+      cntl_size.sub_lu       = &cntl_size_in;
+    }
+
+    cntl = &cntl_size;
+  }
+
+  // Invoke FLA_LU_piv_internal() with the appropriate control tree.
+  r_val = FLA_LU_piv_internal( A, p, cntl );
 
   // This is invalid as FLA_LU_piv_internal returns a null pivot index.
   // Check for singularity.
@@ -10,6 +10,11 @@
 
 #include "FLA_LU_piv_vars.h"
 
+// The number of problems that FLA_LU_piv_batched() factors together, and
+// the largest problem that it factors this way.
+#define FLA_LU_PIV_BATCHED_N_LANES          8
+#define FLA_LU_PIV_BATCHED_MAX_INTERLEAVE  16
+
 FLA_Error FLA_LU_piv_internal( FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
 
 FLA_Error FLA_LU_piv_solve( FLA_Obj A, FLA_Obj p, FLA_Obj B, FLA_Obj X );
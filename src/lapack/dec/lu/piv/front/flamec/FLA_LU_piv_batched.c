@@ -0,0 +1,478 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// A batch is given either as arrays of sizes, buffers, leading dimensions
+// and pivot vectors (buff_A != NULL), or as buff_A_s and buff_p_s with one
+// size and leading dimension and fixed strides, in elements, between the
+// problems. The pivots are stored as FLA_LU_piv() stores them, so each
+// problem may be solved with FLA_Apply_pivots() and two triangular solves.
+
+typedef struct FLA_LU_piv_batched_vars_s
+{
+  FLA_Datatype datatype;
+  dim_t        elem_size;
+  int*         m_A;
+  int*         n_A;
+  void**       buff_A;
+  int*         ldim_A;
+  int**        buff_p;
+  int          m_A_s;
+  int          n_A_s;
+  void*        buff_A_s;
+  int          ldim_A_s;
+  int          stride_A;
+  int*         buff_p_s;
+  int          stride_p;
+  FLA_Error*   r_val;
+} FLA_LU_piv_batched_vars;
+
+static FLA_Error FLA_LU_piv_batched_run( FLA_LU_piv_batched_vars* vars, int n_batch );
+static void      FLA_LU_piv_batched_range( int i_first, int n_batch, void* args );
+static FLA_Error FLA_LU_piv_batched_single( FLA_LU_piv_batched_vars* vars, int i );
+static void      FLA_LU_piv_batched_ilv_ops( FLA_LU_piv_batched_vars* vars, int i_first, float* buff_W );
+static void      FLA_LU_piv_batched_ilv_opd( FLA_LU_piv_batched_vars* vars, int i_first, double* buff_W );
+
+static int FLA_LU_piv_batched_m( FLA_LU_piv_batched_vars* vars, int i )
+{
+  return ( vars->buff_A != NULL ? vars->m_A[i] : vars->m_A_s );
+}
+
+static int FLA_LU_piv_batched_n( FLA_LU_piv_batched_vars* vars, int i )
+{
+  return ( vars->buff_A != NULL ? vars->n_A[i] : vars->n_A_s );
+}
+
+static int FLA_LU_piv_batched_ldim( FLA_LU_piv_batched_vars* vars, int i )
+{
+  return ( vars->buff_A != NULL ? vars->ldim_A[i] : vars->ldim_A_s );
+}
+
+static void* FLA_LU_piv_batched_buff( FLA_LU_piv_batched_vars* vars, int i )
+{
+  return ( vars->buff_A != NULL ? vars->buff_A[i]
+                                : ( char* ) vars->buff_A_s +
+                                  ( size_t ) i * vars->stride_A * vars->elem_size );
+}
+
+static int* FLA_LU_piv_batched_p( FLA_LU_piv_batched_vars* vars, int i )
+{
+  return ( vars->buff_A != NULL ? vars->buff_p[i]
+                                : vars->buff_p_s + ( size_t ) i * vars->stride_p );
+}
+
+
+FLA_Error FLA_LU_piv_batched( FLA_Datatype datatype, int n_batch, int* m_A, int* n_A, void** buff_A, int* ldim_A, int** buff_p, FLA_Error* r_val )
+{
+  FLA_LU_piv_batched_vars vars;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+  {
+    FLA_Check_error_code( FLA_Check_floating_datatype( datatype ) );
+
+    if ( n_batch > 0 )
+    {
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) m_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) n_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) buff_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) ldim_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) buff_p ) );
+    }
+  }
+
+  vars.datatype  = datatype;
+  vars.elem_size = FLA_Obj_datatype_size( datatype );
+  vars.m_A       = m_A;
+  vars.n_A       = n_A;
+  vars.buff_A    = buff_A;
+  vars.ldim_A    = ldim_A;
+  vars.buff_p    = buff_p;
+  vars.r_val     = r_val;
+
+  return FLA_LU_piv_batched_run( &vars, n_batch );
+}
+
+
+FLA_Error FLA_LU_piv_batched_strided( FLA_Datatype datatype, int n_batch, int m_A, int n_A, void* buff_A, int ldim_A, int stride_A, int* buff_p, int stride_p, FLA_Error* r_val )
+{
+  FLA_LU_piv_batched_vars vars;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+  {
+    FLA_Check_error_code( FLA_Check_floating_datatype( datatype ) );
+
+    if ( n_batch > 0 )
+    {
+      FLA_Check_error_code( FLA_Check_null_pointer( buff_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) buff_p ) );
+    }
+  }
+
+  vars.datatype  = datatype;
+  vars.elem_size = FLA_Obj_datatype_size( datatype );
+  vars.buff_A    = NULL;
+  vars.m_A_s     = m_A;
+  vars.n_A_s     = n_A;
+  vars.buff_A_s  = buff_A;
+  vars.ldim_A_s  = ldim_A;
+  vars.stride_A  = stride_A;
+  vars.buff_p_s  = buff_p;
+  vars.stride_p  = stride_p;
+  vars.r_val     = r_val;
+
+  return FLA_LU_piv_batched_run( &vars, n_batch );
+}
+
+
+static FLA_Error FLA_LU_piv_batched_run( FLA_LU_piv_batched_vars* vars, int n_batch )
+{
+  FLA_Error* r_val_user = vars->r_val;
+  FLA_Error  r_val      = FLA_SUCCESS;
+  int        i;
+
+  if ( n_batch <= 0 ) return FLA_SUCCESS;
+
+  if ( r_val_user == NULL )
+    vars->r_val = ( FLA_Error* ) FLA_malloc( n_batch * sizeof( FLA_Error ) );
+
+  FLA_Batch_run( n_batch, FLA_LU_PIV_BATCHED_N_LANES, FLA_LU_piv_batched_range, ( void* ) vars );
+
+  for ( i = 0; i < n_batch; ++i )
+    if ( vars->r_val[i] != FLA_SUCCESS ) r_val = FLA_FAILURE;
+
+  if ( r_val_user == NULL )
+    FLA_free( vars->r_val );
+
+  return r_val;
+}
+
+
+static void FLA_LU_piv_batched_range( int i_first, int n_batch, void* args )
+{
+  FLA_LU_piv_batched_vars* vars    = ( FLA_LU_piv_batched_vars* ) args;
+  int                      n_lanes = FLA_LU_PIV_BATCHED_N_LANES;
+  int                      i_last  = i_first + n_batch;
+  int                      i, k, m, n, is_uniform;
+  void*                    buff_W  = NULL;
+
+  // Only real problems are interleaved; complex ones go one at a time to
+  // the unblocked kernels.
+  if ( vars->datatype == FLA_FLOAT || vars->datatype == FLA_DOUBLE )
+    buff_W = FLA_malloc( n_lanes * FLA_LU_PIV_BATCHED_MAX_INTERLEAVE *
+                         FLA_LU_PIV_BATCHED_MAX_INTERLEAVE * vars->elem_size );
+
+  i = i_first;
+
+  while ( i < i_last )
+  {
+    // Factor the next n_lanes problems together if they are the same size
+    // and small enough that the interleaved copy stays in cache.
+    m          = FLA_LU_piv_batched_m( vars, i );
+    n          = FLA_LU_piv_batched_n( vars, i );
+    is_uniform = ( buff_W != NULL && i + n_lanes <= i_last &&
+                   min( m, n ) > 1 &&
+                   m <= FLA_LU_PIV_BATCHED_MAX_INTERLEAVE &&
+                   n <= FLA_LU_PIV_BATCHED_MAX_INTERLEAVE );
+
+    for ( k = 1; k < n_lanes && is_uniform; ++k )
+      is_uniform = ( FLA_LU_piv_batched_m( vars, i + k ) == m &&
+                     FLA_LU_piv_batched_n( vars, i + k ) == n );
+
+    if ( is_uniform )
+    {
+      if ( vars->datatype == FLA_FLOAT )
+        FLA_LU_piv_batched_ilv_ops( vars, i, ( float* ) buff_W );
+      else
+        FLA_LU_piv_batched_ilv_opd( vars, i, ( double* ) buff_W );
+
+      i += n_lanes;
+    }
+    else
+    {
+      vars->r_val[i] = FLA_LU_piv_batched_single( vars, i );
+
+      i += 1;
+    }
+  }
+
+  if ( buff_W != NULL )
+    FLA_free( buff_W );
+}
+
+
+static FLA_Error FLA_LU_piv_batched_single( FLA_LU_piv_batched_vars* vars, int i )
+{
+  FLA_Error r_val  = FLA_SUCCESS;
+  int       m_A    = FLA_LU_piv_batched_m( vars, i );
+  int       n_A    = FLA_LU_piv_batched_n( vars, i );
+  int       cs_A   = FLA_LU_piv_batched_ldim( vars, i );
+  void*     buff_A = FLA_LU_piv_batched_buff( vars, i );
+  int*      buff_p = FLA_LU_piv_batched_p( vars, i );
+
+  switch ( vars->datatype )
+  {
+    case FLA_FLOAT:
+      r_val = FLA_LU_piv_ops_var5( m_A, n_A, ( float* ) buff_A, 1, cs_A, buff_p, 1 );
+      break;
+
+    case FLA_DOUBLE:
+      r_val = FLA_LU_piv_opd_var5( m_A, n_A, ( double* ) buff_A, 1, cs_A, buff_p, 1 );
+      break;
+
+    case FLA_COMPLEX:
+      r_val = FLA_LU_piv_opc_var5( m_A, n_A, ( scomplex* ) buff_A, 1, cs_A, buff_p, 1 );
+      break;
+
+    case FLA_DOUBLE_COMPLEX:
+      r_val = FLA_LU_piv_opz_var5( m_A, n_A, ( dcomplex* ) buff_A, 1, cs_A, buff_p, 1 );
+      break;
+  }
+
+  return r_val;
+}
+
+
+// The interleaved kernels copy n_lanes problems into W so that element
+// (i,j) of every problem lies in n_lanes consecutive entries, and then
+// factor all of them with the right-looking algorithm (variant 5). The
+// search for the pivot, the scaling and the rank-1 update are vectorized
+// across the problems, while the rows are swapped in each problem on its
+// own. As in the unblocked kernels, a column without a nonzero pivot is
+// neither permuted nor scaled, and the index of the first such column is
+// returned.
+
+static void FLA_LU_piv_batched_ilv_ops( FLA_LU_piv_batched_vars* vars, int i_first, float* buff_W )
+{
+  int    n_lanes = FLA_LU_PIV_BATCHED_N_LANES;
+  int    m_A     = FLA_LU_piv_batched_m( vars, i_first );
+  int    n_A     = FLA_LU_piv_batched_n( vars, i_first );
+  int    min_m_n = min( m_A, n_A );
+  float* buff_A[FLA_LU_PIV_BATCHED_N_LANES];
+  int    cs_A[FLA_LU_PIV_BATCHED_N_LANES];
+  int*   buff_p[FLA_LU_PIV_BATCHED_N_LANES];
+  int    e_val[FLA_LU_PIV_BATCHED_N_LANES];
+  int    i_piv[FLA_LU_PIV_BATCHED_N_LANES];
+  float  abs_piv[FLA_LU_PIV_BATCHED_N_LANES];
+  float  inv_alpha11[FLA_LU_PIV_BATCHED_N_LANES];
+  int    i, j, l, k;
+
+  for ( k = 0; k < n_lanes; ++k )
+  {
+    buff_A[k] = ( float* ) FLA_LU_piv_batched_buff( vars, i_first + k );
+    cs_A[k]   = FLA_LU_piv_batched_ldim( vars, i_first + k );
+    buff_p[k] = FLA_LU_piv_batched_p( vars, i_first + k );
+    e_val[k]  = FLA_SUCCESS;
+  }
+
+  for ( j = 0; j < n_A; ++j )
+    for ( i = 0; i < m_A; ++i )
+      for ( k = 0; k < n_lanes; ++k )
+        buff_W[ ( j*m_A + i )*n_lanes + k ] = buff_A[k][ i + j*cs_A[k] ];
+
+  for ( j = 0; j < min_m_n; ++j )
+  {
+    float* alpha11 = buff_W + ( j*m_A + j )*n_lanes;
+
+    // Find the entry of largest magnitude in alpha11 and a21.
+    for ( k = 0; k < n_lanes; ++k )
+    {
+      abs_piv[k] = fabsf( alpha11[k] );
+      i_piv[k]   = 0;
+    }
+
+    for ( i = j + 1; i < m_A; ++i )
+    {
+      float* alpha21 = buff_W + ( j*m_A + i )*n_lanes;
+
+      for ( k = 0; k < n_lanes; ++k )
+      {
+        float abs_alpha21 = fabsf( alpha21[k] );
+
+        i_piv[k]   = ( abs_alpha21 > abs_piv[k] ? i - j       : i_piv[k] );
+        abs_piv[k] = ( abs_alpha21 > abs_piv[k] ? abs_alpha21 : abs_piv[k] );
+      }
+    }
+
+    // Swap the pivot row into place across the whole problem.
+    for ( k = 0; k < n_lanes; ++k )
+    {
+      buff_p[k][j] = i_piv[k];
+
+      if ( abs_piv[k] == 0.0F )
+      {
+        if ( e_val[k] == FLA_SUCCESS ) e_val[k] = j;
+      }
+      else if ( i_piv[k] != 0 )
+      {
+        for ( l = 0; l < n_A; ++l )
+        {
+          float* alpha_j = buff_W + ( l*m_A + j            )*n_lanes + k;
+          float* alpha_p = buff_W + ( l*m_A + j + i_piv[k] )*n_lanes + k;
+          float  temp    = *alpha_j;
+
+          *alpha_j = *alpha_p;
+          *alpha_p = temp;
+        }
+      }
+
+      inv_alpha11[k] = ( abs_piv[k] == 0.0F ? 1.0F : 1.0F / alpha11[k] );
+    }
+
+    // a21 = a21 / alpha11
+    for ( i = j + 1; i < m_A; ++i )
+    {
+      float* alpha21 = buff_W + ( j*m_A + i )*n_lanes;
+
+      for ( k = 0; k < n_lanes; ++k )
+        alpha21[k] *= inv_alpha11[k];
+    }
+
+    // A22 = A22 - a21 * a12t
+    for ( l = j + 1; l < n_A; ++l )
+    {
+      float* alpha12 = buff_W + ( l*m_A + j )*n_lanes;
+
+      for ( i = j + 1; i < m_A; ++i )
+      {
+        float* alpha21 = buff_W + ( j*m_A + i )*n_lanes;
+        float* alpha22 = buff_W + ( l*m_A + i )*n_lanes;
+
+        for ( k = 0; k < n_lanes; ++k )
+          alpha22[k] -= alpha21[k] * alpha12[k];
+      }
+    }
+  }
+
+  for ( k = 0; k < n_lanes; ++k )
+  {
+    for ( j = 0; j < n_A; ++j )
+      for ( i = 0; i < m_A; ++i )
+        buff_A[k][ i + j*cs_A[k] ] = buff_W[ ( j*m_A + i )*n_lanes + k ];
+
+    vars->r_val[ i_first + k ] = e_val[k];
+  }
+}
+
+
+static void FLA_LU_piv_batched_ilv_opd( FLA_LU_piv_batched_vars* vars, int i_first, double* buff_W )
+{
+  int     n_lanes = FLA_LU_PIV_BATCHED_N_LANES;
+  int     m_A     = FLA_LU_piv_batched_m( vars, i_first );
+  int     n_A     = FLA_LU_piv_batched_n( vars, i_first );
+  int     min_m_n = min( m_A, n_A );
+  double* buff_A[FLA_LU_PIV_BATCHED_N_LANES];
+  int     cs_A[FLA_LU_PIV_BATCHED_N_LANES];
+  int*    buff_p[FLA_LU_PIV_BATCHED_N_LANES];
+  int     e_val[FLA_LU_PIV_BATCHED_N_LANES];
+  int     i_piv[FLA_LU_PIV_BATCHED_N_LANES];
+  double  abs_piv[FLA_LU_PIV_BATCHED_N_LANES];
+  double  inv_alpha11[FLA_LU_PIV_BATCHED_N_LANES];
+  int     i, j, l, k;
+
+  for ( k = 0; k < n_lanes; ++k )
+  {
+    buff_A[k] = ( double* ) FLA_LU_piv_batched_buff( vars, i_first + k );
+    cs_A[k]   = FLA_LU_piv_batched_ldim( vars, i_first + k );
+    buff_p[k] = FLA_LU_piv_batched_p( vars, i_first + k );
+    e_val[k]  = FLA_SUCCESS;
+  }
+
+  for ( j = 0; j < n_A; ++j )
+    for ( i = 0; i < m_A; ++i )
+      for ( k = 0; k < n_lanes; ++k )
+        buff_W[ ( j*m_A + i )*n_lanes + k ] = buff_A[k][ i + j*cs_A[k] ];
+
+  for ( j = 0; j < min_m_n; ++j )
+  {
+    double* alpha11 = buff_W + ( j*m_A + j )*n_lanes;
+
+    // Find the entry of largest magnitude in alpha11 and a21.
+    for ( k = 0; k < n_lanes; ++k )
+    {
+      abs_piv[k] = fabs( alpha11[k] );
+      i_piv[k]   = 0;
+    }
+
+    for ( i = j + 1; i < m_A; ++i )
+    {
+      double* alpha21 = buff_W + ( j*m_A + i )*n_lanes;
+
+      for ( k = 0; k < n_lanes; ++k )
+      {
+        double abs_alpha21 = fabs( alpha21[k] );
+
+        i_piv[k]   = ( abs_alpha21 > abs_piv[k] ? i - j       : i_piv[k] );
+        abs_piv[k] = ( abs_alpha21 > abs_piv[k] ? abs_alpha21 : abs_piv[k] );
+      }
+    }
+
+    // Swap the pivot row into place across the whole problem.
+    for ( k = 0; k < n_lanes; ++k )
+    {
+      buff_p[k][j] = i_piv[k];
+
+      if ( abs_piv[k] == 0.0 )
+      {
+        if ( e_val[k] == FLA_SUCCESS ) e_val[k] = j;
+      }
+      else if ( i_piv[k] != 0 )
+      {
+        for ( l = 0; l < n_A; ++l )
+        {
+          double* alpha_j = buff_W + ( l*m_A + j            )*n_lanes + k;
+          double* alpha_p = buff_W + ( l*m_A + j + i_piv[k] )*n_lanes + k;
+          double  temp    = *alpha_j;
+
+          *alpha_j = *alpha_p;
+          *alpha_p = temp;
+        }
+      }
+
+      inv_alpha11[k] = ( abs_piv[k] == 0.0 ? 1.0 : 1.0 / alpha11[k] );
+    }
+
+    // a21 = a21 / alpha11
+    for ( i = j + 1; i < m_A; ++i )
+    {
+      double* alpha21 = buff_W + ( j*m_A + i )*n_lanes;
+
+      for ( k = 0; k < n_lanes; ++k )
+        alpha21[k] *= inv_alpha11[k];
+    }
+
+    // A22 = A22 - a21 * a12t
+    for ( l = j + 1; l < n_A; ++l )
+    {
+      double* alpha12 = buff_W + ( l*m_A + j )*n_lanes;
+
+      for ( i = j + 1; i < m_A; ++i )
+      {
+        double* alpha21 = buff_W + ( j*m_A + i )*n_lanes;
+        double* alpha22 = buff_W + ( l*m_A + i )*n_lanes;
+
+        for ( k = 0; k < n_lanes; ++k )
+          alpha22[k] -= alpha21[k] * alpha12[k];
+      }
+    }
+  }
+
+  for ( k = 0; k < n_lanes; ++k )
+  {
+    for ( j = 0; j < n_A; ++j )
+      for ( i = 0; i < m_A; ++i )
+        buff_A[k][ i + j*cs_A[k] ] = buff_W[ ( j*m_A + i )*n_lanes + k ];
+
+    vars->r_val[ i_first + k ] = e_val[k];
+  }
+}
+
@@ -112,6 +112,10 @@ FLA_Error FLA_LU_piv_internal( FLA_Obj A, FLA_Obj p, fla_lu_t* cntl )
 		{
 			r_val = FLA_LU_piv_blk_var5( A, p, cntl );
 		}
+		else if ( FLA_Cntl_variant( cntl ) == FLA_RECURSIVE_VARIANT1 )
+		{
+			r_val = FLA_LU_piv_rec_var1( A, p, cntl );
+		}
 		else
 		{
 			FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
@@ -0,0 +1,91 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_LU_piv_rec_var1( FLA_Obj A, FLA_Obj p, fla_lu_t* cntl )
+{
+  FLA_Error r_val = FLA_SUCCESS, r_val_sub = FLA_SUCCESS;
+  FLA_Obj ATL,   ATR,
+          ABL,   ABR;
+
+  FLA_Obj pT,
+          pB;
+
+  FLA_Obj AL, AR;
+
+  dim_t min_m_n, n1, b;
+
+  min_m_n = FLA_Obj_min_dim( A );
+  b       = FLA_Blocksize_extract( FLA_Obj_datatype( A ),
+                                   FLA_Cntl_blocksize( cntl ) );
+
+  // Factor the base case, which is at most b columns wide, with the
+  // subproblem control tree.
+  if ( min_m_n <= b || min_m_n < 2 )
+    return FLA_LU_piv_internal( A, p, FLA_Cntl_sub_lu( cntl ) );
+
+  // Split the columns in half. The halves are cut down recursively until
+  // every panel fits in cache, whatever its size, while the updates in
+  // between are cast in terms of ever larger trsm and gemm.
+  n1 = min_m_n / 2;
+
+  FLA_Part_2x2( A,    &ATL, &ATR,
+                      &ABL, &ABR,     n1, n1, FLA_TL );
+
+  FLA_Part_2x1( p,    &pT,
+                      &pB,            n1, FLA_TOP );
+
+  // AL = / ATL \
+  //      \ ABL /
+  FLA_Merge_2x1( ATL,
+                 ABL,      &AL );
+
+  // AR = / ATR \
+  //      \ ABR /
+  FLA_Merge_2x1( ATR,
+                 ABR,      &AR );
+
+  // AL, pT = LU_piv( AL )
+  r_val_sub = FLA_LU_piv_internal( AL, pT, cntl );
+
+  if ( r_val_sub >= 0 )
+    r_val = r_val_sub;
+
+  // Apply computed pivots to AR
+  FLA_Apply_pivots_internal( FLA_LEFT, FLA_NO_TRANSPOSE, pT, AR,
+                             FLA_Cntl_sub_appiv1( cntl ) );
+
+  // ATR = trilu( ATL ) \ ATR
+  FLA_Trsm_internal( FLA_LEFT, FLA_LOWER_TRIANGULAR,
+                     FLA_NO_TRANSPOSE, FLA_UNIT_DIAG,
+                     FLA_ONE, ATL, ATR,
+                     FLA_Cntl_sub_trsm1( cntl ) );
+
+  // ABR = ABR - ABL * ATR
+  FLA_Gemm_internal( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+                     FLA_MINUS_ONE, ABL, ATR, FLA_ONE, ABR,
+                     FLA_Cntl_sub_gemm1( cntl ) );
+
+  // ABR, pB = LU_piv( ABR )
+  r_val_sub = FLA_LU_piv_internal( ABR, pB, cntl );
+
+  // If the second half returns a null pivot, offset its index by the rows
+  // of the first half, unless the first half already found one.
+  if ( r_val == FLA_SUCCESS && r_val_sub >= 0 )
+    r_val = n1 + r_val_sub;
+
+  // Apply computed pivots to ABL
+  FLA_Apply_pivots_internal( FLA_LEFT, FLA_NO_TRANSPOSE, pB, ABL,
+                             FLA_Cntl_sub_appiv1( cntl ) );
+
+  return r_val;
+}
+
@@ -14,6 +14,8 @@ FLA_Error FLA_LU_piv_blk_var3( FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
 FLA_Error FLA_LU_piv_blk_var4( FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
 FLA_Error FLA_LU_piv_blk_var5( FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
 
+FLA_Error FLA_LU_piv_rec_var1( FLA_Obj A, FLA_Obj p, fla_lu_t* cntl );
+
 FLA_Error FLA_LU_piv_unb_var3( FLA_Obj A, FLA_Obj p );
 FLA_Error FLA_LU_piv_unb_var3b( FLA_Obj A, FLA_Obj p );
 FLA_Error FLA_LU_piv_unb_var4( FLA_Obj A, FLA_Obj p );
@@ -0,0 +1,227 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// Time the factorization of tall m x n panels with the unblocked variant 5,
+// the blocked variant 5 and the recursive variant 1, and report the rate
+// of each along with the residual || P A - L U ||_1 / || A ||_1.
+
+#define FLA_ALG_UNB_OPT   3
+#define FLA_ALG_BLOCKED   1
+#define FLA_ALG_RECURSIVE 4
+
+extern fla_gemm_t*  fla_gemm_cntl_blas;
+extern fla_trsm_t*  fla_trsm_cntl_blas;
+extern fla_appiv_t* fla_appiv_cntl_leaf;
+
+void time_LU_piv_panel(
+               int type, int n_repeats, int nb_alg,
+               FLA_Obj A, FLA_Obj p, double *dtime, double *diff, double *gflops );
+
+
+int main(int argc, char *argv[])
+{
+  int
+    m_input,
+    m, n,
+    p_first, p_last, p_inc,
+    i,
+    nb_alg, nb_rec,
+    n_repeats,
+    datatype;
+
+  double
+    dtime,
+    gflops,
+    diff;
+
+  FLA_Obj
+    A, p;
+
+
+  FLA_Init();
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c enter blocksize of var5 and base case width of the recursion:", '%' );
+  scanf( "%d%d", &nb_alg, &nb_rec );
+  fprintf( stdout, "%c %d %d\n", '%', nb_alg, nb_rec );
+
+  fprintf( stdout, "%c enter panel width first, last, inc:", '%' );
+  scanf( "%d%d%d", &p_first, &p_last, &p_inc );
+  fprintf( stdout, "%c %d %d %d\n", '%', p_first, p_last, p_inc );
+
+  fprintf( stdout, "%c enter m (-k means k times the panel width): ", '%' );
+  scanf( "%d", &m_input );
+  fprintf( stdout, "%c %d\n", '%', m_input );
+
+  fprintf( stdout, "\nclear all;\n\n" );
+
+
+  for ( n = p_first, i = 1; n <= p_last; n += p_inc, i += 1 )
+  {
+    m = m_input;
+
+    if( m < 0 ) m = n * f2c_abs( m_input );
+
+    //datatype = FLA_FLOAT;
+    datatype = FLA_DOUBLE;
+    //datatype = FLA_COMPLEX;
+    //datatype = FLA_DOUBLE_COMPLEX;
+
+    FLA_Obj_create( datatype, m, n, 0, 0, &A );
+    FLA_Obj_create( FLA_INT, n, 1, 0, 0, &p );
+
+    FLA_Random_matrix( A );
+
+    fprintf( stdout, "data_panel( %d, 1:8 ) = [ %d %d  ", i, m, n );
+    fflush( stdout );
+
+    time_LU_piv_panel( FLA_ALG_UNB_OPT, n_repeats, nb_alg,
+                       A, p, &dtime, &diff, &gflops );
+
+    fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
+    fflush( stdout );
+
+    time_LU_piv_panel( FLA_ALG_BLOCKED, n_repeats, nb_alg,
+                       A, p, &dtime, &diff, &gflops );
+
+    fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
+    fflush( stdout );
+
+    time_LU_piv_panel( FLA_ALG_RECURSIVE, n_repeats, nb_rec,
+                       A, p, &dtime, &diff, &gflops );
+
+    fprintf( stdout, "%6.3lf %6.2le ", gflops, diff );
+    fflush( stdout );
+
+    fprintf( stdout, " ]; \n" );
+    fflush( stdout );
+
+    FLA_Obj_free( &A );
+    FLA_Obj_free( &p );
+  }
+
+  FLA_Finalize();
+
+  return 0;
+}
+
+
+void time_LU_piv_panel(
+               int type, int n_repeats, int nb_alg,
+               FLA_Obj A, FLA_Obj p, double *dtime, double *diff, double *gflops )
+{
+  int
+    irep;
+
+  double
+    m, n,
+    diff_A,
+    dtime_save = 1.0e9;
+
+  FLA_Obj
+    A_save, AT, AB, U, L, norm, norm_A;
+
+  fla_blocksize_t*
+    bp;
+  fla_lu_t*
+    cntl_lu_var;
+  fla_lu_t*
+    cntl_lu_opt;
+
+
+  bp             = FLA_Blocksize_create( nb_alg, nb_alg, nb_alg, nb_alg );
+  cntl_lu_opt    = FLA_Cntl_lu_obj_create( FLA_FLAT, FLA_UNB_OPT_VARIANT5, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL );
+  cntl_lu_var    = FLA_Cntl_lu_obj_create( FLA_FLAT,
+                                           type == FLA_ALG_RECURSIVE ? FLA_RECURSIVE_VARIANT1
+                                                                     : FLA_BLOCKED_VARIANT5,
+                                           bp, cntl_lu_opt,
+                                           fla_gemm_cntl_blas, fla_gemm_cntl_blas, fla_gemm_cntl_blas,
+                                           fla_trsm_cntl_blas, fla_trsm_cntl_blas,
+                                           fla_appiv_cntl_leaf, fla_appiv_cntl_leaf );
+
+  FLA_Obj_create_conf_to( FLA_NO_TRANSPOSE, A, &A_save );
+  FLA_Copy_external( A, A_save );
+
+  for ( irep = 0 ; irep < n_repeats; irep++ ){
+
+    FLA_Copy_external( A_save, A );
+
+    *dtime = FLA_Clock();
+
+    switch( type ){
+    case FLA_ALG_UNB_OPT:
+      FLA_LU_piv_opt_var5( A, p );
+      break;
+    case FLA_ALG_BLOCKED:
+      FLA_LU_piv_blk_var5( A, p, cntl_lu_var );
+      break;
+    case FLA_ALG_RECURSIVE:
+      FLA_LU_piv_rec_var1( A, p, cntl_lu_var );
+      break;
+    default:
+      printf("trouble\n");
+    }
+
+    *dtime = FLA_Clock() - *dtime;
+    dtime_save = min( *dtime, dtime_save );
+  }
+
+  FLA_Cntl_obj_free( cntl_lu_var );
+  FLA_Cntl_obj_free( cntl_lu_opt );
+  FLA_Blocksize_free( bp );
+
+  // Overwrite A_save with P A - L U.
+  FLA_Obj_create( FLA_Obj_datatype_proj_to_real( A ), 1, 1, 0, 0, &norm );
+  FLA_Obj_create( FLA_Obj_datatype_proj_to_real( A ), 1, 1, 0, 0, &norm_A );
+
+  FLA_Norm1( A_save, norm_A );
+
+  FLA_Part_2x1( A,    &AT,
+                      &AB,     FLA_Obj_width( A ), FLA_TOP );
+
+  FLA_Obj_create_conf_to( FLA_NO_TRANSPOSE, AT, &U );
+  FLA_Obj_create_conf_to( FLA_NO_TRANSPOSE, A,  &L );
+
+  FLA_Copy_external( AT, U );
+  FLA_Copy_external( A,  L );
+  FLA_Triangularize( FLA_UPPER_TRIANGULAR, FLA_NONUNIT_DIAG, U );
+  FLA_Triangularize( FLA_LOWER_TRIANGULAR, FLA_UNIT_DIAG, L );
+
+  FLA_Apply_pivots( FLA_LEFT, FLA_NO_TRANSPOSE, p, A_save );
+  FLA_Gemm_external( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+                     FLA_MINUS_ONE, L, U, FLA_ONE, A_save );
+
+  FLA_Norm1( A_save, norm );
+  FLA_Obj_extract_real_scalar( norm, diff );
+  FLA_Obj_extract_real_scalar( norm_A, &diff_A );
+  *diff /= diff_A;
+
+  FLA_Obj_free( &U );
+  FLA_Obj_free( &L );
+  FLA_Obj_free( &norm );
+  FLA_Obj_free( &norm_A );
+  FLA_Obj_free( &A_save );
+
+  m = FLA_Obj_length( A );
+  n = FLA_Obj_width( A );
+
+  *gflops = ( m * n * n - n * n * n / 3.0 ) / dtime_save / 1e9;
+
+  if ( FLA_Obj_is_complex( A ) )
+    *gflops *= 4.0;
+
+  *dtime = dtime_save;
+}
+
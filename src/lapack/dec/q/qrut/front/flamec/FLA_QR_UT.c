@@ -20,6 +20,11 @@ FLA_Error FLA_QR_UT( FLA_Obj A, FLA_Obj T )
   if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
     FLA_QR_UT_check( A, T );
 
+  // Factor a tall and skinny matrix by TSQR, whose row blocks fit in cache
+  // and are factored in parallel.
+  if ( FLA_QR_UT_tsqr_is_profitable( A ) )
+    return FLA_QR_UT_tsqr( A, T );
+
   // Invoke FLA_QR_UT_internal() with the standard control tree.
   //r_val = FLA_QR_UT_internal( A, T, fla_qrut_cntl2 );
   r_val = FLA_QR_UT_internal( A, T, fla_qrut_cntl_leaf );
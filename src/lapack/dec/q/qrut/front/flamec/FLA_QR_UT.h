@@ -21,6 +21,10 @@ FLA_Error FLA_QR_UT_recover_tau( FLA_Obj T, FLA_Obj tau );
 
 FLA_Error FLA_QR_UT_solve( FLA_Obj A, FLA_Obj T, FLA_Obj B, FLA_Obj X );
 
+FLA_Bool  FLA_QR_UT_tsqr_is_profitable( FLA_Obj A );
+FLA_Error FLA_QR_UT_tsqr( FLA_Obj A, FLA_Obj T );
+FLA_Error FLA_QR_UT_form_Q_tsqr( FLA_Obj A, FLA_Obj T, FLA_Obj Q );
+
 FLA_Error FLASH_QR_UT( FLA_Obj A, FLA_Obj TW );
 FLA_Error FLASH_QR_UT_create_hier_matrices( FLA_Obj A_flat, dim_t depth, dim_t* b_flash, FLA_Obj* A, FLA_Obj* TW );
 FLA_Error FLASH_QR_UT_solve( FLA_Obj A, FLA_Obj T, FLA_Obj B, FLA_Obj X );
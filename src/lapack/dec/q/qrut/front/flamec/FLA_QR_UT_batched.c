@@ -0,0 +1,166 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// A batch is given either as arrays of sizes, buffers and leading
+// dimensions (buff_A != NULL), or as buff_A_s and buff_T_s with one size
+// and leading dimension and fixed strides, in elements, between the
+// problems. Each T is k x k, where k = min( m, n ), and holds the upper
+// triangular factor of the block reflector that FLA_QR_UT() computes when
+// its blocksize is k, so that FLA_Apply_Q_UT() and FLA_QR_UT_solve() may
+// be given views of A and T.
+
+typedef struct FLA_QR_UT_batched_vars_s
+{
+  FLA_Datatype datatype;
+  dim_t        elem_size;
+  int*         m_A;
+  int*         n_A;
+  void**       buff_A;
+  int*         ldim_A;
+  void**       buff_T;
+  int*         ldim_T;
+  int          m_A_s;
+  int          n_A_s;
+  void*        buff_A_s;
+  int          ldim_A_s;
+  int          stride_A;
+  void*        buff_T_s;
+  int          ldim_T_s;
+  int          stride_T;
+} FLA_QR_UT_batched_vars;
+
+static void FLA_QR_UT_batched_range( int i_first, int n_batch, void* args );
+
+
+FLA_Error FLA_QR_UT_batched( FLA_Datatype datatype, int n_batch, int* m_A, int* n_A, void** buff_A, int* ldim_A, void** buff_T, int* ldim_T )
+{
+  FLA_QR_UT_batched_vars vars;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+  {
+    FLA_Check_error_code( FLA_Check_floating_datatype( datatype ) );
+
+    if ( n_batch > 0 )
+    {
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) m_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) n_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) buff_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) ldim_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) buff_T ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( ( void* ) ldim_T ) );
+    }
+  }
+
+  vars.datatype  = datatype;
+  vars.elem_size = FLA_Obj_datatype_size( datatype );
+  vars.m_A       = m_A;
+  vars.n_A       = n_A;
+  vars.buff_A    = buff_A;
+  vars.ldim_A    = ldim_A;
+  vars.buff_T    = buff_T;
+  vars.ldim_T    = ldim_T;
+
+  // The Householder vectors of a problem cannot be computed together with
+  // those of other problems without giving up the scaled 2-norms of the
+  // unblocked kernels, so the batch is only split across threads.
+  FLA_Batch_run( n_batch, 1, FLA_QR_UT_batched_range, ( void* ) &vars );
+
+  return FLA_SUCCESS;
+}
+
+
+FLA_Error FLA_QR_UT_batched_strided( FLA_Datatype datatype, int n_batch, int m_A, int n_A, void* buff_A, int ldim_A, int stride_A, void* buff_T, int ldim_T, int stride_T )
+{
+  FLA_QR_UT_batched_vars vars;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+  {
+    FLA_Check_error_code( FLA_Check_floating_datatype( datatype ) );
+
+    if ( n_batch > 0 )
+    {
+      FLA_Check_error_code( FLA_Check_null_pointer( buff_A ) );
+      FLA_Check_error_code( FLA_Check_null_pointer( buff_T ) );
+    }
+  }
+
+  vars.datatype  = datatype;
+  vars.elem_size = FLA_Obj_datatype_size( datatype );
+  vars.buff_A    = NULL;
+  vars.m_A_s     = m_A;
+  vars.n_A_s     = n_A;
+  vars.buff_A_s  = buff_A;
+  vars.ldim_A_s  = ldim_A;
+  vars.stride_A  = stride_A;
+  vars.buff_T_s  = buff_T;
+  vars.ldim_T_s  = ldim_T;
+  vars.stride_T  = stride_T;
+
+  FLA_Batch_run( n_batch, 1, FLA_QR_UT_batched_range, ( void* ) &vars );
+
+  return FLA_SUCCESS;
+}
+
+
+static void FLA_QR_UT_batched_range( int i_first, int n_batch, void* args )
+{
+  FLA_QR_UT_batched_vars* vars = ( FLA_QR_UT_batched_vars* ) args;
+  int                     i;
+
+  for ( i = i_first; i < i_first + n_batch; ++i )
+  {
+    int   m_A, n_A, cs_A, cs_T;
+    void* buff_A;
+    void* buff_T;
+
+    if ( vars->buff_A != NULL )
+    {
+      m_A    = vars->m_A[i];
+      n_A    = vars->n_A[i];
+      buff_A = vars->buff_A[i];
+      cs_A   = vars->ldim_A[i];
+      buff_T = vars->buff_T[i];
+      cs_T   = vars->ldim_T[i];
+    }
+    else
+    {
+      m_A    = vars->m_A_s;
+      n_A    = vars->n_A_s;
+      buff_A = ( char* ) vars->buff_A_s + ( size_t ) i * vars->stride_A * vars->elem_size;
+      cs_A   = vars->ldim_A_s;
+      buff_T = ( char* ) vars->buff_T_s + ( size_t ) i * vars->stride_T * vars->elem_size;
+      cs_T   = vars->ldim_T_s;
+    }
+
+    switch ( vars->datatype )
+    {
+      case FLA_FLOAT:
+        FLA_QR_UT_ops_var2( m_A, n_A, ( float* ) buff_A, 1, cs_A, ( float* ) buff_T, 1, cs_T );
+        break;
+
+      case FLA_DOUBLE:
+        FLA_QR_UT_opd_var2( m_A, n_A, ( double* ) buff_A, 1, cs_A, ( double* ) buff_T, 1, cs_T );
+        break;
+
+      case FLA_COMPLEX:
+        FLA_QR_UT_opc_var2( m_A, n_A, ( scomplex* ) buff_A, 1, cs_A, ( scomplex* ) buff_T, 1, cs_T );
+        break;
+
+      case FLA_DOUBLE_COMPLEX:
+        FLA_QR_UT_opz_var2( m_A, n_A, ( dcomplex* ) buff_A, 1, cs_A, ( dcomplex* ) buff_T, 1, cs_T );
+        break;
+    }
+  }
+}
+
@@ -21,6 +21,15 @@ FLA_Error FLA_QR_UT_form_Q( FLA_Obj A, FLA_Obj T, FLA_Obj Q )
     if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
         FLA_QR_UT_form_Q_check( A, T, Q );
 
+    // Form the first n columns of Q for a tall and skinny A in parallel over
+    // its row blocks.
+    if ( FLA_QR_UT_tsqr_is_profitable( A ) &&
+         FLA_Obj_width( T ) == FLA_Obj_width( A ) &&
+         FLA_Obj_width( Q ) == FLA_Obj_width( A ) &&
+         ( FLA_Obj_is_overlapped( A, Q ) == FALSE ||
+           FLA_Obj_buffer_at_view( A ) == FLA_Obj_buffer_at_view( Q ) ) )
+        return FLA_QR_UT_form_Q_tsqr( A, T, Q );
+
     if ( FLA_Obj_is_overlapped( A, Q ) == FALSE )
     {
         // If A and Q are different objects, Q is explicitly formed with A.
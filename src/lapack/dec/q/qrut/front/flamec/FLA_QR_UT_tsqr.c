@@ -0,0 +1,741 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// FLA_QR_UT_tsqr() factors a tall and skinny matrix by TSQR: its row blocks
+// are factored independently, and their triangular factors are combined in
+// pairs along a binary tree with FLA_CAQR2_UT(), the form of FLA_QR2_UT()
+// for a triangle stacked on a triangle. The row blocks, and the pairs of
+// each level of the tree, are split across threads with FLA_Batch_run().
+// Since the rest of libflame expects the Householder vectors and the b x n
+// T of FLA_QR_UT(), the first n columns of the orthonormal factor of the
+// tree are then formed and turned back into Householder vectors with a
+// modified LU factorization, as in "Reconstructing Householder Vectors
+// from Tall-Skinny QR" by Ballard et al. This leaves A and T as
+// FLA_QR_UT() would, to within roundoff.
+//
+// FLA_QR_UT_form_Q_tsqr() forms the first n columns of Q from those
+// Householder vectors as Q = [ I; 0 ] - Y inv( Tf ) Y1', where Tf is the
+// full n x n triangular factor, whose off-diagonal blocks it rebuilds from
+// Y' Y. Both the reduction and the update run over the row blocks in
+// parallel.
+
+extern fla_qrut_t*     fla_qrut_cntl_leaf;
+extern fla_caqr2ut_t*  fla_caqr2ut_cntl_leaf;
+extern fla_apcaq2ut_t* fla_apcaq2ut_cntl_leaf;
+
+// Each row block has at least this many times as many rows as A has
+// columns, which keeps it in cache while amortizing its share of the tree.
+#define FLA_QR_UT_TSQR_BLOCK_RATIO 8
+
+typedef struct FLA_QR_UT_tsqr_vars_s
+{
+  int      stride;
+  dim_t    n_A;
+  FLA_Obj* A_i;
+  FLA_Obj* T_i;
+  FLA_Obj* S_i;
+  FLA_Obj* C_i;
+  FLA_Obj* P_i;
+  FLA_Obj  U;
+  FLA_Obj  Tf;
+} FLA_QR_UT_tsqr_vars;
+
+static int  FLA_QR_UT_tsqr_n_block( FLA_Obj A );
+static void FLA_QR_UT_tsqr_part( FLA_Obj A, int n_block, FLA_Obj* A_i );
+static void FLA_QR_UT_tsqr_bottom( FLA_QR_UT_tsqr_vars* vars, int i, FLA_Obj* A_b );
+static int  FLA_QR_UT_tsqr_n_pairs( int n_block, int stride );
+static void FLA_QR_UT_tsqr_pair( FLA_QR_UT_tsqr_vars* vars, int k, int* i, int* j, FLA_Obj* R_i, FLA_Obj* R_j );
+static void FLA_QR_UT_tsqr_qr_range( int i_first, int n_batch, void* args );
+static void FLA_QR_UT_tsqr_caqr2_range( int i_first, int n_batch, void* args );
+static void FLA_QR_UT_tsqr_apcaq2_range( int i_first, int n_batch, void* args );
+static void FLA_QR_UT_tsqr_apq_range( int i_first, int n_batch, void* args );
+static void FLA_QR_UT_tsqr_trsm_range( int i_first, int n_batch, void* args );
+static void FLA_QR_UT_tsqr_herk_range( int i_first, int n_batch, void* args );
+static void FLA_QR_UT_tsqr_form_Q_range( int i_first, int n_batch, void* args );
+static void FLA_QR_UT_tsqr_lu( FLA_Obj A, FLA_Obj d, FLA_Obj t );
+static void FLA_QR_UT_tsqr_lu_pivot( FLA_Obj alpha11, FLA_Obj delta1, FLA_Obj tau1 );
+
+
+FLA_Bool FLA_QR_UT_tsqr_is_profitable( FLA_Obj A )
+{
+  FLA_Datatype datatype = FLA_Obj_datatype( A );
+  dim_t        m_A      = FLA_Obj_length( A );
+  dim_t        n_A      = FLA_Obj_width( A );
+  dim_t        ratio;
+  dim_t        n_threads_min;
+
+  // TSQR performs about twice the flops of the blocked algorithm, so it only
+  // pays off when FLA_Batch_run() can split the row blocks across enough
+  // threads. A tuned aspect ratio of zero turns it off.
+#ifdef FLA_ENABLE_MULTITHREADING
+  ratio         = FLA_Tune_get_for_size( datatype, FLA_TUNE_QR_UT, FLA_TUNE_TSQR_RATIO, m_A );
+  n_threads_min = FLA_Tune_get_for_size( datatype, FLA_TUNE_QR_UT, FLA_TUNE_TSQR_N_THREADS, m_A );
+
+  return ( ratio > 0 && n_A > 0 && m_A >= ratio * n_A &&
+           FLASH_Queue_get_num_threads() >= max( 2, n_threads_min ) );
+#else
+  return FALSE;
+#endif
+}
+
+
+FLA_Error FLA_QR_UT_tsqr( FLA_Obj A, FLA_Obj T )
+{
+  FLA_Datatype        datatype;
+  FLA_QR_UT_tsqr_vars vars;
+  FLA_Obj             ATL, ATR,
+                      ABL, ABR;
+  FLA_Obj             TL, TR, T1, T1T, T1B;
+  FLA_Obj             TfTL, TfTR,
+                      TfBL, TfBR;
+  FLA_Obj             TW, TWL, TWR, C, CT, CB;
+  FLA_Obj             R, U, d, t, Tf;
+  dim_t               m_A, n_A, b_alg, b_t, b, j;
+  int                 n_block, stride, i;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_QR_UT_check( A, T );
+
+  datatype = FLA_Obj_datatype( A );
+  m_A      = FLA_Obj_length( A );
+  n_A      = FLA_Obj_width( A );
+  b_alg    = FLA_Obj_length( T );
+
+  if ( n_A == 0 ) return FLA_SUCCESS;
+
+  // A wide matrix has no tall and skinny part to speak of.
+  if ( m_A < n_A )
+    return FLA_QR_UT_internal( A, T, fla_qrut_cntl_leaf );
+
+  n_block = FLA_QR_UT_tsqr_n_block( A );
+
+  // The row blocks, and the pairs of the tree, are factored with the
+  // blocksize that FLA_QR_UT_create_T() would choose for a row block.
+  b_t = FLA_Tune_get_for_size( datatype, FLA_TUNE_QR_UT, FLA_TUNE_B_ALG, n_A );
+  b_t = min( b_t, n_A );
+
+  vars.n_A = n_A;
+  vars.A_i = ( FLA_Obj* ) FLA_malloc( n_block * sizeof( FLA_Obj ) );
+  vars.T_i = ( FLA_Obj* ) FLA_malloc( n_block * sizeof( FLA_Obj ) );
+  vars.S_i = ( FLA_Obj* ) FLA_malloc( n_block * sizeof( FLA_Obj ) );
+  vars.C_i = ( FLA_Obj* ) FLA_malloc( n_block * sizeof( FLA_Obj ) );
+
+  // T_i holds the T of row block i, S_i that of the pair of the tree in
+  // which the R of row block i is annihilated, and C_i the rows of the
+  // orthonormal factor of the tree that apply to row block i.
+  FLA_Obj_create( datatype, b_t, 2 * n_block * n_A, 0, 0, &TW );
+  FLA_Obj_create( datatype, n_block * n_A, n_A, 0, 0, &C );
+
+  FLA_QR_UT_tsqr_part( A, n_block, vars.A_i );
+
+  for ( i = 0; i < n_block; ++i )
+  {
+    FLA_Part_1x2( TW,   &TWL, &TWR,   2 * i * n_A, FLA_LEFT );
+    FLA_Part_1x2( TWR,  &vars.T_i[i], &TWR,   n_A, FLA_LEFT );
+    FLA_Part_1x2( TWR,  &vars.S_i[i], &TWR,   n_A, FLA_LEFT );
+
+    FLA_Part_2x1( C,    &CT,
+                        &CB,          i * n_A, FLA_TOP );
+    FLA_Part_2x1( CB,   &vars.C_i[i],
+                        &CB,          n_A, FLA_TOP );
+  }
+
+  // Factor the row blocks, and then combine their R factors level by level
+  // into that of row block 0.
+  FLA_Batch_run( n_block, 1, FLA_QR_UT_tsqr_qr_range, ( void* ) &vars );
+
+  for ( stride = 1; stride < n_block; stride *= 2 )
+  {
+    vars.stride = stride;
+    FLA_Batch_run( FLA_QR_UT_tsqr_n_pairs( n_block, stride ), 1,
+                   FLA_QR_UT_tsqr_caqr2_range, ( void* ) &vars );
+  }
+
+  FLA_Part_2x2( A,    &ATL, &ATR,
+                      &ABL, &ABR,     n_A, n_A, FLA_TL );
+
+  // Save R, which the orthonormal factor is about to overwrite.
+  FLA_Obj_create( datatype, n_A, n_A, 0, 0, &R );
+  FLA_Copyr( FLA_UPPER_TRIANGULAR, ATL, R );
+
+  // Apply the tree, and then the row blocks, to the first n columns of the
+  // identity, which leaves Q1 in A.
+  FLA_Set( FLA_ZERO, C );
+  FLA_Set_diag( FLA_ONE, vars.C_i[0] );
+
+  while ( ( stride /= 2 ) > 0 )
+  {
+    vars.stride = stride;
+    FLA_Batch_run( FLA_QR_UT_tsqr_n_pairs( n_block, stride ), 1,
+                   FLA_QR_UT_tsqr_apcaq2_range, ( void* ) &vars );
+  }
+
+  FLA_Batch_run( n_block, 1, FLA_QR_UT_tsqr_apq_range, ( void* ) &vars );
+
+  FLA_Obj_free( &C );
+  FLA_Obj_free( &TW );
+
+  // Factor Q1 - S = L U, where each element of the diagonal S has the
+  // opposite sign of the element of Q1 that becomes the pivot, so that the
+  // pivots are at least one in magnitude. This leaves the Householder
+  // vectors in L, the diagonal D with H [ I; 0 ] = Q1 D in d, and the
+  // diagonal of Tf in t.
+  FLA_Obj_create( datatype, n_A, 1, 0, 0, &d );
+  FLA_Obj_create( datatype, n_A, 1, 0, 0, &t );
+
+  FLA_QR_UT_tsqr_lu( ATL, d, t );
+
+  // L2 = Q2 * inv( triu( U ) ).
+  vars.U = ATL;
+  FLA_Batch_run( n_block, 1, FLA_QR_UT_tsqr_trsm_range, ( void* ) &vars );
+
+  // Tf = - trilu( L1 )' * inv( triu( U ) * D ), with its diagonal set to
+  // the exact values, which are real.
+  FLA_Obj_create( datatype, n_A, n_A, 0, 0, &U );
+  FLA_Obj_create( datatype, n_A, n_A, 0, 0, &Tf );
+
+  FLA_Copyr( FLA_UPPER_TRIANGULAR, ATL, U );
+  FLA_Apply_diag_matrix( FLA_RIGHT, FLA_NO_CONJUGATE, d, U );
+
+  FLA_Set( FLA_ZERO, Tf );
+  FLA_Copyrt( FLA_UPPER_TRIANGULAR, FLA_CONJ_TRANSPOSE, ATL, Tf );
+  FLA_Set_diag( FLA_ONE, Tf );
+
+  FLA_Trsm( FLA_RIGHT, FLA_UPPER_TRIANGULAR,
+            FLA_NO_TRANSPOSE, FLA_NONUNIT_DIAG,
+            FLA_MINUS_ONE, U, Tf );
+
+  FLA_Set_diagonal_matrix( t, Tf );
+
+  // Copy the b x b diagonal blocks of Tf to T.
+  FLA_Part_1x2( T,    &TL,  &TR,      0, FLA_LEFT );
+
+  for ( j = 0; j < n_A; j += b )
+  {
+    b = min( b_alg, n_A - j );
+
+    FLA_Part_1x2( TR,   &T1,  &TR,      b, FLA_LEFT );
+    FLA_Part_2x1( T1,   &T1T,
+                        &T1B,           b, FLA_TOP );
+
+    FLA_Part_2x2( Tf,   &TfTL, &TfTR,
+                        &TfBL, &TfBR,   j, j, FLA_TL );
+    FLA_Part_2x2( TfBR, &TfTL, &TfTR,
+                        &TfBL, &TfBR,   b, b, FLA_TL );
+
+    FLA_Copy( TfTL, T1T );
+  }
+
+  // R = D' * R.
+  FLA_Apply_diag_matrix( FLA_LEFT, FLA_CONJUGATE, d, R );
+  FLA_Copyr( FLA_UPPER_TRIANGULAR, R, ATL );
+
+  FLA_Obj_free( &U );
+  FLA_Obj_free( &Tf );
+  FLA_Obj_free( &R );
+  FLA_Obj_free( &d );
+  FLA_Obj_free( &t );
+
+  FLA_free( vars.A_i );
+  FLA_free( vars.T_i );
+  FLA_free( vars.S_i );
+  FLA_free( vars.C_i );
+
+  return FLA_SUCCESS;
+}
+
+
+FLA_Error FLA_QR_UT_form_Q_tsqr( FLA_Obj A, FLA_Obj T, FLA_Obj Q )
+{
+  FLA_Datatype        datatype;
+  FLA_QR_UT_tsqr_vars vars;
+  FLA_Obj             QT,
+                      QB;
+  FLA_Obj             TL, TR, T1, T1T, T1B;
+  FLA_Obj             TfTL, TfTR,
+                      TfBL, TfBR;
+  FLA_Obj             Z, Tf;
+  dim_t               n_A, b_alg, b, j;
+  int                 n_block, i;
+
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_QR_UT_form_Q_check( A, T, Q );
+
+  datatype = FLA_Obj_datatype( A );
+  n_A      = FLA_Obj_width( A );
+  b_alg    = FLA_Obj_length( T );
+
+  // Only the first n columns of Q, for the n Householder vectors of a tall
+  // matrix, are formed this way.
+  if ( n_A == 0 ||
+       FLA_Obj_length( A ) < n_A ||
+       FLA_Obj_width( T ) != n_A ||
+       FLA_Obj_width( Q ) != n_A ||
+       ( FLA_Obj_is_overlapped( A, Q ) &&
+         FLA_Obj_buffer_at_view( A ) != FLA_Obj_buffer_at_view( Q ) ) )
+    return FLA_QR_UT_form_Q( A, T, Q );
+
+  if ( FLA_Obj_buffer_at_view( A ) != FLA_Obj_buffer_at_view( Q ) )
+    FLA_Copy( A, Q );
+
+  n_block = FLA_QR_UT_tsqr_n_block( Q );
+
+  vars.n_A = n_A;
+  vars.A_i = ( FLA_Obj* ) FLA_malloc( n_block * sizeof( FLA_Obj ) );
+  vars.P_i = ( FLA_Obj* ) FLA_malloc( n_block * sizeof( FLA_Obj ) );
+
+  for ( i = 0; i < n_block; ++i )
+    vars.P_i[i].base = NULL;
+
+  FLA_QR_UT_tsqr_part( Q, n_block, vars.A_i );
+
+  FLA_Part_2x1( Q,    &QT,
+                      &QB,            n_A, FLA_TOP );
+
+  FLA_Obj_create( datatype, n_A, n_A, 0, 0, &Z );
+  FLA_Obj_create( datatype, n_A, n_A, 0, 0, &Tf );
+
+  // Z = trilu( Y1 ).
+  FLA_Set( FLA_ZERO, Z );
+  FLA_Copyr( FLA_LOWER_TRIANGULAR, QT, Z );
+  FLA_Set_diag( FLA_ONE, Z );
+
+  // triu( Tf ) = Y' * Y, from which only the blocks above the diagonal
+  // blocks of T are used.
+  FLA_Set( FLA_ZERO, Tf );
+  FLA_Herk( FLA_UPPER_TRIANGULAR, FLA_CONJ_TRANSPOSE,
+            FLA_ONE, Z, FLA_ZERO, Tf );
+
+  FLA_Batch_run( n_block, 1, FLA_QR_UT_tsqr_herk_range, ( void* ) &vars );
+
+  for ( i = 0; i < n_block; ++i )
+  {
+    if ( vars.P_i[i].base == NULL ) continue;
+
+    FLA_Axpy( FLA_ONE, vars.P_i[i], Tf );
+    FLA_Obj_free( &vars.P_i[i] );
+  }
+
+  FLA_Part_1x2( T,    &TL,  &TR,      0, FLA_LEFT );
+
+  for ( j = 0; j < n_A; j += b )
+  {
+    b = min( b_alg, n_A - j );
+
+    FLA_Part_1x2( TR,   &T1,  &TR,      b, FLA_LEFT );
+    FLA_Part_2x1( T1,   &T1T,
+                        &T1B,           b, FLA_TOP );
+
+    FLA_Part_2x2( Tf,   &TfTL, &TfTR,
+                        &TfBL, &TfBR,   j, j, FLA_TL );
+    FLA_Part_2x2( TfBR, &TfTL, &TfTR,
+                        &TfBL, &TfBR,   b, b, FLA_TL );
+
+    FLA_Copyr( FLA_UPPER_TRIANGULAR, T1T, TfTL );
+  }
+
+  // Q2 = - Y2 * inv( triu( Tf ) ) * trilu( Y1 )'.
+  vars.U  = QT;
+  vars.Tf = Tf;
+  FLA_Batch_run( n_block, 1, FLA_QR_UT_tsqr_form_Q_range, ( void* ) &vars );
+
+  // Q1 = I - trilu( Y1 ) * inv( triu( Tf ) ) * trilu( Y1 )'.
+  FLA_Trsm( FLA_RIGHT, FLA_UPPER_TRIANGULAR,
+            FLA_NO_TRANSPOSE, FLA_NONUNIT_DIAG,
+            FLA_MINUS_ONE, Tf, Z );
+  FLA_Trmm( FLA_RIGHT, FLA_LOWER_TRIANGULAR,
+            FLA_CONJ_TRANSPOSE, FLA_UNIT_DIAG,
+            FLA_ONE, QT, Z );
+  FLA_Shift_diag( FLA_NO_CONJUGATE, FLA_ONE, Z );
+  FLA_Copy( Z, QT );
+
+  FLA_Obj_free( &Z );
+  FLA_Obj_free( &Tf );
+
+  FLA_free( vars.A_i );
+  FLA_free( vars.P_i );
+
+  return FLA_SUCCESS;
+}
+
+
+static int FLA_QR_UT_tsqr_n_block( FLA_Obj A )
+{
+  dim_t m_A = FLA_Obj_length( A );
+  dim_t n_A = FLA_Obj_width( A );
+
+  return max( 1, m_A / ( FLA_QR_UT_TSQR_BLOCK_RATIO * n_A ) );
+}
+
+
+static void FLA_QR_UT_tsqr_part( FLA_Obj A, int n_block, FLA_Obj* A_i )
+{
+  dim_t  m_A = FLA_Obj_length( A );
+  FLA_Obj AT,
+          AB;
+  int     i;
+
+  // Split the rows of A as evenly as possible, so that every row block has
+  // at least as many rows as A has columns.
+  for ( i = 0; i < n_block; ++i )
+  {
+    dim_t i_first = ( ( size_t ) m_A * ( i     ) ) / n_block;
+    dim_t i_last  = ( ( size_t ) m_A * ( i + 1 ) ) / n_block;
+
+    FLA_Part_2x1( A,    &AT,
+                        &AB,          i_first, FLA_TOP );
+    FLA_Part_2x1( AB,   &A_i[i],
+                        &AB,          i_last - i_first, FLA_TOP );
+  }
+}
+
+
+static void FLA_QR_UT_tsqr_bottom( FLA_QR_UT_tsqr_vars* vars, int i, FLA_Obj* A_b )
+{
+  FLA_Obj AT;
+
+  // The rows of row block i below the first n rows of A.
+  if ( i == 0 )
+    FLA_Part_2x1( vars->A_i[0], &AT,
+                                A_b,    vars->n_A, FLA_TOP );
+  else
+    *A_b = vars->A_i[i];
+}
+
+
+static int FLA_QR_UT_tsqr_n_pairs( int n_block, int stride )
+{
+  // The pairs at this level combine row blocks i and i + stride for each i
+  // that is a multiple of 2 stride.
+  return ( n_block - stride + 2 * stride - 1 ) / ( 2 * stride );
+}
+
+
+static void FLA_QR_UT_tsqr_pair( FLA_QR_UT_tsqr_vars* vars, int k, int* i, int* j, FLA_Obj* R_i, FLA_Obj* R_j )
+{
+  FLA_Obj AB;
+
+  *i = 2 * vars->stride * k;
+  *j = *i + vars->stride;
+
+  FLA_Part_2x1( vars->A_i[*i],  R_i,
+                                &AB,    vars->n_A, FLA_TOP );
+  FLA_Part_2x1( vars->A_i[*j],  R_j,
+                                &AB,    vars->n_A, FLA_TOP );
+}
+
+
+static void FLA_QR_UT_tsqr_qr_range( int i_first, int n_batch, void* args )
+{
+  FLA_QR_UT_tsqr_vars* vars = ( FLA_QR_UT_tsqr_vars* ) args;
+  int                  i;
+
+  for ( i = i_first; i < i_first + n_batch; ++i )
+    FLA_QR_UT_internal( vars->A_i[i], vars->T_i[i], fla_qrut_cntl_leaf );
+}
+
+
+static void FLA_QR_UT_tsqr_caqr2_range( int i_first, int n_batch, void* args )
+{
+  FLA_QR_UT_tsqr_vars* vars = ( FLA_QR_UT_tsqr_vars* ) args;
+  FLA_Obj              R_i, R_j;
+  int                  k, i, j;
+
+  // Only the upper triangle of R_j is referenced, so the Householder
+  // vectors of row block j below it are left intact.
+  for ( k = i_first; k < i_first + n_batch; ++k )
+  {
+    FLA_QR_UT_tsqr_pair( vars, k, &i, &j, &R_i, &R_j );
+
+    FLA_CAQR2_UT_internal( R_i,
+                           R_j, vars->S_i[j], fla_caqr2ut_cntl_leaf );
+  }
+}
+
+
+static void FLA_QR_UT_tsqr_apcaq2_range( int i_first, int n_batch, void* args )
+{
+  FLA_QR_UT_tsqr_vars* vars = ( FLA_QR_UT_tsqr_vars* ) args;
+  FLA_Obj              R_i, R_j, W;
+  int                  k, i, j;
+
+  FLA_Obj_create( FLA_Obj_datatype( vars->S_i[0] ),
+                  FLA_Obj_length( vars->S_i[0] ), vars->n_A, 0, 0, &W );
+
+  for ( k = i_first; k < i_first + n_batch; ++k )
+  {
+    FLA_QR_UT_tsqr_pair( vars, k, &i, &j, &R_i, &R_j );
+
+    FLA_Apply_CAQ2_UT_internal( FLA_LEFT, FLA_NO_TRANSPOSE,
+                                FLA_FORWARD, FLA_COLUMNWISE,
+                                R_j, vars->S_i[j], W, vars->C_i[i],
+                                                      vars->C_i[j],
+                                fla_apcaq2ut_cntl_leaf );
+  }
+
+  FLA_Obj_free( &W );
+}
+
+
+static void FLA_QR_UT_tsqr_apq_range( int i_first, int n_batch, void* args )
+{
+  FLA_QR_UT_tsqr_vars* vars = ( FLA_QR_UT_tsqr_vars* ) args;
+  FLA_Obj              B, BT, BB, BTT, BTB, W;
+  dim_t                m_max = 0;
+  int                  i;
+
+  for ( i = i_first; i < i_first + n_batch; ++i )
+    m_max = max( m_max, FLA_Obj_length( vars->A_i[i] ) );
+
+  FLA_Obj_create( FLA_Obj_datatype( vars->A_i[i_first] ),
+                  m_max, vars->n_A, 0, 0, &B );
+  FLA_Apply_Q_UT_create_workspace_side( FLA_LEFT, vars->T_i[i_first], B, &W );
+
+  // A_i = Q_i [ C_i; 0 ], through B since A_i holds the Householder vectors
+  // of Q_i.
+  for ( i = i_first; i < i_first + n_batch; ++i )
+  {
+    FLA_Part_2x1( B,    &BT,
+                        &BB,    FLA_Obj_length( vars->A_i[i] ), FLA_TOP );
+    FLA_Part_2x1( BT,   &BTT,
+                        &BTB,   vars->n_A, FLA_TOP );
+
+    FLA_Copy( vars->C_i[i], BTT );
+    FLA_Set( FLA_ZERO, BTB );
+
+    FLA_Apply_Q_UT( FLA_LEFT, FLA_NO_TRANSPOSE, FLA_FORWARD, FLA_COLUMNWISE,
+                    vars->A_i[i], vars->T_i[i], W, BT );
+
+    FLA_Copy( BT, vars->A_i[i] );
+  }
+
+  FLA_Obj_free( &W );
+  FLA_Obj_free( &B );
+}
+
+
+static void FLA_QR_UT_tsqr_trsm_range( int i_first, int n_batch, void* args )
+{
+  FLA_QR_UT_tsqr_vars* vars = ( FLA_QR_UT_tsqr_vars* ) args;
+  FLA_Obj              A_b;
+  int                  i;
+
+  for ( i = i_first; i < i_first + n_batch; ++i )
+  {
+    FLA_QR_UT_tsqr_bottom( vars, i, &A_b );
+
+    FLA_Trsm( FLA_RIGHT, FLA_UPPER_TRIANGULAR,
+              FLA_NO_TRANSPOSE, FLA_NONUNIT_DIAG,
+              FLA_ONE, vars->U, A_b );
+  }
+}
+
+
+static void FLA_QR_UT_tsqr_herk_range( int i_first, int n_batch, void* args )
+{
+  FLA_QR_UT_tsqr_vars* vars = ( FLA_QR_UT_tsqr_vars* ) args;
+  FLA_Obj              A_b, P;
+  int                  i;
+
+  // Each range sums into its own P, which is kept with its first row
+  // block.
+  FLA_Obj_create( FLA_Obj_datatype( vars->A_i[i_first] ),
+                  vars->n_A, vars->n_A, 0, 0, &P );
+  FLA_Set( FLA_ZERO, P );
+
+  for ( i = i_first; i < i_first + n_batch; ++i )
+  {
+    FLA_QR_UT_tsqr_bottom( vars, i, &A_b );
+
+    FLA_Herk( FLA_UPPER_TRIANGULAR, FLA_CONJ_TRANSPOSE,
+              FLA_ONE, A_b, FLA_ONE, P );
+  }
+
+  vars->P_i[i_first] = P;
+}
+
+
+static void FLA_QR_UT_tsqr_form_Q_range( int i_first, int n_batch, void* args )
+{
+  FLA_QR_UT_tsqr_vars* vars = ( FLA_QR_UT_tsqr_vars* ) args;
+  FLA_Obj              A_b;
+  int                  i;
+
+  for ( i = i_first; i < i_first + n_batch; ++i )
+  {
+    FLA_QR_UT_tsqr_bottom( vars, i, &A_b );
+
+    FLA_Trsm( FLA_RIGHT, FLA_UPPER_TRIANGULAR,
+              FLA_NO_TRANSPOSE, FLA_NONUNIT_DIAG,
+              FLA_MINUS_ONE, vars->Tf, A_b );
+    FLA_Trmm( FLA_RIGHT, FLA_LOWER_TRIANGULAR,
+              FLA_CONJ_TRANSPOSE, FLA_UNIT_DIAG,
+              FLA_ONE, vars->U, A_b );
+  }
+}
+
+
+static void FLA_QR_UT_tsqr_lu( FLA_Obj A, FLA_Obj d, FLA_Obj t )
+{
+  FLA_Obj ATL,   ATR,      A00,  a01,     A02,
+          ABL,   ABR,      a10t, alpha11, a12t,
+                           A20,  a21,     A22;
+
+  FLA_Obj dT,              d0,
+          dB,              delta1,
+                           d2;
+
+  FLA_Obj tT,              t0,
+          tB,              tau1,
+                           t2;
+
+  FLA_Part_2x2( A,    &ATL, &ATR,
+                      &ABL, &ABR,     0, 0, FLA_TL );
+
+  FLA_Part_2x1( d,    &dT,
+                      &dB,            0, FLA_TOP );
+
+  FLA_Part_2x1( t,    &tT,
+                      &tB,            0, FLA_TOP );
+
+  while ( FLA_Obj_length( ATL ) < FLA_Obj_length( A ) ){
+
+    FLA_Repart_2x2_to_3x3( ATL, /**/ ATR,       &A00,  /**/ &a01,     &A02,
+                        /* ************* */   /* ************************** */
+                                                &a10t, /**/ &alpha11, &a12t,
+                           ABL, /**/ ABR,       &A20,  /**/ &a21,     &A22,
+                           1, 1, FLA_BR );
+
+    FLA_Repart_2x1_to_3x1( dT,                &d0,
+                        /* ** */            /* ****** */
+                                              &delta1,
+                           dB,                &d2,        1, FLA_BOTTOM );
+
+    FLA_Repart_2x1_to_3x1( tT,                &t0,
+                        /* ** */            /* **** */
+                                              &tau1,
+                           tB,                &t2,        1, FLA_BOTTOM );
+
+    /*------------------------------------------------------------*/
+
+    // alpha11 = alpha11 + sign( alpha11 );
+    FLA_QR_UT_tsqr_lu_pivot( alpha11, delta1, tau1 );
+
+    // a21 = a21 / alpha11;
+    FLA_Inv_scal( alpha11, a21 );
+
+    // A22 = A22 - a21 * a12t;
+    FLA_Ger( FLA_MINUS_ONE, a21, a12t, A22 );
+
+    /*------------------------------------------------------------*/
+
+    FLA_Cont_with_3x3_to_2x2( &ATL, /**/ &ATR,       A00,  a01,     /**/ A02,
+                                                     a10t, alpha11, /**/ a12t,
+                            /* ************** */  /* ************************ */
+                              &ABL, /**/ &ABR,       A20,  a21,     /**/ A22,
+                              FLA_TL );
+
+    FLA_Cont_with_3x1_to_2x1( &dT,                d0,
+                                                  delta1,
+                            /* ** */           /* ****** */
+                              &dB,                d2,     FLA_TOP );
+
+    FLA_Cont_with_3x1_to_2x1( &tT,                t0,
+                                                  tau1,
+                            /* ** */           /* **** */
+                              &tB,                t2,     FLA_TOP );
+  }
+}
+
+
+static void FLA_QR_UT_tsqr_lu_pivot( FLA_Obj alpha11, FLA_Obj delta1, FLA_Obj tau1 )
+{
+  // With sigma = sign( alpha11 ), taken as one for zero, set
+  //   alpha11 = alpha11 + sigma,
+  //   delta1  = - conj( sigma ),
+  //   tau1    = 1 / ( 1 + | alpha11 | ),
+  // where tau1 is the element on the diagonal of Tf, which is real.
+  switch ( FLA_Obj_datatype( alpha11 ) )
+  {
+    case FLA_FLOAT:
+    {
+      float* alpha = FLA_FLOAT_PTR( alpha11 );
+      float* delta = FLA_FLOAT_PTR( delta1 );
+      float* tau   = FLA_FLOAT_PTR( tau1 );
+      float  sigma = ( *alpha < 0.0F ? -1.0F : 1.0F );
+
+      *tau    = 1.0F / ( 1.0F + fabsf( *alpha ) );
+      *alpha += sigma;
+      *delta  = -sigma;
+
+      break;
+    }
+
+    case FLA_DOUBLE:
+    {
+      double* alpha = FLA_DOUBLE_PTR( alpha11 );
+      double* delta = FLA_DOUBLE_PTR( delta1 );
+      double* tau   = FLA_DOUBLE_PTR( tau1 );
+      double  sigma = ( *alpha < 0.0 ? -1.0 : 1.0 );
+
+      *tau    = 1.0 / ( 1.0 + fabs( *alpha ) );
+      *alpha += sigma;
+      *delta  = -sigma;
+
+      break;
+    }
+
+    case FLA_COMPLEX:
+    {
+      scomplex* alpha = FLA_COMPLEX_PTR( alpha11 );
+      scomplex* delta = FLA_COMPLEX_PTR( delta1 );
+      scomplex* tau   = FLA_COMPLEX_PTR( tau1 );
+      float     abs   = sqrtf( alpha->real * alpha->real + alpha->imag * alpha->imag );
+      scomplex  sigma;
+
+      sigma.real = ( abs == 0.0F ? 1.0F : alpha->real / abs );
+      sigma.imag = ( abs == 0.0F ? 0.0F : alpha->imag / abs );
+
+      tau->real    = 1.0F / ( 1.0F + abs );
+      tau->imag    = 0.0F;
+      alpha->real += sigma.real;
+      alpha->imag += sigma.imag;
+      delta->real  = -sigma.real;
+      delta->imag  =  sigma.imag;
+
+      break;
+    }
+
+    case FLA_DOUBLE_COMPLEX:
+    {
+      dcomplex* alpha = FLA_DOUBLE_COMPLEX_PTR( alpha11 );
+      dcomplex* delta = FLA_DOUBLE_COMPLEX_PTR( delta1 );
+      dcomplex* tau   = FLA_DOUBLE_COMPLEX_PTR( tau1 );
+      double    abs   = sqrt( alpha->real * alpha->real + alpha->imag * alpha->imag );
+      dcomplex  sigma;
+
+      sigma.real = ( abs == 0.0 ? 1.0 : alpha->real / abs );
+      sigma.imag = ( abs == 0.0 ? 0.0 : alpha->imag / abs );
+
+      tau->real    = 1.0 / ( 1.0 + abs );
+      tau->imag    = 0.0;
+      alpha->real += sigma.real;
+      alpha->imag += sigma.imag;
+      delta->real  = -sigma.real;
+      delta->imag  =  sigma.imag;
+
+      break;
+    }
+  }
+}
+
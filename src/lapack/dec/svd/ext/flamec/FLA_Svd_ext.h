@@ -13,3 +13,9 @@ FLA_Error FLA_Svd_ext_u_unb_var1( FLA_Svd_type jobu, FLA_Svd_type jobv,
                                   FLA_Obj A, FLA_Obj s, FLA_Obj V, FLA_Obj U,
                                   dim_t k_accum,
                                   dim_t b_alg );
+
+FLA_Error FLA_Svd_ext_u_unb_var2( FLA_Svd_type jobu, FLA_Svd_type jobv, 
+                                  dim_t n_iter_max,
+                                  FLA_Obj A, FLA_Obj s, FLA_Obj U, FLA_Obj V,
+                                  dim_t k_accum,
+                                  dim_t b_alg );
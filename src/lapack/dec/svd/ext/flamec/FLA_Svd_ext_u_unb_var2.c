@@ -0,0 +1,234 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+
+FLA_Error FLA_Svd_ext_u_unb_var2( FLA_Svd_type jobu, FLA_Svd_type jobv, 
+                                  dim_t n_iter_max,
+                                  FLA_Obj A, FLA_Obj s, FLA_Obj U, FLA_Obj V,
+                                  dim_t k_accum,
+                                  dim_t b_alg )
+{
+    FLA_Error    r_val = FLA_SUCCESS;
+    FLA_Datatype dt;
+    FLA_Datatype dt_real;
+    FLA_Datatype dt_comp;
+    FLA_Obj      scale, TU, TV, VU, tu, VV, tv, rL, rR, d, e, G, H, C; // C is dummy.
+    FLA_Obj      B;
+    FLA_Bool     a_is_copied = FALSE;
+    dim_t        m_A, n_A, min_m_n;
+    dim_t        n_GH;
+    double       crossover_ratio = 17.0 / 9.0;
+    int          apply_scale;
+
+    // The vectors may not overwrite A, which holds the Householder vectors
+    // of both stages of the reduction until U and V are formed.
+    if ( jobu == FLA_SVD_VECTORS_MIN_OVERWRITE ||
+         jobv == FLA_SVD_VECTORS_MIN_OVERWRITE )
+    {
+        FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+    }
+
+    n_GH    = k_accum;
+
+    m_A     = FLA_Obj_length( A );
+    n_A     = FLA_Obj_width( A );
+    min_m_n = min( m_A, n_A );
+    dt      = FLA_Obj_datatype( A );
+    dt_real = FLA_Obj_datatype_proj_to_real( A );
+    dt_comp = FLA_Obj_datatype_proj_to_complex( A );
+
+    // The two-stage reduction requires A to be stored by columns, which it
+    // is not if it was flipped by the caller; reduce a copy in that case.
+    if ( FLA_Obj_row_stride( A ) != 1 )
+    {
+        FLA_Obj_create( dt, m_A, n_A, 0, 0, &B );
+        FLA_Copy( A, B );
+        A = B;
+        a_is_copied = TRUE;
+    }
+
+    // Create matrices to hold the Householder transformations of both stages.
+    FLA_Bidiag_UT_2s_create( A, FLA_BIDIAG_UT_2S_BANDWIDTH, &TU, &TV, &VU, &tu, &VV, &tv );
+
+    // Create vectors to hold the realifying scalars.
+    if ( FLA_Obj_is_complex( A ) )
+    {
+        FLA_Obj_create( dt,      min_m_n,      1, 0, 0, &rL );
+        FLA_Obj_create( dt,      min_m_n,      1, 0, 0, &rR );
+    }
+
+    // Create vectors to hold the diagonal and sub-diagonal.
+    FLA_Obj_create( dt_real, min_m_n,      1, 0, 0, &d );
+    FLA_Obj_create( dt_real, min_m_n-1,    1, 0, 0, &e );
+
+    // Create matrices to hold the left and right Givens scalars.
+    FLA_Obj_create( dt_comp, min_m_n-1, n_GH, 0, 0, &G );
+    FLA_Obj_create( dt_comp, min_m_n-1, n_GH, 0, 0, &H );
+
+    // Create a real scaling factor.
+    FLA_Obj_create( dt_real, 1, 1, 0, 0, &scale );
+
+    // Scale matrix A if necessary. 
+    FLA_Max_abs_value( A, scale );
+    apply_scale =
+      ( FLA_Obj_gt( scale, FLA_OVERFLOW_SQUARE_THRES  ) == TRUE ) -     
+      ( FLA_Obj_lt( scale, FLA_UNDERFLOW_SQUARE_THRES ) == TRUE ); 
+    
+    if ( apply_scale )
+      FLA_Scal( apply_scale > 0 ? FLA_SAFE_MIN : FLA_SAFE_INV_MIN, A );   
+
+    if ( m_A < crossover_ratio * n_A )
+    {
+        // Reduce the matrix to bidiagonal form in two stages.
+        // Apply scalars to rotate elements on the superdiagonal to the real domain.
+        // Extract the diagonal and superdiagonal from A.
+        FLA_Bidiag_UT_2s( A, TU, TV, VU, tu, VV, tv );
+        if ( FLA_Obj_is_complex( A ) )
+            FLA_Bidiag_UT_realify( A, rL, rR );
+        FLA_Bidiag_UT_extract_real_diagonals( A, d, e );
+
+        // Form U and V.
+        if ( jobu != FLA_SVD_VECTORS_NONE )
+            FLA_Bidiag_UT_2s_form_U( A, TU, VU, tu, U );
+        if ( jobv != FLA_SVD_VECTORS_NONE )
+            FLA_Bidiag_UT_2s_form_V( A, TV, VV, tv, V );
+
+        // For complex matrices, apply realification transformation.
+        if ( FLA_Obj_is_complex( A ) && jobu != FLA_SVD_VECTORS_NONE )
+        {
+            FLA_Obj UL, UR;
+            FLA_Part_1x2( U,   &UL, &UR,   min_m_n, FLA_LEFT );
+            FLA_Apply_diag_matrix( FLA_RIGHT, FLA_CONJUGATE,    rL, UL );
+        }
+        if ( FLA_Obj_is_complex( A ) && jobv != FLA_SVD_VECTORS_NONE )
+        {
+            FLA_Obj VL, VR;
+            FLA_Part_1x2( V,   &VL, &VR,   min_m_n, FLA_LEFT );
+            FLA_Apply_diag_matrix( FLA_RIGHT, FLA_NO_CONJUGATE, rR, VL );
+        }
+
+        // Perform a singular value decomposition on the upper bidiagonal matrix.
+        r_val = FLA_Bsvd_ext_opt_var1( n_iter_max,
+                                       d, e, G, H,
+                                       jobu, U, jobv, V,
+                                       FALSE, C, // C is not referenced
+                                       b_alg );
+    }
+    else // if ( crossover_ratio * n_A <= m_A )
+    {
+        FLA_Obj TQ, R, UR;
+        FLA_Obj AT,
+                AB;
+
+        // Perform a QR factorization on A.
+        FLA_QR_UT_create_T( A, &TQ );
+        FLA_QR_UT( A, TQ );
+
+        // Set the lower triangle of R to zero and then copy the upper
+        // triangle of A to R.
+        FLA_Part_2x1( A,   &AT,
+                           &AB,   n_A, FLA_TOP );
+        FLA_Obj_create( dt, n_A, n_A, 0, 0, &R );
+        FLA_Setr( FLA_LOWER_TRIANGULAR, FLA_ZERO, R );
+        FLA_Copyr( FLA_UPPER_TRIANGULAR, AT, R );
+
+        // Form U.
+        if ( jobu != FLA_SVD_VECTORS_NONE )
+            FLA_QR_UT_form_Q( A, TQ, U );
+        FLA_Obj_free( &TQ );
+
+        // Reduce the matrix to bidiagonal form in two stages.
+        // Apply scalars to rotate elements on the superdiagonal to the real domain.
+        // Extract the diagonal and superdiagonal from R.
+        FLA_Bidiag_UT_2s( R, TU, TV, VU, tu, VV, tv );
+        if ( FLA_Obj_is_complex( R ) )
+            FLA_Bidiag_UT_realify( R, rL, rR );
+        FLA_Bidiag_UT_extract_real_diagonals( R, d, e );
+
+        // Form V, and the left singular vectors of R in UR.
+        if ( jobv != FLA_SVD_VECTORS_NONE )
+            FLA_Bidiag_UT_2s_form_V( R, TV, VV, tv, V );
+
+        UR = R; // UR is not referenced if U is not formed.
+        if ( jobu != FLA_SVD_VECTORS_NONE )
+        {
+            FLA_Obj_create( dt, n_A, n_A, 0, 0, &UR );
+            FLA_Bidiag_UT_2s_form_U( R, TU, VU, tu, UR );
+        }
+
+        // Apply the realifying scalars in rL and rR to UR and V, respectively.
+        if ( FLA_Obj_is_complex( A ) && jobu != FLA_SVD_VECTORS_NONE )
+        {
+            FLA_Apply_diag_matrix( FLA_RIGHT, FLA_CONJUGATE,    rL, UR );
+        }
+        if ( FLA_Obj_is_complex( A ) && jobv != FLA_SVD_VECTORS_NONE )
+        {
+            FLA_Obj VL, VR;
+            FLA_Part_1x2( V,   &VL, &VR,   min_m_n, FLA_LEFT );
+            FLA_Apply_diag_matrix( FLA_RIGHT, FLA_NO_CONJUGATE, rR, VL );
+        }
+
+        // Perform a singular value decomposition on the bidiagonal matrix.
+        r_val = FLA_Bsvd_ext_opt_var1( n_iter_max,
+                                       d, e, G, H,
+                                       jobu, UR, jobv, V,
+                                       FALSE, C,
+                                       b_alg );
+
+        // Multiply UR into U, storing the result in A and then copying back
+        // to U.
+        if ( jobu != FLA_SVD_VECTORS_NONE )
+        {
+            FLA_Obj UL, UR2;
+            FLA_Part_1x2( U,   &UL, &UR2,  min_m_n, FLA_LEFT );
+
+            FLA_Gemm( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+                      FLA_ONE, UL, UR, FLA_ZERO, A );
+            FLA_Copy( A, UL );
+
+            FLA_Obj_free( &UR );
+        }
+        FLA_Obj_free( &R );
+    }
+
+    // Copy the converged eigenvalues to the output vector.
+    FLA_Copy( d, s );
+
+    // No sort is required as it is applied on FLA_Bsvd.
+
+    if ( apply_scale ) 
+      FLA_Scal( apply_scale < 0 ? FLA_SAFE_MIN : FLA_SAFE_INV_MIN, s ); 
+
+    FLA_Obj_free( &scale );
+    FLA_Obj_free( &TU );
+    FLA_Obj_free( &TV );
+    FLA_Obj_free( &VU );
+    FLA_Obj_free( &tu );
+    FLA_Obj_free( &VV );
+    FLA_Obj_free( &tv );
+
+    if ( FLA_Obj_is_complex( A ) )
+    {
+        FLA_Obj_free( &rL );
+        FLA_Obj_free( &rR );
+    }
+
+    FLA_Obj_free( &d );
+    FLA_Obj_free( &e );
+    FLA_Obj_free( &G );
+    FLA_Obj_free( &H );
+
+    if ( a_is_copied )
+        FLA_Obj_free( &B );
+
+    return r_val;
+}
@@ -13,9 +13,12 @@
 FLA_Error FLA_Svd( FLA_Svd_type jobu, FLA_Svd_type jobv, FLA_Obj A, FLA_Obj s, FLA_Obj U, FLA_Obj V )
 {
   FLA_Error r_val      = FLA_SUCCESS;
-  dim_t     n_iter_max = 30;
-  dim_t     k_accum    = 32;
-  dim_t     b_alg      = 512;
+  dim_t     n_iter_max;
+  dim_t     k_accum;
+  dim_t     b_alg;
+  dim_t     m_2s;
+  dim_t     m_2s_vec;
+  FLA_Bool  two_stage;
   dim_t     min_m_n    = FLA_Obj_min_dim( A );
   dim_t     m_A        = FLA_Obj_length( A );
   dim_t     n_A        = FLA_Obj_width( A );
@@ -25,17 +28,42 @@ FLA_Error FLA_Svd( FLA_Svd_type jobu, FLA_Svd_type jobv, FLA_Obj A, FLA_Obj s, F
   if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
     FLA_Svd_check( jobu, jobv, A, s, U, V );
 
+  // Query the (possibly tuned) parameters of the QR algorithm.
+  n_iter_max = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_SVD, FLA_TUNE_N_ITER_MAX );
+  k_accum    = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_SVD, FLA_TUNE_K_ACCUM );
+  b_alg      = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_SVD, FLA_TUNE_B_ALG );
+  m_2s       = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_SVD, FLA_TUNE_M_2S );
+  m_2s_vec   = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_SVD, FLA_TUNE_M_2S_VEC );
+
   // Partition U and V if necessary.
   if ( jobu == FLA_SVD_VECTORS_MIN_COPY ) FLA_Part_1x2( U, &U, &W, min_m_n, FLA_LEFT );
   if ( jobv == FLA_SVD_VECTORS_MIN_COPY ) FLA_Part_1x2( V, &V, &W, min_m_n, FLA_LEFT );
 
-  // Use extension version
+  // Reduce larger matrices to bidiagonal form in two stages, which casts
+  // most of the reduction in terms of level-3 operations. When the singular
+  // vectors are wanted, they must also be formed from the reflectors of both
+  // stages, which only pays off when enough threads chase the bulges of the
+  // second stage, so that case has its own switch point, off by default. The
+  // vectors may not overwrite A, which holds those reflectors.
+  if ( jobu == FLA_SVD_VECTORS_NONE && jobv == FLA_SVD_VECTORS_NONE )
+    two_stage = ( min_m_n >= m_2s );
+  else
+    two_stage = ( m_2s_vec > 0 && min_m_n >= m_2s_vec &&
+                  jobu != FLA_SVD_VECTORS_MIN_OVERWRITE &&
+                  jobv != FLA_SVD_VECTORS_MIN_OVERWRITE );
+
   if ( m_A >= n_A )
   {
-    r_val = FLA_Svd_ext_u_unb_var1( jobu, jobv, 
-                                    n_iter_max, 
-                                    A, s, U, V,
-                                    k_accum, b_alg );
+    if ( two_stage )
+      r_val = FLA_Svd_ext_u_unb_var2( jobu, jobv,
+                                      n_iter_max,
+                                      A, s, U, V,
+                                      k_accum, b_alg );
+    else
+      r_val = FLA_Svd_ext_u_unb_var1( jobu, jobv, 
+                                      n_iter_max, 
+                                      A, s, U, V,
+                                      k_accum, b_alg );
   }
   else
   {
@@ -43,10 +71,16 @@ FLA_Error FLA_Svd( FLA_Svd_type jobu, FLA_Svd_type jobv, FLA_Obj A, FLA_Obj s, F
     FLA_Obj_flip_base( &A );
     FLA_Obj_flip_view( &A );
     
-    r_val = FLA_Svd_ext_u_unb_var1( jobu, jobv, 
-                                    n_iter_max, 
-                                    A, s, V, U,
-                                    k_accum, b_alg );
+    if ( two_stage )
+      r_val = FLA_Svd_ext_u_unb_var2( jobu, jobv,
+                                      n_iter_max,
+                                      A, s, V, U,
+                                      k_accum, b_alg );
+    else
+      r_val = FLA_Svd_ext_u_unb_var1( jobu, jobv, 
+                                      n_iter_max, 
+                                      A, s, V, U,
+                                      k_accum, b_alg );
     
     // Recover A and conjugate U and V for complex cases
     FLA_Obj_flip_base( &A );
@@ -27,9 +27,9 @@ FLA_Error FLA_Svd_ext( FLA_Svd_type jobu, FLA_Trans transu,
                        FLA_Obj A, FLA_Obj s, FLA_Obj U, FLA_Obj V )
 {
   FLA_Error r_val      = FLA_SUCCESS;
-  dim_t     n_iter_max = 30;
-  dim_t     k_accum    = 32;
-  dim_t     b_alg      = 512;
+  dim_t     n_iter_max;
+  dim_t     k_accum;
+  dim_t     b_alg;
   dim_t     min_m_n    = FLA_Obj_min_dim( A );
   dim_t     m_A        = FLA_Obj_length( A );
   dim_t     n_A        = FLA_Obj_width( A );
@@ -41,6 +41,11 @@ FLA_Error FLA_Svd_ext( FLA_Svd_type jobu, FLA_Trans transu,
   if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
     FLA_Svd_ext_check( jobu, transu, jobv, transv, A, s, U, V );
 
+  // Query the (possibly tuned) parameters of the QR algorithm.
+  n_iter_max = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_SVD, FLA_TUNE_N_ITER_MAX );
+  k_accum    = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_SVD, FLA_TUNE_K_ACCUM );
+  b_alg      = FLA_Tune_get( FLA_Obj_datatype( A ), FLA_TUNE_SVD, FLA_TUNE_B_ALG );
+
   // Transpose U and V to match dimensions used in SVD. 
   if ( ( transu == FLA_TRANSPOSE        || transu == FLA_CONJ_TRANSPOSE            ) &&
        ( jobu   != FLA_SVD_VECTORS_NONE && jobu   != FLA_SVD_VECTORS_MIN_OVERWRITE ) )
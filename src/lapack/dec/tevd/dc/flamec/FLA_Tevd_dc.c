@@ -0,0 +1,74 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Tevd_dc( dim_t n_iter_max, FLA_Obj d, FLA_Obj e, FLA_Obj U, dim_t k_accum, dim_t b_alg )
+{
+	FLA_Error    r_val;
+	FLA_Datatype dt_real;
+	FLA_Datatype dt_comp;
+	FLA_Obj      Z, W, S, G, C;
+	FLA_Obj      Ur, Cr;
+	dim_t        m_A, m_U;
+
+	dt_real = FLA_Obj_datatype( d );
+	dt_comp = FLA_Obj_datatype_proj_to_complex( d );
+
+	m_A     = FLA_Obj_vector_dim( d );
+	m_U     = FLA_Obj_length( U );
+
+	if ( m_A <= 1 )
+		return FLA_SUCCESS;
+
+	// Create the eigenvectors of the tridiagonal matrix, workspace for the
+	// merges, and the Givens rotations of the QR algorithm at the leaves.
+	FLA_Obj_create( dt_real, m_A,   m_A,     0, 0, &Z );
+	FLA_Obj_create( dt_real, m_A,   m_A,     0, 0, &W );
+	FLA_Obj_create( dt_real, m_A,   m_A,     0, 0, &S );
+	FLA_Obj_create( dt_comp, m_A-1, k_accum, 0, 0, &G );
+
+	r_val = FLA_Tevd_dc_solve( n_iter_max, d, e, G, Z, W, S, b_alg );
+
+	// Apply the eigenvectors to U with one matrix-matrix multiplication.
+	FLA_Obj_create_copy_of( FLA_NO_TRANSPOSE, U, &C );
+
+	if ( FLA_Obj_is_real( U ) )
+	{
+		FLA_Gemm( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+		          FLA_ONE, C, Z, FLA_ZERO, U );
+	}
+	else
+	{
+		// A complex matrix times a real matrix is computed as a real matrix
+		// with twice as many rows, which holds the real and imaginary parts.
+		FLA_Obj_create_without_buffer( dt_real, 2 * m_U, m_A, &Ur );
+		FLA_Obj_create_without_buffer( dt_real, 2 * m_U, m_A, &Cr );
+		FLA_Obj_attach_buffer( FLA_Obj_buffer_at_view( U ), 1,
+		                       2 * FLA_Obj_col_stride( U ), &Ur );
+		FLA_Obj_attach_buffer( FLA_Obj_buffer_at_view( C ), 1,
+		                       2 * FLA_Obj_col_stride( C ), &Cr );
+
+		FLA_Gemm( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+		          FLA_ONE, Cr, Z, FLA_ZERO, Ur );
+
+		FLA_Obj_free_without_buffer( &Ur );
+		FLA_Obj_free_without_buffer( &Cr );
+	}
+
+	FLA_Obj_free( &C );
+	FLA_Obj_free( &Z );
+	FLA_Obj_free( &W );
+	FLA_Obj_free( &S );
+	FLA_Obj_free( &G );
+
+	return r_val;
+}
+
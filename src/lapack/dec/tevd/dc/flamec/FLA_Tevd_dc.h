@@ -0,0 +1,60 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+// Subproblems of this size or smaller are solved with the QR algorithm.
+#define FLA_TEVD_DC_LEAF_SIZE 32
+
+// --- FLA_Tevd_dc() -----------------------------------------------------------
+
+FLA_Error FLA_Tevd_dc( dim_t n_iter_max, FLA_Obj d, FLA_Obj e, FLA_Obj U, dim_t k_accum, dim_t b_alg );
+
+FLA_Error FLA_Tevd_dc_solve( dim_t n_iter_max, FLA_Obj d, FLA_Obj e, FLA_Obj G, FLA_Obj Z, FLA_Obj W, FLA_Obj S, dim_t b_alg );
+
+// --- FLA_Tevd_dc_merge() -----------------------------------------------------
+
+FLA_Error FLA_Tevd_dc_merge( dim_t n1, FLA_Obj beta, FLA_Obj d, FLA_Obj Z, FLA_Obj W, FLA_Obj S );
+FLA_Error FLA_Tevd_dc_merge_ops( int       m_A,
+                                 int       n1,
+                                 float     beta,
+                                 float*    buff_d, int inc_d,
+                                 float*    buff_Z, int rs_Z, int cs_Z,
+                                 float*    buff_W, int rs_W, int cs_W,
+                                 float*    buff_S, int rs_S, int cs_S,
+                                 int*      k,
+                                 int*      k1,
+                                 int*      k3 );
+FLA_Error FLA_Tevd_dc_merge_opd( int       m_A,
+                                 int       n1,
+                                 double    beta,
+                                 double*   buff_d, int inc_d,
+                                 double*   buff_Z, int rs_Z, int cs_Z,
+                                 double*   buff_W, int rs_W, int cs_W,
+                                 double*   buff_S, int rs_S, int cs_S,
+                                 int*      k,
+                                 int*      k1,
+                                 int*      k3 );
+
+// --- FLA_Tevd_dc_secular() ---------------------------------------------------
+
+FLA_Error FLA_Tevd_dc_secular_ops( int       m_A,
+                                   int       i,
+                                   float*    buff_dl,
+                                   float*    buff_w,
+                                   float     rho,
+                                   float*    buff_delta,
+                                   float*    lambda );
+FLA_Error FLA_Tevd_dc_secular_opd( int       m_A,
+                                   int       i,
+                                   double*   buff_dl,
+                                   double*   buff_w,
+                                   double    rho,
+                                   double*   buff_delta,
+                                   double*   lambda );
+
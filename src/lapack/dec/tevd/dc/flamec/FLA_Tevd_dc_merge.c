@@ -0,0 +1,638 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Tevd_dc_merge( dim_t n1, FLA_Obj beta, FLA_Obj d, FLA_Obj Z, FLA_Obj W, FLA_Obj S )
+{
+	FLA_Error    r_val = FLA_SUCCESS;
+	FLA_Datatype datatype;
+	FLA_Obj      ZL, ZR;
+	FLA_Obj      ZLT,
+	             ZLB;
+	FLA_Obj      WL, WR;
+	FLA_Obj      WLT,
+	             WLB;
+	FLA_Obj      STL, STR,
+	             SBL, SBR;
+	FLA_Obj      W12, W3, W1, W23;
+	FLA_Obj      S12, S3, S1, S23;
+	double       beta_value;
+	int          m_A;
+	int          inc_d;
+	int          rs_Z, cs_Z;
+	int          rs_W, cs_W;
+	int          rs_S, cs_S;
+	int          k = 0, k1 = 0, k3 = 0;
+
+	datatype = FLA_Obj_datatype( Z );
+
+	m_A       = FLA_Obj_vector_dim( d );
+	inc_d     = FLA_Obj_vector_inc( d );
+
+	rs_Z      = FLA_Obj_row_stride( Z );
+	cs_Z      = FLA_Obj_col_stride( Z );
+	rs_W      = FLA_Obj_row_stride( W );
+	cs_W      = FLA_Obj_col_stride( W );
+	rs_S      = FLA_Obj_row_stride( S );
+	cs_S      = FLA_Obj_col_stride( S );
+
+	FLA_Obj_extract_real_scalar( beta, &beta_value );
+
+	switch ( datatype )
+	{
+		case FLA_FLOAT:
+		{
+			float*    buff_d = FLA_FLOAT_PTR( d );
+			float*    buff_Z = FLA_FLOAT_PTR( Z );
+			float*    buff_W = FLA_FLOAT_PTR( W );
+			float*    buff_S = FLA_FLOAT_PTR( S );
+
+			r_val = FLA_Tevd_dc_merge_ops( m_A,
+			                               n1,
+			                               ( float ) beta_value,
+			                               buff_d, inc_d,
+			                               buff_Z, rs_Z, cs_Z,
+			                               buff_W, rs_W, cs_W,
+			                               buff_S, rs_S, cs_S,
+			                               &k, &k1, &k3 );
+
+			break;
+		}
+
+		case FLA_DOUBLE:
+		{
+			double*   buff_d = FLA_DOUBLE_PTR( d );
+			double*   buff_Z = FLA_DOUBLE_PTR( Z );
+			double*   buff_W = FLA_DOUBLE_PTR( W );
+			double*   buff_S = FLA_DOUBLE_PTR( S );
+
+			r_val = FLA_Tevd_dc_merge_opd( m_A,
+			                               n1,
+			                               beta_value,
+			                               buff_d, inc_d,
+			                               buff_Z, rs_Z, cs_Z,
+			                               buff_W, rs_W, cs_W,
+			                               buff_S, rs_S, cs_S,
+			                               &k, &k1, &k3 );
+
+			break;
+		}
+	}
+
+	// The first k columns of W hold the eigenvectors of the two halves that
+	// did not deflate, ordered so that the ones nonzero only in the top half
+	// (k1 columns) come first and the ones nonzero only in the bottom half
+	// (k3 columns) come last. The remaining columns hold the deflated
+	// eigenvectors.
+	FLA_Part_1x2( Z,    &ZL,  &ZR,      k, FLA_LEFT );
+	FLA_Part_1x2( W,    &WL,  &WR,      k, FLA_LEFT );
+
+	FLA_Part_2x1( ZL,   &ZLT,
+	                    &ZLB,           n1, FLA_TOP );
+	FLA_Part_2x1( WL,   &WLT,
+	                    &WLB,           n1, FLA_TOP );
+
+	FLA_Part_2x2( S,    &STL, &STR,
+	                    &SBL, &SBR,     k, k, FLA_TL );
+
+	// Multiply the eigenvectors of the rank-one modified problem into the
+	// top and bottom halves, skipping the columns that are zero there.
+	FLA_Part_1x2( WLT,  &W12, &W3,      k3, FLA_RIGHT );
+	FLA_Part_2x1( STL,  &S12,
+	                    &S3,            k3, FLA_BOTTOM );
+
+	if ( k - k3 > 0 )
+		FLA_Gemm( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+		          FLA_ONE, W12, S12, FLA_ZERO, ZLT );
+	else
+		FLA_Set( FLA_ZERO, ZLT );
+
+	FLA_Part_1x2( WLB,  &W1,  &W23,     k1, FLA_LEFT );
+	FLA_Part_2x1( STL,  &S1,
+	                    &S23,           k1, FLA_TOP );
+
+	if ( k - k1 > 0 )
+		FLA_Gemm( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+		          FLA_ONE, W23, S23, FLA_ZERO, ZLB );
+	else
+		FLA_Set( FLA_ZERO, ZLB );
+
+	// The deflated eigenvectors are unchanged.
+	FLA_Copy( WR, ZR );
+
+	// Sort the eigenvalues and eigenvectors in ascending order.
+	FLA_Sort_evd( FLA_FORWARD, d, Z );
+
+	return r_val;
+}
+
+
+
+FLA_Error FLA_Tevd_dc_merge_ops( int       m_A,
+                                 int       n1,
+                                 float     beta,
+                                 float*    buff_d, int inc_d,
+                                 float*    buff_Z, int rs_Z, int cs_Z,
+                                 float*    buff_W, int rs_W, int cs_W,
+                                 float*    buff_S, int rs_S, int cs_S,
+                                 int*      k,
+                                 int*      k1,
+                                 int*      k3 )
+{
+	float     rzero = bl1_s0();
+	float     rone  = bl1_s1();
+	float     rtwo  = bl1_s2();
+
+	FLA_Error r_val = FLA_SUCCESS;
+	float*    z;
+	float*    dl;
+	float*    w;
+	float*    lambda;
+	float*    temp;
+	int*      perm;
+	int*      type;
+	int*      nd;
+	int*      defl;
+	int*      order;
+	float     eps, tol, rho, zmax, dmax;
+	float     c, s, tau, t, x, y, prod;
+	float*    s_j;
+	int       i, j, l, q, a, b, pj, nj;
+	int       n_nd, n_defl, t_i;
+
+	z      = ( float* ) FLA_malloc( m_A * sizeof( float ) );
+	dl     = ( float* ) FLA_malloc( m_A * sizeof( float ) );
+	w      = ( float* ) FLA_malloc( m_A * sizeof( float ) );
+	lambda = ( float* ) FLA_malloc( m_A * sizeof( float ) );
+	temp   = ( float* ) FLA_malloc( m_A * sizeof( float ) );
+	perm   = ( int*   ) FLA_malloc( m_A * sizeof( int ) );
+	type   = ( int*   ) FLA_malloc( m_A * sizeof( int ) );
+	nd     = ( int*   ) FLA_malloc( m_A * sizeof( int ) );
+	defl   = ( int*   ) FLA_malloc( m_A * sizeof( int ) );
+	order  = ( int*   ) FLA_malloc( m_A * sizeof( int ) );
+
+	eps = FLA_Mach_params_ops( FLA_MACH_EPS );
+
+	// Form the updating vector from the last row of the eigenvectors of the
+	// top half and the first row of those of the bottom half, normalized so
+	// that it has unit length. Its columns are nonzero only in the top (1)
+	// or the bottom (3) half.
+	for ( j = 0; j < n1; ++j )
+	{
+		z[j]    = buff_Z[ (n1-1)*rs_Z + j*cs_Z ] / sqrt( rtwo );
+		type[j] = 1;
+	}
+	for ( j = n1; j < m_A; ++j )
+	{
+		z[j]    = buff_Z[ (n1  )*rs_Z + j*cs_Z ] / sqrt( rtwo );
+		if ( beta < rzero ) z[j] = -z[j];
+		type[j] = 3;
+	}
+
+	rho = rtwo * fabs( beta );
+
+	// Merge the sorted eigenvalues of the two halves.
+	for ( q = 0, a = 0, b = n1; q < m_A; ++q )
+	{
+		if ( b >= m_A || ( a < n1 && buff_d[ a*inc_d ] <= buff_d[ b*inc_d ] ) )
+			perm[q] = a++;
+		else
+			perm[q] = b++;
+	}
+
+	zmax = rzero;
+	dmax = rzero;
+	for ( j = 0; j < m_A; ++j )
+	{
+		zmax = max( zmax, fabs( z[j] ) );
+		dmax = max( dmax, fabs( buff_d[ j*inc_d ] ) );
+	}
+
+	tol = 8.0F * eps * max( dmax, zmax );
+
+	// Deflate eigenvalues whose component of the updating vector is
+	// negligible, and rotate away one of two nearly equal eigenvalues.
+	n_nd   = 0;
+	n_defl = 0;
+	pj     = -1;
+
+	for ( q = 0; q < m_A; ++q )
+	{
+		nj = perm[q];
+
+		if ( rho * fabs( z[nj] ) <= tol )
+		{
+			defl[ n_defl++ ] = nj;
+			continue;
+		}
+
+		if ( pj < 0 )
+		{
+			pj = nj;
+			continue;
+		}
+
+		s   = z[pj];
+		c   = z[nj];
+		FLA_Pythag2_ops( &c, &s, &tau );
+		t   = buff_d[ nj*inc_d ] - buff_d[ pj*inc_d ];
+		c   =  c / tau;
+		s   = -s / tau;
+
+		if ( fabs( t * c * s ) <= tol )
+		{
+			z[nj] = tau;
+			z[pj] = rzero;
+
+			for ( i = 0; i < m_A; ++i )
+			{
+				x = buff_Z[ i*rs_Z + pj*cs_Z ];
+				y = buff_Z[ i*rs_Z + nj*cs_Z ];
+				buff_Z[ i*rs_Z + pj*cs_Z ] = c * x + s * y;
+				buff_Z[ i*rs_Z + nj*cs_Z ] = c * y - s * x;
+			}
+
+			if ( type[pj] != type[nj] )
+				type[nj] = 2;
+
+			t = buff_d[ pj*inc_d ] * c * c + buff_d[ nj*inc_d ] * s * s;
+			buff_d[ nj*inc_d ] = buff_d[ pj*inc_d ] * s * s + buff_d[ nj*inc_d ] * c * c;
+			buff_d[ pj*inc_d ] = t;
+
+			defl[ n_defl++ ] = pj;
+		}
+		else
+		{
+			nd[ n_nd++ ] = pj;
+		}
+
+		pj = nj;
+	}
+
+	if ( pj >= 0 )
+		nd[ n_nd++ ] = pj;
+
+	// Solve the secular equation for each eigenvalue that did not deflate.
+	// Column j of S holds the differences between the poles and root j.
+	for ( i = 0; i < n_nd; ++i )
+	{
+		dl[i] = buff_d[ nd[i]*inc_d ];
+		w[i]  = z[ nd[i] ];
+	}
+
+	for ( j = 0; j < n_nd; ++j )
+	{
+		if ( FLA_Tevd_dc_secular_ops( n_nd, j, dl, w, rho,
+		                              buff_S + j*cs_S, &lambda[j] ) != FLA_SUCCESS )
+			r_val = FLA_FAILURE;
+	}
+
+	// Recompute the updating vector from the computed roots, so that the
+	// eigenvectors are numerically orthogonal even though the roots are
+	// only accurate to working precision.
+	for ( l = 0; l < n_nd; ++l )
+	{
+		prod = -buff_S[ l*rs_S + l*cs_S ];
+
+		for ( j = 0; j < n_nd; ++j )
+			if ( j != l )
+				prod *= -buff_S[ l*rs_S + j*cs_S ] / ( dl[j] - dl[l] );
+
+		w[l] = ( w[l] >= rzero ? rone : -rone ) * sqrt( fabs( prod ) / rho );
+	}
+
+	// Form the eigenvectors of the rank-one modified diagonal matrix.
+	for ( j = 0; j < n_nd; ++j )
+	{
+		s_j = buff_S + j*cs_S;
+		t   = rzero;
+
+		for ( l = 0; l < n_nd; ++l )
+		{
+			s_j[ l*rs_S ] = w[l] / s_j[ l*rs_S ];
+			t += s_j[ l*rs_S ] * s_j[ l*rs_S ];
+		}
+
+		t = sqrt( t );
+
+		for ( l = 0; l < n_nd; ++l )
+			s_j[ l*rs_S ] /= t;
+	}
+
+	// Group the eigenvectors of the two halves by the rows in which they
+	// are nonzero, and permute the rows of S to match.
+	for ( q = 0, t_i = 1; t_i <= 3; ++t_i )
+		for ( l = 0; l < n_nd; ++l )
+			if ( type[ nd[l] ] == t_i )
+				order[q++] = l;
+
+	*k  = n_nd;
+	*k1 = 0;
+	*k3 = 0;
+	for ( l = 0; l < n_nd; ++l )
+	{
+		if ( type[ nd[l] ] == 1 ) ( *k1 )++;
+		if ( type[ nd[l] ] == 3 ) ( *k3 )++;
+	}
+
+	for ( q = 0; q < n_nd; ++q )
+		for ( i = 0; i < m_A; ++i )
+			buff_W[ i*rs_W + q*cs_W ] = buff_Z[ i*rs_Z + nd[ order[q] ]*cs_Z ];
+
+	for ( j = 0; j < n_nd; ++j )
+	{
+		s_j = buff_S + j*cs_S;
+
+		for ( q = 0; q < n_nd; ++q )
+			temp[q] = s_j[ order[q]*rs_S ];
+		for ( q = 0; q < n_nd; ++q )
+			s_j[ q*rs_S ] = temp[q];
+	}
+
+	// Copy out the deflated eigenvectors and place all of the eigenvalues.
+	for ( q = 0; q < n_defl; ++q )
+	{
+		for ( i = 0; i < m_A; ++i )
+			buff_W[ i*rs_W + (n_nd+q)*cs_W ] = buff_Z[ i*rs_Z + defl[q]*cs_Z ];
+
+		temp[q] = buff_d[ defl[q]*inc_d ];
+	}
+
+	for ( q = 0; q < n_defl; ++q )
+		buff_d[ (n_nd+q)*inc_d ] = temp[q];
+	for ( j = 0; j < n_nd; ++j )
+		buff_d[ j*inc_d ] = lambda[j];
+
+	FLA_free( z );
+	FLA_free( dl );
+	FLA_free( w );
+	FLA_free( lambda );
+	FLA_free( temp );
+	FLA_free( perm );
+	FLA_free( type );
+	FLA_free( nd );
+	FLA_free( defl );
+	FLA_free( order );
+
+	return r_val;
+}
+
+
+
+FLA_Error FLA_Tevd_dc_merge_opd( int       m_A,
+                                 int       n1,
+                                 double    beta,
+                                 double*   buff_d, int inc_d,
+                                 double*   buff_Z, int rs_Z, int cs_Z,
+                                 double*   buff_W, int rs_W, int cs_W,
+                                 double*   buff_S, int rs_S, int cs_S,
+                                 int*      k,
+                                 int*      k1,
+                                 int*      k3 )
+{
+	double    rzero = bl1_d0();
+	double    rone  = bl1_d1();
+	double    rtwo  = bl1_d2();
+
+	FLA_Error r_val = FLA_SUCCESS;
+	double*   z;
+	double*   dl;
+	double*   w;
+	double*   lambda;
+	double*   temp;
+	int*      perm;
+	int*      type;
+	int*      nd;
+	int*      defl;
+	int*      order;
+	double    eps, tol, rho, zmax, dmax;
+	double    c, s, tau, t, x, y, prod;
+	double*   s_j;
+	int       i, j, l, q, a, b, pj, nj;
+	int       n_nd, n_defl, t_i;
+
+	z      = ( double* ) FLA_malloc( m_A * sizeof( double ) );
+	dl     = ( double* ) FLA_malloc( m_A * sizeof( double ) );
+	w      = ( double* ) FLA_malloc( m_A * sizeof( double ) );
+	lambda = ( double* ) FLA_malloc( m_A * sizeof( double ) );
+	temp   = ( double* ) FLA_malloc( m_A * sizeof( double ) );
+	perm   = ( int*    ) FLA_malloc( m_A * sizeof( int ) );
+	type   = ( int*    ) FLA_malloc( m_A * sizeof( int ) );
+	nd     = ( int*    ) FLA_malloc( m_A * sizeof( int ) );
+	defl   = ( int*    ) FLA_malloc( m_A * sizeof( int ) );
+	order  = ( int*    ) FLA_malloc( m_A * sizeof( int ) );
+
+	eps = FLA_Mach_params_opd( FLA_MACH_EPS );
+
+	// Form the updating vector from the last row of the eigenvectors of the
+	// top half and the first row of those of the bottom half, normalized so
+	// that it has unit length. Its columns are nonzero only in the top (1)
+	// or the bottom (3) half.
+	for ( j = 0; j < n1; ++j )
+	{
+		z[j]    = buff_Z[ (n1-1)*rs_Z + j*cs_Z ] / sqrt( rtwo );
+		type[j] = 1;
+	}
+	for ( j = n1; j < m_A; ++j )
+	{
+		z[j]    = buff_Z[ (n1  )*rs_Z + j*cs_Z ] / sqrt( rtwo );
+		if ( beta < rzero ) z[j] = -z[j];
+		type[j] = 3;
+	}
+
+	rho = rtwo * fabs( beta );
+
+	// Merge the sorted eigenvalues of the two halves.
+	for ( q = 0, a = 0, b = n1; q < m_A; ++q )
+	{
+		if ( b >= m_A || ( a < n1 && buff_d[ a*inc_d ] <= buff_d[ b*inc_d ] ) )
+			perm[q] = a++;
+		else
+			perm[q] = b++;
+	}
+
+	zmax = rzero;
+	dmax = rzero;
+	for ( j = 0; j < m_A; ++j )
+	{
+		zmax = max( zmax, fabs( z[j] ) );
+		dmax = max( dmax, fabs( buff_d[ j*inc_d ] ) );
+	}
+
+	tol = 8.0 * eps * max( dmax, zmax );
+
+	// Deflate eigenvalues whose component of the updating vector is
+	// negligible, and rotate away one of two nearly equal eigenvalues.
+	n_nd   = 0;
+	n_defl = 0;
+	pj     = -1;
+
+	for ( q = 0; q < m_A; ++q )
+	{
+		nj = perm[q];
+
+		if ( rho * fabs( z[nj] ) <= tol )
+		{
+			defl[ n_defl++ ] = nj;
+			continue;
+		}
+
+		if ( pj < 0 )
+		{
+			pj = nj;
+			continue;
+		}
+
+		s   = z[pj];
+		c   = z[nj];
+		FLA_Pythag2_opd( &c, &s, &tau );
+		t   = buff_d[ nj*inc_d ] - buff_d[ pj*inc_d ];
+		c   =  c / tau;
+		s   = -s / tau;
+
+		if ( fabs( t * c * s ) <= tol )
+		{
+			z[nj] = tau;
+			z[pj] = rzero;
+
+			for ( i = 0; i < m_A; ++i )
+			{
+				x = buff_Z[ i*rs_Z + pj*cs_Z ];
+				y = buff_Z[ i*rs_Z + nj*cs_Z ];
+				buff_Z[ i*rs_Z + pj*cs_Z ] = c * x + s * y;
+				buff_Z[ i*rs_Z + nj*cs_Z ] = c * y - s * x;
+			}
+
+			if ( type[pj] != type[nj] )
+				type[nj] = 2;
+
+			t = buff_d[ pj*inc_d ] * c * c + buff_d[ nj*inc_d ] * s * s;
+			buff_d[ nj*inc_d ] = buff_d[ pj*inc_d ] * s * s + buff_d[ nj*inc_d ] * c * c;
+			buff_d[ pj*inc_d ] = t;
+
+			defl[ n_defl++ ] = pj;
+		}
+		else
+		{
+			nd[ n_nd++ ] = pj;
+		}
+
+		pj = nj;
+	}
+
+	if ( pj >= 0 )
+		nd[ n_nd++ ] = pj;
+
+	// Solve the secular equation for each eigenvalue that did not deflate.
+	// Column j of S holds the differences between the poles and root j.
+	for ( i = 0; i < n_nd; ++i )
+	{
+		dl[i] = buff_d[ nd[i]*inc_d ];
+		w[i]  = z[ nd[i] ];
+	}
+
+	for ( j = 0; j < n_nd; ++j )
+	{
+		if ( FLA_Tevd_dc_secular_opd( n_nd, j, dl, w, rho,
+		                              buff_S + j*cs_S, &lambda[j] ) != FLA_SUCCESS )
+			r_val = FLA_FAILURE;
+	}
+
+	// Recompute the updating vector from the computed roots, so that the
+	// eigenvectors are numerically orthogonal even though the roots are
+	// only accurate to working precision.
+	for ( l = 0; l < n_nd; ++l )
+	{
+		prod = -buff_S[ l*rs_S + l*cs_S ];
+
+		for ( j = 0; j < n_nd; ++j )
+			if ( j != l )
+				prod *= -buff_S[ l*rs_S + j*cs_S ] / ( dl[j] - dl[l] );
+
+		w[l] = ( w[l] >= rzero ? rone : -rone ) * sqrt( fabs( prod ) / rho );
+	}
+
+	// Form the eigenvectors of the rank-one modified diagonal matrix.
+	for ( j = 0; j < n_nd; ++j )
+	{
+		s_j = buff_S + j*cs_S;
+		t   = rzero;
+
+		for ( l = 0; l < n_nd; ++l )
+		{
+			s_j[ l*rs_S ] = w[l] / s_j[ l*rs_S ];
+			t += s_j[ l*rs_S ] * s_j[ l*rs_S ];
+		}
+
+		t = sqrt( t );
+
+		for ( l = 0; l < n_nd; ++l )
+			s_j[ l*rs_S ] /= t;
+	}
+
+	// Group the eigenvectors of the two halves by the rows in which they
+	// are nonzero, and permute the rows of S to match.
+	for ( q = 0, t_i = 1; t_i <= 3; ++t_i )
+		for ( l = 0; l < n_nd; ++l )
+			if ( type[ nd[l] ] == t_i )
+				order[q++] = l;
+
+	*k  = n_nd;
+	*k1 = 0;
+	*k3 = 0;
+	for ( l = 0; l < n_nd; ++l )
+	{
+		if ( type[ nd[l] ] == 1 ) ( *k1 )++;
+		if ( type[ nd[l] ] == 3 ) ( *k3 )++;
+	}
+
+	for ( q = 0; q < n_nd; ++q )
+		for ( i = 0; i < m_A; ++i )
+			buff_W[ i*rs_W + q*cs_W ] = buff_Z[ i*rs_Z + nd[ order[q] ]*cs_Z ];
+
+	for ( j = 0; j < n_nd; ++j )
+	{
+		s_j = buff_S + j*cs_S;
+
+		for ( q = 0; q < n_nd; ++q )
+			temp[q] = s_j[ order[q]*rs_S ];
+		for ( q = 0; q < n_nd; ++q )
+			s_j[ q*rs_S ] = temp[q];
+	}
+
+	// Copy out the deflated eigenvectors and place all of the eigenvalues.
+	for ( q = 0; q < n_defl; ++q )
+	{
+		for ( i = 0; i < m_A; ++i )
+			buff_W[ i*rs_W + (n_nd+q)*cs_W ] = buff_Z[ i*rs_Z + defl[q]*cs_Z ];
+
+		temp[q] = buff_d[ defl[q]*inc_d ];
+	}
+
+	for ( q = 0; q < n_defl; ++q )
+		buff_d[ (n_nd+q)*inc_d ] = temp[q];
+	for ( j = 0; j < n_nd; ++j )
+		buff_d[ j*inc_d ] = lambda[j];
+
+	FLA_free( z );
+	FLA_free( dl );
+	FLA_free( w );
+	FLA_free( lambda );
+	FLA_free( temp );
+	FLA_free( perm );
+	FLA_free( type );
+	FLA_free( nd );
+	FLA_free( defl );
+	FLA_free( order );
+
+	return r_val;
+}
+
@@ -0,0 +1,308 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#define FLA_TEVD_DC_SECULAR_MAX_ITER 100
+
+FLA_Error FLA_Tevd_dc_secular_ops( int       m_A,
+                                   int       i,
+                                   float*    buff_dl,
+                                   float*    buff_w,
+                                   float     rho,
+                                   float*    buff_delta,
+                                   float*    lambda )
+{
+	float     rzero = bl1_s0();
+	float     rone  = bl1_s1();
+	float     rtwo  = bl1_s2();
+
+	float     eps;
+	float     rhoinv;
+	float     origin;
+	float     lo, hi, tau, tau_new, eta;
+	float     psi, dpsi, phi, dphi, f, erretm;
+	float     di, dn, b, bn, c, aa, bb, sq, r1, r2;
+	float     diff, t;
+	int       j, iter;
+
+	eps    = FLA_Mach_params_ops( FLA_MACH_EPS );
+	rhoinv = rone / rho;
+
+	// Choose the pole nearest to the root as the origin, so that the
+	// distances from the root to the poles are formed accurately.
+	if ( i < m_A - 1 )
+	{
+		hi = ( buff_dl[i+1] - buff_dl[i] ) / rtwo;
+
+		f = rhoinv;
+		for ( j = 0; j < m_A; ++j )
+			f += buff_w[j] * buff_w[j] / ( ( buff_dl[j] - buff_dl[i] ) - hi );
+
+		if ( f >= rzero )
+		{
+			origin = buff_dl[i];
+			lo     = rzero;
+			tau    = hi / rtwo;
+			for ( j = 0; j < m_A; ++j )
+				buff_delta[j] = buff_dl[j] - buff_dl[i];
+		}
+		else
+		{
+			origin = buff_dl[i+1];
+			lo     = -hi;
+			hi     = rzero;
+			tau    = lo / rtwo;
+			for ( j = 0; j < m_A; ++j )
+				buff_delta[j] = buff_dl[j] - buff_dl[i+1];
+		}
+	}
+	else
+	{
+		// The largest root lies within rho * w' * w of the largest pole.
+		origin = buff_dl[i];
+		lo     = rzero;
+		hi     = rzero;
+		for ( j = 0; j < m_A; ++j )
+		{
+			hi += rho * buff_w[j] * buff_w[j];
+			buff_delta[j] = buff_dl[j] - buff_dl[i];
+		}
+		tau    = hi / rtwo;
+	}
+
+	for ( iter = 0; iter < FLA_TEVD_DC_SECULAR_MAX_ITER; ++iter )
+	{
+		// Evaluate the secular function and its derivative, split into the
+		// poles to the left (psi) and to the right (phi) of the root.
+		psi = dpsi = phi = dphi = rzero;
+		for ( j = 0; j < m_A; ++j )
+		{
+			diff = buff_delta[j] - tau;
+			t    = buff_w[j] / diff;
+			if ( j <= i ) { psi += buff_w[j] * t; dpsi += t * t; }
+			else          { phi += buff_w[j] * t; dphi += t * t; }
+		}
+
+		f      = rhoinv + psi + phi;
+		erretm = 8.0F * ( phi - psi ) + rtwo * rhoinv +
+		         3.0F * fabs( tau ) * ( dpsi + dphi );
+
+		if ( fabs( f ) <= eps * erretm )
+			break;
+
+		// Shrink the interval known to contain the root.
+		if ( f < rzero ) lo = tau;
+		else             hi = tau;
+
+		if ( hi - lo <= rtwo * eps * max( fabs( lo ), fabs( hi ) ) )
+			break;
+
+		// Interpolate the secular function by one pole on each side of the
+		// root and take the zero of the interpolant as the next iterate.
+		di = buff_delta[i] - tau;
+		b  = di * di * dpsi;
+
+		if ( i < m_A - 1 )
+		{
+			dn = buff_delta[i+1] - tau;
+			bn = dn * dn * dphi;
+			c  = f - b / di - bn / dn;
+
+			aa = c * ( di + dn ) + b + bn;
+			bb = c * di * dn + b * dn + bn * di;
+
+			if ( c == rzero )
+			{
+				eta = bb / aa;
+			}
+			else
+			{
+				sq = sqrt( max( aa * aa - 4.0F * c * bb, rzero ) );
+				if ( aa >= rzero ) { r1 = ( aa + sq ) / ( rtwo * c ); r2 = rtwo * bb / ( aa + sq ); }
+				else               { r1 = ( aa - sq ) / ( rtwo * c ); r2 = rtwo * bb / ( aa - sq ); }
+
+				eta = ( di < r2 && r2 < dn ? r2 : r1 );
+			}
+		}
+		else
+		{
+			c   = f - b / di;
+			eta = di + b / c;
+		}
+
+		tau_new = tau + eta;
+
+		// Fall back to bisection if the iterate leaves the interval.
+		if ( !( lo < tau_new && tau_new < hi ) )
+			tau_new = ( lo + hi ) / rtwo;
+
+		if ( tau_new == tau )
+			break;
+
+		tau = tau_new;
+	}
+
+	for ( j = 0; j < m_A; ++j )
+		buff_delta[j] -= tau;
+
+	*lambda = origin + tau;
+
+	return ( iter < FLA_TEVD_DC_SECULAR_MAX_ITER ? FLA_SUCCESS : FLA_FAILURE );
+}
+
+
+
+FLA_Error FLA_Tevd_dc_secular_opd( int       m_A,
+                                   int       i,
+                                   double*   buff_dl,
+                                   double*   buff_w,
+                                   double    rho,
+                                   double*   buff_delta,
+                                   double*   lambda )
+{
+	double    rzero = bl1_d0();
+	double    rone  = bl1_d1();
+	double    rtwo  = bl1_d2();
+
+	double    eps;
+	double    rhoinv;
+	double    origin;
+	double    lo, hi, tau, tau_new, eta;
+	double    psi, dpsi, phi, dphi, f, erretm;
+	double    di, dn, b, bn, c, aa, bb, sq, r1, r2;
+	double    diff, t;
+	int       j, iter;
+
+	eps    = FLA_Mach_params_opd( FLA_MACH_EPS );
+	rhoinv = rone / rho;
+
+	// Choose the pole nearest to the root as the origin, so that the
+	// distances from the root to the poles are formed accurately.
+	if ( i < m_A - 1 )
+	{
+		hi = ( buff_dl[i+1] - buff_dl[i] ) / rtwo;
+
+		f = rhoinv;
+		for ( j = 0; j < m_A; ++j )
+			f += buff_w[j] * buff_w[j] / ( ( buff_dl[j] - buff_dl[i] ) - hi );
+
+		if ( f >= rzero )
+		{
+			origin = buff_dl[i];
+			lo     = rzero;
+			tau    = hi / rtwo;
+			for ( j = 0; j < m_A; ++j )
+				buff_delta[j] = buff_dl[j] - buff_dl[i];
+		}
+		else
+		{
+			origin = buff_dl[i+1];
+			lo     = -hi;
+			hi     = rzero;
+			tau    = lo / rtwo;
+			for ( j = 0; j < m_A; ++j )
+				buff_delta[j] = buff_dl[j] - buff_dl[i+1];
+		}
+	}
+	else
+	{
+		// The largest root lies within rho * w' * w of the largest pole.
+		origin = buff_dl[i];
+		lo     = rzero;
+		hi     = rzero;
+		for ( j = 0; j < m_A; ++j )
+		{
+			hi += rho * buff_w[j] * buff_w[j];
+			buff_delta[j] = buff_dl[j] - buff_dl[i];
+		}
+		tau    = hi / rtwo;
+	}
+
+	for ( iter = 0; iter < FLA_TEVD_DC_SECULAR_MAX_ITER; ++iter )
+	{
+		// Evaluate the secular function and its derivative, split into the
+		// poles to the left (psi) and to the right (phi) of the root.
+		psi = dpsi = phi = dphi = rzero;
+		for ( j = 0; j < m_A; ++j )
+		{
+			diff = buff_delta[j] - tau;
+			t    = buff_w[j] / diff;
+			if ( j <= i ) { psi += buff_w[j] * t; dpsi += t * t; }
+			else          { phi += buff_w[j] * t; dphi += t * t; }
+		}
+
+		f      = rhoinv + psi + phi;
+		erretm = 8.0 * ( phi - psi ) + rtwo * rhoinv +
+		         3.0 * fabs( tau ) * ( dpsi + dphi );
+
+		if ( fabs( f ) <= eps * erretm )
+			break;
+
+		// Shrink the interval known to contain the root.
+		if ( f < rzero ) lo = tau;
+		else             hi = tau;
+
+		if ( hi - lo <= rtwo * eps * max( fabs( lo ), fabs( hi ) ) )
+			break;
+
+		// Interpolate the secular function by one pole on each side of the
+		// root and take the zero of the interpolant as the next iterate.
+		di = buff_delta[i] - tau;
+		b  = di * di * dpsi;
+
+		if ( i < m_A - 1 )
+		{
+			dn = buff_delta[i+1] - tau;
+			bn = dn * dn * dphi;
+			c  = f - b / di - bn / dn;
+
+			aa = c * ( di + dn ) + b + bn;
+			bb = c * di * dn + b * dn + bn * di;
+
+			if ( c == rzero )
+			{
+				eta = bb / aa;
+			}
+			else
+			{
+				sq = sqrt( max( aa * aa - 4.0 * c * bb, rzero ) );
+				if ( aa >= rzero ) { r1 = ( aa + sq ) / ( rtwo * c ); r2 = rtwo * bb / ( aa + sq ); }
+				else               { r1 = ( aa - sq ) / ( rtwo * c ); r2 = rtwo * bb / ( aa - sq ); }
+
+				eta = ( di < r2 && r2 < dn ? r2 : r1 );
+			}
+		}
+		else
+		{
+			c   = f - b / di;
+			eta = di + b / c;
+		}
+
+		tau_new = tau + eta;
+
+		// Fall back to bisection if the iterate leaves the interval.
+		if ( !( lo < tau_new && tau_new < hi ) )
+			tau_new = ( lo + hi ) / rtwo;
+
+		if ( tau_new == tau )
+			break;
+
+		tau = tau_new;
+	}
+
+	for ( j = 0; j < m_A; ++j )
+		buff_delta[j] -= tau;
+
+	*lambda = origin + tau;
+
+	return ( iter < FLA_TEVD_DC_SECULAR_MAX_ITER ? FLA_SUCCESS : FLA_FAILURE );
+}
+
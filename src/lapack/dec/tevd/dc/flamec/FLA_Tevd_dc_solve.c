@@ -0,0 +1,103 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Tevd_dc_solve( dim_t n_iter_max, FLA_Obj d, FLA_Obj e, FLA_Obj G, FLA_Obj Z, FLA_Obj W, FLA_Obj S, dim_t b_alg )
+{
+	FLA_Error r_val = FLA_SUCCESS;
+	FLA_Obj   dT,
+	          dB;
+	FLA_Obj   d1,       d2;
+	FLA_Obj   delta1,   delta2;
+	FLA_Obj   eT,
+	          eB;
+	FLA_Obj   epsilon,  e2;
+	FLA_Obj   ZTL, ZTR,
+	          ZBL, ZBR;
+	FLA_Obj   WTL, WTR,
+	          WBL, WBR;
+	FLA_Obj   STL, STR,
+	          SBL, SBR;
+	FLA_Obj   GT,
+	          GB;
+	FLA_Obj   rho;
+	dim_t     m_A;
+	dim_t     n1;
+
+	m_A = FLA_Obj_vector_dim( d );
+
+	// Solve small problems with the QR algorithm.
+	if ( m_A <= FLA_TEVD_DC_LEAF_SIZE )
+	{
+		FLA_Set_to_identity( Z );
+
+		if ( m_A > 1 )
+		{
+			FLA_Part_2x1( G,    &GT,
+			                    &GB,            m_A - 1, FLA_TOP );
+
+			FLA_Tevd_v_opt_var1( n_iter_max, d, e, GT, Z, b_alg );
+		}
+
+		FLA_Sort_evd( FLA_FORWARD, d, Z );
+
+		return FLA_SUCCESS;
+	}
+
+	n1 = m_A / 2;
+
+	FLA_Part_2x1( d,    &dT,
+	                    &dB,            n1, FLA_TOP );
+	FLA_Part_2x1( dT,   &d1,
+	                    &delta1,        1, FLA_BOTTOM );
+	FLA_Part_2x1( dB,   &delta2,
+	                    &d2,            1, FLA_TOP );
+
+	FLA_Part_2x1( e,    &eT,
+	                    &eB,            n1 - 1, FLA_TOP );
+	FLA_Part_2x1( eB,   &epsilon,
+	                    &e2,            1, FLA_TOP );
+
+	FLA_Part_2x2( Z,    &ZTL, &ZTR,
+	                    &ZBL, &ZBR,     n1, n1, FLA_TL );
+	FLA_Part_2x2( W,    &WTL, &WTR,
+	                    &WBL, &WBR,     n1, n1, FLA_TL );
+	FLA_Part_2x2( S,    &STL, &STR,
+	                    &SBL, &SBR,     n1, n1, FLA_TL );
+
+	// Tear the matrix into two tridiagonal halves and a rank-one update
+	// by subtracting the magnitude of the coupling element from the two
+	// diagonal elements that it connects.
+	FLA_Obj_create( FLA_Obj_datatype( d ), 1, 1, 0, 0, &rho );
+
+	FLA_Copy( epsilon, rho );
+	FLA_Absolute_value( rho );
+	FLA_Axpy( FLA_MINUS_ONE, rho, delta1 );
+	FLA_Axpy( FLA_MINUS_ONE, rho, delta2 );
+
+	FLA_Obj_free( &rho );
+
+	// Find the eigenvalues and eigenvectors of the two halves. The halves
+	// share the workspace since they are solved one after the other.
+	r_val = FLA_Tevd_dc_solve( n_iter_max, dT, eT, G, ZTL, WTL, STL, b_alg );
+	if ( FLA_Tevd_dc_solve( n_iter_max, dB, e2, G, ZBR, WBR, SBR, b_alg ) != FLA_SUCCESS )
+		r_val = FLA_FAILURE;
+
+	FLA_Set( FLA_ZERO, ZTR );
+	FLA_Set( FLA_ZERO, ZBL );
+
+	// Merge the two halves through the rank-one update.
+	if ( FLA_Tevd_dc_merge( n1, epsilon, d, Z, W, S ) != FLA_SUCCESS )
+		r_val = FLA_FAILURE;
+
+	return r_val;
+}
+
@@ -10,6 +10,7 @@
 
 #include "FLA_Tevd_n.h"
 #include "FLA_Tevd_v.h"
+#include "FLA_Tevd_dc.h"
 
 // --- MAC_Tevd_eigval_converged() ---------------------------------------------
 
@@ -71,4 +71,15 @@ FLA_Error FLA_Tevd_n_opz_var1( int       m_A,
                                double*   buff_e, int inc_e,
                                dcomplex* buff_G, int rs_G, int cs_G );
 
+// --- FLA_Tevd_n_opt_var2() ---------------------------------------------------
+
+FLA_Error FLA_Tevd_n_opt_var2( dim_t n_iter_max, FLA_Obj d, FLA_Obj e );
+FLA_Error FLA_Tevd_n_ops_var2( int       m_A,
+                               int       n_iter_max,
+                               float*    buff_d, int inc_d, 
+                               float*    buff_e, int inc_e );
+FLA_Error FLA_Tevd_n_opd_var2( int       m_A,
+                               int       n_iter_max,
+                               double*   buff_d, int inc_d, 
+                               double*   buff_e, int inc_e );
 
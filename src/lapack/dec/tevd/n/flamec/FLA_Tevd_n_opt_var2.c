@@ -0,0 +1,607 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Tevd_n_opt_var2( dim_t n_iter_max, FLA_Obj d, FLA_Obj e )
+{
+	FLA_Error    r_val = FLA_SUCCESS;
+	FLA_Datatype datatype;
+	int          m_A;
+	int          inc_d;
+	int          inc_e;
+
+	datatype = FLA_Obj_datatype( d );
+
+	m_A       = FLA_Obj_vector_dim( d );
+
+	inc_d     = FLA_Obj_vector_inc( d );
+	inc_e     = FLA_Obj_vector_inc( e );
+
+	switch ( datatype )
+	{
+		case FLA_FLOAT:
+		{
+			float*    buff_d = FLA_FLOAT_PTR( d );
+			float*    buff_e = FLA_FLOAT_PTR( e );
+
+			r_val = FLA_Tevd_n_ops_var2( m_A,
+			                             n_iter_max,
+			                             buff_d, inc_d,
+			                             buff_e, inc_e );
+
+			break;
+		}
+
+		case FLA_DOUBLE:
+		{
+			double*   buff_d = FLA_DOUBLE_PTR( d );
+			double*   buff_e = FLA_DOUBLE_PTR( e );
+
+			r_val = FLA_Tevd_n_opd_var2( m_A,
+			                             n_iter_max,
+			                             buff_d, inc_d,
+			                             buff_e, inc_e );
+
+			break;
+		}
+	}
+
+	return r_val;
+}
+
+
+
+FLA_Error FLA_Tevd_n_ops_var2( int       m_A,
+                               int       n_iter_max,
+                               float*    buff_d, int inc_d,
+                               float*    buff_e, int inc_e )
+{
+	float     rzero = bl1_s0();
+	float     rone  = bl1_s1();
+	float     rtwo  = bl1_s2();
+
+	float     eps;
+	float     eps2;
+	float     safmin;
+	float     safmax;
+	float     ssfmin;
+	float     ssfmax;
+	float     ssf;
+	float     anorm;
+	float     alpha, bb, c, s, oldc, gamma, oldgam;
+	float     p, r, rte, rt1, rt2, sigma;
+	int       i, l, l1, m, lend, lsv, lendsv;
+	int       n_iter, n_iter_total;
+	int       scaled;
+
+	// Initialize some numerical constants.
+	eps    = FLA_Mach_params_ops( FLA_MACH_EPS );
+	eps2   = FLA_Mach_params_ops( FLA_MACH_EPS2 );
+	safmin = FLA_Mach_params_ops( FLA_MACH_SFMIN );
+	safmax = rone / safmin;
+	ssfmax = sqrt( safmax ) / 3.0F;
+	ssfmin = sqrt( safmin ) / eps2;
+
+	// The iteration budget is shared by all of the eigenvalues.
+	n_iter       = 0;
+	n_iter_total = n_iter_max * m_A;
+
+	// Process each unreduced submatrix in turn, starting at l1.
+	for ( l1 = 0; l1 < m_A; )
+	{
+		if ( l1 > 0 )
+			buff_e[ (l1-1)*inc_e ] = rzero;
+
+		// Find the end of the current submatrix by searching for a
+		// negligible subdiagonal element.
+		for ( m = l1; m < m_A - 1; ++m )
+		{
+			if ( fabs( buff_e[ m*inc_e ] ) <= sqrt( fabs( buff_d[ m*inc_d ] ) ) *
+			                                  sqrt( fabs( buff_d[ (m+1)*inc_d ] ) ) * eps )
+			{
+				buff_e[ m*inc_e ] = rzero;
+				break;
+			}
+		}
+
+		l      = l1;
+		lsv    = l;
+		lend   = m;
+		lendsv = lend;
+		l1     = m + 1;
+
+		// A 1x1 submatrix has already converged.
+		if ( lend == l )
+			continue;
+
+		// Scale the submatrix if its largest element is too large or too
+		// small, since the squares of the subdiagonal are formed below.
+		anorm = rzero;
+		for ( i = l; i <= lend; ++i )
+			anorm = max( anorm, fabs( buff_d[ i*inc_d ] ) );
+		for ( i = l; i < lend; ++i )
+			anorm = max( anorm, fabs( buff_e[ i*inc_e ] ) );
+
+		if ( anorm == rzero )
+			continue;
+
+		ssf    = rone;
+		scaled = TRUE;
+		if      ( anorm > ssfmax ) ssf = ssfmax;
+		else if ( anorm < ssfmin ) ssf = ssfmin;
+		else                       scaled = FALSE;
+
+		if ( scaled )
+		{
+			for ( i = l; i <= lend; ++i )
+				buff_d[ i*inc_d ] = ( buff_d[ i*inc_d ] / anorm ) * ssf;
+			for ( i = l; i < lend; ++i )
+				buff_e[ i*inc_e ] = ( buff_e[ i*inc_e ] / anorm ) * ssf;
+		}
+
+		// From here on the subdiagonal holds squared elements, which is
+		// what makes the iteration free of square roots.
+		for ( i = l; i < lend; ++i )
+			buff_e[ i*inc_e ] = buff_e[ i*inc_e ] * buff_e[ i*inc_e ];
+
+		// Chase the bulge toward the end with the smaller diagonal element.
+		if ( fabs( buff_d[ lend*inc_d ] ) < fabs( buff_d[ l*inc_d ] ) )
+		{
+			lend = lsv;
+			l    = lendsv;
+		}
+
+		if ( lend >= l )
+		{
+			// QL iteration: eigenvalues converge at the top of the
+			// submatrix.
+			while ( TRUE )
+			{
+				for ( m = l; m < lend; ++m )
+					if ( fabs( buff_e[ m*inc_e ] ) <= eps2 * fabs( buff_d[ m*inc_d ] *
+					                                               buff_d[ (m+1)*inc_d ] ) )
+						break;
+
+				if ( m < lend )
+					buff_e[ m*inc_e ] = rzero;
+
+				p = buff_d[ l*inc_d ];
+
+				if ( m == l )
+				{
+					++l;
+					if ( l <= lend ) continue;
+					break;
+				}
+
+				if ( m == l + 1 )
+				{
+					rte = sqrt( buff_e[ l*inc_e ] );
+					FLA_Hev_2x2_ops( buff_d + (l  )*inc_d,
+					                 &rte,
+					                 buff_d + (l+1)*inc_d,
+					                 &rt1,
+					                 &rt2 );
+					buff_d[ (l  )*inc_d ] = rt1;
+					buff_d[ (l+1)*inc_d ] = rt2;
+					buff_e[ (l  )*inc_e ] = rzero;
+					l += 2;
+					if ( l <= lend ) continue;
+					break;
+				}
+
+				if ( n_iter == n_iter_total )
+					break;
+
+				++n_iter;
+
+				// Form the shift from the leading 2x2 submatrix.
+				rte   = sqrt( buff_e[ l*inc_e ] );
+				sigma = ( buff_d[ (l+1)*inc_d ] - p ) / ( rtwo * rte );
+				FLA_Pythag2_ops( &sigma, &rone, &r );
+				sigma = p - ( rte / ( sigma + ( sigma >= rzero ? r : -r ) ) );
+
+				c      = rone;
+				s      = rzero;
+				gamma  = buff_d[ m*inc_d ] - sigma;
+				p      = gamma * gamma;
+
+				for ( i = m - 1; i >= l; --i )
+				{
+					bb     = buff_e[ i*inc_e ];
+					r      = p + bb;
+					if ( i != m - 1 )
+						buff_e[ (i+1)*inc_e ] = s * r;
+					oldc   = c;
+					c      = p / r;
+					s      = bb / r;
+					oldgam = gamma;
+					alpha  = buff_d[ i*inc_d ];
+					gamma  = c * ( alpha - sigma ) - s * oldgam;
+					buff_d[ (i+1)*inc_d ] = oldgam + ( alpha - gamma );
+					if ( c != rzero ) p = ( gamma * gamma ) / c;
+					else              p = oldc * bb;
+				}
+
+				buff_e[ l*inc_e ] = s * p;
+				buff_d[ l*inc_d ] = sigma + gamma;
+			}
+		}
+		else
+		{
+			// QR iteration: eigenvalues converge at the bottom of the
+			// submatrix.
+			while ( TRUE )
+			{
+				for ( m = l; m > lend; --m )
+					if ( fabs( buff_e[ (m-1)*inc_e ] ) <= eps2 * fabs( buff_d[ m*inc_d ] *
+					                                                   buff_d[ (m-1)*inc_d ] ) )
+						break;
+
+				if ( m > lend )
+					buff_e[ (m-1)*inc_e ] = rzero;
+
+				p = buff_d[ l*inc_d ];
+
+				if ( m == l )
+				{
+					--l;
+					if ( l >= lend ) continue;
+					break;
+				}
+
+				if ( m == l - 1 )
+				{
+					rte = sqrt( buff_e[ (l-1)*inc_e ] );
+					FLA_Hev_2x2_ops( buff_d + (l  )*inc_d,
+					                 &rte,
+					                 buff_d + (l-1)*inc_d,
+					                 &rt1,
+					                 &rt2 );
+					buff_d[ (l  )*inc_d ] = rt1;
+					buff_d[ (l-1)*inc_d ] = rt2;
+					buff_e[ (l-1)*inc_e ] = rzero;
+					l -= 2;
+					if ( l >= lend ) continue;
+					break;
+				}
+
+				if ( n_iter == n_iter_total )
+					break;
+
+				++n_iter;
+
+				// Form the shift from the trailing 2x2 submatrix.
+				rte   = sqrt( buff_e[ (l-1)*inc_e ] );
+				sigma = ( buff_d[ (l-1)*inc_d ] - p ) / ( rtwo * rte );
+				FLA_Pythag2_ops( &sigma, &rone, &r );
+				sigma = p - ( rte / ( sigma + ( sigma >= rzero ? r : -r ) ) );
+
+				c      = rone;
+				s      = rzero;
+				gamma  = buff_d[ m*inc_d ] - sigma;
+				p      = gamma * gamma;
+
+				for ( i = m; i <= l - 1; ++i )
+				{
+					bb     = buff_e[ i*inc_e ];
+					r      = p + bb;
+					if ( i != m )
+						buff_e[ (i-1)*inc_e ] = s * r;
+					oldc   = c;
+					c      = p / r;
+					s      = bb / r;
+					oldgam = gamma;
+					alpha  = buff_d[ (i+1)*inc_d ];
+					gamma  = c * ( alpha - sigma ) - s * oldgam;
+					buff_d[ i*inc_d ] = oldgam + ( alpha - gamma );
+					if ( c != rzero ) p = ( gamma * gamma ) / c;
+					else              p = oldc * bb;
+				}
+
+				buff_e[ (l-1)*inc_e ] = s * p;
+				buff_d[ l*inc_d ]     = sigma + gamma;
+			}
+		}
+
+		// Undo the scaling of the eigenvalues of the submatrix.
+		if ( scaled )
+		{
+			for ( i = lsv; i <= lendsv; ++i )
+				buff_d[ i*inc_d ] = ( buff_d[ i*inc_d ] / ssf ) * anorm;
+		}
+
+		if ( n_iter == n_iter_total )
+			break;
+	}
+
+	// The iteration failed to converge if any subdiagonal element remains.
+	for ( i = 0; i < m_A - 1; ++i )
+		if ( buff_e[ i*inc_e ] != rzero )
+			return FLA_FAILURE;
+
+	return FLA_SUCCESS;
+}
+
+
+
+FLA_Error FLA_Tevd_n_opd_var2( int       m_A,
+                               int       n_iter_max,
+                               double*   buff_d, int inc_d,
+                               double*   buff_e, int inc_e )
+{
+	double    rzero = bl1_d0();
+	double    rone  = bl1_d1();
+	double    rtwo  = bl1_d2();
+
+	double    eps;
+	double    eps2;
+	double    safmin;
+	double    safmax;
+	double    ssfmin;
+	double    ssfmax;
+	double    ssf;
+	double    anorm;
+	double    alpha, bb, c, s, oldc, gamma, oldgam;
+	double    p, r, rte, rt1, rt2, sigma;
+	int       i, l, l1, m, lend, lsv, lendsv;
+	int       n_iter, n_iter_total;
+	int       scaled;
+
+	// Initialize some numerical constants.
+	eps    = FLA_Mach_params_opd( FLA_MACH_EPS );
+	eps2   = FLA_Mach_params_opd( FLA_MACH_EPS2 );
+	safmin = FLA_Mach_params_opd( FLA_MACH_SFMIN );
+	safmax = rone / safmin;
+	ssfmax = sqrt( safmax ) / 3.0;
+	ssfmin = sqrt( safmin ) / eps2;
+
+	// The iteration budget is shared by all of the eigenvalues.
+	n_iter       = 0;
+	n_iter_total = n_iter_max * m_A;
+
+	// Process each unreduced submatrix in turn, starting at l1.
+	for ( l1 = 0; l1 < m_A; )
+	{
+		if ( l1 > 0 )
+			buff_e[ (l1-1)*inc_e ] = rzero;
+
+		// Find the end of the current submatrix by searching for a
+		// negligible subdiagonal element.
+		for ( m = l1; m < m_A - 1; ++m )
+		{
+			if ( fabs( buff_e[ m*inc_e ] ) <= sqrt( fabs( buff_d[ m*inc_d ] ) ) *
+			                                  sqrt( fabs( buff_d[ (m+1)*inc_d ] ) ) * eps )
+			{
+				buff_e[ m*inc_e ] = rzero;
+				break;
+			}
+		}
+
+		l      = l1;
+		lsv    = l;
+		lend   = m;
+		lendsv = lend;
+		l1     = m + 1;
+
+		// A 1x1 submatrix has already converged.
+		if ( lend == l )
+			continue;
+
+		// Scale the submatrix if its largest element is too large or too
+		// small, since the squares of the subdiagonal are formed below.
+		anorm = rzero;
+		for ( i = l; i <= lend; ++i )
+			anorm = max( anorm, fabs( buff_d[ i*inc_d ] ) );
+		for ( i = l; i < lend; ++i )
+			anorm = max( anorm, fabs( buff_e[ i*inc_e ] ) );
+
+		if ( anorm == rzero )
+			continue;
+
+		ssf    = rone;
+		scaled = TRUE;
+		if      ( anorm > ssfmax ) ssf = ssfmax;
+		else if ( anorm < ssfmin ) ssf = ssfmin;
+		else                       scaled = FALSE;
+
+		if ( scaled )
+		{
+			for ( i = l; i <= lend; ++i )
+				buff_d[ i*inc_d ] = ( buff_d[ i*inc_d ] / anorm ) * ssf;
+			for ( i = l; i < lend; ++i )
+				buff_e[ i*inc_e ] = ( buff_e[ i*inc_e ] / anorm ) * ssf;
+		}
+
+		// From here on the subdiagonal holds squared elements, which is
+		// what makes the iteration free of square roots.
+		for ( i = l; i < lend; ++i )
+			buff_e[ i*inc_e ] = buff_e[ i*inc_e ] * buff_e[ i*inc_e ];
+
+		// Chase the bulge toward the end with the smaller diagonal element.
+		if ( fabs( buff_d[ lend*inc_d ] ) < fabs( buff_d[ l*inc_d ] ) )
+		{
+			lend = lsv;
+			l    = lendsv;
+		}
+
+		if ( lend >= l )
+		{
+			// QL iteration: eigenvalues converge at the top of the
+			// submatrix.
+			while ( TRUE )
+			{
+				for ( m = l; m < lend; ++m )
+					if ( fabs( buff_e[ m*inc_e ] ) <= eps2 * fabs( buff_d[ m*inc_d ] *
+					                                               buff_d[ (m+1)*inc_d ] ) )
+						break;
+
+				if ( m < lend )
+					buff_e[ m*inc_e ] = rzero;
+
+				p = buff_d[ l*inc_d ];
+
+				if ( m == l )
+				{
+					++l;
+					if ( l <= lend ) continue;
+					break;
+				}
+
+				if ( m == l + 1 )
+				{
+					rte = sqrt( buff_e[ l*inc_e ] );
+					FLA_Hev_2x2_opd( buff_d + (l  )*inc_d,
+					                 &rte,
+					                 buff_d + (l+1)*inc_d,
+					                 &rt1,
+					                 &rt2 );
+					buff_d[ (l  )*inc_d ] = rt1;
+					buff_d[ (l+1)*inc_d ] = rt2;
+					buff_e[ (l  )*inc_e ] = rzero;
+					l += 2;
+					if ( l <= lend ) continue;
+					break;
+				}
+
+				if ( n_iter == n_iter_total )
+					break;
+
+				++n_iter;
+
+				// Form the shift from the leading 2x2 submatrix.
+				rte   = sqrt( buff_e[ l*inc_e ] );
+				sigma = ( buff_d[ (l+1)*inc_d ] - p ) / ( rtwo * rte );
+				FLA_Pythag2_opd( &sigma, &rone, &r );
+				sigma = p - ( rte / ( sigma + ( sigma >= rzero ? r : -r ) ) );
+
+				c      = rone;
+				s      = rzero;
+				gamma  = buff_d[ m*inc_d ] - sigma;
+				p      = gamma * gamma;
+
+				for ( i = m - 1; i >= l; --i )
+				{
+					bb     = buff_e[ i*inc_e ];
+					r      = p + bb;
+					if ( i != m - 1 )
+						buff_e[ (i+1)*inc_e ] = s * r;
+					oldc   = c;
+					c      = p / r;
+					s      = bb / r;
+					oldgam = gamma;
+					alpha  = buff_d[ i*inc_d ];
+					gamma  = c * ( alpha - sigma ) - s * oldgam;
+					buff_d[ (i+1)*inc_d ] = oldgam + ( alpha - gamma );
+					if ( c != rzero ) p = ( gamma * gamma ) / c;
+					else              p = oldc * bb;
+				}
+
+				buff_e[ l*inc_e ] = s * p;
+				buff_d[ l*inc_d ] = sigma + gamma;
+			}
+		}
+		else
+		{
+			// QR iteration: eigenvalues converge at the bottom of the
+			// submatrix.
+			while ( TRUE )
+			{
+				for ( m = l; m > lend; --m )
+					if ( fabs( buff_e[ (m-1)*inc_e ] ) <= eps2 * fabs( buff_d[ m*inc_d ] *
+					                                                   buff_d[ (m-1)*inc_d ] ) )
+						break;
+
+				if ( m > lend )
+					buff_e[ (m-1)*inc_e ] = rzero;
+
+				p = buff_d[ l*inc_d ];
+
+				if ( m == l )
+				{
+					--l;
+					if ( l >= lend ) continue;
+					break;
+				}
+
+				if ( m == l - 1 )
+				{
+					rte = sqrt( buff_e[ (l-1)*inc_e ] );
+					FLA_Hev_2x2_opd( buff_d + (l  )*inc_d,
+					                 &rte,
+					                 buff_d + (l-1)*inc_d,
+					                 &rt1,
+					                 &rt2 );
+					buff_d[ (l  )*inc_d ] = rt1;
+					buff_d[ (l-1)*inc_d ] = rt2;
+					buff_e[ (l-1)*inc_e ] = rzero;
+					l -= 2;
+					if ( l >= lend ) continue;
+					break;
+				}
+
+				if ( n_iter == n_iter_total )
+					break;
+
+				++n_iter;
+
+				// Form the shift from the trailing 2x2 submatrix.
+				rte   = sqrt( buff_e[ (l-1)*inc_e ] );
+				sigma = ( buff_d[ (l-1)*inc_d ] - p ) / ( rtwo * rte );
+				FLA_Pythag2_opd( &sigma, &rone, &r );
+				sigma = p - ( rte / ( sigma + ( sigma >= rzero ? r : -r ) ) );
+
+				c      = rone;
+				s      = rzero;
+				gamma  = buff_d[ m*inc_d ] - sigma;
+				p      = gamma * gamma;
+
+				for ( i = m; i <= l - 1; ++i )
+				{
+					bb     = buff_e[ i*inc_e ];
+					r      = p + bb;
+					if ( i != m )
+						buff_e[ (i-1)*inc_e ] = s * r;
+					oldc   = c;
+					c      = p / r;
+					s      = bb / r;
+					oldgam = gamma;
+					alpha  = buff_d[ (i+1)*inc_d ];
+					gamma  = c * ( alpha - sigma ) - s * oldgam;
+					buff_d[ i*inc_d ] = oldgam + ( alpha - gamma );
+					if ( c != rzero ) p = ( gamma * gamma ) / c;
+					else              p = oldc * bb;
+				}
+
+				buff_e[ (l-1)*inc_e ] = s * p;
+				buff_d[ l*inc_d ]     = sigma + gamma;
+			}
+		}
+
+		// Undo the scaling of the eigenvalues of the submatrix.
+		if ( scaled )
+		{
+			for ( i = lsv; i <= lendsv; ++i )
+				buff_d[ i*inc_d ] = ( buff_d[ i*inc_d ] / ssf ) * anorm;
+		}
+
+		if ( n_iter == n_iter_total )
+			break;
+	}
+
+	// The iteration failed to converge if any subdiagonal element remains.
+	for ( i = 0; i < m_A - 1; ++i )
+		if ( buff_e[ i*inc_e ] != rzero )
+			return FLA_FAILURE;
+
+	return FLA_SUCCESS;
+}
+
@@ -12,13 +12,15 @@
 
 extern fla_trinv_t*     fla_trinv_cntl_leaf;
 extern fla_trinv_t*     fla_trinv_cntl;
-extern fla_blocksize_t* fla_trinv_var3_bsize;
 
 FLA_Error FLA_Trinv( FLA_Uplo uplo, FLA_Diag diag, FLA_Obj A )
 {
-  FLA_Datatype datatype;
-  int          m_A, r_val = 0;
-  int          FLA_TRINV_VAR3_BLOCKSIZE;
+  FLA_Datatype    datatype;
+  dim_t           m_A, n_levels, b_alg;
+  int             r_val = 0;
+  fla_trinv_t*    cntl;
+  fla_trinv_t     cntl_size;
+  fla_blocksize_t bsize;
 
   // Check parameters.
   if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
@@ -27,22 +29,36 @@ FLA_Error FLA_Trinv( FLA_Uplo uplo, FLA_Diag diag, FLA_Obj A )
   // Determine the datatype of the operation.
   datatype = FLA_Obj_datatype( A );
 
-  // Extract the appropriate blocksize for the given datatype.
-  FLA_TRINV_VAR3_BLOCKSIZE = FLA_Blocksize_extract( datatype, fla_trinv_var3_bsize );
-
   // Determine the dimension of A.
   m_A = FLA_Obj_length( A );
 
-  // Invoke FLA_Trinv_internal() with the appropriate control tree.
-  if      ( m_A <= FLA_TRINV_VAR3_BLOCKSIZE )
-  {
-    r_val = FLA_Trinv_internal( uplo, diag, A, fla_trinv_cntl_leaf );
-  }
-  else if ( FLA_TRINV_VAR3_BLOCKSIZE < m_A )
+  // Look up the number of algorithmic levels and the blocksize for a
+  // problem of this size in the (possibly tuned) decision table. By default,
+  // problems that fit in a single block are inverted by the unblocked
+  // variant.
+  n_levels = FLA_Tune_get_for_size( datatype, FLA_TUNE_TRINV, FLA_TUNE_N_LEVELS, m_A );
+  b_alg    = FLA_Tune_get_for_size( datatype, FLA_TUNE_TRINV, FLA_TUNE_B_ALG,    m_A );
+
+  // Only one level of blocking is available.
+  cntl = ( n_levels <= 1 ? fla_trinv_cntl_leaf : fla_trinv_cntl );
+
+  // When the table gives this problem a blocksize other than the one the
+  // control tree was created with, use a copy of the tree that blocks
+  // accordingly.
+  if ( n_levels >= 2 &&
+       b_alg != FLA_Blocksize_extract( datatype, FLA_Cntl_blocksize( cntl ) ) )
   {
-    r_val = FLA_Trinv_internal( uplo, diag, A, fla_trinv_cntl );
+    FLA_Blocksize_set( &bsize, b_alg, b_alg, b_alg, b_alg );
+
+    cntl_size           = *cntl;
+    cntl_size.blocksize = &bsize;
+
+    cntl = &cntl_size;
   }
 
+  // Invoke FLA_Trinv_internal() with the appropriate control tree.
+  r_val = FLA_Trinv_internal( uplo, diag, A, cntl );
+
   return r_val;
 }
 
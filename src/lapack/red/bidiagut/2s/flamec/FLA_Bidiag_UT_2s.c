@@ -0,0 +1,41 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Bidiag_UT_2s( FLA_Obj A, FLA_Obj TU, FLA_Obj TV, FLA_Obj VU, FLA_Obj tu, FLA_Obj VV, FLA_Obj tv )
+{
+  FLA_Error r_val = FLA_SUCCESS;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_Bidiag_UT_check( A, TU, TV );
+
+  // The band is copied and chased with column-oriented kernels.
+  if ( FLA_Obj_row_stride( A ) != 1 )
+  {
+    FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+  }
+
+  if ( FLA_Obj_length( A ) >= FLA_Obj_width( A ) )
+  {
+    // Reduce A to an upper band matrix of bandwidth b = length( TU ), with
+    // level-3 operations, and then the band matrix to upper bidiagonal form.
+    r_val = FLA_Bidiag_UT_2s_u_band( A, TU, TV );
+    r_val = FLA_Bidiag_UT_2s_u_chase( A, VU, tu, VV, tv );
+  }
+  else // if ( FLA_Obj_length( A ) < FLA_Obj_width( A ) )
+  {
+    FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+  }
+
+  return r_val;
+}
+
@@ -0,0 +1,59 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+// The default bandwidth of the intermediate band matrix.
+#define FLA_BIDIAG_UT_2S_BANDWIDTH 32
+
+FLA_Error FLA_Bidiag_UT_2s( FLA_Obj A, FLA_Obj TU, FLA_Obj TV, FLA_Obj VU, FLA_Obj tu, FLA_Obj VV, FLA_Obj tv );
+
+FLA_Error FLA_Bidiag_UT_2s_create( FLA_Obj A, dim_t b_band, FLA_Obj* TU, FLA_Obj* TV, FLA_Obj* VU, FLA_Obj* tu, FLA_Obj* VV, FLA_Obj* tv );
+
+FLA_Error FLA_Bidiag_UT_2s_form_U( FLA_Obj A, FLA_Obj TU, FLA_Obj VU, FLA_Obj tu, FLA_Obj U );
+FLA_Error FLA_Bidiag_UT_2s_form_V( FLA_Obj A, FLA_Obj TV, FLA_Obj VV, FLA_Obj tv, FLA_Obj V );
+
+FLA_Error FLA_Bidiag_UT_2s_u_band( FLA_Obj A, FLA_Obj TU, FLA_Obj TV );
+
+FLA_Error FLA_Bidiag_UT_2s_u_chase( FLA_Obj A, FLA_Obj VU, FLA_Obj tu, FLA_Obj VV, FLA_Obj tv );
+FLA_Error FLA_Bidiag_UT_2s_u_step_ops( int       m_B,
+                                       int       m_R,
+                                       int       n_L,
+                                       float*    buff_R,
+                                       float*    buff_L, int cs_A,
+                                       float*    buff_uv,
+                                       float*    buff_tauv,
+                                       float*    buff_uu,
+                                       float*    buff_tauu );
+FLA_Error FLA_Bidiag_UT_2s_u_step_opd( int       m_B,
+                                       int       m_R,
+                                       int       n_L,
+                                       double*   buff_R,
+                                       double*   buff_L, int cs_A,
+                                       double*   buff_uv,
+                                       double*   buff_tauv,
+                                       double*   buff_uu,
+                                       double*   buff_tauu );
+FLA_Error FLA_Bidiag_UT_2s_u_step_opc( int       m_B,
+                                       int       m_R,
+                                       int       n_L,
+                                       scomplex* buff_R,
+                                       scomplex* buff_L, int cs_A,
+                                       scomplex* buff_uv,
+                                       scomplex* buff_tauv,
+                                       scomplex* buff_uu,
+                                       scomplex* buff_tauu );
+FLA_Error FLA_Bidiag_UT_2s_u_step_opz( int       m_B,
+                                       int       m_R,
+                                       int       n_L,
+                                       dcomplex* buff_R,
+                                       dcomplex* buff_L, int cs_A,
+                                       dcomplex* buff_uv,
+                                       dcomplex* buff_tauv,
+                                       dcomplex* buff_uu,
+                                       dcomplex* buff_tauu );
@@ -0,0 +1,47 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Bidiag_UT_2s_create( FLA_Obj A, dim_t b_band, FLA_Obj* TU, FLA_Obj* TV, FLA_Obj* VU, FLA_Obj* tu, FLA_Obj* VV, FLA_Obj* tv )
+{
+  FLA_Datatype datatype;
+  dim_t        n_A;
+  dim_t        n_sweeps, k_max;
+
+  // Query the datatype and the smaller dimension of A.
+  datatype = FLA_Obj_datatype( A );
+  n_A      = FLA_Obj_min_dim( A );
+
+  // The bandwidth may not exceed the order of the bidiagonal matrix less one.
+  b_band = max( 1, min( b_band, n_A - 1 ) );
+
+  // Create b_band x n_A matrices to hold the block Householder transforms
+  // of the reduction to band form, one b_band x b_band block for each panel
+  // of b_band columns (TU) or rows (TV).
+  FLA_Obj_create( datatype, b_band, n_A, 0, 0, TU );
+  FLA_Obj_create( datatype, b_band, n_A, 0, 0, TV );
+
+  // The reduction from band to bidiagonal form performs n_A - 2 sweeps, the
+  // first of which generates the most pairs of reflectors, k_max. Create
+  // matrices to hold each reflector, of length at most b_band, in a column,
+  // and vectors to hold the corresponding tau, for the reflectors applied
+  // from the left (VU and tu) and from the right (VV and tv).
+  n_sweeps = ( n_A > 2 ? n_A - 2 : 0 );
+  k_max    = ( n_A > 2 ? ( n_A - 3 ) / b_band + 1 : 0 );
+
+  FLA_Obj_create( datatype, b_band, max( 1, n_sweeps * k_max ), 0, 0, VU );
+  FLA_Obj_create( datatype, max( 1, n_sweeps * k_max ), 1, 0, 0, tu );
+  FLA_Obj_create( datatype, b_band, max( 1, n_sweeps * k_max ), 0, 0, VV );
+  FLA_Obj_create( datatype, max( 1, n_sweeps * k_max ), 1, 0, 0, tv );
+
+  return FLA_SUCCESS;
+}
+
@@ -0,0 +1,46 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Bidiag_UT_2s_form_U( FLA_Obj A, FLA_Obj TU, FLA_Obj VU, FLA_Obj tu, FLA_Obj U )
+{
+  FLA_Obj UT, UB;
+  FLA_Obj W;
+
+  // U must be distinct from A, which holds the Householder vectors of the
+  // reduction to band form.
+  FLA_Set_to_identity( U );
+
+  if ( FLA_Obj_length( A ) >= FLA_Obj_width( A ) )
+  {
+    // U = U1 diag( U2, I ). Apply U2, which acts on the leading rows only,
+    // first, so that the leading columns of U that are still zero may be
+    // skipped.
+    FLA_Part_2x1( U,    &UT,
+                        &UB,    FLA_Obj_width( A ), FLA_TOP );
+
+    FLA_Tridiag_UT_2s_l_apply_Q2( TRUE, VU, tu, UT );
+
+    FLA_Apply_Q_UT_create_workspace( TU, U, &W );
+
+    FLA_Apply_Q_UT( FLA_LEFT, FLA_NO_TRANSPOSE, FLA_FORWARD, FLA_COLUMNWISE,
+                    A, TU, W, U );
+
+    FLA_Obj_free( &W );
+  }
+  else // if ( FLA_Obj_length( A ) < FLA_Obj_width( A ) )
+  {
+    FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+  }
+
+  return FLA_SUCCESS;
+}
+
@@ -0,0 +1,61 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Bidiag_UT_2s_form_V( FLA_Obj A, FLA_Obj TV, FLA_Obj VV, FLA_Obj tv, FLA_Obj V )
+{
+  FLA_Obj ATL, ATR,
+          ABL, ABR;
+  FLA_Obj TVL, TVR;
+  FLA_Obj VT,  VB;
+  FLA_Obj W;
+  dim_t   n_A, b;
+
+  n_A = FLA_Obj_width( A );
+  b   = FLA_Obj_length( TV );
+
+  // V must be distinct from A, which holds the Householder vectors of the
+  // reduction to band form.
+  FLA_Set_to_identity( V );
+
+  if ( FLA_Obj_length( A ) >= FLA_Obj_width( A ) )
+  {
+    // V = diag( I, V1 ) V2, where V1 acts on all but the first b rows.
+    // Apply V2 first, so that the leading columns of V that are still zero
+    // may be skipped.
+    FLA_Tridiag_UT_2s_l_apply_Q2( TRUE, VV, tv, V );
+
+    if ( n_A > b )
+    {
+      // The Householder vectors of V1 are stored by rows beyond the b-th
+      // superdiagonal of A, in ATR = A( 0:n_A-b-1, b:n_A-1 ).
+      FLA_Part_2x2( A,    &ATL, &ATR,
+                          &ABL, &ABR,     n_A - b, b, FLA_TL );
+      FLA_Part_1x2( TV,   &TVL, &TVR,     n_A - b,    FLA_LEFT );
+      FLA_Part_2x1( V,    &VT,
+                          &VB,            b,          FLA_TOP );
+
+      FLA_Apply_Q_UT_create_workspace( TV, V, &W );
+
+      FLA_Apply_Q_UT( FLA_LEFT, FLA_NO_TRANSPOSE, FLA_FORWARD, FLA_ROWWISE,
+                      ATR, TVL, W, VB );
+
+      FLA_Obj_free( &W );
+    }
+  }
+  else // if ( FLA_Obj_length( A ) < FLA_Obj_width( A ) )
+  {
+    FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+  }
+
+  return FLA_SUCCESS;
+}
+
@@ -0,0 +1,87 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_qrut_t* fla_qrut_cntl_leaf;
+
+FLA_Error FLA_Bidiag_UT_2s_u_band( FLA_Obj A, FLA_Obj TU, FLA_Obj TV )
+{
+	FLA_Obj   ATL, ATR,
+	          ABL, ABR;
+	FLA_Obj   AP,  AR,  AR1, AR2;
+	FLA_Obj   TP,  TR,  TR1;
+	FLA_Obj   W,   WP;
+	FLA_Obj   junk;
+	dim_t     n_A, b, n_P, n_R, j;
+
+	n_A = FLA_Obj_width( A );
+	b   = FLA_Obj_length( TU );
+
+	FLA_Apply_Q_UT_create_workspace( TU, A, &W );
+
+	for ( j = 0; j < n_A; j += b )
+	{
+		n_P = min( b, n_A - j );
+
+		// AP = A( j:m_A-1, j:j+n_P-1 ) is the current column panel and
+		// ATR = A( j:m_A-1, j+n_P:n_A-1 ) is the matrix to its right.
+		FLA_Part_2x2( A,    &ATL, &ATR,
+		                    &ABL, &ABR,     j, j, FLA_TL );
+		FLA_Part_1x2( ABR,  &AP,  &ATR,     n_P,      FLA_LEFT );
+
+		FLA_Part_1x2( TU,   &junk, &TP,     j,        FLA_LEFT );
+		FLA_Part_1x2( TP,   &TP,   &junk,   n_P,      FLA_LEFT );
+
+		// Annihilate the panel below its upper triangle, AP = Q R, and apply
+		// Q' to the columns to its right. The panel is factored by the
+		// blocked algorithm directly, so that the reduction does not change
+		// when FLA_QR_UT() is tuned to use TSQR.
+		FLA_QR_UT_internal( AP, TP, fla_qrut_cntl_leaf );
+
+		if ( FLA_Obj_width( ATR ) == 0 ) break;
+
+		FLA_Part_2x2( W,    &WP,   &junk,
+		                    &junk, &junk,   n_P, FLA_Obj_width( ATR ), FLA_TL );
+
+		FLA_Apply_Q_UT( FLA_LEFT, FLA_CONJ_TRANSPOSE, FLA_FORWARD, FLA_COLUMNWISE,
+		                AP, TP, WP, ATR );
+
+		// The panel is a full b columns wide whenever there are columns
+		// beyond the b-th superdiagonal. AR = A( j:m_A-1, j+b:n_A-1 ) holds
+		// them in its first b rows, AR1, above the trailing rows, AR2.
+		FLA_Part_2x1( ATR,  &AR1,
+		                    &AR2,           b,        FLA_TOP );
+		n_R = min( b, FLA_Obj_width( ATR ) );
+
+		// Annihilate the row panel to the right of its lower triangle,
+		// AR1 = L Z, and apply Z' to the rows below it. Only the first n_R
+		// rows of AR1 hold Householder vectors if AR1 is wider than it is
+		// tall.
+		FLA_Part_1x2( TV,   &junk, &TR,     j,        FLA_LEFT );
+		FLA_Part_1x2( TR,   &TR,   &junk,   b,        FLA_LEFT );
+
+		FLA_LQ_UT( AR1, TR );
+
+		FLA_Part_2x1( AR1,  &AR,
+		                    &junk,          n_R,      FLA_TOP );
+		FLA_Part_1x2( TR,   &TR1,  &junk,   n_R,      FLA_LEFT );
+		FLA_Part_2x2( W,    &WP,   &junk,
+		                    &junk, &junk,   n_R, FLA_Obj_length( AR2 ), FLA_TL );
+
+		FLA_Apply_Q_UT( FLA_RIGHT, FLA_NO_TRANSPOSE, FLA_FORWARD, FLA_ROWWISE,
+		                AR, TR1, WP, AR2 );
+	}
+
+	FLA_Obj_free( &W );
+
+	return FLA_SUCCESS;
+}
+
@@ -0,0 +1,552 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#if !defined(FLA_ENABLE_WINDOWS_BUILD) && !defined(FLA_ENABLE_TIDSP)
+#include <sched.h>
+#endif
+
+// The band is chased in a compact copy in which element (i,j), for
+// -b <= i - j < 2b, is stored at buff_A[ i + j*cs_A ] with cs_A = 3b - 1,
+// where buff_A points 2b - 1 elements into the buffer. The upper band of A
+// occupies the first b + 1 of these diagonals, the bulge created above it
+// by the reflectors applied from the left the next b - 1, and the bulge
+// created below the diagonal by the reflectors applied from the right the
+// last b - 1.
+
+typedef struct FLA_Bidiag_UT_2s_vars_s
+{
+	FLA_Datatype datatype;
+	int          n_A;
+	int          b;
+	int          n_sweeps;
+	void*        buff_A;
+	int          cs_A;
+	void*        buff_VU;
+	int          cs_VU;
+	void*        buff_tu;
+	int          inc_tu;
+	void*        buff_VV;
+	int          cs_VV;
+	void*        buff_tv;
+	int          inc_tv;
+	int*         n_done;
+} FLA_Bidiag_UT_2s_vars;
+
+static void  FLA_Bidiag_UT_2s_u_chase_step( FLA_Bidiag_UT_2s_vars* args, int i, int k );
+static void* FLA_Bidiag_UT_2s_u_chase_thread( void* arg );
+
+FLA_Error FLA_Bidiag_UT_2s_u_chase( FLA_Obj A, FLA_Obj VU, FLA_Obj tu, FLA_Obj VV, FLA_Obj tv )
+{
+	FLA_Bidiag_UT_2s_vars args;
+	FLA_Obj               A_band;
+	char*                 buff_A;
+	char*                 buff_band;
+	dim_t                 elem_size;
+	int                   n_A, cs_A, cs_band, b;
+	int                   n_threads = 1;
+	int                   i, i0, n_copy;
+
+	n_A       = FLA_Obj_width( A );
+	cs_A      = FLA_Obj_col_stride( A );
+	b         = FLA_Obj_length( VU );
+	elem_size = FLA_Obj_elem_size( A );
+	buff_A    = ( char* ) FLA_Obj_buffer_at_view( A );
+
+	// A band of width one (or a matrix of order two) is already bidiagonal.
+	if ( b < 2 || n_A < 3 )
+		return FLA_SUCCESS;
+
+#if defined(FLA_ENABLE_MULTITHREADING) && defined(FLASH_QUEUE_ENABLE_ATOMICS)
+	// Pipeline the sweeps across the threads that SuperMatrix is set to use.
+	n_threads = FLASH_Queue_get_num_threads();
+	n_threads = max( 1, min( n_threads, n_A - 2 ) );
+#endif
+
+	// Copy the upper band of the leading n_A x n_A block of A into the
+	// compact storage.
+	FLA_Obj_create( FLA_Obj_datatype( A ), 3 * b, n_A, 0, 0, &A_band );
+	FLA_Set( FLA_ZERO, A_band );
+	cs_band   = 3 * b - 1;
+	buff_band = ( char* ) FLA_Obj_buffer_at_view( A_band ) + ( 2 * b - 1 ) * elem_size;
+
+	for ( i = 0; i < n_A; ++i )
+	{
+		i0     = max( 0, i - b );
+		n_copy = i - i0 + 1;
+		memcpy( buff_band + ( i0 + i * cs_band ) * elem_size,
+		        buff_A    + ( i0 + i * cs_A    ) * elem_size,
+		        n_copy * elem_size );
+	}
+
+	args.datatype  = FLA_Obj_datatype( A );
+	args.n_A       = n_A;
+	args.b         = b;
+	args.n_sweeps  = n_A - 2;
+	args.buff_A    = buff_band;
+	args.cs_A      = cs_band;
+	args.buff_VU   = FLA_Obj_buffer_at_view( VU );
+	args.cs_VU     = FLA_Obj_col_stride( VU );
+	args.buff_tu   = FLA_Obj_buffer_at_view( tu );
+	args.inc_tu    = FLA_Obj_vector_inc( tu );
+	args.buff_VV   = FLA_Obj_buffer_at_view( VV );
+	args.cs_VV     = FLA_Obj_col_stride( VV );
+	args.buff_tv   = FLA_Obj_buffer_at_view( tv );
+	args.inc_tv    = FLA_Obj_vector_inc( tv );
+	args.n_done    = ( int* ) FLA_malloc( args.n_sweeps * sizeof( int ) );
+
+	for ( i = 0; i < args.n_sweeps; ++i )
+		args.n_done[i] = 0;
+
+	// The sweeps are dealt out to the threads that actually run, which may
+	// be fewer than requested if they are busy with another job.
+	FLA_Thread_run( n_threads, FLA_Bidiag_UT_2s_u_chase_thread, ( void* ) &args );
+
+	// Copy the bidiagonal matrix back to A and clear the rest of the band,
+	// leaving the Householder vectors of the first stage intact. The first
+	// subdiagonal is cleared too, since the bidiagonal matrix is expected to
+	// be stored alone in its two diagonals.
+	for ( i = 0; i < n_A; ++i )
+	{
+		i0     = max( 0, i - 1 );
+		n_copy = i - i0 + 1;
+		memcpy( buff_A    + ( i0 + i * cs_A    ) * elem_size,
+		        buff_band + ( i0 + i * cs_band ) * elem_size,
+		        n_copy * elem_size );
+
+		i0     = max( 0, i - b );
+		n_copy = i - 1 - i0;
+		if ( n_copy > 0 )
+			memset( buff_A + ( i0 + i * cs_A ) * elem_size, 0,
+			        n_copy * elem_size );
+	}
+
+	FLA_free( args.n_done );
+	FLA_Obj_free( &A_band );
+
+	return FLA_SUCCESS;
+}
+
+
+
+static void* FLA_Bidiag_UT_2s_u_chase_thread( void* arg )
+{
+	FLASH_Thread*          me   = ( FLASH_Thread* ) arg;
+	FLA_Bidiag_UT_2s_vars* args = ( FLA_Bidiag_UT_2s_vars* ) me->args;
+	int                    b    = args->b;
+	int                    i, k;
+	int                    n_steps;
+
+	// Sweep i annihilates row i beyond the superdiagonal and chases the
+	// resulting bulge down the band in n_steps steps of b rows each.
+	// Consecutive sweeps are assigned to different threads; the k-th step of
+	// sweep i overlaps the steps of sweep i-1 up to k+3 and may start as soon
+	// as those are complete.
+	for ( i = me->id; i < args->n_sweeps; i += me->n_threads )
+	{
+		n_steps = ( args->n_A - 3 - i ) / b + 1;
+
+		for ( k = 0; k < n_steps; ++k )
+		{
+#if defined(FLA_ENABLE_MULTITHREADING) && defined(FLASH_QUEUE_ENABLE_ATOMICS)
+			if ( i > 0 )
+			{
+				int n_steps_prev = ( args->n_A - 2 - i ) / b + 1;
+				int n_wait       = min( k + 4, n_steps_prev );
+
+				// Give up the core while waiting, in case there are more
+				// threads than cores.
+				while ( FLASH_ATOMIC_LOAD( &(args->n_done[i-1]) ) < n_wait )
+				{
+#if !defined(FLA_ENABLE_WINDOWS_BUILD) && !defined(FLA_ENABLE_TIDSP)
+					sched_yield();
+#endif
+				}
+			}
+#endif
+
+			FLA_Bidiag_UT_2s_u_chase_step( args, i, k );
+
+#if defined(FLA_ENABLE_MULTITHREADING) && defined(FLASH_QUEUE_ENABLE_ATOMICS)
+			FLASH_ATOMIC_STORE( &(args->n_done[i]), k + 1 );
+#else
+			args->n_done[i] = k + 1;
+#endif
+		}
+	}
+
+	return NULL;
+}
+
+
+
+static void FLA_Bidiag_UT_2s_u_chase_step( FLA_Bidiag_UT_2s_vars* args, int i, int k )
+{
+	int b      = args->b;
+	int n_A    = args->n_A;
+	int cs_A   = args->cs_A;
+	int cs_VU  = args->cs_VU;
+	int inc_tu = args->inc_tu;
+	int cs_VV  = args->cs_VV;
+	int inc_tv = args->inc_tv;
+
+	// The k-th pair of reflectors of sweep i acts on columns, and then rows,
+	// c0:c0+m_B-1. At step zero the reflector applied from the right
+	// annihilates row i beyond the superdiagonal; later it annihilates the
+	// first row of the bulge that the previous reflector applied from the
+	// left created, row r0. The reflector applied from the left then
+	// annihilates the bulge that this one created below the diagonal.
+	int c0    = i + 1 + k * b;
+	int r0    = ( k == 0 ? i : c0 - b );
+	int m_B   = min( b, n_A - c0 );
+	int m_R   = min( c0 + b, n_A ) - r0 - 1;
+	int n_L   = min( c0 + 2 * b, n_A ) - c0 - 1;
+
+	// The reflectors are stored with those of equal step index from
+	// consecutive sweeps adjacent, which is the order in which they are
+	// aggregated when U and V are formed.
+	int j     = k * args->n_sweeps + i;
+
+	switch ( args->datatype )
+	{
+		case FLA_FLOAT:
+		{
+			float* buff_A  = ( float* ) args->buff_A;
+			float* buff_VU = ( float* ) args->buff_VU;
+			float* buff_tu = ( float* ) args->buff_tu;
+			float* buff_VV = ( float* ) args->buff_VV;
+			float* buff_tv = ( float* ) args->buff_tv;
+
+			FLA_Bidiag_UT_2s_u_step_ops( m_B,
+			                               m_R,
+			                               n_L,
+			                               buff_A + r0 + c0 * cs_A,
+			                               buff_A + c0 + c0 * cs_A, cs_A,
+			                               buff_VV + j * cs_VV,
+			                               buff_tv + j * inc_tv,
+			                               buff_VU + j * cs_VU,
+			                               buff_tu + j * inc_tu );
+			break;
+		}
+
+		case FLA_DOUBLE:
+		{
+			double* buff_A  = ( double* ) args->buff_A;
+			double* buff_VU = ( double* ) args->buff_VU;
+			double* buff_tu = ( double* ) args->buff_tu;
+			double* buff_VV = ( double* ) args->buff_VV;
+			double* buff_tv = ( double* ) args->buff_tv;
+
+			FLA_Bidiag_UT_2s_u_step_opd( m_B,
+			                               m_R,
+			                               n_L,
+			                               buff_A + r0 + c0 * cs_A,
+			                               buff_A + c0 + c0 * cs_A, cs_A,
+			                               buff_VV + j * cs_VV,
+			                               buff_tv + j * inc_tv,
+			                               buff_VU + j * cs_VU,
+			                               buff_tu + j * inc_tu );
+			break;
+		}
+
+		case FLA_COMPLEX:
+		{
+			scomplex* buff_A  = ( scomplex* ) args->buff_A;
+			scomplex* buff_VU = ( scomplex* ) args->buff_VU;
+			scomplex* buff_tu = ( scomplex* ) args->buff_tu;
+			scomplex* buff_VV = ( scomplex* ) args->buff_VV;
+			scomplex* buff_tv = ( scomplex* ) args->buff_tv;
+
+			FLA_Bidiag_UT_2s_u_step_opc( m_B,
+			                               m_R,
+			                               n_L,
+			                               buff_A + r0 + c0 * cs_A,
+			                               buff_A + c0 + c0 * cs_A, cs_A,
+			                               buff_VV + j * cs_VV,
+			                               buff_tv + j * inc_tv,
+			                               buff_VU + j * cs_VU,
+			                               buff_tu + j * inc_tu );
+			break;
+		}
+
+		case FLA_DOUBLE_COMPLEX:
+		{
+			dcomplex* buff_A  = ( dcomplex* ) args->buff_A;
+			dcomplex* buff_VU = ( dcomplex* ) args->buff_VU;
+			dcomplex* buff_tu = ( dcomplex* ) args->buff_tu;
+			dcomplex* buff_VV = ( dcomplex* ) args->buff_VV;
+			dcomplex* buff_tv = ( dcomplex* ) args->buff_tv;
+
+			FLA_Bidiag_UT_2s_u_step_opz( m_B,
+			                               m_R,
+			                               n_L,
+			                               buff_A + r0 + c0 * cs_A,
+			                               buff_A + c0 + c0 * cs_A, cs_A,
+			                               buff_VV + j * cs_VV,
+			                               buff_tv + j * inc_tv,
+			                               buff_VU + j * cs_VU,
+			                               buff_tu + j * inc_tu );
+			break;
+		}
+	}
+}
+
+
+
+FLA_Error FLA_Bidiag_UT_2s_u_step_ops( int       m_B,
+                                       int       m_R,
+                                       int       n_L,
+                                       float*    buff_R,
+                                       float*    buff_L, int cs_A,
+                                       float*    buff_uv,
+                                       float*    buff_tauv,
+                                       float*    buff_uu,
+                                       float*    buff_tauu )
+{
+	float*    buff_1  = FLA_FLOAT_PTR( FLA_ONE );
+	float*    buff_0  = FLA_FLOAT_PTR( FLA_ZERO );
+	int       i;
+
+	// Annihilate the row of the band that begins at buff_R beyond its first
+	// element, save the reflector, and apply it from the right to the m_R
+	// rows below.
+	FLA_Househ2_UT_r_ops( m_B - 1,
+	                      buff_R,
+	                      buff_R + cs_A, cs_A,
+	                      buff_tauv );
+
+	buff_uv[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_uv[i]         = buff_R[ i * cs_A ];
+		buff_R[ i * cs_A ] = *buff_0;
+	}
+
+	FLA_Apply_H2_UT_r_ops_var1( m_R,
+	                            m_B - 1,
+	                            buff_tauv,
+	                            buff_uv + 1, 1,
+	                            buff_R + 1, 1,
+	                            buff_R + 1 + cs_A, 1, cs_A );
+
+	// Annihilate the column of the band that begins at buff_L below its first
+	// element, which the previous reflector filled, save the reflector,
+	// and apply it from the left to the n_L columns to the right.
+	FLA_Househ2_UT_l_ops( m_B - 1,
+	                      buff_L,
+	                      buff_L + 1, 1,
+	                      buff_tauu );
+
+	buff_uu[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_uu[i] = buff_L[i];
+		buff_L[i]  = *buff_0;
+	}
+
+	FLA_Apply_H2_UT_l_ops_var1( m_B - 1,
+	                            n_L,
+	                            buff_tauu,
+	                            buff_uu + 1, 1,
+	                            buff_L + cs_A, cs_A,
+	                            buff_L + 1 + cs_A, 1, cs_A );
+
+	return FLA_SUCCESS;
+}
+
+
+
+FLA_Error FLA_Bidiag_UT_2s_u_step_opd( int       m_B,
+                                       int       m_R,
+                                       int       n_L,
+                                       double*   buff_R,
+                                       double*   buff_L, int cs_A,
+                                       double*   buff_uv,
+                                       double*   buff_tauv,
+                                       double*   buff_uu,
+                                       double*   buff_tauu )
+{
+	double*   buff_1  = FLA_DOUBLE_PTR( FLA_ONE );
+	double*   buff_0  = FLA_DOUBLE_PTR( FLA_ZERO );
+	int       i;
+
+	// Annihilate the row of the band that begins at buff_R beyond its first
+	// element, save the reflector, and apply it from the right to the m_R
+	// rows below.
+	FLA_Househ2_UT_r_opd( m_B - 1,
+	                      buff_R,
+	                      buff_R + cs_A, cs_A,
+	                      buff_tauv );
+
+	buff_uv[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_uv[i]         = buff_R[ i * cs_A ];
+		buff_R[ i * cs_A ] = *buff_0;
+	}
+
+	FLA_Apply_H2_UT_r_opd_var1( m_R,
+	                            m_B - 1,
+	                            buff_tauv,
+	                            buff_uv + 1, 1,
+	                            buff_R + 1, 1,
+	                            buff_R + 1 + cs_A, 1, cs_A );
+
+	// Annihilate the column of the band that begins at buff_L below its first
+	// element, which the previous reflector filled, save the reflector,
+	// and apply it from the left to the n_L columns to the right.
+	FLA_Househ2_UT_l_opd( m_B - 1,
+	                      buff_L,
+	                      buff_L + 1, 1,
+	                      buff_tauu );
+
+	buff_uu[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_uu[i] = buff_L[i];
+		buff_L[i]  = *buff_0;
+	}
+
+	FLA_Apply_H2_UT_l_opd_var1( m_B - 1,
+	                            n_L,
+	                            buff_tauu,
+	                            buff_uu + 1, 1,
+	                            buff_L + cs_A, cs_A,
+	                            buff_L + 1 + cs_A, 1, cs_A );
+
+	return FLA_SUCCESS;
+}
+
+
+
+FLA_Error FLA_Bidiag_UT_2s_u_step_opc( int       m_B,
+                                       int       m_R,
+                                       int       n_L,
+                                       scomplex* buff_R,
+                                       scomplex* buff_L, int cs_A,
+                                       scomplex* buff_uv,
+                                       scomplex* buff_tauv,
+                                       scomplex* buff_uu,
+                                       scomplex* buff_tauu )
+{
+	scomplex* buff_1  = FLA_COMPLEX_PTR( FLA_ONE );
+	scomplex* buff_0  = FLA_COMPLEX_PTR( FLA_ZERO );
+	int       i;
+
+	// Annihilate the row of the band that begins at buff_R beyond its first
+	// element, save the reflector, and apply it from the right to the m_R
+	// rows below.
+	FLA_Househ2_UT_r_opc( m_B - 1,
+	                      buff_R,
+	                      buff_R + cs_A, cs_A,
+	                      buff_tauv );
+
+	buff_uv[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_uv[i]         = buff_R[ i * cs_A ];
+		buff_R[ i * cs_A ] = *buff_0;
+	}
+
+	FLA_Apply_H2_UT_r_opc_var1( m_R,
+	                            m_B - 1,
+	                            buff_tauv,
+	                            buff_uv + 1, 1,
+	                            buff_R + 1, 1,
+	                            buff_R + 1 + cs_A, 1, cs_A );
+
+	// Annihilate the column of the band that begins at buff_L below its first
+	// element, which the previous reflector filled, save the reflector,
+	// and apply it from the left to the n_L columns to the right.
+	FLA_Househ2_UT_l_opc( m_B - 1,
+	                      buff_L,
+	                      buff_L + 1, 1,
+	                      buff_tauu );
+
+	buff_uu[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_uu[i] = buff_L[i];
+		buff_L[i]  = *buff_0;
+	}
+
+	FLA_Apply_H2_UT_l_opc_var1( m_B - 1,
+	                            n_L,
+	                            buff_tauu,
+	                            buff_uu + 1, 1,
+	                            buff_L + cs_A, cs_A,
+	                            buff_L + 1 + cs_A, 1, cs_A );
+
+	return FLA_SUCCESS;
+}
+
+
+
+FLA_Error FLA_Bidiag_UT_2s_u_step_opz( int       m_B,
+                                       int       m_R,
+                                       int       n_L,
+                                       dcomplex* buff_R,
+                                       dcomplex* buff_L, int cs_A,
+                                       dcomplex* buff_uv,
+                                       dcomplex* buff_tauv,
+                                       dcomplex* buff_uu,
+                                       dcomplex* buff_tauu )
+{
+	dcomplex* buff_1  = FLA_DOUBLE_COMPLEX_PTR( FLA_ONE );
+	dcomplex* buff_0  = FLA_DOUBLE_COMPLEX_PTR( FLA_ZERO );
+	int       i;
+
+	// Annihilate the row of the band that begins at buff_R beyond its first
+	// element, save the reflector, and apply it from the right to the m_R
+	// rows below.
+	FLA_Househ2_UT_r_opz( m_B - 1,
+	                      buff_R,
+	                      buff_R + cs_A, cs_A,
+	                      buff_tauv );
+
+	buff_uv[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_uv[i]         = buff_R[ i * cs_A ];
+		buff_R[ i * cs_A ] = *buff_0;
+	}
+
+	FLA_Apply_H2_UT_r_opz_var1( m_R,
+	                            m_B - 1,
+	                            buff_tauv,
+	                            buff_uv + 1, 1,
+	                            buff_R + 1, 1,
+	                            buff_R + 1 + cs_A, 1, cs_A );
+
+	// Annihilate the column of the band that begins at buff_L below its first
+	// element, which the previous reflector filled, save the reflector,
+	// and apply it from the left to the n_L columns to the right.
+	FLA_Househ2_UT_l_opz( m_B - 1,
+	                      buff_L,
+	                      buff_L + 1, 1,
+	                      buff_tauu );
+
+	buff_uu[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_uu[i] = buff_L[i];
+		buff_L[i]  = *buff_0;
+	}
+
+	FLA_Apply_H2_UT_l_opz_var1( m_B - 1,
+	                            n_L,
+	                            buff_tauu,
+	                            buff_uu + 1, 1,
+	                            buff_L + cs_A, cs_A,
+	                            buff_L + 1 + cs_A, 1, cs_A );
+
+	return FLA_SUCCESS;
+}
@@ -10,6 +10,7 @@
 
 //#include "FLA_Bidiag_UT_l.h"
 #include "FLA_Bidiag_UT_u.h"
+#include "FLA_Bidiag_UT_2s.h"
 
 FLA_Error FLA_Bidiag_UT( FLA_Obj A, FLA_Obj TU, FLA_Obj TV );
 
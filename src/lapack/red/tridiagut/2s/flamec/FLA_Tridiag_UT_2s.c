@@ -0,0 +1,41 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Tridiag_UT_2s( FLA_Uplo uplo, FLA_Obj A, FLA_Obj T, FLA_Obj V, FLA_Obj t )
+{
+  FLA_Error r_val = FLA_SUCCESS;
+
+  // Check parameters.
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_Tridiag_UT_check( uplo, A, T );
+
+  // The band is copied and chased with column-oriented kernels.
+  if ( FLA_Obj_row_stride( A ) != 1 )
+  {
+    FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+  }
+
+  if ( uplo == FLA_LOWER_TRIANGULAR )
+  {
+    // Reduce A to a band matrix of bandwidth b = length( T ), with level-3
+    // operations, and then the band matrix to tridiagonal form.
+    r_val = FLA_Tridiag_UT_2s_l_band( A, T );
+    r_val = FLA_Tridiag_UT_2s_l_chase( A, V, t );
+  }
+  else // if ( uplo == FLA_UPPER_TRIANGULAR )
+  {
+    FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+  }
+
+  return r_val;
+}
+
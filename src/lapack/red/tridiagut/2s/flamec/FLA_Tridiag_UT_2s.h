@@ -0,0 +1,61 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+// The default bandwidth of the intermediate band matrix.
+#define FLA_TRIDIAG_UT_2S_BANDWIDTH 32
+
+FLA_Error FLA_Tridiag_UT_2s( FLA_Uplo uplo, FLA_Obj A, FLA_Obj T, FLA_Obj V, FLA_Obj t );
+
+FLA_Error FLA_Tridiag_UT_2s_create( FLA_Obj A, dim_t b_band, FLA_Obj* T, FLA_Obj* V, FLA_Obj* t );
+
+FLA_Error FLA_Tridiag_UT_2s_apply_Q( FLA_Uplo uplo, FLA_Obj A, FLA_Obj T, FLA_Obj V, FLA_Obj t, FLA_Obj B );
+FLA_Error FLA_Tridiag_UT_2s_form_Q( FLA_Uplo uplo, FLA_Obj A, FLA_Obj T, FLA_Obj V, FLA_Obj t, FLA_Obj Q );
+FLA_Error FLA_Tridiag_UT_2s_l_apply_Q1( FLA_Obj A, FLA_Obj T, FLA_Obj B );
+FLA_Error FLA_Tridiag_UT_2s_l_apply_Q2( FLA_Bool B_is_identity, FLA_Obj V, FLA_Obj t, FLA_Obj B );
+
+FLA_Error FLA_Tridiag_UT_2s_l_band( FLA_Obj A, FLA_Obj T );
+
+FLA_Error FLA_Tridiag_UT_2s_l_chase( FLA_Obj A, FLA_Obj V, FLA_Obj t );
+FLA_Error FLA_Tridiag_UT_2s_l_step_ops( int       m_B,
+                                        int       n_B,
+                                        float*    buff_B,
+                                        float*    buff_D, int cs_A,
+                                        float*    buff_u,
+                                        float*    buff_tau,
+                                        float*    buff_u_prev,
+                                        float*    buff_tau_prev,
+                                        float*    buff_w );
+FLA_Error FLA_Tridiag_UT_2s_l_step_opd( int       m_B,
+                                        int       n_B,
+                                        double*   buff_B,
+                                        double*   buff_D, int cs_A,
+                                        double*   buff_u,
+                                        double*   buff_tau,
+                                        double*   buff_u_prev,
+                                        double*   buff_tau_prev,
+                                        double*   buff_w );
+FLA_Error FLA_Tridiag_UT_2s_l_step_opc( int       m_B,
+                                        int       n_B,
+                                        scomplex* buff_B,
+                                        scomplex* buff_D, int cs_A,
+                                        scomplex* buff_u,
+                                        scomplex* buff_tau,
+                                        scomplex* buff_u_prev,
+                                        scomplex* buff_tau_prev,
+                                        scomplex* buff_w );
+FLA_Error FLA_Tridiag_UT_2s_l_step_opz( int       m_B,
+                                        int       n_B,
+                                        dcomplex* buff_B,
+                                        dcomplex* buff_D, int cs_A,
+                                        dcomplex* buff_u,
+                                        dcomplex* buff_tau,
+                                        dcomplex* buff_u_prev,
+                                        dcomplex* buff_tau_prev,
+                                        dcomplex* buff_w );
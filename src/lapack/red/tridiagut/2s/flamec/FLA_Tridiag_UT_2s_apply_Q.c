@@ -0,0 +1,164 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Tridiag_UT_2s_apply_Q( FLA_Uplo uplo, FLA_Obj A, FLA_Obj T, FLA_Obj V, FLA_Obj t, FLA_Obj B )
+{
+  FLA_Error r_val = FLA_SUCCESS;
+
+  if ( uplo == FLA_LOWER_TRIANGULAR )
+  {
+    // B := Q1 Q2 B, where Q1 is the orthogonal matrix of the reduction to
+    // band form and Q2 that of the reduction to tridiagonal form.
+    r_val = FLA_Tridiag_UT_2s_l_apply_Q2( FALSE, V, t, B );
+    r_val = FLA_Tridiag_UT_2s_l_apply_Q1( A, T, B );
+  }
+  else // if ( uplo == FLA_UPPER_TRIANGULAR )
+  {
+    FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+  }
+
+  return r_val;
+}
+
+FLA_Error FLA_Tridiag_UT_2s_l_apply_Q1( FLA_Obj A, FLA_Obj T, FLA_Obj B )
+{
+  FLA_Obj ATL, ATR,
+          ABL, ABR;
+  FLA_Obj TL,  TR;
+  FLA_Obj BT,
+          BB;
+  FLA_Obj W;
+  dim_t   m_A, b;
+
+  m_A = FLA_Obj_length( A );
+  b   = FLA_Obj_length( T );
+
+  // The Householder vectors of the reduction to band form lie below the
+  // b-th subdiagonal of A, so that they form the QR factorization of
+  // A( b:m_A-1, 0:m_A-b-1 ).
+  if ( m_A <= b ) return FLA_SUCCESS;
+
+  FLA_Part_2x2( A,    &ATL, &ATR,
+                      &ABL, &ABR,    b, m_A - b, FLA_TL );
+  FLA_Part_1x2( T,    &TL,  &TR,     m_A - b, FLA_LEFT );
+  FLA_Part_2x1( B,    &BT,
+                      &BB,           b, FLA_TOP );
+
+  FLA_Apply_Q_UT_create_workspace( TL, BB, &W );
+
+  FLA_Apply_Q_UT( FLA_LEFT, FLA_NO_TRANSPOSE, FLA_FORWARD, FLA_COLUMNWISE,
+                  ABL, TL, W, BB );
+
+  FLA_Obj_free( &W );
+
+  return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Tridiag_UT_2s_l_apply_Q2( FLA_Bool B_is_identity, FLA_Obj V, FLA_Obj t, FLA_Obj B )
+{
+  FLA_Datatype datatype;
+  FLA_Obj      Vg, Tg, W;
+  FLA_Obj      Vg1, Tg1, tg1, W1, B1;
+  FLA_Obj      junk;
+  char*        buff_V;
+  char*        buff_Vg;
+  dim_t        elem_size;
+  dim_t        m_A, b;
+  dim_t        cs_V, cs_Vg;
+  int          n_sweeps, k_max;
+  int          s, k, j, g, r0, m_g, m_u;
+
+  datatype  = FLA_Obj_datatype( V );
+  elem_size = FLA_Obj_elem_size( V );
+  m_A       = FLA_Obj_length( B );
+  b         = FLA_Obj_length( V );
+
+  // A band of width one (or a matrix of order two) was already tridiagonal.
+  if ( b < 2 || m_A < 3 ) return FLA_SUCCESS;
+
+  n_sweeps = m_A - 2;
+  k_max    = ( m_A - 3 ) / b + 1;
+
+  FLA_Obj_create( datatype, 2 * b - 1, b, 0, 0, &Vg );
+  FLA_Obj_create( datatype, b,         b, 0, 0, &Tg );
+  FLA_Apply_Q_UT_create_workspace( Tg, B, &W );
+
+  buff_V  = ( char* ) FLA_Obj_buffer_at_view( V );
+  buff_Vg = ( char* ) FLA_Obj_buffer_at_view( Vg );
+  cs_V    = FLA_Obj_col_stride( V );
+  cs_Vg   = FLA_Obj_col_stride( Vg );
+
+  // The k-th reflectors of b consecutive sweeps overlap in a staircase of
+  // 2b-1 rows, and are aggregated into a block transform. The blocks are
+  // applied from the last group of sweeps to the first, and within each
+  // group in order of increasing k, which respects the order in which the
+  // reflectors that overlap were generated.
+  for ( s = ( ( n_sweeps - 1 ) / b ) * b; s >= 0; s -= b )
+  {
+    for ( k = 0; k < k_max; ++k )
+    {
+      // Sweeps s through s+g-1 generated a k-th reflector.
+      g = min( s + b, min( n_sweeps, m_A - 2 - k * b ) ) - s;
+      if ( g <= 0 ) break;
+
+      r0  = s + 1 + k * b;
+      m_g = min( g - 1 + b, m_A - r0 );
+
+      FLA_Part_2x2( Vg,  &Vg1, &junk,
+                         &junk, &junk,   m_g, g, FLA_TL );
+      FLA_Part_2x2( Tg,  &Tg1, &junk,
+                         &junk, &junk,   g, g,   FLA_TL );
+      FLA_Part_2x1( W,   &W1,
+                         &junk,          g,      FLA_TOP );
+      FLA_Part_2x1( t,   &junk,
+                         &tg1,           k * n_sweeps + s, FLA_TOP );
+      FLA_Part_2x1( tg1, &tg1,
+                         &junk,          g,      FLA_TOP );
+      FLA_Part_2x1( B,   &junk,
+                         &B1,            r0,     FLA_TOP );
+      FLA_Part_2x1( B1,  &B1,
+                         &junk,          m_g,    FLA_TOP );
+
+      // If B was the identity before Q2 was applied, then the rows that
+      // these reflectors act upon are still zero in their first s+1
+      // columns.
+      if ( B_is_identity )
+      {
+        FLA_Part_1x2( B1,  &junk, &B1,   s + 1,  FLA_LEFT );
+        FLA_Part_1x2( W1,  &junk, &W1,   s + 1,  FLA_LEFT );
+      }
+
+      // Copy the reflectors into the staircase, each one row below the
+      // one before it.
+      FLA_Set( FLA_ZERO, Vg1 );
+
+      for ( j = 0; j < g; ++j )
+      {
+        m_u = min( b, m_A - r0 - j );
+        memcpy( buff_Vg + ( j + j * cs_Vg ) * elem_size,
+                buff_V  + ( ( k * n_sweeps + s + j ) * cs_V ) * elem_size,
+                m_u * elem_size );
+      }
+
+      FLA_Accum_T_UT( FLA_FORWARD, FLA_COLUMNWISE, Vg1, tg1, Tg1 );
+
+      FLA_Apply_Q_UT( FLA_LEFT, FLA_NO_TRANSPOSE, FLA_FORWARD, FLA_COLUMNWISE,
+                      Vg1, Tg1, W1, B1 );
+    }
+  }
+
+  FLA_Obj_free( &Vg );
+  FLA_Obj_free( &Tg );
+  FLA_Obj_free( &W );
+
+  return FLA_SUCCESS;
+}
@@ -0,0 +1,43 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Tridiag_UT_2s_create( FLA_Obj A, dim_t b_band, FLA_Obj* T, FLA_Obj* V, FLA_Obj* t )
+{
+  FLA_Datatype datatype;
+  dim_t        m_A;
+  dim_t        n_sweeps, k_max;
+
+  // Query the datatype and order of A.
+  datatype = FLA_Obj_datatype( A );
+  m_A      = FLA_Obj_length( A );
+
+  // The bandwidth may not exceed the order of A less one.
+  b_band = max( 1, min( b_band, m_A - 1 ) );
+
+  // Create a b_band x m_A matrix to hold the block Householder transforms
+  // of the reduction to band form, one b_band x b_band block for each panel
+  // of b_band columns. (The last b_band columns are not used.)
+  FLA_Obj_create( datatype, b_band, m_A, 0, 0, T );
+
+  // The reduction from band to tridiagonal form performs m_A - 2 sweeps,
+  // the first of which generates the most reflectors, k_max. Create a
+  // matrix to hold each reflector, of length at most b_band, in a column,
+  // and a vector to hold the corresponding tau.
+  n_sweeps = ( m_A > 2 ? m_A - 2 : 0 );
+  k_max    = ( m_A > 2 ? ( m_A - 3 ) / b_band + 1 : 0 );
+
+  FLA_Obj_create( datatype, b_band, max( 1, n_sweeps * k_max ), 0, 0, V );
+  FLA_Obj_create( datatype, max( 1, n_sweeps * k_max ), 1, 0, 0, t );
+
+  return FLA_SUCCESS;
+}
+
@@ -0,0 +1,34 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Tridiag_UT_2s_form_Q( FLA_Uplo uplo, FLA_Obj A, FLA_Obj T, FLA_Obj V, FLA_Obj t, FLA_Obj Q )
+{
+  FLA_Error r_val = FLA_SUCCESS;
+
+  // Q must be distinct from A, which holds the Householder vectors of the
+  // reduction to band form.
+  FLA_Set_to_identity( Q );
+
+  if ( uplo == FLA_LOWER_TRIANGULAR )
+  {
+    // Apply Q2 first, so that the leading columns of Q that are still
+    // zero may be skipped.
+    r_val = FLA_Tridiag_UT_2s_l_apply_Q2( TRUE, V, t, Q );
+    r_val = FLA_Tridiag_UT_2s_l_apply_Q1( A, T, Q );
+  }
+  else // if ( uplo == FLA_UPPER_TRIANGULAR )
+  {
+    FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+  }
+
+  return r_val;
+}
@@ -0,0 +1,101 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern fla_qrut_t* fla_qrut_cntl_leaf;
+
+FLA_Error FLA_Tridiag_UT_2s_l_band( FLA_Obj A, FLA_Obj T )
+{
+	FLA_Obj   ATL, ATR,
+	          ABL, ABR;
+	FLA_Obj   AP,  AP1, TP, TP1;
+	FLA_Obj   W,   U,  U1;
+	FLA_Obj   X,   X1;
+	FLA_Obj   M,   M1;
+	FLA_Obj   junk;
+	dim_t     m_A, b, m_P, n_P, j;
+
+	m_A = FLA_Obj_length( A );
+	b   = FLA_Obj_length( T );
+
+	// Create workspace for the Householder vectors of a panel (W), for the
+	// update of the trailing matrix (X) and for a small product (M).
+	FLA_Obj_create( FLA_Obj_datatype( A ), m_A, b, 0, 0, &W );
+	FLA_Obj_create( FLA_Obj_datatype( A ), m_A, b, 0, 0, &X );
+	FLA_Obj_create( FLA_Obj_datatype( A ), b,   b, 0, 0, &M );
+
+	for ( j = 0; j + b < m_A; j += b )
+	{
+		m_P = m_A - b - j;
+		n_P = min( b, m_P );
+
+		// AP = A( j+b:m_A-1, j:j+b-1 ) is the panel below the band, and
+		// ABR = A( j+b:m_A-1, j+b:m_A-1 ) is the trailing matrix. The last
+		// panel may have fewer than b rows, in which case only its first n_P
+		// columns are annihilated and QR_UT applies Q' to the others.
+		FLA_Part_2x2( A,    &ATL, &ATR,
+		                    &ABL, &AP,      j + b, j, FLA_TL );
+		FLA_Part_1x2( AP,   &AP,  &junk,    b,        FLA_LEFT );
+		FLA_Part_1x2( AP,   &AP1, &junk,    n_P,      FLA_LEFT );
+		FLA_Part_2x2( A,    &ATL, &ATR,
+		                    &ABL, &ABR,     j + b, j + b, FLA_TL );
+
+		// TP = T( :, j:j+b-1 ) and TP1 is its leading n_P x n_P block.
+		FLA_Part_1x2( T,    &junk, &TP,     j,        FLA_LEFT );
+		FLA_Part_1x2( TP,   &TP,   &junk,   b,        FLA_LEFT );
+		FLA_Part_2x2( TP,   &TP1,  &junk,
+		                    &junk, &junk,   n_P, n_P, FLA_TL );
+
+		FLA_Part_2x2( W,    &U,    &junk,
+		                    &junk, &junk,   m_P, n_P, FLA_TL );
+		FLA_Part_2x1( U,    &U1,
+		                    &junk,          n_P,      FLA_TOP );
+		FLA_Part_2x2( X,    &X1,   &junk,
+		                    &junk, &junk,   m_P, n_P, FLA_TL );
+		FLA_Part_2x2( M,    &M1,   &junk,
+		                    &junk, &junk,   n_P, n_P, FLA_TL );
+
+		// Annihilate the panel below its upper triangle with a QR
+		// factorization, AP = Q R, where Q = I - U inv(TP1) U'. The panel is
+		// factored by the blocked algorithm directly, so that the reduction
+		// does not change when FLA_QR_UT() is tuned to use TSQR.
+		FLA_QR_UT_internal( AP, TP, fla_qrut_cntl_leaf );
+
+		// Copy the Householder vectors to U, with an explicit unit diagonal
+		// and zeros above it.
+		FLA_Copy( AP1, U );
+		FLA_Triangularize( FLA_LOWER_TRIANGULAR, FLA_UNIT_DIAG, U1 );
+
+		// Apply Q from both sides to the trailing matrix:
+		//   X   = ABR U inv(TP1);
+		//   X   = X - 1/2 U ( inv(TP1)' U' X );
+		//   ABR = ABR - U X' - X U';
+		FLA_Hemm( FLA_LEFT, FLA_LOWER_TRIANGULAR,
+		          FLA_ONE, ABR, U, FLA_ZERO, X1 );
+		FLA_Trsm( FLA_RIGHT, FLA_UPPER_TRIANGULAR, FLA_NO_TRANSPOSE, FLA_NONUNIT_DIAG,
+		          FLA_ONE, TP1, X1 );
+		FLA_Gemm( FLA_CONJ_TRANSPOSE, FLA_NO_TRANSPOSE,
+		          FLA_ONE, U, X1, FLA_ZERO, M1 );
+		FLA_Trsm( FLA_LEFT, FLA_UPPER_TRIANGULAR, FLA_CONJ_TRANSPOSE, FLA_NONUNIT_DIAG,
+		          FLA_ONE, TP1, M1 );
+		FLA_Gemm( FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE,
+		          FLA_MINUS_ONE_HALF, U, M1, FLA_ONE, X1 );
+		FLA_Her2k( FLA_LOWER_TRIANGULAR, FLA_NO_TRANSPOSE,
+		           FLA_MINUS_ONE, U, X1, FLA_ONE, ABR );
+	}
+
+	FLA_Obj_free( &W );
+	FLA_Obj_free( &X );
+	FLA_Obj_free( &M );
+
+	return FLA_SUCCESS;
+}
+
@@ -0,0 +1,653 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#if !defined(FLA_ENABLE_WINDOWS_BUILD) && !defined(FLA_ENABLE_TIDSP)
+#include <sched.h>
+#endif
+
+// The band is chased in a compact copy in which element (i,j) of the lower
+// band, for 0 <= i - j < 2b, is stored at buff_A[ i + j*cs_A ] with
+// cs_A = 2b - 1. Any block within the band (and the bulge below it) is
+// thus an ordinary column-major matrix with column stride cs_A, and the
+// whole working set of a sweep stays in cache.
+
+typedef struct FLA_Tridiag_UT_2s_vars_s
+{
+	FLA_Datatype datatype;
+	int          m_A;
+	int          b;
+	int          n_sweeps;
+	void*        buff_A;
+	int          cs_A;
+	void*        buff_V;
+	int          cs_V;
+	void*        buff_t;
+	int          inc_t;
+	int*         n_done;
+} FLA_Tridiag_UT_2s_vars;
+
+static void  FLA_Tridiag_UT_2s_l_chase_step( FLA_Tridiag_UT_2s_vars* args, int i, int k, void* buff_w );
+static void* FLA_Tridiag_UT_2s_l_chase_thread( void* arg );
+
+FLA_Error FLA_Tridiag_UT_2s_l_chase( FLA_Obj A, FLA_Obj V, FLA_Obj t )
+{
+	FLA_Tridiag_UT_2s_vars args;
+	FLA_Obj                A_band;
+	char*                  buff_A;
+	char*                  buff_band;
+	dim_t                  elem_size;
+	int                    m_A, cs_A, b;
+	int                    n_threads = 1;
+	int                    i, n_copy;
+
+	m_A       = FLA_Obj_length( A );
+	cs_A      = FLA_Obj_col_stride( A );
+	b         = FLA_Obj_length( V );
+	elem_size = FLA_Obj_elem_size( A );
+	buff_A    = ( char* ) FLA_Obj_buffer_at_view( A );
+
+	// A band of width one (or a matrix of order two) is already tridiagonal.
+	if ( b < 2 || m_A < 3 )
+		return FLA_SUCCESS;
+
+#if defined(FLA_ENABLE_MULTITHREADING) && defined(FLASH_QUEUE_ENABLE_ATOMICS)
+	// Pipeline the sweeps across the threads that SuperMatrix is set to use.
+	n_threads = FLASH_Queue_get_num_threads();
+	n_threads = max( 1, min( n_threads, m_A - 2 ) );
+#endif
+
+	// Copy the lower band of A into the compact storage, with room for the
+	// bulge below it.
+	FLA_Obj_create( FLA_Obj_datatype( A ), 2 * b, m_A, 0, 0, &A_band );
+	FLA_Set( FLA_ZERO, A_band );
+	buff_band = ( char* ) FLA_Obj_buffer_at_view( A_band );
+
+	for ( i = 0; i < m_A; ++i )
+	{
+		n_copy = min( b + 1, m_A - i );
+		memcpy( buff_band + ( i + i * ( 2 * b - 1 ) ) * elem_size,
+		        buff_A    + ( i + i * cs_A          ) * elem_size,
+		        n_copy * elem_size );
+	}
+
+	args.datatype  = FLA_Obj_datatype( A );
+	args.m_A       = m_A;
+	args.b         = b;
+	args.n_sweeps  = m_A - 2;
+	args.buff_A    = buff_band;
+	args.cs_A      = 2 * b - 1;
+	args.buff_V    = FLA_Obj_buffer_at_view( V );
+	args.cs_V      = FLA_Obj_col_stride( V );
+	args.buff_t    = FLA_Obj_buffer_at_view( t );
+	args.inc_t     = FLA_Obj_vector_inc( t );
+	args.n_done    = ( int* ) FLA_malloc( args.n_sweeps * sizeof( int ) );
+
+	for ( i = 0; i < args.n_sweeps; ++i )
+		args.n_done[i] = 0;
+
+	// The sweeps are dealt out to the threads that actually run, which may
+	// be fewer than requested if they are busy with another job.
+	FLA_Thread_run( n_threads, FLA_Tridiag_UT_2s_l_chase_thread, ( void* ) &args );
+
+	// Copy the tridiagonal matrix back to A and clear the rest of the band,
+	// leaving the Householder vectors of the first stage below it intact.
+	for ( i = 0; i < m_A; ++i )
+	{
+		n_copy = min( 2, m_A - i );
+		memcpy( buff_A    + ( i + i * cs_A          ) * elem_size,
+		        buff_band + ( i + i * ( 2 * b - 1 ) ) * elem_size,
+		        n_copy * elem_size );
+
+		n_copy = min( b + 1, m_A - i ) - 2;
+		if ( n_copy > 0 )
+			memset( buff_A + ( i + 2 + i * cs_A ) * elem_size, 0,
+			        n_copy * elem_size );
+	}
+
+	FLA_free( args.n_done );
+	FLA_Obj_free( &A_band );
+
+	return FLA_SUCCESS;
+}
+
+
+
+static void* FLA_Tridiag_UT_2s_l_chase_thread( void* arg )
+{
+	FLASH_Thread*           me   = ( FLASH_Thread* ) arg;
+	FLA_Tridiag_UT_2s_vars* args = ( FLA_Tridiag_UT_2s_vars* ) me->args;
+	void*                   buff_w;
+	int                     b    = args->b;
+	int                     i, k;
+	int                     n_steps;
+
+	buff_w = FLA_malloc( b * FLA_Obj_datatype_size( args->datatype ) );
+
+	// Sweep i annihilates column i and chases the resulting bulge down the
+	// band in n_steps steps of b rows each. Consecutive sweeps are assigned
+	// to different threads; the k-th step of sweep i overlaps the steps of
+	// sweep i-1 up to k+2 and may start as soon as those are complete.
+	for ( i = me->id; i < args->n_sweeps; i += me->n_threads )
+	{
+		n_steps = ( args->m_A - 2 - i ) / b + 1;
+
+		for ( k = 0; k < n_steps; ++k )
+		{
+#if defined(FLA_ENABLE_MULTITHREADING) && defined(FLASH_QUEUE_ENABLE_ATOMICS)
+			if ( i > 0 )
+			{
+				int n_steps_prev = ( args->m_A - 1 - i ) / b + 1;
+				int n_wait       = min( k + 3, n_steps_prev );
+
+				// Give up the core while waiting, in case there are more
+				// threads than cores.
+				while ( FLASH_ATOMIC_LOAD( &(args->n_done[i-1]) ) < n_wait )
+				{
+#if !defined(FLA_ENABLE_WINDOWS_BUILD) && !defined(FLA_ENABLE_TIDSP)
+					sched_yield();
+#endif
+				}
+			}
+#endif
+
+			FLA_Tridiag_UT_2s_l_chase_step( args, i, k, buff_w );
+
+#if defined(FLA_ENABLE_MULTITHREADING) && defined(FLASH_QUEUE_ENABLE_ATOMICS)
+			FLASH_ATOMIC_STORE( &(args->n_done[i]), k + 1 );
+#else
+			args->n_done[i] = k + 1;
+#endif
+		}
+	}
+
+	FLA_free( buff_w );
+
+	return NULL;
+}
+
+
+
+static void FLA_Tridiag_UT_2s_l_chase_step( FLA_Tridiag_UT_2s_vars* args, int i, int k, void* buff_w )
+{
+	int b     = args->b;
+	int cs_A  = args->cs_A;
+	int cs_V  = args->cs_V;
+	int inc_t = args->inc_t;
+
+	// The k-th reflector of sweep i acts on rows r0:r0+m_B-1. At step zero
+	// it annihilates column i; later it annihilates the first column of the
+	// bulge that the previous reflector created in columns c0:c0+n_B-1.
+	int r0    = i + 1 + k * b;
+	int m_B   = min( b, args->m_A - r0 );
+	int c0    = ( k == 0 ? i : r0 - b );
+	int n_B   = ( k == 0 ? 1 : b );
+
+	// The reflectors are stored with those of equal step index from
+	// consecutive sweeps adjacent, which is the order in which they are
+	// aggregated when Q is applied.
+	int j      = k * args->n_sweeps + i;
+	int j_prev = j - args->n_sweeps;
+
+	switch ( args->datatype )
+	{
+		case FLA_FLOAT:
+		{
+			float* buff_A = ( float* ) args->buff_A;
+			float* buff_V = ( float* ) args->buff_V;
+			float* buff_t = ( float* ) args->buff_t;
+
+			FLA_Tridiag_UT_2s_l_step_ops( m_B,
+			                              n_B,
+			                              buff_A + r0 + c0 * cs_A,
+			                              buff_A + r0 + r0 * cs_A, cs_A,
+			                              ( m_B > 1 ? buff_V + j * cs_V : NULL ),
+			                              ( m_B > 1 ? buff_t + j * inc_t : NULL ),
+			                              ( k > 0 ? buff_V + j_prev * cs_V : NULL ),
+			                              ( k > 0 ? buff_t + j_prev * inc_t : NULL ),
+			                              ( float* ) buff_w );
+			break;
+		}
+
+		case FLA_DOUBLE:
+		{
+			double* buff_A = ( double* ) args->buff_A;
+			double* buff_V = ( double* ) args->buff_V;
+			double* buff_t = ( double* ) args->buff_t;
+
+			FLA_Tridiag_UT_2s_l_step_opd( m_B,
+			                              n_B,
+			                              buff_A + r0 + c0 * cs_A,
+			                              buff_A + r0 + r0 * cs_A, cs_A,
+			                              ( m_B > 1 ? buff_V + j * cs_V : NULL ),
+			                              ( m_B > 1 ? buff_t + j * inc_t : NULL ),
+			                              ( k > 0 ? buff_V + j_prev * cs_V : NULL ),
+			                              ( k > 0 ? buff_t + j_prev * inc_t : NULL ),
+			                              ( double* ) buff_w );
+			break;
+		}
+
+		case FLA_COMPLEX:
+		{
+			scomplex* buff_A = ( scomplex* ) args->buff_A;
+			scomplex* buff_V = ( scomplex* ) args->buff_V;
+			scomplex* buff_t = ( scomplex* ) args->buff_t;
+
+			FLA_Tridiag_UT_2s_l_step_opc( m_B,
+			                              n_B,
+			                              buff_A + r0 + c0 * cs_A,
+			                              buff_A + r0 + r0 * cs_A, cs_A,
+			                              ( m_B > 1 ? buff_V + j * cs_V : NULL ),
+			                              ( m_B > 1 ? buff_t + j * inc_t : NULL ),
+			                              ( k > 0 ? buff_V + j_prev * cs_V : NULL ),
+			                              ( k > 0 ? buff_t + j_prev * inc_t : NULL ),
+			                              ( scomplex* ) buff_w );
+			break;
+		}
+
+		case FLA_DOUBLE_COMPLEX:
+		{
+			dcomplex* buff_A = ( dcomplex* ) args->buff_A;
+			dcomplex* buff_V = ( dcomplex* ) args->buff_V;
+			dcomplex* buff_t = ( dcomplex* ) args->buff_t;
+
+			FLA_Tridiag_UT_2s_l_step_opz( m_B,
+			                              n_B,
+			                              buff_A + r0 + c0 * cs_A,
+			                              buff_A + r0 + r0 * cs_A, cs_A,
+			                              ( m_B > 1 ? buff_V + j * cs_V : NULL ),
+			                              ( m_B > 1 ? buff_t + j * inc_t : NULL ),
+			                              ( k > 0 ? buff_V + j_prev * cs_V : NULL ),
+			                              ( k > 0 ? buff_t + j_prev * inc_t : NULL ),
+			                              ( dcomplex* ) buff_w );
+			break;
+		}
+	}
+}
+
+
+
+FLA_Error FLA_Tridiag_UT_2s_l_step_ops( int       m_B,
+                                        int       n_B,
+                                        float*    buff_B,
+                                        float*    buff_D, int cs_A,
+                                        float*    buff_u,
+                                        float*    buff_tau,
+                                        float*    buff_u_prev,
+                                        float*    buff_tau_prev,
+                                        float*    buff_w )
+{
+	float*    buff_1  = FLA_FLOAT_PTR( FLA_ONE );
+	float*    buff_0  = FLA_FLOAT_PTR( FLA_ZERO );
+	float*    buff_m1 = FLA_FLOAT_PTR( FLA_MINUS_ONE );
+	float     beta;
+	int       i;
+
+	// Apply the previous reflector from the right, which fills B.
+	if ( buff_u_prev != NULL )
+		FLA_Apply_H2_UT_r_ops_var1( m_B,
+		                            n_B - 1,
+		                            buff_tau_prev,
+		                            buff_u_prev + 1, 1,
+		                            buff_B, 1,
+		                            buff_B + cs_A, 1, cs_A );
+
+	if ( m_B < 2 ) return FLA_SUCCESS;
+
+	// Annihilate the first column of B below its first element, and save
+	// the reflector.
+	FLA_Househ2_UT_l_ops( m_B - 1,
+	                      buff_B,
+	                      buff_B + 1, 1,
+	                      buff_tau );
+
+	buff_u[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_u[i] = buff_B[i];
+		buff_B[i] = *buff_0;
+	}
+
+	// Apply the reflector from the left to the rest of B.
+	if ( n_B > 1 )
+		FLA_Apply_H2_UT_l_ops_var1( m_B - 1,
+		                            n_B - 1,
+		                            buff_tau,
+		                            buff_u + 1, 1,
+		                            buff_B + cs_A, cs_A,
+		                            buff_B + 1 + cs_A, 1, cs_A );
+
+	// Apply the reflector from both sides to the diagonal block D:
+	//   w = D u / tau - ( u' D u / ( 2 tau^2 ) ) u;
+	//   D = D - u w' - w u';
+	bl1_shemv( BLIS1_LOWER_TRIANGULAR,
+	           BLIS1_NO_CONJUGATE,
+	           m_B,
+	           buff_1,
+	           buff_D, 1, cs_A,
+	           buff_u, 1,
+	           buff_0,
+	           buff_w, 1 );
+
+	bl1_sinvscalv( BLIS1_NO_CONJUGATE,
+	               m_B,
+	               buff_tau,
+	               buff_w, 1 );
+
+	bl1_sdot( BLIS1_CONJUGATE,
+	          m_B,
+	          buff_u, 1,
+	          buff_w, 1,
+	          &beta );
+
+	beta = -beta / ( 2.0F * (*buff_tau) );
+
+	bl1_saxpyv( BLIS1_NO_CONJUGATE,
+	            m_B,
+	            &beta,
+	            buff_u, 1,
+	            buff_w, 1 );
+
+	bl1_sher2( BLIS1_LOWER_TRIANGULAR,
+	           BLIS1_NO_CONJUGATE,
+	           m_B,
+	           buff_m1,
+	           buff_u, 1,
+	           buff_w, 1,
+	           buff_D, 1, cs_A );
+
+	return FLA_SUCCESS;
+}
+
+
+
+FLA_Error FLA_Tridiag_UT_2s_l_step_opd( int       m_B,
+                                        int       n_B,
+                                        double*   buff_B,
+                                        double*   buff_D, int cs_A,
+                                        double*   buff_u,
+                                        double*   buff_tau,
+                                        double*   buff_u_prev,
+                                        double*   buff_tau_prev,
+                                        double*   buff_w )
+{
+	double*   buff_1  = FLA_DOUBLE_PTR( FLA_ONE );
+	double*   buff_0  = FLA_DOUBLE_PTR( FLA_ZERO );
+	double*   buff_m1 = FLA_DOUBLE_PTR( FLA_MINUS_ONE );
+	double    beta;
+	int       i;
+
+	// Apply the previous reflector from the right, which fills B.
+	if ( buff_u_prev != NULL )
+		FLA_Apply_H2_UT_r_opd_var1( m_B,
+		                            n_B - 1,
+		                            buff_tau_prev,
+		                            buff_u_prev + 1, 1,
+		                            buff_B, 1,
+		                            buff_B + cs_A, 1, cs_A );
+
+	if ( m_B < 2 ) return FLA_SUCCESS;
+
+	// Annihilate the first column of B below its first element, and save
+	// the reflector.
+	FLA_Househ2_UT_l_opd( m_B - 1,
+	                      buff_B,
+	                      buff_B + 1, 1,
+	                      buff_tau );
+
+	buff_u[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_u[i] = buff_B[i];
+		buff_B[i] = *buff_0;
+	}
+
+	// Apply the reflector from the left to the rest of B.
+	if ( n_B > 1 )
+		FLA_Apply_H2_UT_l_opd_var1( m_B - 1,
+		                            n_B - 1,
+		                            buff_tau,
+		                            buff_u + 1, 1,
+		                            buff_B + cs_A, cs_A,
+		                            buff_B + 1 + cs_A, 1, cs_A );
+
+	// Apply the reflector from both sides to the diagonal block D:
+	//   w = D u / tau - ( u' D u / ( 2 tau^2 ) ) u;
+	//   D = D - u w' - w u';
+	bl1_dhemv( BLIS1_LOWER_TRIANGULAR,
+	           BLIS1_NO_CONJUGATE,
+	           m_B,
+	           buff_1,
+	           buff_D, 1, cs_A,
+	           buff_u, 1,
+	           buff_0,
+	           buff_w, 1 );
+
+	bl1_dinvscalv( BLIS1_NO_CONJUGATE,
+	               m_B,
+	               buff_tau,
+	               buff_w, 1 );
+
+	bl1_ddot( BLIS1_CONJUGATE,
+	          m_B,
+	          buff_u, 1,
+	          buff_w, 1,
+	          &beta );
+
+	beta = -beta / ( 2.0 * (*buff_tau) );
+
+	bl1_daxpyv( BLIS1_NO_CONJUGATE,
+	            m_B,
+	            &beta,
+	            buff_u, 1,
+	            buff_w, 1 );
+
+	bl1_dher2( BLIS1_LOWER_TRIANGULAR,
+	           BLIS1_NO_CONJUGATE,
+	           m_B,
+	           buff_m1,
+	           buff_u, 1,
+	           buff_w, 1,
+	           buff_D, 1, cs_A );
+
+	return FLA_SUCCESS;
+}
+
+
+
+FLA_Error FLA_Tridiag_UT_2s_l_step_opc( int       m_B,
+                                        int       n_B,
+                                        scomplex* buff_B,
+                                        scomplex* buff_D, int cs_A,
+                                        scomplex* buff_u,
+                                        scomplex* buff_tau,
+                                        scomplex* buff_u_prev,
+                                        scomplex* buff_tau_prev,
+                                        scomplex* buff_w )
+{
+	scomplex* buff_1  = FLA_COMPLEX_PTR( FLA_ONE );
+	scomplex* buff_0  = FLA_COMPLEX_PTR( FLA_ZERO );
+	scomplex* buff_m1 = FLA_COMPLEX_PTR( FLA_MINUS_ONE );
+	scomplex  beta;
+	int       i;
+
+	// Apply the previous reflector from the right, which fills B.
+	if ( buff_u_prev != NULL )
+		FLA_Apply_H2_UT_r_opc_var1( m_B,
+		                            n_B - 1,
+		                            buff_tau_prev,
+		                            buff_u_prev + 1, 1,
+		                            buff_B, 1,
+		                            buff_B + cs_A, 1, cs_A );
+
+	if ( m_B < 2 ) return FLA_SUCCESS;
+
+	// Annihilate the first column of B below its first element, and save
+	// the reflector.
+	FLA_Househ2_UT_l_opc( m_B - 1,
+	                      buff_B,
+	                      buff_B + 1, 1,
+	                      buff_tau );
+
+	buff_u[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_u[i] = buff_B[i];
+		buff_B[i] = *buff_0;
+	}
+
+	// Apply the reflector from the left to the rest of B.
+	if ( n_B > 1 )
+		FLA_Apply_H2_UT_l_opc_var1( m_B - 1,
+		                            n_B - 1,
+		                            buff_tau,
+		                            buff_u + 1, 1,
+		                            buff_B + cs_A, cs_A,
+		                            buff_B + 1 + cs_A, 1, cs_A );
+
+	// Apply the reflector from both sides to the diagonal block D:
+	//   w = D u / tau - ( u' D u / ( 2 tau^2 ) ) u;
+	//   D = D - u w' - w u';
+	bl1_chemv( BLIS1_LOWER_TRIANGULAR,
+	           BLIS1_NO_CONJUGATE,
+	           m_B,
+	           buff_1,
+	           buff_D, 1, cs_A,
+	           buff_u, 1,
+	           buff_0,
+	           buff_w, 1 );
+
+	bl1_cinvscalv( BLIS1_NO_CONJUGATE,
+	               m_B,
+	               buff_tau,
+	               buff_w, 1 );
+
+	bl1_cdot( BLIS1_CONJUGATE,
+	          m_B,
+	          buff_u, 1,
+	          buff_w, 1,
+	          &beta );
+
+	// tau is real.
+	beta.real = -beta.real / ( 2.0F * buff_tau->real );
+	beta.imag = -beta.imag / ( 2.0F * buff_tau->real );
+
+	bl1_caxpyv( BLIS1_NO_CONJUGATE,
+	            m_B,
+	            &beta,
+	            buff_u, 1,
+	            buff_w, 1 );
+
+	bl1_cher2( BLIS1_LOWER_TRIANGULAR,
+	           BLIS1_NO_CONJUGATE,
+	           m_B,
+	           buff_m1,
+	           buff_u, 1,
+	           buff_w, 1,
+	           buff_D, 1, cs_A );
+
+	return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Tridiag_UT_2s_l_step_opz( int       m_B,
+                                        int       n_B,
+                                        dcomplex* buff_B,
+                                        dcomplex* buff_D, int cs_A,
+                                        dcomplex* buff_u,
+                                        dcomplex* buff_tau,
+                                        dcomplex* buff_u_prev,
+                                        dcomplex* buff_tau_prev,
+                                        dcomplex* buff_w )
+{
+	dcomplex* buff_1  = FLA_DOUBLE_COMPLEX_PTR( FLA_ONE );
+	dcomplex* buff_0  = FLA_DOUBLE_COMPLEX_PTR( FLA_ZERO );
+	dcomplex* buff_m1 = FLA_DOUBLE_COMPLEX_PTR( FLA_MINUS_ONE );
+	dcomplex  beta;
+	int       i;
+
+	// Apply the previous reflector from the right, which fills B.
+	if ( buff_u_prev != NULL )
+		FLA_Apply_H2_UT_r_opz_var1( m_B,
+		                            n_B - 1,
+		                            buff_tau_prev,
+		                            buff_u_prev + 1, 1,
+		                            buff_B, 1,
+		                            buff_B + cs_A, 1, cs_A );
+
+	if ( m_B < 2 ) return FLA_SUCCESS;
+
+	// Annihilate the first column of B below its first element, and save
+	// the reflector.
+	FLA_Househ2_UT_l_opz( m_B - 1,
+	                      buff_B,
+	                      buff_B + 1, 1,
+	                      buff_tau );
+
+	buff_u[0] = *buff_1;
+	for ( i = 1; i < m_B; ++i )
+	{
+		buff_u[i] = buff_B[i];
+		buff_B[i] = *buff_0;
+	}
+
+	// Apply the reflector from the left to the rest of B.
+	if ( n_B > 1 )
+		FLA_Apply_H2_UT_l_opz_var1( m_B - 1,
+		                            n_B - 1,
+		                            buff_tau,
+		                            buff_u + 1, 1,
+		                            buff_B + cs_A, cs_A,
+		                            buff_B + 1 + cs_A, 1, cs_A );
+
+	// Apply the reflector from both sides to the diagonal block D:
+	//   w = D u / tau - ( u' D u / ( 2 tau^2 ) ) u;
+	//   D = D - u w' - w u';
+	bl1_zhemv( BLIS1_LOWER_TRIANGULAR,
+	           BLIS1_NO_CONJUGATE,
+	           m_B,
+	           buff_1,
+	           buff_D, 1, cs_A,
+	           buff_u, 1,
+	           buff_0,
+	           buff_w, 1 );
+
+	bl1_zinvscalv( BLIS1_NO_CONJUGATE,
+	               m_B,
+	               buff_tau,
+	               buff_w, 1 );
+
+	bl1_zdot( BLIS1_CONJUGATE,
+	          m_B,
+	          buff_u, 1,
+	          buff_w, 1,
+	          &beta );
+
+	// tau is real.
+	beta.real = -beta.real / ( 2.0 * buff_tau->real );
+	beta.imag = -beta.imag / ( 2.0 * buff_tau->real );
+
+	bl1_zaxpyv( BLIS1_NO_CONJUGATE,
+	            m_B,
+	            &beta,
+	            buff_u, 1,
+	            buff_w, 1 );
+
+	bl1_zher2( BLIS1_LOWER_TRIANGULAR,
+	           BLIS1_NO_CONJUGATE,
+	           m_B,
+	           buff_m1,
+	           buff_u, 1,
+	           buff_w, 1,
+	           buff_D, 1, cs_A );
+
+	return FLA_SUCCESS;
+}
+
@@ -10,6 +10,7 @@
 
 #include "FLA_Tridiag_UT_l.h"
 //#include "FLA_Tridiag_UT_u.h"
+#include "FLA_Tridiag_UT_2s.h"
 
 FLA_Error FLA_Tridiag_UT( FLA_Uplo uplo, FLA_Obj A, FLA_Obj T );
 
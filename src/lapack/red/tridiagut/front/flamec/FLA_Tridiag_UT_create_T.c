@@ -19,11 +19,10 @@ FLA_Error FLA_Tridiag_UT_create_T( FLA_Obj A, FLA_Obj* T )
   // Query the datatype of A.
   datatype = FLA_Obj_datatype( A );
 
-  // Query the blocksize from the library.
-  b_alg = FLA_Query_blocksize( datatype, FLA_DIMENSION_MIN );
-
-  // Scale the blocksize by a pre-set global constant.
-  b_alg = ( dim_t )( ( ( double ) b_alg ) * FLA_TRIDIAG_INNER_TO_OUTER_B_RATIO );
+  // Query the (possibly tuned) blocksize for a problem of this size, which
+  // is already scaled down from the library blocksize.
+  b_alg = FLA_Tune_get_for_size( datatype, FLA_TUNE_TRIDIAG_UT, FLA_TUNE_B_ALG,
+                                 FLA_Obj_min_dim( A ) );
 
   // Query the minimum dimension of A.
   k = FLA_Obj_min_dim( A );
@@ -89,7 +89,7 @@ FLA_Error FLA_Apply_CAQ2_UT_internal( FLA_Side side, FLA_Trans trans, FLA_Direct
 				if      ( direct == FLA_FORWARD )
 				{
 					if      ( storev == FLA_COLUMNWISE )
-						FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+						r_val = FLA_Apply_CAQ2_UT_lnfc( D, T, W, C, E, cntl );
 					else if ( storev == FLA_ROWWISE )
 						FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
 				}
@@ -0,0 +1,29 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+FLA_Error FLA_Apply_CAQ2_UT_lnfc( FLA_Obj D, FLA_Obj T, FLA_Obj W, FLA_Obj C,
+                                                                   FLA_Obj E, fla_apcaq2ut_t* cntl )
+{
+	FLA_Error r_val = FLA_SUCCESS;
+	
+	if      ( FLA_Cntl_variant( cntl ) == FLA_BLOCKED_VARIANT1 )
+	{
+		r_val = FLA_Apply_CAQ2_UT_lnfc_blk_var1( D, T, W, C, E, cntl );
+	}
+	else
+	{
+		FLA_Check_error_code( FLA_NOT_YET_IMPLEMENTED );
+	}
+
+	return r_val;
+}
+
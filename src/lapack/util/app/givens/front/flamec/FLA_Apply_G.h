@@ -16,6 +16,8 @@
 FLA_Error FLA_Apply_G( FLA_Side side, FLA_Direct direct, FLA_Obj G, FLA_Obj A );
 FLA_Error FLA_Apply_G_internal( FLA_Side side, FLA_Direct direct, FLA_Obj G, FLA_Obj A );
 
+FLA_Error FLA_Apply_G_tune( FLA_Datatype datatype, dim_t m_A, int n_repeats, dim_t* k_accum, dim_t* b_alg );
+
 #include "FLA_Givens2.h"
 
 #include "FLA_Apply_GTG.h"
@@ -24,6 +26,8 @@ FLA_Error FLA_Apply_G_internal( FLA_Side side, FLA_Direct direct, FLA_Obj G, FLA
 #include "FLA_Apply_G_2x2.h"
 #include "FLA_Apply_G_1x2.h"
 
+#include "FLA_Apply_G_mx_simd.h"
+
 #include "FLA_Apply_G_mx2_opt.h"
 #include "FLA_Apply_G_mx2_asm.h"
 
@@ -11,11 +11,101 @@
 
 #if FLA_VECTOR_INTRINSIC_TYPE == FLA_NO_INTRINSICS
 
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+
+// Contiguous columns are handed to the AVX2 or AVX-512 kernels, if the
+// processor supports either; complex columns are rotated as real columns
+// of twice the length since gamma and sigma are real.
+
+#define MAC_Apply_G_mx2_ass( m_A, \
+                             gamma12, \
+                             sigma12, \
+                             a1, inc_a1, \
+                             a2, inc_a2 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 ) \
+		FLA_Apply_G_mx2_simd_ops( m_A, \
+		                          gamma12, \
+		                          sigma12, \
+		                          a1, \
+		                          a2 ); \
+	else \
+		MAC_Apply_G_mx2_ops( m_A, \
+		                     gamma12, \
+		                     sigma12, \
+		                     a1, inc_a1, \
+		                     a2, inc_a2 ) \
+}
+
+#define MAC_Apply_G_mx2_asd( m_A, \
+                             gamma12, \
+                             sigma12, \
+                             a1, inc_a1, \
+                             a2, inc_a2 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 ) \
+		FLA_Apply_G_mx2_simd_opd( m_A, \
+		                          gamma12, \
+		                          sigma12, \
+		                          a1, \
+		                          a2 ); \
+	else \
+		MAC_Apply_G_mx2_opd( m_A, \
+		                     gamma12, \
+		                     sigma12, \
+		                     a1, inc_a1, \
+		                     a2, inc_a2 ) \
+}
+
+#define MAC_Apply_G_mx2_asc( m_A, \
+                             gamma12, \
+                             sigma12, \
+                             a1, inc_a1, \
+                             a2, inc_a2 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 ) \
+		FLA_Apply_G_mx2_simd_ops( 2 * ( m_A ), \
+		                          gamma12, \
+		                          sigma12, \
+		                          ( float* ) ( a1 ), \
+		                          ( float* ) ( a2 ) ); \
+	else \
+		MAC_Apply_G_mx2_opc( m_A, \
+		                     gamma12, \
+		                     sigma12, \
+		                     a1, inc_a1, \
+		                     a2, inc_a2 ) \
+}
+
+#define MAC_Apply_G_mx2_asz( m_A, \
+                             gamma12, \
+                             sigma12, \
+                             a1, inc_a1, \
+                             a2, inc_a2 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 ) \
+		FLA_Apply_G_mx2_simd_opd( 2 * ( m_A ), \
+		                          gamma12, \
+		                          sigma12, \
+		                          ( double* ) ( a1 ), \
+		                          ( double* ) ( a2 ) ); \
+	else \
+		MAC_Apply_G_mx2_opz( m_A, \
+		                     gamma12, \
+		                     sigma12, \
+		                     a1, inc_a1, \
+		                     a2, inc_a2 ) \
+}
+
+#else
+
 #define MAC_Apply_G_mx2_ass MAC_Apply_G_mx2_ops
 #define MAC_Apply_G_mx2_asd MAC_Apply_G_mx2_opd
 #define MAC_Apply_G_mx2_asc MAC_Apply_G_mx2_opc
 #define MAC_Apply_G_mx2_asz MAC_Apply_G_mx2_opz
 
+#endif
+
 #elif FLA_VECTOR_INTRINSIC_TYPE == FLA_SSE_INTRINSICS
 
 #define MAC_Apply_G_mx2_ass( m_A, \
@@ -11,11 +11,137 @@
 
 #if FLA_VECTOR_INTRINSIC_TYPE == FLA_NO_INTRINSICS
 
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+
+// Contiguous columns are handed to the AVX2 or AVX-512 kernels, if the
+// processor supports either; complex columns are rotated as real columns
+// of twice the length since gamma and sigma are real.
+
+#define MAC_Apply_G_mx3_ass( m_A, \
+                             gamma12, \
+                             sigma12, \
+                             gamma23, \
+                             sigma23, \
+                             a1, inc_a1, \
+                             a2, inc_a2, \
+                             a3, inc_a3 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 ) \
+		FLA_Apply_G_mx3_simd_ops( m_A, \
+		                          gamma12, \
+		                          sigma12, \
+		                          gamma23, \
+		                          sigma23, \
+		                          a1, \
+		                          a2, \
+		                          a3 ); \
+	else \
+		MAC_Apply_G_mx3_ops( m_A, \
+		                     gamma12, \
+		                     sigma12, \
+		                     gamma23, \
+		                     sigma23, \
+		                     a1, inc_a1, \
+		                     a2, inc_a2, \
+		                     a3, inc_a3 ) \
+}
+
+#define MAC_Apply_G_mx3_asd( m_A, \
+                             gamma12, \
+                             sigma12, \
+                             gamma23, \
+                             sigma23, \
+                             a1, inc_a1, \
+                             a2, inc_a2, \
+                             a3, inc_a3 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 ) \
+		FLA_Apply_G_mx3_simd_opd( m_A, \
+		                          gamma12, \
+		                          sigma12, \
+		                          gamma23, \
+		                          sigma23, \
+		                          a1, \
+		                          a2, \
+		                          a3 ); \
+	else \
+		MAC_Apply_G_mx3_opd( m_A, \
+		                     gamma12, \
+		                     sigma12, \
+		                     gamma23, \
+		                     sigma23, \
+		                     a1, inc_a1, \
+		                     a2, inc_a2, \
+		                     a3, inc_a3 ) \
+}
+
+#define MAC_Apply_G_mx3_asc( m_A, \
+                             gamma12, \
+                             sigma12, \
+                             gamma23, \
+                             sigma23, \
+                             a1, inc_a1, \
+                             a2, inc_a2, \
+                             a3, inc_a3 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 ) \
+		FLA_Apply_G_mx3_simd_ops( 2 * ( m_A ), \
+		                          gamma12, \
+		                          sigma12, \
+		                          gamma23, \
+		                          sigma23, \
+		                          ( float* ) ( a1 ), \
+		                          ( float* ) ( a2 ), \
+		                          ( float* ) ( a3 ) ); \
+	else \
+		MAC_Apply_G_mx3_opc( m_A, \
+		                     gamma12, \
+		                     sigma12, \
+		                     gamma23, \
+		                     sigma23, \
+		                     a1, inc_a1, \
+		                     a2, inc_a2, \
+		                     a3, inc_a3 ) \
+}
+
+#define MAC_Apply_G_mx3_asz( m_A, \
+                             gamma12, \
+                             sigma12, \
+                             gamma23, \
+                             sigma23, \
+                             a1, inc_a1, \
+                             a2, inc_a2, \
+                             a3, inc_a3 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 ) \
+		FLA_Apply_G_mx3_simd_opd( 2 * ( m_A ), \
+		                          gamma12, \
+		                          sigma12, \
+		                          gamma23, \
+		                          sigma23, \
+		                          ( double* ) ( a1 ), \
+		                          ( double* ) ( a2 ), \
+		                          ( double* ) ( a3 ) ); \
+	else \
+		MAC_Apply_G_mx3_opz( m_A, \
+		                     gamma12, \
+		                     sigma12, \
+		                     gamma23, \
+		                     sigma23, \
+		                     a1, inc_a1, \
+		                     a2, inc_a2, \
+		                     a3, inc_a3 ) \
+}
+
+#else
+
 #define MAC_Apply_G_mx3_ass MAC_Apply_G_mx3_ops
 #define MAC_Apply_G_mx3_asd MAC_Apply_G_mx3_opd
 #define MAC_Apply_G_mx3_asc MAC_Apply_G_mx3_opc
 #define MAC_Apply_G_mx3_asz MAC_Apply_G_mx3_opz
 
+#endif
+
 #elif FLA_VECTOR_INTRINSIC_TYPE == FLA_SSE_INTRINSICS
 
 #define MAC_Apply_G_mx3_ass( m_A, \
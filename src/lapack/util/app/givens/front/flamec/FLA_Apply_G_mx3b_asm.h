@@ -11,11 +11,137 @@
 
 #if FLA_VECTOR_INTRINSIC_TYPE == FLA_NO_INTRINSICS
 
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+
+// Contiguous columns are handed to the AVX2 or AVX-512 kernels, if the
+// processor supports either; complex columns are rotated as real columns
+// of twice the length since gamma and sigma are real.
+
+#define MAC_Apply_G_mx3b_ass( m_A, \
+                              gamma12, \
+                              sigma12, \
+                              gamma23, \
+                              sigma23, \
+                              a1, inc_a1, \
+                              a2, inc_a2, \
+                              a3, inc_a3 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 ) \
+		FLA_Apply_G_mx3b_simd_ops( m_A, \
+		                           gamma12, \
+		                           sigma12, \
+		                           gamma23, \
+		                           sigma23, \
+		                           a1, \
+		                           a2, \
+		                           a3 ); \
+	else \
+		MAC_Apply_G_mx3b_ops( m_A, \
+		                      gamma12, \
+		                      sigma12, \
+		                      gamma23, \
+		                      sigma23, \
+		                      a1, inc_a1, \
+		                      a2, inc_a2, \
+		                      a3, inc_a3 ) \
+}
+
+#define MAC_Apply_G_mx3b_asd( m_A, \
+                              gamma12, \
+                              sigma12, \
+                              gamma23, \
+                              sigma23, \
+                              a1, inc_a1, \
+                              a2, inc_a2, \
+                              a3, inc_a3 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 ) \
+		FLA_Apply_G_mx3b_simd_opd( m_A, \
+		                           gamma12, \
+		                           sigma12, \
+		                           gamma23, \
+		                           sigma23, \
+		                           a1, \
+		                           a2, \
+		                           a3 ); \
+	else \
+		MAC_Apply_G_mx3b_opd( m_A, \
+		                      gamma12, \
+		                      sigma12, \
+		                      gamma23, \
+		                      sigma23, \
+		                      a1, inc_a1, \
+		                      a2, inc_a2, \
+		                      a3, inc_a3 ) \
+}
+
+#define MAC_Apply_G_mx3b_asc( m_A, \
+                              gamma12, \
+                              sigma12, \
+                              gamma23, \
+                              sigma23, \
+                              a1, inc_a1, \
+                              a2, inc_a2, \
+                              a3, inc_a3 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 ) \
+		FLA_Apply_G_mx3b_simd_ops( 2 * ( m_A ), \
+		                           gamma12, \
+		                           sigma12, \
+		                           gamma23, \
+		                           sigma23, \
+		                           ( float* ) ( a1 ), \
+		                           ( float* ) ( a2 ), \
+		                           ( float* ) ( a3 ) ); \
+	else \
+		MAC_Apply_G_mx3b_opc( m_A, \
+		                      gamma12, \
+		                      sigma12, \
+		                      gamma23, \
+		                      sigma23, \
+		                      a1, inc_a1, \
+		                      a2, inc_a2, \
+		                      a3, inc_a3 ) \
+}
+
+#define MAC_Apply_G_mx3b_asz( m_A, \
+                              gamma12, \
+                              sigma12, \
+                              gamma23, \
+                              sigma23, \
+                              a1, inc_a1, \
+                              a2, inc_a2, \
+                              a3, inc_a3 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 ) \
+		FLA_Apply_G_mx3b_simd_opd( 2 * ( m_A ), \
+		                           gamma12, \
+		                           sigma12, \
+		                           gamma23, \
+		                           sigma23, \
+		                           ( double* ) ( a1 ), \
+		                           ( double* ) ( a2 ), \
+		                           ( double* ) ( a3 ) ); \
+	else \
+		MAC_Apply_G_mx3b_opz( m_A, \
+		                      gamma12, \
+		                      sigma12, \
+		                      gamma23, \
+		                      sigma23, \
+		                      a1, inc_a1, \
+		                      a2, inc_a2, \
+		                      a3, inc_a3 ) \
+}
+
+#else
+
 #define MAC_Apply_G_mx3b_ass MAC_Apply_G_mx3b_ops
 #define MAC_Apply_G_mx3b_asd MAC_Apply_G_mx3b_opd
 #define MAC_Apply_G_mx3b_asc MAC_Apply_G_mx3b_opc
 #define MAC_Apply_G_mx3b_asz MAC_Apply_G_mx3b_opz
 
+#endif
+
 #elif FLA_VECTOR_INTRINSIC_TYPE == FLA_SSE_INTRINSICS
 
 #define MAC_Apply_G_mx3b_ass( m_A, \
@@ -11,11 +11,197 @@
 
 #if FLA_VECTOR_INTRINSIC_TYPE == FLA_NO_INTRINSICS
 
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+
+// Contiguous columns are handed to the AVX2 or AVX-512 kernels, if the
+// processor supports either; complex columns are rotated as real columns
+// of twice the length since gamma and sigma are real.
+
+#define MAC_Apply_G_mx4s_ass( m_A, \
+                              gamma23_k1, \
+                              sigma23_k1, \
+                              gamma34_k1, \
+                              sigma34_k1, \
+                              gamma12_k2, \
+                              sigma12_k2, \
+                              gamma23_k2, \
+                              sigma23_k2, \
+                              a1, inc_a1, \
+                              a2, inc_a2, \
+                              a3, inc_a3, \
+                              a4, inc_a4 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 && inc_a4 == 1 ) \
+		FLA_Apply_G_mx4s_simd_ops( m_A, \
+		                           gamma23_k1, \
+		                           sigma23_k1, \
+		                           gamma34_k1, \
+		                           sigma34_k1, \
+		                           gamma12_k2, \
+		                           sigma12_k2, \
+		                           gamma23_k2, \
+		                           sigma23_k2, \
+		                           a1, \
+		                           a2, \
+		                           a3, \
+		                           a4 ); \
+	else \
+		MAC_Apply_G_mx4s_ops( m_A, \
+		                      gamma23_k1, \
+		                      sigma23_k1, \
+		                      gamma34_k1, \
+		                      sigma34_k1, \
+		                      gamma12_k2, \
+		                      sigma12_k2, \
+		                      gamma23_k2, \
+		                      sigma23_k2, \
+		                      a1, inc_a1, \
+		                      a2, inc_a2, \
+		                      a3, inc_a3, \
+		                      a4, inc_a4 ) \
+}
+
+#define MAC_Apply_G_mx4s_asd( m_A, \
+                              gamma23_k1, \
+                              sigma23_k1, \
+                              gamma34_k1, \
+                              sigma34_k1, \
+                              gamma12_k2, \
+                              sigma12_k2, \
+                              gamma23_k2, \
+                              sigma23_k2, \
+                              a1, inc_a1, \
+                              a2, inc_a2, \
+                              a3, inc_a3, \
+                              a4, inc_a4 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 && inc_a4 == 1 ) \
+		FLA_Apply_G_mx4s_simd_opd( m_A, \
+		                           gamma23_k1, \
+		                           sigma23_k1, \
+		                           gamma34_k1, \
+		                           sigma34_k1, \
+		                           gamma12_k2, \
+		                           sigma12_k2, \
+		                           gamma23_k2, \
+		                           sigma23_k2, \
+		                           a1, \
+		                           a2, \
+		                           a3, \
+		                           a4 ); \
+	else \
+		MAC_Apply_G_mx4s_opd( m_A, \
+		                      gamma23_k1, \
+		                      sigma23_k1, \
+		                      gamma34_k1, \
+		                      sigma34_k1, \
+		                      gamma12_k2, \
+		                      sigma12_k2, \
+		                      gamma23_k2, \
+		                      sigma23_k2, \
+		                      a1, inc_a1, \
+		                      a2, inc_a2, \
+		                      a3, inc_a3, \
+		                      a4, inc_a4 ) \
+}
+
+#define MAC_Apply_G_mx4s_asc( m_A, \
+                              gamma23_k1, \
+                              sigma23_k1, \
+                              gamma34_k1, \
+                              sigma34_k1, \
+                              gamma12_k2, \
+                              sigma12_k2, \
+                              gamma23_k2, \
+                              sigma23_k2, \
+                              a1, inc_a1, \
+                              a2, inc_a2, \
+                              a3, inc_a3, \
+                              a4, inc_a4 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 && inc_a4 == 1 ) \
+		FLA_Apply_G_mx4s_simd_ops( 2 * ( m_A ), \
+		                           gamma23_k1, \
+		                           sigma23_k1, \
+		                           gamma34_k1, \
+		                           sigma34_k1, \
+		                           gamma12_k2, \
+		                           sigma12_k2, \
+		                           gamma23_k2, \
+		                           sigma23_k2, \
+		                           ( float* ) ( a1 ), \
+		                           ( float* ) ( a2 ), \
+		                           ( float* ) ( a3 ), \
+		                           ( float* ) ( a4 ) ); \
+	else \
+		MAC_Apply_G_mx4s_opc( m_A, \
+		                      gamma23_k1, \
+		                      sigma23_k1, \
+		                      gamma34_k1, \
+		                      sigma34_k1, \
+		                      gamma12_k2, \
+		                      sigma12_k2, \
+		                      gamma23_k2, \
+		                      sigma23_k2, \
+		                      a1, inc_a1, \
+		                      a2, inc_a2, \
+		                      a3, inc_a3, \
+		                      a4, inc_a4 ) \
+}
+
+#define MAC_Apply_G_mx4s_asz( m_A, \
+                              gamma23_k1, \
+                              sigma23_k1, \
+                              gamma34_k1, \
+                              sigma34_k1, \
+                              gamma12_k2, \
+                              sigma12_k2, \
+                              gamma23_k2, \
+                              sigma23_k2, \
+                              a1, inc_a1, \
+                              a2, inc_a2, \
+                              a3, inc_a3, \
+                              a4, inc_a4 ) \
+{\
+	if ( inc_a1 == 1 && inc_a2 == 1 && inc_a3 == 1 && inc_a4 == 1 ) \
+		FLA_Apply_G_mx4s_simd_opd( 2 * ( m_A ), \
+		                           gamma23_k1, \
+		                           sigma23_k1, \
+		                           gamma34_k1, \
+		                           sigma34_k1, \
+		                           gamma12_k2, \
+		                           sigma12_k2, \
+		                           gamma23_k2, \
+		                           sigma23_k2, \
+		                           ( double* ) ( a1 ), \
+		                           ( double* ) ( a2 ), \
+		                           ( double* ) ( a3 ), \
+		                           ( double* ) ( a4 ) ); \
+	else \
+		MAC_Apply_G_mx4s_opz( m_A, \
+		                      gamma23_k1, \
+		                      sigma23_k1, \
+		                      gamma34_k1, \
+		                      sigma34_k1, \
+		                      gamma12_k2, \
+		                      sigma12_k2, \
+		                      gamma23_k2, \
+		                      sigma23_k2, \
+		                      a1, inc_a1, \
+		                      a2, inc_a2, \
+		                      a3, inc_a3, \
+		                      a4, inc_a4 ) \
+}
+
+#else
+
 #define MAC_Apply_G_mx4s_ass MAC_Apply_G_mx4s_ops
 #define MAC_Apply_G_mx4s_asd MAC_Apply_G_mx4s_opd
 #define MAC_Apply_G_mx4s_asc MAC_Apply_G_mx4s_opc
 #define MAC_Apply_G_mx4s_asz MAC_Apply_G_mx4s_opz
 
+#endif
+
 #elif FLA_VECTOR_INTRINSIC_TYPE == FLA_SSE_INTRINSICS
 
 #define MAC_Apply_G_mx4s_ass( m_A, \
@@ -0,0 +1,763 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+
+#include <immintrin.h>
+
+// Kernels that apply sets of Givens rotations to contiguous columns with
+// AVX2 and FMA instructions. They are compiled for that instruction set
+// regardless of the flags used for the rest of libflame, and are only
+// called once FLA_Apply_G_mx_simd_type() has found it to be supported.
+// Each rotation updates a pair of columns as
+//
+//   ( a1 a2 ) := ( gamma * a1 + sigma * a2,  gamma * a2 - sigma * a1 ).
+
+__attribute__(( target( "avx2,fma" ) ))
+FLA_Error FLA_Apply_G_mx2_avx2_ops( int     m_A,
+                                    float*  gamma12,
+                                    float*  sigma12,
+                                    float*  a1,
+                                    float*  a2 )
+{
+	__m256 g12v = _mm256_set1_ps( *gamma12 );
+	__m256 s12v = _mm256_set1_ps( *sigma12 );
+	__m256 a1v, a2v, b1v, b2v, t1v, t2v;
+	float  temp1, temp2;
+	int    i;
+
+	// Apply the rotations to 16 rows at a time, in two independent chains.
+	for ( i = 0; i + 16 <= m_A; i += 16 )
+	{
+		a1v = _mm256_loadu_ps( a1 + i );
+		b1v = _mm256_loadu_ps( a1 + i + 8 );
+		a2v = _mm256_loadu_ps( a2 + i );
+		b2v = _mm256_loadu_ps( a2 + i + 8 );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_ps( t1v, g12v, _mm256_mul_ps( a2v, s12v ) );
+		a2v = _mm256_fmsub_ps( a2v, g12v, _mm256_mul_ps( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm256_fmadd_ps( t2v, g12v, _mm256_mul_ps( b2v, s12v ) );
+		b2v = _mm256_fmsub_ps( b2v, g12v, _mm256_mul_ps( t2v, s12v ) );
+
+		_mm256_storeu_ps( a1 + i, a1v );
+		_mm256_storeu_ps( a1 + i + 8, b1v );
+		_mm256_storeu_ps( a2 + i, a2v );
+		_mm256_storeu_ps( a2 + i + 8, b2v );
+	}
+
+	for ( ; i + 8 <= m_A; i += 8 )
+	{
+		a1v = _mm256_loadu_ps( a1 + i );
+		a2v = _mm256_loadu_ps( a2 + i );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_ps( t1v, g12v, _mm256_mul_ps( a2v, s12v ) );
+		a2v = _mm256_fmsub_ps( a2v, g12v, _mm256_mul_ps( t1v, s12v ) );
+
+		_mm256_storeu_ps( a1 + i, a1v );
+		_mm256_storeu_ps( a2 + i, a2v );
+	}
+
+	for ( ; i < m_A; ++i )
+	{
+		temp1 = a1[i];
+		temp2 = a2[i];
+
+		a1[i] = temp1 * *gamma12 + temp2 * *sigma12;
+		a2[i] = temp2 * *gamma12 - temp1 * *sigma12;
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx2,fma" ) ))
+FLA_Error FLA_Apply_G_mx2_avx2_opd( int     m_A,
+                                    double* gamma12,
+                                    double* sigma12,
+                                    double* a1,
+                                    double* a2 )
+{
+	__m256d g12v = _mm256_set1_pd( *gamma12 );
+	__m256d s12v = _mm256_set1_pd( *sigma12 );
+	__m256d a1v, a2v, b1v, b2v, t1v, t2v;
+	double  temp1, temp2;
+	int     i;
+
+	// Apply the rotations to 8 rows at a time, in two independent chains.
+	for ( i = 0; i + 8 <= m_A; i += 8 )
+	{
+		a1v = _mm256_loadu_pd( a1 + i );
+		b1v = _mm256_loadu_pd( a1 + i + 4 );
+		a2v = _mm256_loadu_pd( a2 + i );
+		b2v = _mm256_loadu_pd( a2 + i + 4 );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_pd( t1v, g12v, _mm256_mul_pd( a2v, s12v ) );
+		a2v = _mm256_fmsub_pd( a2v, g12v, _mm256_mul_pd( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm256_fmadd_pd( t2v, g12v, _mm256_mul_pd( b2v, s12v ) );
+		b2v = _mm256_fmsub_pd( b2v, g12v, _mm256_mul_pd( t2v, s12v ) );
+
+		_mm256_storeu_pd( a1 + i, a1v );
+		_mm256_storeu_pd( a1 + i + 4, b1v );
+		_mm256_storeu_pd( a2 + i, a2v );
+		_mm256_storeu_pd( a2 + i + 4, b2v );
+	}
+
+	for ( ; i + 4 <= m_A; i += 4 )
+	{
+		a1v = _mm256_loadu_pd( a1 + i );
+		a2v = _mm256_loadu_pd( a2 + i );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_pd( t1v, g12v, _mm256_mul_pd( a2v, s12v ) );
+		a2v = _mm256_fmsub_pd( a2v, g12v, _mm256_mul_pd( t1v, s12v ) );
+
+		_mm256_storeu_pd( a1 + i, a1v );
+		_mm256_storeu_pd( a2 + i, a2v );
+	}
+
+	for ( ; i < m_A; ++i )
+	{
+		temp1 = a1[i];
+		temp2 = a2[i];
+
+		a1[i] = temp1 * *gamma12 + temp2 * *sigma12;
+		a2[i] = temp2 * *gamma12 - temp1 * *sigma12;
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx2,fma" ) ))
+FLA_Error FLA_Apply_G_mx3_avx2_ops( int     m_A,
+                                    float*  gamma12,
+                                    float*  sigma12,
+                                    float*  gamma23,
+                                    float*  sigma23,
+                                    float*  a1,
+                                    float*  a2,
+                                    float*  a3 )
+{
+	__m256 g12v = _mm256_set1_ps( *gamma12 );
+	__m256 s12v = _mm256_set1_ps( *sigma12 );
+	__m256 g23v = _mm256_set1_ps( *gamma23 );
+	__m256 s23v = _mm256_set1_ps( *sigma23 );
+	__m256 a1v, a2v, a3v, b1v, b2v, b3v, t1v, t2v;
+	float  temp1, temp2, temp3;
+	int    i;
+
+	// Apply the rotations to 16 rows at a time, in two independent chains.
+	for ( i = 0; i + 16 <= m_A; i += 16 )
+	{
+		a1v = _mm256_loadu_ps( a1 + i );
+		b1v = _mm256_loadu_ps( a1 + i + 8 );
+		a2v = _mm256_loadu_ps( a2 + i );
+		b2v = _mm256_loadu_ps( a2 + i + 8 );
+		a3v = _mm256_loadu_ps( a3 + i );
+		b3v = _mm256_loadu_ps( a3 + i + 8 );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_ps( t1v, g12v, _mm256_mul_ps( a2v, s12v ) );
+		a2v = _mm256_fmsub_ps( a2v, g12v, _mm256_mul_ps( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm256_fmadd_ps( t2v, g12v, _mm256_mul_ps( b2v, s12v ) );
+		b2v = _mm256_fmsub_ps( b2v, g12v, _mm256_mul_ps( t2v, s12v ) );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_ps( t1v, g23v, _mm256_mul_ps( a3v, s23v ) );
+		a3v = _mm256_fmsub_ps( a3v, g23v, _mm256_mul_ps( t1v, s23v ) );
+		t2v = b2v;
+		b2v = _mm256_fmadd_ps( t2v, g23v, _mm256_mul_ps( b3v, s23v ) );
+		b3v = _mm256_fmsub_ps( b3v, g23v, _mm256_mul_ps( t2v, s23v ) );
+
+		_mm256_storeu_ps( a1 + i, a1v );
+		_mm256_storeu_ps( a1 + i + 8, b1v );
+		_mm256_storeu_ps( a2 + i, a2v );
+		_mm256_storeu_ps( a2 + i + 8, b2v );
+		_mm256_storeu_ps( a3 + i, a3v );
+		_mm256_storeu_ps( a3 + i + 8, b3v );
+	}
+
+	for ( ; i + 8 <= m_A; i += 8 )
+	{
+		a1v = _mm256_loadu_ps( a1 + i );
+		a2v = _mm256_loadu_ps( a2 + i );
+		a3v = _mm256_loadu_ps( a3 + i );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_ps( t1v, g12v, _mm256_mul_ps( a2v, s12v ) );
+		a2v = _mm256_fmsub_ps( a2v, g12v, _mm256_mul_ps( t1v, s12v ) );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_ps( t1v, g23v, _mm256_mul_ps( a3v, s23v ) );
+		a3v = _mm256_fmsub_ps( a3v, g23v, _mm256_mul_ps( t1v, s23v ) );
+
+		_mm256_storeu_ps( a1 + i, a1v );
+		_mm256_storeu_ps( a2 + i, a2v );
+		_mm256_storeu_ps( a3 + i, a3v );
+	}
+
+	for ( ; i < m_A; ++i )
+	{
+		temp1 = a1[i];
+		temp2 = a2[i];
+
+		a1[i] = temp1 * *gamma12 + temp2 * *sigma12;
+		a2[i] = temp2 * *gamma12 - temp1 * *sigma12;
+
+		temp2 = a2[i];
+		temp3 = a3[i];
+
+		a2[i] = temp2 * *gamma23 + temp3 * *sigma23;
+		a3[i] = temp3 * *gamma23 - temp2 * *sigma23;
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx2,fma" ) ))
+FLA_Error FLA_Apply_G_mx3_avx2_opd( int     m_A,
+                                    double* gamma12,
+                                    double* sigma12,
+                                    double* gamma23,
+                                    double* sigma23,
+                                    double* a1,
+                                    double* a2,
+                                    double* a3 )
+{
+	__m256d g12v = _mm256_set1_pd( *gamma12 );
+	__m256d s12v = _mm256_set1_pd( *sigma12 );
+	__m256d g23v = _mm256_set1_pd( *gamma23 );
+	__m256d s23v = _mm256_set1_pd( *sigma23 );
+	__m256d a1v, a2v, a3v, b1v, b2v, b3v, t1v, t2v;
+	double  temp1, temp2, temp3;
+	int     i;
+
+	// Apply the rotations to 8 rows at a time, in two independent chains.
+	for ( i = 0; i + 8 <= m_A; i += 8 )
+	{
+		a1v = _mm256_loadu_pd( a1 + i );
+		b1v = _mm256_loadu_pd( a1 + i + 4 );
+		a2v = _mm256_loadu_pd( a2 + i );
+		b2v = _mm256_loadu_pd( a2 + i + 4 );
+		a3v = _mm256_loadu_pd( a3 + i );
+		b3v = _mm256_loadu_pd( a3 + i + 4 );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_pd( t1v, g12v, _mm256_mul_pd( a2v, s12v ) );
+		a2v = _mm256_fmsub_pd( a2v, g12v, _mm256_mul_pd( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm256_fmadd_pd( t2v, g12v, _mm256_mul_pd( b2v, s12v ) );
+		b2v = _mm256_fmsub_pd( b2v, g12v, _mm256_mul_pd( t2v, s12v ) );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_pd( t1v, g23v, _mm256_mul_pd( a3v, s23v ) );
+		a3v = _mm256_fmsub_pd( a3v, g23v, _mm256_mul_pd( t1v, s23v ) );
+		t2v = b2v;
+		b2v = _mm256_fmadd_pd( t2v, g23v, _mm256_mul_pd( b3v, s23v ) );
+		b3v = _mm256_fmsub_pd( b3v, g23v, _mm256_mul_pd( t2v, s23v ) );
+
+		_mm256_storeu_pd( a1 + i, a1v );
+		_mm256_storeu_pd( a1 + i + 4, b1v );
+		_mm256_storeu_pd( a2 + i, a2v );
+		_mm256_storeu_pd( a2 + i + 4, b2v );
+		_mm256_storeu_pd( a3 + i, a3v );
+		_mm256_storeu_pd( a3 + i + 4, b3v );
+	}
+
+	for ( ; i + 4 <= m_A; i += 4 )
+	{
+		a1v = _mm256_loadu_pd( a1 + i );
+		a2v = _mm256_loadu_pd( a2 + i );
+		a3v = _mm256_loadu_pd( a3 + i );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_pd( t1v, g12v, _mm256_mul_pd( a2v, s12v ) );
+		a2v = _mm256_fmsub_pd( a2v, g12v, _mm256_mul_pd( t1v, s12v ) );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_pd( t1v, g23v, _mm256_mul_pd( a3v, s23v ) );
+		a3v = _mm256_fmsub_pd( a3v, g23v, _mm256_mul_pd( t1v, s23v ) );
+
+		_mm256_storeu_pd( a1 + i, a1v );
+		_mm256_storeu_pd( a2 + i, a2v );
+		_mm256_storeu_pd( a3 + i, a3v );
+	}
+
+	for ( ; i < m_A; ++i )
+	{
+		temp1 = a1[i];
+		temp2 = a2[i];
+
+		a1[i] = temp1 * *gamma12 + temp2 * *sigma12;
+		a2[i] = temp2 * *gamma12 - temp1 * *sigma12;
+
+		temp2 = a2[i];
+		temp3 = a3[i];
+
+		a2[i] = temp2 * *gamma23 + temp3 * *sigma23;
+		a3[i] = temp3 * *gamma23 - temp2 * *sigma23;
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx2,fma" ) ))
+FLA_Error FLA_Apply_G_mx3b_avx2_ops( int     m_A,
+                                     float*  gamma12,
+                                     float*  sigma12,
+                                     float*  gamma23,
+                                     float*  sigma23,
+                                     float*  a1,
+                                     float*  a2,
+                                     float*  a3 )
+{
+	__m256 g12v = _mm256_set1_ps( *gamma12 );
+	__m256 s12v = _mm256_set1_ps( *sigma12 );
+	__m256 g23v = _mm256_set1_ps( *gamma23 );
+	__m256 s23v = _mm256_set1_ps( *sigma23 );
+	__m256 a1v, a2v, a3v, b1v, b2v, b3v, t1v, t2v;
+	float  temp1, temp2, temp3;
+	int    i;
+
+	// Apply the rotations to 16 rows at a time, in two independent chains.
+	for ( i = 0; i + 16 <= m_A; i += 16 )
+	{
+		a1v = _mm256_loadu_ps( a1 + i );
+		b1v = _mm256_loadu_ps( a1 + i + 8 );
+		a2v = _mm256_loadu_ps( a2 + i );
+		b2v = _mm256_loadu_ps( a2 + i + 8 );
+		a3v = _mm256_loadu_ps( a3 + i );
+		b3v = _mm256_loadu_ps( a3 + i + 8 );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_ps( t1v, g23v, _mm256_mul_ps( a3v, s23v ) );
+		a3v = _mm256_fmsub_ps( a3v, g23v, _mm256_mul_ps( t1v, s23v ) );
+		t2v = b2v;
+		b2v = _mm256_fmadd_ps( t2v, g23v, _mm256_mul_ps( b3v, s23v ) );
+		b3v = _mm256_fmsub_ps( b3v, g23v, _mm256_mul_ps( t2v, s23v ) );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_ps( t1v, g12v, _mm256_mul_ps( a2v, s12v ) );
+		a2v = _mm256_fmsub_ps( a2v, g12v, _mm256_mul_ps( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm256_fmadd_ps( t2v, g12v, _mm256_mul_ps( b2v, s12v ) );
+		b2v = _mm256_fmsub_ps( b2v, g12v, _mm256_mul_ps( t2v, s12v ) );
+
+		_mm256_storeu_ps( a1 + i, a1v );
+		_mm256_storeu_ps( a1 + i + 8, b1v );
+		_mm256_storeu_ps( a2 + i, a2v );
+		_mm256_storeu_ps( a2 + i + 8, b2v );
+		_mm256_storeu_ps( a3 + i, a3v );
+		_mm256_storeu_ps( a3 + i + 8, b3v );
+	}
+
+	for ( ; i + 8 <= m_A; i += 8 )
+	{
+		a1v = _mm256_loadu_ps( a1 + i );
+		a2v = _mm256_loadu_ps( a2 + i );
+		a3v = _mm256_loadu_ps( a3 + i );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_ps( t1v, g23v, _mm256_mul_ps( a3v, s23v ) );
+		a3v = _mm256_fmsub_ps( a3v, g23v, _mm256_mul_ps( t1v, s23v ) );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_ps( t1v, g12v, _mm256_mul_ps( a2v, s12v ) );
+		a2v = _mm256_fmsub_ps( a2v, g12v, _mm256_mul_ps( t1v, s12v ) );
+
+		_mm256_storeu_ps( a1 + i, a1v );
+		_mm256_storeu_ps( a2 + i, a2v );
+		_mm256_storeu_ps( a3 + i, a3v );
+	}
+
+	for ( ; i < m_A; ++i )
+	{
+		temp2 = a2[i];
+		temp3 = a3[i];
+
+		a2[i] = temp2 * *gamma23 + temp3 * *sigma23;
+		a3[i] = temp3 * *gamma23 - temp2 * *sigma23;
+
+		temp1 = a1[i];
+		temp2 = a2[i];
+
+		a1[i] = temp1 * *gamma12 + temp2 * *sigma12;
+		a2[i] = temp2 * *gamma12 - temp1 * *sigma12;
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx2,fma" ) ))
+FLA_Error FLA_Apply_G_mx3b_avx2_opd( int     m_A,
+                                     double* gamma12,
+                                     double* sigma12,
+                                     double* gamma23,
+                                     double* sigma23,
+                                     double* a1,
+                                     double* a2,
+                                     double* a3 )
+{
+	__m256d g12v = _mm256_set1_pd( *gamma12 );
+	__m256d s12v = _mm256_set1_pd( *sigma12 );
+	__m256d g23v = _mm256_set1_pd( *gamma23 );
+	__m256d s23v = _mm256_set1_pd( *sigma23 );
+	__m256d a1v, a2v, a3v, b1v, b2v, b3v, t1v, t2v;
+	double  temp1, temp2, temp3;
+	int     i;
+
+	// Apply the rotations to 8 rows at a time, in two independent chains.
+	for ( i = 0; i + 8 <= m_A; i += 8 )
+	{
+		a1v = _mm256_loadu_pd( a1 + i );
+		b1v = _mm256_loadu_pd( a1 + i + 4 );
+		a2v = _mm256_loadu_pd( a2 + i );
+		b2v = _mm256_loadu_pd( a2 + i + 4 );
+		a3v = _mm256_loadu_pd( a3 + i );
+		b3v = _mm256_loadu_pd( a3 + i + 4 );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_pd( t1v, g23v, _mm256_mul_pd( a3v, s23v ) );
+		a3v = _mm256_fmsub_pd( a3v, g23v, _mm256_mul_pd( t1v, s23v ) );
+		t2v = b2v;
+		b2v = _mm256_fmadd_pd( t2v, g23v, _mm256_mul_pd( b3v, s23v ) );
+		b3v = _mm256_fmsub_pd( b3v, g23v, _mm256_mul_pd( t2v, s23v ) );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_pd( t1v, g12v, _mm256_mul_pd( a2v, s12v ) );
+		a2v = _mm256_fmsub_pd( a2v, g12v, _mm256_mul_pd( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm256_fmadd_pd( t2v, g12v, _mm256_mul_pd( b2v, s12v ) );
+		b2v = _mm256_fmsub_pd( b2v, g12v, _mm256_mul_pd( t2v, s12v ) );
+
+		_mm256_storeu_pd( a1 + i, a1v );
+		_mm256_storeu_pd( a1 + i + 4, b1v );
+		_mm256_storeu_pd( a2 + i, a2v );
+		_mm256_storeu_pd( a2 + i + 4, b2v );
+		_mm256_storeu_pd( a3 + i, a3v );
+		_mm256_storeu_pd( a3 + i + 4, b3v );
+	}
+
+	for ( ; i + 4 <= m_A; i += 4 )
+	{
+		a1v = _mm256_loadu_pd( a1 + i );
+		a2v = _mm256_loadu_pd( a2 + i );
+		a3v = _mm256_loadu_pd( a3 + i );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_pd( t1v, g23v, _mm256_mul_pd( a3v, s23v ) );
+		a3v = _mm256_fmsub_pd( a3v, g23v, _mm256_mul_pd( t1v, s23v ) );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_pd( t1v, g12v, _mm256_mul_pd( a2v, s12v ) );
+		a2v = _mm256_fmsub_pd( a2v, g12v, _mm256_mul_pd( t1v, s12v ) );
+
+		_mm256_storeu_pd( a1 + i, a1v );
+		_mm256_storeu_pd( a2 + i, a2v );
+		_mm256_storeu_pd( a3 + i, a3v );
+	}
+
+	for ( ; i < m_A; ++i )
+	{
+		temp2 = a2[i];
+		temp3 = a3[i];
+
+		a2[i] = temp2 * *gamma23 + temp3 * *sigma23;
+		a3[i] = temp3 * *gamma23 - temp2 * *sigma23;
+
+		temp1 = a1[i];
+		temp2 = a2[i];
+
+		a1[i] = temp1 * *gamma12 + temp2 * *sigma12;
+		a2[i] = temp2 * *gamma12 - temp1 * *sigma12;
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx2,fma" ) ))
+FLA_Error FLA_Apply_G_mx4s_avx2_ops( int     m_A,
+                                     float*  gamma23_k1,
+                                     float*  sigma23_k1,
+                                     float*  gamma34_k1,
+                                     float*  sigma34_k1,
+                                     float*  gamma12_k2,
+                                     float*  sigma12_k2,
+                                     float*  gamma23_k2,
+                                     float*  sigma23_k2,
+                                     float*  a1,
+                                     float*  a2,
+                                     float*  a3,
+                                     float*  a4 )
+{
+	__m256 g23_k1v = _mm256_set1_ps( *gamma23_k1 );
+	__m256 s23_k1v = _mm256_set1_ps( *sigma23_k1 );
+	__m256 g34_k1v = _mm256_set1_ps( *gamma34_k1 );
+	__m256 s34_k1v = _mm256_set1_ps( *sigma34_k1 );
+	__m256 g12_k2v = _mm256_set1_ps( *gamma12_k2 );
+	__m256 s12_k2v = _mm256_set1_ps( *sigma12_k2 );
+	__m256 g23_k2v = _mm256_set1_ps( *gamma23_k2 );
+	__m256 s23_k2v = _mm256_set1_ps( *sigma23_k2 );
+	__m256 a1v, a2v, a3v, a4v, b1v, b2v, b3v, b4v, t1v, t2v;
+	float  temp1, temp2, temp3, temp4;
+	int    i;
+
+	// Apply the rotations to 16 rows at a time, in two independent chains.
+	for ( i = 0; i + 16 <= m_A; i += 16 )
+	{
+		a1v = _mm256_loadu_ps( a1 + i );
+		b1v = _mm256_loadu_ps( a1 + i + 8 );
+		a2v = _mm256_loadu_ps( a2 + i );
+		b2v = _mm256_loadu_ps( a2 + i + 8 );
+		a3v = _mm256_loadu_ps( a3 + i );
+		b3v = _mm256_loadu_ps( a3 + i + 8 );
+		a4v = _mm256_loadu_ps( a4 + i );
+		b4v = _mm256_loadu_ps( a4 + i + 8 );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_ps( t1v, g23_k1v, _mm256_mul_ps( a3v, s23_k1v ) );
+		a3v = _mm256_fmsub_ps( a3v, g23_k1v, _mm256_mul_ps( t1v, s23_k1v ) );
+		t2v = b2v;
+		b2v = _mm256_fmadd_ps( t2v, g23_k1v, _mm256_mul_ps( b3v, s23_k1v ) );
+		b3v = _mm256_fmsub_ps( b3v, g23_k1v, _mm256_mul_ps( t2v, s23_k1v ) );
+
+		t1v = a3v;
+		a3v = _mm256_fmadd_ps( t1v, g34_k1v, _mm256_mul_ps( a4v, s34_k1v ) );
+		a4v = _mm256_fmsub_ps( a4v, g34_k1v, _mm256_mul_ps( t1v, s34_k1v ) );
+		t2v = b3v;
+		b3v = _mm256_fmadd_ps( t2v, g34_k1v, _mm256_mul_ps( b4v, s34_k1v ) );
+		b4v = _mm256_fmsub_ps( b4v, g34_k1v, _mm256_mul_ps( t2v, s34_k1v ) );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_ps( t1v, g12_k2v, _mm256_mul_ps( a2v, s12_k2v ) );
+		a2v = _mm256_fmsub_ps( a2v, g12_k2v, _mm256_mul_ps( t1v, s12_k2v ) );
+		t2v = b1v;
+		b1v = _mm256_fmadd_ps( t2v, g12_k2v, _mm256_mul_ps( b2v, s12_k2v ) );
+		b2v = _mm256_fmsub_ps( b2v, g12_k2v, _mm256_mul_ps( t2v, s12_k2v ) );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_ps( t1v, g23_k2v, _mm256_mul_ps( a3v, s23_k2v ) );
+		a3v = _mm256_fmsub_ps( a3v, g23_k2v, _mm256_mul_ps( t1v, s23_k2v ) );
+		t2v = b2v;
+		b2v = _mm256_fmadd_ps( t2v, g23_k2v, _mm256_mul_ps( b3v, s23_k2v ) );
+		b3v = _mm256_fmsub_ps( b3v, g23_k2v, _mm256_mul_ps( t2v, s23_k2v ) );
+
+		_mm256_storeu_ps( a1 + i, a1v );
+		_mm256_storeu_ps( a1 + i + 8, b1v );
+		_mm256_storeu_ps( a2 + i, a2v );
+		_mm256_storeu_ps( a2 + i + 8, b2v );
+		_mm256_storeu_ps( a3 + i, a3v );
+		_mm256_storeu_ps( a3 + i + 8, b3v );
+		_mm256_storeu_ps( a4 + i, a4v );
+		_mm256_storeu_ps( a4 + i + 8, b4v );
+	}
+
+	for ( ; i + 8 <= m_A; i += 8 )
+	{
+		a1v = _mm256_loadu_ps( a1 + i );
+		a2v = _mm256_loadu_ps( a2 + i );
+		a3v = _mm256_loadu_ps( a3 + i );
+		a4v = _mm256_loadu_ps( a4 + i );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_ps( t1v, g23_k1v, _mm256_mul_ps( a3v, s23_k1v ) );
+		a3v = _mm256_fmsub_ps( a3v, g23_k1v, _mm256_mul_ps( t1v, s23_k1v ) );
+
+		t1v = a3v;
+		a3v = _mm256_fmadd_ps( t1v, g34_k1v, _mm256_mul_ps( a4v, s34_k1v ) );
+		a4v = _mm256_fmsub_ps( a4v, g34_k1v, _mm256_mul_ps( t1v, s34_k1v ) );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_ps( t1v, g12_k2v, _mm256_mul_ps( a2v, s12_k2v ) );
+		a2v = _mm256_fmsub_ps( a2v, g12_k2v, _mm256_mul_ps( t1v, s12_k2v ) );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_ps( t1v, g23_k2v, _mm256_mul_ps( a3v, s23_k2v ) );
+		a3v = _mm256_fmsub_ps( a3v, g23_k2v, _mm256_mul_ps( t1v, s23_k2v ) );
+
+		_mm256_storeu_ps( a1 + i, a1v );
+		_mm256_storeu_ps( a2 + i, a2v );
+		_mm256_storeu_ps( a3 + i, a3v );
+		_mm256_storeu_ps( a4 + i, a4v );
+	}
+
+	for ( ; i < m_A; ++i )
+	{
+		temp2 = a2[i];
+		temp3 = a3[i];
+
+		a2[i] = temp2 * *gamma23_k1 + temp3 * *sigma23_k1;
+		a3[i] = temp3 * *gamma23_k1 - temp2 * *sigma23_k1;
+
+		temp3 = a3[i];
+		temp4 = a4[i];
+
+		a3[i] = temp3 * *gamma34_k1 + temp4 * *sigma34_k1;
+		a4[i] = temp4 * *gamma34_k1 - temp3 * *sigma34_k1;
+
+		temp1 = a1[i];
+		temp2 = a2[i];
+
+		a1[i] = temp1 * *gamma12_k2 + temp2 * *sigma12_k2;
+		a2[i] = temp2 * *gamma12_k2 - temp1 * *sigma12_k2;
+
+		temp2 = a2[i];
+		temp3 = a3[i];
+
+		a2[i] = temp2 * *gamma23_k2 + temp3 * *sigma23_k2;
+		a3[i] = temp3 * *gamma23_k2 - temp2 * *sigma23_k2;
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx2,fma" ) ))
+FLA_Error FLA_Apply_G_mx4s_avx2_opd( int     m_A,
+                                     double* gamma23_k1,
+                                     double* sigma23_k1,
+                                     double* gamma34_k1,
+                                     double* sigma34_k1,
+                                     double* gamma12_k2,
+                                     double* sigma12_k2,
+                                     double* gamma23_k2,
+                                     double* sigma23_k2,
+                                     double* a1,
+                                     double* a2,
+                                     double* a3,
+                                     double* a4 )
+{
+	__m256d g23_k1v = _mm256_set1_pd( *gamma23_k1 );
+	__m256d s23_k1v = _mm256_set1_pd( *sigma23_k1 );
+	__m256d g34_k1v = _mm256_set1_pd( *gamma34_k1 );
+	__m256d s34_k1v = _mm256_set1_pd( *sigma34_k1 );
+	__m256d g12_k2v = _mm256_set1_pd( *gamma12_k2 );
+	__m256d s12_k2v = _mm256_set1_pd( *sigma12_k2 );
+	__m256d g23_k2v = _mm256_set1_pd( *gamma23_k2 );
+	__m256d s23_k2v = _mm256_set1_pd( *sigma23_k2 );
+	__m256d a1v, a2v, a3v, a4v, b1v, b2v, b3v, b4v, t1v, t2v;
+	double  temp1, temp2, temp3, temp4;
+	int     i;
+
+	// Apply the rotations to 8 rows at a time, in two independent chains.
+	for ( i = 0; i + 8 <= m_A; i += 8 )
+	{
+		a1v = _mm256_loadu_pd( a1 + i );
+		b1v = _mm256_loadu_pd( a1 + i + 4 );
+		a2v = _mm256_loadu_pd( a2 + i );
+		b2v = _mm256_loadu_pd( a2 + i + 4 );
+		a3v = _mm256_loadu_pd( a3 + i );
+		b3v = _mm256_loadu_pd( a3 + i + 4 );
+		a4v = _mm256_loadu_pd( a4 + i );
+		b4v = _mm256_loadu_pd( a4 + i + 4 );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_pd( t1v, g23_k1v, _mm256_mul_pd( a3v, s23_k1v ) );
+		a3v = _mm256_fmsub_pd( a3v, g23_k1v, _mm256_mul_pd( t1v, s23_k1v ) );
+		t2v = b2v;
+		b2v = _mm256_fmadd_pd( t2v, g23_k1v, _mm256_mul_pd( b3v, s23_k1v ) );
+		b3v = _mm256_fmsub_pd( b3v, g23_k1v, _mm256_mul_pd( t2v, s23_k1v ) );
+
+		t1v = a3v;
+		a3v = _mm256_fmadd_pd( t1v, g34_k1v, _mm256_mul_pd( a4v, s34_k1v ) );
+		a4v = _mm256_fmsub_pd( a4v, g34_k1v, _mm256_mul_pd( t1v, s34_k1v ) );
+		t2v = b3v;
+		b3v = _mm256_fmadd_pd( t2v, g34_k1v, _mm256_mul_pd( b4v, s34_k1v ) );
+		b4v = _mm256_fmsub_pd( b4v, g34_k1v, _mm256_mul_pd( t2v, s34_k1v ) );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_pd( t1v, g12_k2v, _mm256_mul_pd( a2v, s12_k2v ) );
+		a2v = _mm256_fmsub_pd( a2v, g12_k2v, _mm256_mul_pd( t1v, s12_k2v ) );
+		t2v = b1v;
+		b1v = _mm256_fmadd_pd( t2v, g12_k2v, _mm256_mul_pd( b2v, s12_k2v ) );
+		b2v = _mm256_fmsub_pd( b2v, g12_k2v, _mm256_mul_pd( t2v, s12_k2v ) );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_pd( t1v, g23_k2v, _mm256_mul_pd( a3v, s23_k2v ) );
+		a3v = _mm256_fmsub_pd( a3v, g23_k2v, _mm256_mul_pd( t1v, s23_k2v ) );
+		t2v = b2v;
+		b2v = _mm256_fmadd_pd( t2v, g23_k2v, _mm256_mul_pd( b3v, s23_k2v ) );
+		b3v = _mm256_fmsub_pd( b3v, g23_k2v, _mm256_mul_pd( t2v, s23_k2v ) );
+
+		_mm256_storeu_pd( a1 + i, a1v );
+		_mm256_storeu_pd( a1 + i + 4, b1v );
+		_mm256_storeu_pd( a2 + i, a2v );
+		_mm256_storeu_pd( a2 + i + 4, b2v );
+		_mm256_storeu_pd( a3 + i, a3v );
+		_mm256_storeu_pd( a3 + i + 4, b3v );
+		_mm256_storeu_pd( a4 + i, a4v );
+		_mm256_storeu_pd( a4 + i + 4, b4v );
+	}
+
+	for ( ; i + 4 <= m_A; i += 4 )
+	{
+		a1v = _mm256_loadu_pd( a1 + i );
+		a2v = _mm256_loadu_pd( a2 + i );
+		a3v = _mm256_loadu_pd( a3 + i );
+		a4v = _mm256_loadu_pd( a4 + i );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_pd( t1v, g23_k1v, _mm256_mul_pd( a3v, s23_k1v ) );
+		a3v = _mm256_fmsub_pd( a3v, g23_k1v, _mm256_mul_pd( t1v, s23_k1v ) );
+
+		t1v = a3v;
+		a3v = _mm256_fmadd_pd( t1v, g34_k1v, _mm256_mul_pd( a4v, s34_k1v ) );
+		a4v = _mm256_fmsub_pd( a4v, g34_k1v, _mm256_mul_pd( t1v, s34_k1v ) );
+
+		t1v = a1v;
+		a1v = _mm256_fmadd_pd( t1v, g12_k2v, _mm256_mul_pd( a2v, s12_k2v ) );
+		a2v = _mm256_fmsub_pd( a2v, g12_k2v, _mm256_mul_pd( t1v, s12_k2v ) );
+
+		t1v = a2v;
+		a2v = _mm256_fmadd_pd( t1v, g23_k2v, _mm256_mul_pd( a3v, s23_k2v ) );
+		a3v = _mm256_fmsub_pd( a3v, g23_k2v, _mm256_mul_pd( t1v, s23_k2v ) );
+
+		_mm256_storeu_pd( a1 + i, a1v );
+		_mm256_storeu_pd( a2 + i, a2v );
+		_mm256_storeu_pd( a3 + i, a3v );
+		_mm256_storeu_pd( a4 + i, a4v );
+	}
+
+	for ( ; i < m_A; ++i )
+	{
+		temp2 = a2[i];
+		temp3 = a3[i];
+
+		a2[i] = temp2 * *gamma23_k1 + temp3 * *sigma23_k1;
+		a3[i] = temp3 * *gamma23_k1 - temp2 * *sigma23_k1;
+
+		temp3 = a3[i];
+		temp4 = a4[i];
+
+		a3[i] = temp3 * *gamma34_k1 + temp4 * *sigma34_k1;
+		a4[i] = temp4 * *gamma34_k1 - temp3 * *sigma34_k1;
+
+		temp1 = a1[i];
+		temp2 = a2[i];
+
+		a1[i] = temp1 * *gamma12_k2 + temp2 * *sigma12_k2;
+		a2[i] = temp2 * *gamma12_k2 - temp1 * *sigma12_k2;
+
+		temp2 = a2[i];
+		temp3 = a3[i];
+
+		a2[i] = temp2 * *gamma23_k2 + temp3 * *sigma23_k2;
+		a3[i] = temp3 * *gamma23_k2 - temp2 * *sigma23_k2;
+	}
+
+	return FLA_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,655 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+
+#include <immintrin.h>
+
+// Kernels that apply sets of Givens rotations to contiguous columns with
+// AVX-512F instructions. They are compiled for that instruction set
+// regardless of the flags used for the rest of libflame, and are only
+// called once FLA_Apply_G_mx_simd_type() has found it to be supported.
+// Each rotation updates a pair of columns as
+//
+//   ( a1 a2 ) := ( gamma * a1 + sigma * a2,  gamma * a2 - sigma * a1 ).
+
+__attribute__(( target( "avx512f" ) ))
+FLA_Error FLA_Apply_G_mx2_avx512_ops( int     m_A,
+                                      float*  gamma12,
+                                      float*  sigma12,
+                                      float*  a1,
+                                      float*  a2 )
+{
+	__m512 g12v = _mm512_set1_ps( *gamma12 );
+	__m512 s12v = _mm512_set1_ps( *sigma12 );
+	__m512 a1v, a2v, b1v, b2v, t1v, t2v;
+	__mmask16 k;
+	int    i;
+
+	// Apply the rotations to 32 rows at a time, in two independent chains.
+	for ( i = 0; i + 32 <= m_A; i += 32 )
+	{
+		a1v = _mm512_loadu_ps( a1 + i );
+		b1v = _mm512_loadu_ps( a1 + i + 16 );
+		a2v = _mm512_loadu_ps( a2 + i );
+		b2v = _mm512_loadu_ps( a2 + i + 16 );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_ps( t1v, g12v, _mm512_mul_ps( a2v, s12v ) );
+		a2v = _mm512_fmsub_ps( a2v, g12v, _mm512_mul_ps( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm512_fmadd_ps( t2v, g12v, _mm512_mul_ps( b2v, s12v ) );
+		b2v = _mm512_fmsub_ps( b2v, g12v, _mm512_mul_ps( t2v, s12v ) );
+
+		_mm512_storeu_ps( a1 + i, a1v );
+		_mm512_storeu_ps( a1 + i + 16, b1v );
+		_mm512_storeu_ps( a2 + i, a2v );
+		_mm512_storeu_ps( a2 + i + 16, b2v );
+	}
+
+	for ( ; i < m_A; i += 16 )
+	{
+		// Mask off the rows beyond m_A.
+		k = ( __mmask16 ) ( m_A - i >= 16 ? ~0u : ( 1u << ( m_A - i ) ) - 1 );
+
+		a1v = _mm512_maskz_loadu_ps( k, a1 + i );
+		a2v = _mm512_maskz_loadu_ps( k, a2 + i );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_ps( t1v, g12v, _mm512_mul_ps( a2v, s12v ) );
+		a2v = _mm512_fmsub_ps( a2v, g12v, _mm512_mul_ps( t1v, s12v ) );
+
+		_mm512_mask_storeu_ps( a1 + i, k, a1v );
+		_mm512_mask_storeu_ps( a2 + i, k, a2v );
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx512f" ) ))
+FLA_Error FLA_Apply_G_mx2_avx512_opd( int     m_A,
+                                      double* gamma12,
+                                      double* sigma12,
+                                      double* a1,
+                                      double* a2 )
+{
+	__m512d g12v = _mm512_set1_pd( *gamma12 );
+	__m512d s12v = _mm512_set1_pd( *sigma12 );
+	__m512d a1v, a2v, b1v, b2v, t1v, t2v;
+	__mmask8 k;
+	int     i;
+
+	// Apply the rotations to 16 rows at a time, in two independent chains.
+	for ( i = 0; i + 16 <= m_A; i += 16 )
+	{
+		a1v = _mm512_loadu_pd( a1 + i );
+		b1v = _mm512_loadu_pd( a1 + i + 8 );
+		a2v = _mm512_loadu_pd( a2 + i );
+		b2v = _mm512_loadu_pd( a2 + i + 8 );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_pd( t1v, g12v, _mm512_mul_pd( a2v, s12v ) );
+		a2v = _mm512_fmsub_pd( a2v, g12v, _mm512_mul_pd( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm512_fmadd_pd( t2v, g12v, _mm512_mul_pd( b2v, s12v ) );
+		b2v = _mm512_fmsub_pd( b2v, g12v, _mm512_mul_pd( t2v, s12v ) );
+
+		_mm512_storeu_pd( a1 + i, a1v );
+		_mm512_storeu_pd( a1 + i + 8, b1v );
+		_mm512_storeu_pd( a2 + i, a2v );
+		_mm512_storeu_pd( a2 + i + 8, b2v );
+	}
+
+	for ( ; i < m_A; i += 8 )
+	{
+		// Mask off the rows beyond m_A.
+		k = ( __mmask8 ) ( m_A - i >= 8 ? ~0u : ( 1u << ( m_A - i ) ) - 1 );
+
+		a1v = _mm512_maskz_loadu_pd( k, a1 + i );
+		a2v = _mm512_maskz_loadu_pd( k, a2 + i );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_pd( t1v, g12v, _mm512_mul_pd( a2v, s12v ) );
+		a2v = _mm512_fmsub_pd( a2v, g12v, _mm512_mul_pd( t1v, s12v ) );
+
+		_mm512_mask_storeu_pd( a1 + i, k, a1v );
+		_mm512_mask_storeu_pd( a2 + i, k, a2v );
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx512f" ) ))
+FLA_Error FLA_Apply_G_mx3_avx512_ops( int     m_A,
+                                      float*  gamma12,
+                                      float*  sigma12,
+                                      float*  gamma23,
+                                      float*  sigma23,
+                                      float*  a1,
+                                      float*  a2,
+                                      float*  a3 )
+{
+	__m512 g12v = _mm512_set1_ps( *gamma12 );
+	__m512 s12v = _mm512_set1_ps( *sigma12 );
+	__m512 g23v = _mm512_set1_ps( *gamma23 );
+	__m512 s23v = _mm512_set1_ps( *sigma23 );
+	__m512 a1v, a2v, a3v, b1v, b2v, b3v, t1v, t2v;
+	__mmask16 k;
+	int    i;
+
+	// Apply the rotations to 32 rows at a time, in two independent chains.
+	for ( i = 0; i + 32 <= m_A; i += 32 )
+	{
+		a1v = _mm512_loadu_ps( a1 + i );
+		b1v = _mm512_loadu_ps( a1 + i + 16 );
+		a2v = _mm512_loadu_ps( a2 + i );
+		b2v = _mm512_loadu_ps( a2 + i + 16 );
+		a3v = _mm512_loadu_ps( a3 + i );
+		b3v = _mm512_loadu_ps( a3 + i + 16 );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_ps( t1v, g12v, _mm512_mul_ps( a2v, s12v ) );
+		a2v = _mm512_fmsub_ps( a2v, g12v, _mm512_mul_ps( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm512_fmadd_ps( t2v, g12v, _mm512_mul_ps( b2v, s12v ) );
+		b2v = _mm512_fmsub_ps( b2v, g12v, _mm512_mul_ps( t2v, s12v ) );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_ps( t1v, g23v, _mm512_mul_ps( a3v, s23v ) );
+		a3v = _mm512_fmsub_ps( a3v, g23v, _mm512_mul_ps( t1v, s23v ) );
+		t2v = b2v;
+		b2v = _mm512_fmadd_ps( t2v, g23v, _mm512_mul_ps( b3v, s23v ) );
+		b3v = _mm512_fmsub_ps( b3v, g23v, _mm512_mul_ps( t2v, s23v ) );
+
+		_mm512_storeu_ps( a1 + i, a1v );
+		_mm512_storeu_ps( a1 + i + 16, b1v );
+		_mm512_storeu_ps( a2 + i, a2v );
+		_mm512_storeu_ps( a2 + i + 16, b2v );
+		_mm512_storeu_ps( a3 + i, a3v );
+		_mm512_storeu_ps( a3 + i + 16, b3v );
+	}
+
+	for ( ; i < m_A; i += 16 )
+	{
+		// Mask off the rows beyond m_A.
+		k = ( __mmask16 ) ( m_A - i >= 16 ? ~0u : ( 1u << ( m_A - i ) ) - 1 );
+
+		a1v = _mm512_maskz_loadu_ps( k, a1 + i );
+		a2v = _mm512_maskz_loadu_ps( k, a2 + i );
+		a3v = _mm512_maskz_loadu_ps( k, a3 + i );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_ps( t1v, g12v, _mm512_mul_ps( a2v, s12v ) );
+		a2v = _mm512_fmsub_ps( a2v, g12v, _mm512_mul_ps( t1v, s12v ) );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_ps( t1v, g23v, _mm512_mul_ps( a3v, s23v ) );
+		a3v = _mm512_fmsub_ps( a3v, g23v, _mm512_mul_ps( t1v, s23v ) );
+
+		_mm512_mask_storeu_ps( a1 + i, k, a1v );
+		_mm512_mask_storeu_ps( a2 + i, k, a2v );
+		_mm512_mask_storeu_ps( a3 + i, k, a3v );
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx512f" ) ))
+FLA_Error FLA_Apply_G_mx3_avx512_opd( int     m_A,
+                                      double* gamma12,
+                                      double* sigma12,
+                                      double* gamma23,
+                                      double* sigma23,
+                                      double* a1,
+                                      double* a2,
+                                      double* a3 )
+{
+	__m512d g12v = _mm512_set1_pd( *gamma12 );
+	__m512d s12v = _mm512_set1_pd( *sigma12 );
+	__m512d g23v = _mm512_set1_pd( *gamma23 );
+	__m512d s23v = _mm512_set1_pd( *sigma23 );
+	__m512d a1v, a2v, a3v, b1v, b2v, b3v, t1v, t2v;
+	__mmask8 k;
+	int     i;
+
+	// Apply the rotations to 16 rows at a time, in two independent chains.
+	for ( i = 0; i + 16 <= m_A; i += 16 )
+	{
+		a1v = _mm512_loadu_pd( a1 + i );
+		b1v = _mm512_loadu_pd( a1 + i + 8 );
+		a2v = _mm512_loadu_pd( a2 + i );
+		b2v = _mm512_loadu_pd( a2 + i + 8 );
+		a3v = _mm512_loadu_pd( a3 + i );
+		b3v = _mm512_loadu_pd( a3 + i + 8 );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_pd( t1v, g12v, _mm512_mul_pd( a2v, s12v ) );
+		a2v = _mm512_fmsub_pd( a2v, g12v, _mm512_mul_pd( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm512_fmadd_pd( t2v, g12v, _mm512_mul_pd( b2v, s12v ) );
+		b2v = _mm512_fmsub_pd( b2v, g12v, _mm512_mul_pd( t2v, s12v ) );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_pd( t1v, g23v, _mm512_mul_pd( a3v, s23v ) );
+		a3v = _mm512_fmsub_pd( a3v, g23v, _mm512_mul_pd( t1v, s23v ) );
+		t2v = b2v;
+		b2v = _mm512_fmadd_pd( t2v, g23v, _mm512_mul_pd( b3v, s23v ) );
+		b3v = _mm512_fmsub_pd( b3v, g23v, _mm512_mul_pd( t2v, s23v ) );
+
+		_mm512_storeu_pd( a1 + i, a1v );
+		_mm512_storeu_pd( a1 + i + 8, b1v );
+		_mm512_storeu_pd( a2 + i, a2v );
+		_mm512_storeu_pd( a2 + i + 8, b2v );
+		_mm512_storeu_pd( a3 + i, a3v );
+		_mm512_storeu_pd( a3 + i + 8, b3v );
+	}
+
+	for ( ; i < m_A; i += 8 )
+	{
+		// Mask off the rows beyond m_A.
+		k = ( __mmask8 ) ( m_A - i >= 8 ? ~0u : ( 1u << ( m_A - i ) ) - 1 );
+
+		a1v = _mm512_maskz_loadu_pd( k, a1 + i );
+		a2v = _mm512_maskz_loadu_pd( k, a2 + i );
+		a3v = _mm512_maskz_loadu_pd( k, a3 + i );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_pd( t1v, g12v, _mm512_mul_pd( a2v, s12v ) );
+		a2v = _mm512_fmsub_pd( a2v, g12v, _mm512_mul_pd( t1v, s12v ) );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_pd( t1v, g23v, _mm512_mul_pd( a3v, s23v ) );
+		a3v = _mm512_fmsub_pd( a3v, g23v, _mm512_mul_pd( t1v, s23v ) );
+
+		_mm512_mask_storeu_pd( a1 + i, k, a1v );
+		_mm512_mask_storeu_pd( a2 + i, k, a2v );
+		_mm512_mask_storeu_pd( a3 + i, k, a3v );
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx512f" ) ))
+FLA_Error FLA_Apply_G_mx3b_avx512_ops( int     m_A,
+                                       float*  gamma12,
+                                       float*  sigma12,
+                                       float*  gamma23,
+                                       float*  sigma23,
+                                       float*  a1,
+                                       float*  a2,
+                                       float*  a3 )
+{
+	__m512 g12v = _mm512_set1_ps( *gamma12 );
+	__m512 s12v = _mm512_set1_ps( *sigma12 );
+	__m512 g23v = _mm512_set1_ps( *gamma23 );
+	__m512 s23v = _mm512_set1_ps( *sigma23 );
+	__m512 a1v, a2v, a3v, b1v, b2v, b3v, t1v, t2v;
+	__mmask16 k;
+	int    i;
+
+	// Apply the rotations to 32 rows at a time, in two independent chains.
+	for ( i = 0; i + 32 <= m_A; i += 32 )
+	{
+		a1v = _mm512_loadu_ps( a1 + i );
+		b1v = _mm512_loadu_ps( a1 + i + 16 );
+		a2v = _mm512_loadu_ps( a2 + i );
+		b2v = _mm512_loadu_ps( a2 + i + 16 );
+		a3v = _mm512_loadu_ps( a3 + i );
+		b3v = _mm512_loadu_ps( a3 + i + 16 );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_ps( t1v, g23v, _mm512_mul_ps( a3v, s23v ) );
+		a3v = _mm512_fmsub_ps( a3v, g23v, _mm512_mul_ps( t1v, s23v ) );
+		t2v = b2v;
+		b2v = _mm512_fmadd_ps( t2v, g23v, _mm512_mul_ps( b3v, s23v ) );
+		b3v = _mm512_fmsub_ps( b3v, g23v, _mm512_mul_ps( t2v, s23v ) );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_ps( t1v, g12v, _mm512_mul_ps( a2v, s12v ) );
+		a2v = _mm512_fmsub_ps( a2v, g12v, _mm512_mul_ps( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm512_fmadd_ps( t2v, g12v, _mm512_mul_ps( b2v, s12v ) );
+		b2v = _mm512_fmsub_ps( b2v, g12v, _mm512_mul_ps( t2v, s12v ) );
+
+		_mm512_storeu_ps( a1 + i, a1v );
+		_mm512_storeu_ps( a1 + i + 16, b1v );
+		_mm512_storeu_ps( a2 + i, a2v );
+		_mm512_storeu_ps( a2 + i + 16, b2v );
+		_mm512_storeu_ps( a3 + i, a3v );
+		_mm512_storeu_ps( a3 + i + 16, b3v );
+	}
+
+	for ( ; i < m_A; i += 16 )
+	{
+		// Mask off the rows beyond m_A.
+		k = ( __mmask16 ) ( m_A - i >= 16 ? ~0u : ( 1u << ( m_A - i ) ) - 1 );
+
+		a1v = _mm512_maskz_loadu_ps( k, a1 + i );
+		a2v = _mm512_maskz_loadu_ps( k, a2 + i );
+		a3v = _mm512_maskz_loadu_ps( k, a3 + i );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_ps( t1v, g23v, _mm512_mul_ps( a3v, s23v ) );
+		a3v = _mm512_fmsub_ps( a3v, g23v, _mm512_mul_ps( t1v, s23v ) );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_ps( t1v, g12v, _mm512_mul_ps( a2v, s12v ) );
+		a2v = _mm512_fmsub_ps( a2v, g12v, _mm512_mul_ps( t1v, s12v ) );
+
+		_mm512_mask_storeu_ps( a1 + i, k, a1v );
+		_mm512_mask_storeu_ps( a2 + i, k, a2v );
+		_mm512_mask_storeu_ps( a3 + i, k, a3v );
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx512f" ) ))
+FLA_Error FLA_Apply_G_mx3b_avx512_opd( int     m_A,
+                                       double* gamma12,
+                                       double* sigma12,
+                                       double* gamma23,
+                                       double* sigma23,
+                                       double* a1,
+                                       double* a2,
+                                       double* a3 )
+{
+	__m512d g12v = _mm512_set1_pd( *gamma12 );
+	__m512d s12v = _mm512_set1_pd( *sigma12 );
+	__m512d g23v = _mm512_set1_pd( *gamma23 );
+	__m512d s23v = _mm512_set1_pd( *sigma23 );
+	__m512d a1v, a2v, a3v, b1v, b2v, b3v, t1v, t2v;
+	__mmask8 k;
+	int     i;
+
+	// Apply the rotations to 16 rows at a time, in two independent chains.
+	for ( i = 0; i + 16 <= m_A; i += 16 )
+	{
+		a1v = _mm512_loadu_pd( a1 + i );
+		b1v = _mm512_loadu_pd( a1 + i + 8 );
+		a2v = _mm512_loadu_pd( a2 + i );
+		b2v = _mm512_loadu_pd( a2 + i + 8 );
+		a3v = _mm512_loadu_pd( a3 + i );
+		b3v = _mm512_loadu_pd( a3 + i + 8 );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_pd( t1v, g23v, _mm512_mul_pd( a3v, s23v ) );
+		a3v = _mm512_fmsub_pd( a3v, g23v, _mm512_mul_pd( t1v, s23v ) );
+		t2v = b2v;
+		b2v = _mm512_fmadd_pd( t2v, g23v, _mm512_mul_pd( b3v, s23v ) );
+		b3v = _mm512_fmsub_pd( b3v, g23v, _mm512_mul_pd( t2v, s23v ) );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_pd( t1v, g12v, _mm512_mul_pd( a2v, s12v ) );
+		a2v = _mm512_fmsub_pd( a2v, g12v, _mm512_mul_pd( t1v, s12v ) );
+		t2v = b1v;
+		b1v = _mm512_fmadd_pd( t2v, g12v, _mm512_mul_pd( b2v, s12v ) );
+		b2v = _mm512_fmsub_pd( b2v, g12v, _mm512_mul_pd( t2v, s12v ) );
+
+		_mm512_storeu_pd( a1 + i, a1v );
+		_mm512_storeu_pd( a1 + i + 8, b1v );
+		_mm512_storeu_pd( a2 + i, a2v );
+		_mm512_storeu_pd( a2 + i + 8, b2v );
+		_mm512_storeu_pd( a3 + i, a3v );
+		_mm512_storeu_pd( a3 + i + 8, b3v );
+	}
+
+	for ( ; i < m_A; i += 8 )
+	{
+		// Mask off the rows beyond m_A.
+		k = ( __mmask8 ) ( m_A - i >= 8 ? ~0u : ( 1u << ( m_A - i ) ) - 1 );
+
+		a1v = _mm512_maskz_loadu_pd( k, a1 + i );
+		a2v = _mm512_maskz_loadu_pd( k, a2 + i );
+		a3v = _mm512_maskz_loadu_pd( k, a3 + i );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_pd( t1v, g23v, _mm512_mul_pd( a3v, s23v ) );
+		a3v = _mm512_fmsub_pd( a3v, g23v, _mm512_mul_pd( t1v, s23v ) );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_pd( t1v, g12v, _mm512_mul_pd( a2v, s12v ) );
+		a2v = _mm512_fmsub_pd( a2v, g12v, _mm512_mul_pd( t1v, s12v ) );
+
+		_mm512_mask_storeu_pd( a1 + i, k, a1v );
+		_mm512_mask_storeu_pd( a2 + i, k, a2v );
+		_mm512_mask_storeu_pd( a3 + i, k, a3v );
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx512f" ) ))
+FLA_Error FLA_Apply_G_mx4s_avx512_ops( int     m_A,
+                                       float*  gamma23_k1,
+                                       float*  sigma23_k1,
+                                       float*  gamma34_k1,
+                                       float*  sigma34_k1,
+                                       float*  gamma12_k2,
+                                       float*  sigma12_k2,
+                                       float*  gamma23_k2,
+                                       float*  sigma23_k2,
+                                       float*  a1,
+                                       float*  a2,
+                                       float*  a3,
+                                       float*  a4 )
+{
+	__m512 g23_k1v = _mm512_set1_ps( *gamma23_k1 );
+	__m512 s23_k1v = _mm512_set1_ps( *sigma23_k1 );
+	__m512 g34_k1v = _mm512_set1_ps( *gamma34_k1 );
+	__m512 s34_k1v = _mm512_set1_ps( *sigma34_k1 );
+	__m512 g12_k2v = _mm512_set1_ps( *gamma12_k2 );
+	__m512 s12_k2v = _mm512_set1_ps( *sigma12_k2 );
+	__m512 g23_k2v = _mm512_set1_ps( *gamma23_k2 );
+	__m512 s23_k2v = _mm512_set1_ps( *sigma23_k2 );
+	__m512 a1v, a2v, a3v, a4v, b1v, b2v, b3v, b4v, t1v, t2v;
+	__mmask16 k;
+	int    i;
+
+	// Apply the rotations to 32 rows at a time, in two independent chains.
+	for ( i = 0; i + 32 <= m_A; i += 32 )
+	{
+		a1v = _mm512_loadu_ps( a1 + i );
+		b1v = _mm512_loadu_ps( a1 + i + 16 );
+		a2v = _mm512_loadu_ps( a2 + i );
+		b2v = _mm512_loadu_ps( a2 + i + 16 );
+		a3v = _mm512_loadu_ps( a3 + i );
+		b3v = _mm512_loadu_ps( a3 + i + 16 );
+		a4v = _mm512_loadu_ps( a4 + i );
+		b4v = _mm512_loadu_ps( a4 + i + 16 );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_ps( t1v, g23_k1v, _mm512_mul_ps( a3v, s23_k1v ) );
+		a3v = _mm512_fmsub_ps( a3v, g23_k1v, _mm512_mul_ps( t1v, s23_k1v ) );
+		t2v = b2v;
+		b2v = _mm512_fmadd_ps( t2v, g23_k1v, _mm512_mul_ps( b3v, s23_k1v ) );
+		b3v = _mm512_fmsub_ps( b3v, g23_k1v, _mm512_mul_ps( t2v, s23_k1v ) );
+
+		t1v = a3v;
+		a3v = _mm512_fmadd_ps( t1v, g34_k1v, _mm512_mul_ps( a4v, s34_k1v ) );
+		a4v = _mm512_fmsub_ps( a4v, g34_k1v, _mm512_mul_ps( t1v, s34_k1v ) );
+		t2v = b3v;
+		b3v = _mm512_fmadd_ps( t2v, g34_k1v, _mm512_mul_ps( b4v, s34_k1v ) );
+		b4v = _mm512_fmsub_ps( b4v, g34_k1v, _mm512_mul_ps( t2v, s34_k1v ) );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_ps( t1v, g12_k2v, _mm512_mul_ps( a2v, s12_k2v ) );
+		a2v = _mm512_fmsub_ps( a2v, g12_k2v, _mm512_mul_ps( t1v, s12_k2v ) );
+		t2v = b1v;
+		b1v = _mm512_fmadd_ps( t2v, g12_k2v, _mm512_mul_ps( b2v, s12_k2v ) );
+		b2v = _mm512_fmsub_ps( b2v, g12_k2v, _mm512_mul_ps( t2v, s12_k2v ) );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_ps( t1v, g23_k2v, _mm512_mul_ps( a3v, s23_k2v ) );
+		a3v = _mm512_fmsub_ps( a3v, g23_k2v, _mm512_mul_ps( t1v, s23_k2v ) );
+		t2v = b2v;
+		b2v = _mm512_fmadd_ps( t2v, g23_k2v, _mm512_mul_ps( b3v, s23_k2v ) );
+		b3v = _mm512_fmsub_ps( b3v, g23_k2v, _mm512_mul_ps( t2v, s23_k2v ) );
+
+		_mm512_storeu_ps( a1 + i, a1v );
+		_mm512_storeu_ps( a1 + i + 16, b1v );
+		_mm512_storeu_ps( a2 + i, a2v );
+		_mm512_storeu_ps( a2 + i + 16, b2v );
+		_mm512_storeu_ps( a3 + i, a3v );
+		_mm512_storeu_ps( a3 + i + 16, b3v );
+		_mm512_storeu_ps( a4 + i, a4v );
+		_mm512_storeu_ps( a4 + i + 16, b4v );
+	}
+
+	for ( ; i < m_A; i += 16 )
+	{
+		// Mask off the rows beyond m_A.
+		k = ( __mmask16 ) ( m_A - i >= 16 ? ~0u : ( 1u << ( m_A - i ) ) - 1 );
+
+		a1v = _mm512_maskz_loadu_ps( k, a1 + i );
+		a2v = _mm512_maskz_loadu_ps( k, a2 + i );
+		a3v = _mm512_maskz_loadu_ps( k, a3 + i );
+		a4v = _mm512_maskz_loadu_ps( k, a4 + i );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_ps( t1v, g23_k1v, _mm512_mul_ps( a3v, s23_k1v ) );
+		a3v = _mm512_fmsub_ps( a3v, g23_k1v, _mm512_mul_ps( t1v, s23_k1v ) );
+
+		t1v = a3v;
+		a3v = _mm512_fmadd_ps( t1v, g34_k1v, _mm512_mul_ps( a4v, s34_k1v ) );
+		a4v = _mm512_fmsub_ps( a4v, g34_k1v, _mm512_mul_ps( t1v, s34_k1v ) );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_ps( t1v, g12_k2v, _mm512_mul_ps( a2v, s12_k2v ) );
+		a2v = _mm512_fmsub_ps( a2v, g12_k2v, _mm512_mul_ps( t1v, s12_k2v ) );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_ps( t1v, g23_k2v, _mm512_mul_ps( a3v, s23_k2v ) );
+		a3v = _mm512_fmsub_ps( a3v, g23_k2v, _mm512_mul_ps( t1v, s23_k2v ) );
+
+		_mm512_mask_storeu_ps( a1 + i, k, a1v );
+		_mm512_mask_storeu_ps( a2 + i, k, a2v );
+		_mm512_mask_storeu_ps( a3 + i, k, a3v );
+		_mm512_mask_storeu_ps( a4 + i, k, a4v );
+	}
+
+	return FLA_SUCCESS;
+}
+
+__attribute__(( target( "avx512f" ) ))
+FLA_Error FLA_Apply_G_mx4s_avx512_opd( int     m_A,
+                                       double* gamma23_k1,
+                                       double* sigma23_k1,
+                                       double* gamma34_k1,
+                                       double* sigma34_k1,
+                                       double* gamma12_k2,
+                                       double* sigma12_k2,
+                                       double* gamma23_k2,
+                                       double* sigma23_k2,
+                                       double* a1,
+                                       double* a2,
+                                       double* a3,
+                                       double* a4 )
+{
+	__m512d g23_k1v = _mm512_set1_pd( *gamma23_k1 );
+	__m512d s23_k1v = _mm512_set1_pd( *sigma23_k1 );
+	__m512d g34_k1v = _mm512_set1_pd( *gamma34_k1 );
+	__m512d s34_k1v = _mm512_set1_pd( *sigma34_k1 );
+	__m512d g12_k2v = _mm512_set1_pd( *gamma12_k2 );
+	__m512d s12_k2v = _mm512_set1_pd( *sigma12_k2 );
+	__m512d g23_k2v = _mm512_set1_pd( *gamma23_k2 );
+	__m512d s23_k2v = _mm512_set1_pd( *sigma23_k2 );
+	__m512d a1v, a2v, a3v, a4v, b1v, b2v, b3v, b4v, t1v, t2v;
+	__mmask8 k;
+	int     i;
+
+	// Apply the rotations to 16 rows at a time, in two independent chains.
+	for ( i = 0; i + 16 <= m_A; i += 16 )
+	{
+		a1v = _mm512_loadu_pd( a1 + i );
+		b1v = _mm512_loadu_pd( a1 + i + 8 );
+		a2v = _mm512_loadu_pd( a2 + i );
+		b2v = _mm512_loadu_pd( a2 + i + 8 );
+		a3v = _mm512_loadu_pd( a3 + i );
+		b3v = _mm512_loadu_pd( a3 + i + 8 );
+		a4v = _mm512_loadu_pd( a4 + i );
+		b4v = _mm512_loadu_pd( a4 + i + 8 );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_pd( t1v, g23_k1v, _mm512_mul_pd( a3v, s23_k1v ) );
+		a3v = _mm512_fmsub_pd( a3v, g23_k1v, _mm512_mul_pd( t1v, s23_k1v ) );
+		t2v = b2v;
+		b2v = _mm512_fmadd_pd( t2v, g23_k1v, _mm512_mul_pd( b3v, s23_k1v ) );
+		b3v = _mm512_fmsub_pd( b3v, g23_k1v, _mm512_mul_pd( t2v, s23_k1v ) );
+
+		t1v = a3v;
+		a3v = _mm512_fmadd_pd( t1v, g34_k1v, _mm512_mul_pd( a4v, s34_k1v ) );
+		a4v = _mm512_fmsub_pd( a4v, g34_k1v, _mm512_mul_pd( t1v, s34_k1v ) );
+		t2v = b3v;
+		b3v = _mm512_fmadd_pd( t2v, g34_k1v, _mm512_mul_pd( b4v, s34_k1v ) );
+		b4v = _mm512_fmsub_pd( b4v, g34_k1v, _mm512_mul_pd( t2v, s34_k1v ) );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_pd( t1v, g12_k2v, _mm512_mul_pd( a2v, s12_k2v ) );
+		a2v = _mm512_fmsub_pd( a2v, g12_k2v, _mm512_mul_pd( t1v, s12_k2v ) );
+		t2v = b1v;
+		b1v = _mm512_fmadd_pd( t2v, g12_k2v, _mm512_mul_pd( b2v, s12_k2v ) );
+		b2v = _mm512_fmsub_pd( b2v, g12_k2v, _mm512_mul_pd( t2v, s12_k2v ) );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_pd( t1v, g23_k2v, _mm512_mul_pd( a3v, s23_k2v ) );
+		a3v = _mm512_fmsub_pd( a3v, g23_k2v, _mm512_mul_pd( t1v, s23_k2v ) );
+		t2v = b2v;
+		b2v = _mm512_fmadd_pd( t2v, g23_k2v, _mm512_mul_pd( b3v, s23_k2v ) );
+		b3v = _mm512_fmsub_pd( b3v, g23_k2v, _mm512_mul_pd( t2v, s23_k2v ) );
+
+		_mm512_storeu_pd( a1 + i, a1v );
+		_mm512_storeu_pd( a1 + i + 8, b1v );
+		_mm512_storeu_pd( a2 + i, a2v );
+		_mm512_storeu_pd( a2 + i + 8, b2v );
+		_mm512_storeu_pd( a3 + i, a3v );
+		_mm512_storeu_pd( a3 + i + 8, b3v );
+		_mm512_storeu_pd( a4 + i, a4v );
+		_mm512_storeu_pd( a4 + i + 8, b4v );
+	}
+
+	for ( ; i < m_A; i += 8 )
+	{
+		// Mask off the rows beyond m_A.
+		k = ( __mmask8 ) ( m_A - i >= 8 ? ~0u : ( 1u << ( m_A - i ) ) - 1 );
+
+		a1v = _mm512_maskz_loadu_pd( k, a1 + i );
+		a2v = _mm512_maskz_loadu_pd( k, a2 + i );
+		a3v = _mm512_maskz_loadu_pd( k, a3 + i );
+		a4v = _mm512_maskz_loadu_pd( k, a4 + i );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_pd( t1v, g23_k1v, _mm512_mul_pd( a3v, s23_k1v ) );
+		a3v = _mm512_fmsub_pd( a3v, g23_k1v, _mm512_mul_pd( t1v, s23_k1v ) );
+
+		t1v = a3v;
+		a3v = _mm512_fmadd_pd( t1v, g34_k1v, _mm512_mul_pd( a4v, s34_k1v ) );
+		a4v = _mm512_fmsub_pd( a4v, g34_k1v, _mm512_mul_pd( t1v, s34_k1v ) );
+
+		t1v = a1v;
+		a1v = _mm512_fmadd_pd( t1v, g12_k2v, _mm512_mul_pd( a2v, s12_k2v ) );
+		a2v = _mm512_fmsub_pd( a2v, g12_k2v, _mm512_mul_pd( t1v, s12_k2v ) );
+
+		t1v = a2v;
+		a2v = _mm512_fmadd_pd( t1v, g23_k2v, _mm512_mul_pd( a3v, s23_k2v ) );
+		a3v = _mm512_fmsub_pd( a3v, g23_k2v, _mm512_mul_pd( t1v, s23_k2v ) );
+
+		_mm512_mask_storeu_pd( a1 + i, k, a1v );
+		_mm512_mask_storeu_pd( a2 + i, k, a2v );
+		_mm512_mask_storeu_pd( a3 + i, k, a3v );
+		_mm512_mask_storeu_pd( a4 + i, k, a4v );
+	}
+
+	return FLA_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,492 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+#include <cpuid.h>
+#endif
+
+// The instruction set used by the Givens kernels, or -1 until it has been
+// determined. Determining it more than once, should two threads race to do
+// so first, is harmless since the result is always the same.
+static int fla_apply_g_mx_simd_type = -1;
+static int fla_apply_g_mx_simd_type_max = -1;
+
+static int FLA_Apply_G_mx_detect_simd_type( void )
+{
+	int type = FLA_APPLY_G_SIMD_NONE;
+
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+	unsigned int eax, ebx, ecx, edx;
+	unsigned int xcr0_lo, xcr0_hi;
+
+	// FMA, OSXSAVE and AVX are reported in ecx of leaf 1.
+	if ( !__get_cpuid( 1, &eax, &ebx, &ecx, &edx ) ) return type;
+	if ( ( ecx & ( 1u << 12 ) ) == 0 ||
+	     ( ecx & ( 1u << 27 ) ) == 0 ||
+	     ( ecx & ( 1u << 28 ) ) == 0 ) return type;
+
+	// The operating system must save the YMM state, and the opmask and ZMM
+	// state for AVX-512, on a context switch.
+	__asm__ __volatile__ ( "xgetbv" : "=a" ( xcr0_lo ), "=d" ( xcr0_hi ) : "c" ( 0 ) );
+	if ( ( xcr0_lo & 0x06 ) != 0x06 ) return type;
+
+	// AVX2 and AVX-512F are reported in ebx of leaf 7.
+	if ( __get_cpuid_max( 0, NULL ) < 7 ) return type;
+	__cpuid_count( 7, 0, eax, ebx, ecx, edx );
+
+	if ( ebx & ( 1u << 5 ) )
+		type = FLA_APPLY_G_SIMD_AVX2;
+	if ( ( ebx & ( 1u << 16 ) ) && ( xcr0_lo & 0xe6 ) == 0xe6 )
+		type = FLA_APPLY_G_SIMD_AVX512;
+#endif
+
+	return type;
+}
+
+int FLA_Apply_G_mx_simd_type( void )
+{
+	if ( fla_apply_g_mx_simd_type < 0 )
+	{
+		fla_apply_g_mx_simd_type_max = FLA_Apply_G_mx_detect_simd_type();
+		fla_apply_g_mx_simd_type     = fla_apply_g_mx_simd_type_max;
+	}
+
+	return fla_apply_g_mx_simd_type;
+}
+
+FLA_Error FLA_Apply_G_mx_set_simd_type( int simd_type )
+{
+	// Make sure the instruction sets that the processor supports are known,
+	// and never select one beyond them.
+	FLA_Apply_G_mx_simd_type();
+
+	fla_apply_g_mx_simd_type = max( FLA_APPLY_G_SIMD_NONE,
+	                                min( simd_type, fla_apply_g_mx_simd_type_max ) );
+
+	return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Apply_G_mx2_simd_ops( int     m_A,
+                                    float*  gamma12,
+                                    float*  sigma12,
+                                    float*  a1,
+                                    float*  a2 )
+{
+	switch ( FLA_Apply_G_mx_simd_type() )
+	{
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+		case FLA_APPLY_G_SIMD_AVX512:
+			FLA_Apply_G_mx2_avx512_ops( m_A,
+			                            gamma12,
+			                            sigma12,
+			                            a1,
+			                            a2 );
+			break;
+
+		case FLA_APPLY_G_SIMD_AVX2:
+			FLA_Apply_G_mx2_avx2_ops( m_A,
+			                          gamma12,
+			                          sigma12,
+			                          a1,
+			                          a2 );
+			break;
+
+#endif
+		default:
+			MAC_Apply_G_mx2_ops( m_A,
+			                     gamma12,
+			                     sigma12,
+			                     a1, 1,
+			                     a2, 1 )
+			break;
+	}
+
+	return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Apply_G_mx2_simd_opd( int     m_A,
+                                    double* gamma12,
+                                    double* sigma12,
+                                    double* a1,
+                                    double* a2 )
+{
+	switch ( FLA_Apply_G_mx_simd_type() )
+	{
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+		case FLA_APPLY_G_SIMD_AVX512:
+			FLA_Apply_G_mx2_avx512_opd( m_A,
+			                            gamma12,
+			                            sigma12,
+			                            a1,
+			                            a2 );
+			break;
+
+		case FLA_APPLY_G_SIMD_AVX2:
+			FLA_Apply_G_mx2_avx2_opd( m_A,
+			                          gamma12,
+			                          sigma12,
+			                          a1,
+			                          a2 );
+			break;
+
+#endif
+		default:
+			MAC_Apply_G_mx2_opd( m_A,
+			                     gamma12,
+			                     sigma12,
+			                     a1, 1,
+			                     a2, 1 )
+			break;
+	}
+
+	return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Apply_G_mx3_simd_ops( int     m_A,
+                                    float*  gamma12,
+                                    float*  sigma12,
+                                    float*  gamma23,
+                                    float*  sigma23,
+                                    float*  a1,
+                                    float*  a2,
+                                    float*  a3 )
+{
+	switch ( FLA_Apply_G_mx_simd_type() )
+	{
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+		case FLA_APPLY_G_SIMD_AVX512:
+			FLA_Apply_G_mx3_avx512_ops( m_A,
+			                            gamma12,
+			                            sigma12,
+			                            gamma23,
+			                            sigma23,
+			                            a1,
+			                            a2,
+			                            a3 );
+			break;
+
+		case FLA_APPLY_G_SIMD_AVX2:
+			FLA_Apply_G_mx3_avx2_ops( m_A,
+			                          gamma12,
+			                          sigma12,
+			                          gamma23,
+			                          sigma23,
+			                          a1,
+			                          a2,
+			                          a3 );
+			break;
+
+#endif
+		default:
+			MAC_Apply_G_mx3_ops( m_A,
+			                     gamma12,
+			                     sigma12,
+			                     gamma23,
+			                     sigma23,
+			                     a1, 1,
+			                     a2, 1,
+			                     a3, 1 )
+			break;
+	}
+
+	return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Apply_G_mx3_simd_opd( int     m_A,
+                                    double* gamma12,
+                                    double* sigma12,
+                                    double* gamma23,
+                                    double* sigma23,
+                                    double* a1,
+                                    double* a2,
+                                    double* a3 )
+{
+	switch ( FLA_Apply_G_mx_simd_type() )
+	{
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+		case FLA_APPLY_G_SIMD_AVX512:
+			FLA_Apply_G_mx3_avx512_opd( m_A,
+			                            gamma12,
+			                            sigma12,
+			                            gamma23,
+			                            sigma23,
+			                            a1,
+			                            a2,
+			                            a3 );
+			break;
+
+		case FLA_APPLY_G_SIMD_AVX2:
+			FLA_Apply_G_mx3_avx2_opd( m_A,
+			                          gamma12,
+			                          sigma12,
+			                          gamma23,
+			                          sigma23,
+			                          a1,
+			                          a2,
+			                          a3 );
+			break;
+
+#endif
+		default:
+			MAC_Apply_G_mx3_opd( m_A,
+			                     gamma12,
+			                     sigma12,
+			                     gamma23,
+			                     sigma23,
+			                     a1, 1,
+			                     a2, 1,
+			                     a3, 1 )
+			break;
+	}
+
+	return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Apply_G_mx3b_simd_ops( int     m_A,
+                                     float*  gamma12,
+                                     float*  sigma12,
+                                     float*  gamma23,
+                                     float*  sigma23,
+                                     float*  a1,
+                                     float*  a2,
+                                     float*  a3 )
+{
+	switch ( FLA_Apply_G_mx_simd_type() )
+	{
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+		case FLA_APPLY_G_SIMD_AVX512:
+			FLA_Apply_G_mx3b_avx512_ops( m_A,
+			                             gamma12,
+			                             sigma12,
+			                             gamma23,
+			                             sigma23,
+			                             a1,
+			                             a2,
+			                             a3 );
+			break;
+
+		case FLA_APPLY_G_SIMD_AVX2:
+			FLA_Apply_G_mx3b_avx2_ops( m_A,
+			                           gamma12,
+			                           sigma12,
+			                           gamma23,
+			                           sigma23,
+			                           a1,
+			                           a2,
+			                           a3 );
+			break;
+
+#endif
+		default:
+			MAC_Apply_G_mx3b_ops( m_A,
+			                      gamma12,
+			                      sigma12,
+			                      gamma23,
+			                      sigma23,
+			                      a1, 1,
+			                      a2, 1,
+			                      a3, 1 )
+			break;
+	}
+
+	return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Apply_G_mx3b_simd_opd( int     m_A,
+                                     double* gamma12,
+                                     double* sigma12,
+                                     double* gamma23,
+                                     double* sigma23,
+                                     double* a1,
+                                     double* a2,
+                                     double* a3 )
+{
+	switch ( FLA_Apply_G_mx_simd_type() )
+	{
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+		case FLA_APPLY_G_SIMD_AVX512:
+			FLA_Apply_G_mx3b_avx512_opd( m_A,
+			                             gamma12,
+			                             sigma12,
+			                             gamma23,
+			                             sigma23,
+			                             a1,
+			                             a2,
+			                             a3 );
+			break;
+
+		case FLA_APPLY_G_SIMD_AVX2:
+			FLA_Apply_G_mx3b_avx2_opd( m_A,
+			                           gamma12,
+			                           sigma12,
+			                           gamma23,
+			                           sigma23,
+			                           a1,
+			                           a2,
+			                           a3 );
+			break;
+
+#endif
+		default:
+			MAC_Apply_G_mx3b_opd( m_A,
+			                      gamma12,
+			                      sigma12,
+			                      gamma23,
+			                      sigma23,
+			                      a1, 1,
+			                      a2, 1,
+			                      a3, 1 )
+			break;
+	}
+
+	return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Apply_G_mx4s_simd_ops( int     m_A,
+                                     float*  gamma23_k1,
+                                     float*  sigma23_k1,
+                                     float*  gamma34_k1,
+                                     float*  sigma34_k1,
+                                     float*  gamma12_k2,
+                                     float*  sigma12_k2,
+                                     float*  gamma23_k2,
+                                     float*  sigma23_k2,
+                                     float*  a1,
+                                     float*  a2,
+                                     float*  a3,
+                                     float*  a4 )
+{
+	switch ( FLA_Apply_G_mx_simd_type() )
+	{
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+		case FLA_APPLY_G_SIMD_AVX512:
+			FLA_Apply_G_mx4s_avx512_ops( m_A,
+			                             gamma23_k1,
+			                             sigma23_k1,
+			                             gamma34_k1,
+			                             sigma34_k1,
+			                             gamma12_k2,
+			                             sigma12_k2,
+			                             gamma23_k2,
+			                             sigma23_k2,
+			                             a1,
+			                             a2,
+			                             a3,
+			                             a4 );
+			break;
+
+		case FLA_APPLY_G_SIMD_AVX2:
+			FLA_Apply_G_mx4s_avx2_ops( m_A,
+			                           gamma23_k1,
+			                           sigma23_k1,
+			                           gamma34_k1,
+			                           sigma34_k1,
+			                           gamma12_k2,
+			                           sigma12_k2,
+			                           gamma23_k2,
+			                           sigma23_k2,
+			                           a1,
+			                           a2,
+			                           a3,
+			                           a4 );
+			break;
+
+#endif
+		default:
+			MAC_Apply_G_mx4s_ops( m_A,
+			                      gamma23_k1,
+			                      sigma23_k1,
+			                      gamma34_k1,
+			                      sigma34_k1,
+			                      gamma12_k2,
+			                      sigma12_k2,
+			                      gamma23_k2,
+			                      sigma23_k2,
+			                      a1, 1,
+			                      a2, 1,
+			                      a3, 1,
+			                      a4, 1 )
+			break;
+	}
+
+	return FLA_SUCCESS;
+}
+
+FLA_Error FLA_Apply_G_mx4s_simd_opd( int     m_A,
+                                     double* gamma23_k1,
+                                     double* sigma23_k1,
+                                     double* gamma34_k1,
+                                     double* sigma34_k1,
+                                     double* gamma12_k2,
+                                     double* sigma12_k2,
+                                     double* gamma23_k2,
+                                     double* sigma23_k2,
+                                     double* a1,
+                                     double* a2,
+                                     double* a3,
+                                     double* a4 )
+{
+	switch ( FLA_Apply_G_mx_simd_type() )
+	{
+#ifdef FLA_ENABLE_APPLY_G_MX_SIMD
+		case FLA_APPLY_G_SIMD_AVX512:
+			FLA_Apply_G_mx4s_avx512_opd( m_A,
+			                             gamma23_k1,
+			                             sigma23_k1,
+			                             gamma34_k1,
+			                             sigma34_k1,
+			                             gamma12_k2,
+			                             sigma12_k2,
+			                             gamma23_k2,
+			                             sigma23_k2,
+			                             a1,
+			                             a2,
+			                             a3,
+			                             a4 );
+			break;
+
+		case FLA_APPLY_G_SIMD_AVX2:
+			FLA_Apply_G_mx4s_avx2_opd( m_A,
+			                           gamma23_k1,
+			                           sigma23_k1,
+			                           gamma34_k1,
+			                           sigma34_k1,
+			                           gamma12_k2,
+			                           sigma12_k2,
+			                           gamma23_k2,
+			                           sigma23_k2,
+			                           a1,
+			                           a2,
+			                           a3,
+			                           a4 );
+			break;
+
+#endif
+		default:
+			MAC_Apply_G_mx4s_opd( m_A,
+			                      gamma23_k1,
+			                      sigma23_k1,
+			                      gamma34_k1,
+			                      sigma34_k1,
+			                      gamma12_k2,
+			                      sigma12_k2,
+			                      gamma23_k2,
+			                      sigma23_k2,
+			                      a1, 1,
+			                      a2, 1,
+			                      a3, 1,
+			                      a4, 1 )
+			break;
+	}
+
+	return FLA_SUCCESS;
+}
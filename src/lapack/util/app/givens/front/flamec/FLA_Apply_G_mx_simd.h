@@ -0,0 +1,230 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+// The AVX2 and AVX-512 kernels are built with compiler attributes that
+// select the instruction set per function, and are chosen at run time.
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) ) && \
+    !defined(FLA_ENABLE_TIDSP)
+#define FLA_ENABLE_APPLY_G_MX_SIMD
+#endif
+
+#define FLA_APPLY_G_SIMD_NONE    0
+#define FLA_APPLY_G_SIMD_AVX2    1
+#define FLA_APPLY_G_SIMD_AVX512  2
+
+int       FLA_Apply_G_mx_simd_type( void );
+FLA_Error FLA_Apply_G_mx_set_simd_type( int simd_type );
+
+FLA_Error FLA_Apply_G_mx2_simd_ops( int     m_A,
+                                    float*  gamma12,
+                                    float*  sigma12,
+                                    float*  a1,
+                                    float*  a2 );
+FLA_Error FLA_Apply_G_mx2_simd_opd( int     m_A,
+                                    double* gamma12,
+                                    double* sigma12,
+                                    double* a1,
+                                    double* a2 );
+FLA_Error FLA_Apply_G_mx3_simd_ops( int     m_A,
+                                    float*  gamma12,
+                                    float*  sigma12,
+                                    float*  gamma23,
+                                    float*  sigma23,
+                                    float*  a1,
+                                    float*  a2,
+                                    float*  a3 );
+FLA_Error FLA_Apply_G_mx3_simd_opd( int     m_A,
+                                    double* gamma12,
+                                    double* sigma12,
+                                    double* gamma23,
+                                    double* sigma23,
+                                    double* a1,
+                                    double* a2,
+                                    double* a3 );
+FLA_Error FLA_Apply_G_mx3b_simd_ops( int     m_A,
+                                     float*  gamma12,
+                                     float*  sigma12,
+                                     float*  gamma23,
+                                     float*  sigma23,
+                                     float*  a1,
+                                     float*  a2,
+                                     float*  a3 );
+FLA_Error FLA_Apply_G_mx3b_simd_opd( int     m_A,
+                                     double* gamma12,
+                                     double* sigma12,
+                                     double* gamma23,
+                                     double* sigma23,
+                                     double* a1,
+                                     double* a2,
+                                     double* a3 );
+FLA_Error FLA_Apply_G_mx4s_simd_ops( int     m_A,
+                                     float*  gamma23_k1,
+                                     float*  sigma23_k1,
+                                     float*  gamma34_k1,
+                                     float*  sigma34_k1,
+                                     float*  gamma12_k2,
+                                     float*  sigma12_k2,
+                                     float*  gamma23_k2,
+                                     float*  sigma23_k2,
+                                     float*  a1,
+                                     float*  a2,
+                                     float*  a3,
+                                     float*  a4 );
+FLA_Error FLA_Apply_G_mx4s_simd_opd( int     m_A,
+                                     double* gamma23_k1,
+                                     double* sigma23_k1,
+                                     double* gamma34_k1,
+                                     double* sigma34_k1,
+                                     double* gamma12_k2,
+                                     double* sigma12_k2,
+                                     double* gamma23_k2,
+                                     double* sigma23_k2,
+                                     double* a1,
+                                     double* a2,
+                                     double* a3,
+                                     double* a4 );
+
+FLA_Error FLA_Apply_G_mx2_avx2_ops( int     m_A,
+                                    float*  gamma12,
+                                    float*  sigma12,
+                                    float*  a1,
+                                    float*  a2 );
+FLA_Error FLA_Apply_G_mx2_avx2_opd( int     m_A,
+                                    double* gamma12,
+                                    double* sigma12,
+                                    double* a1,
+                                    double* a2 );
+FLA_Error FLA_Apply_G_mx3_avx2_ops( int     m_A,
+                                    float*  gamma12,
+                                    float*  sigma12,
+                                    float*  gamma23,
+                                    float*  sigma23,
+                                    float*  a1,
+                                    float*  a2,
+                                    float*  a3 );
+FLA_Error FLA_Apply_G_mx3_avx2_opd( int     m_A,
+                                    double* gamma12,
+                                    double* sigma12,
+                                    double* gamma23,
+                                    double* sigma23,
+                                    double* a1,
+                                    double* a2,
+                                    double* a3 );
+FLA_Error FLA_Apply_G_mx3b_avx2_ops( int     m_A,
+                                     float*  gamma12,
+                                     float*  sigma12,
+                                     float*  gamma23,
+                                     float*  sigma23,
+                                     float*  a1,
+                                     float*  a2,
+                                     float*  a3 );
+FLA_Error FLA_Apply_G_mx3b_avx2_opd( int     m_A,
+                                     double* gamma12,
+                                     double* sigma12,
+                                     double* gamma23,
+                                     double* sigma23,
+                                     double* a1,
+                                     double* a2,
+                                     double* a3 );
+FLA_Error FLA_Apply_G_mx4s_avx2_ops( int     m_A,
+                                     float*  gamma23_k1,
+                                     float*  sigma23_k1,
+                                     float*  gamma34_k1,
+                                     float*  sigma34_k1,
+                                     float*  gamma12_k2,
+                                     float*  sigma12_k2,
+                                     float*  gamma23_k2,
+                                     float*  sigma23_k2,
+                                     float*  a1,
+                                     float*  a2,
+                                     float*  a3,
+                                     float*  a4 );
+FLA_Error FLA_Apply_G_mx4s_avx2_opd( int     m_A,
+                                     double* gamma23_k1,
+                                     double* sigma23_k1,
+                                     double* gamma34_k1,
+                                     double* sigma34_k1,
+                                     double* gamma12_k2,
+                                     double* sigma12_k2,
+                                     double* gamma23_k2,
+                                     double* sigma23_k2,
+                                     double* a1,
+                                     double* a2,
+                                     double* a3,
+                                     double* a4 );
+
+FLA_Error FLA_Apply_G_mx2_avx512_ops( int     m_A,
+                                      float*  gamma12,
+                                      float*  sigma12,
+                                      float*  a1,
+                                      float*  a2 );
+FLA_Error FLA_Apply_G_mx2_avx512_opd( int     m_A,
+                                      double* gamma12,
+                                      double* sigma12,
+                                      double* a1,
+                                      double* a2 );
+FLA_Error FLA_Apply_G_mx3_avx512_ops( int     m_A,
+                                      float*  gamma12,
+                                      float*  sigma12,
+                                      float*  gamma23,
+                                      float*  sigma23,
+                                      float*  a1,
+                                      float*  a2,
+                                      float*  a3 );
+FLA_Error FLA_Apply_G_mx3_avx512_opd( int     m_A,
+                                      double* gamma12,
+                                      double* sigma12,
+                                      double* gamma23,
+                                      double* sigma23,
+                                      double* a1,
+                                      double* a2,
+                                      double* a3 );
+FLA_Error FLA_Apply_G_mx3b_avx512_ops( int     m_A,
+                                       float*  gamma12,
+                                       float*  sigma12,
+                                       float*  gamma23,
+                                       float*  sigma23,
+                                       float*  a1,
+                                       float*  a2,
+                                       float*  a3 );
+FLA_Error FLA_Apply_G_mx3b_avx512_opd( int     m_A,
+                                       double* gamma12,
+                                       double* sigma12,
+                                       double* gamma23,
+                                       double* sigma23,
+                                       double* a1,
+                                       double* a2,
+                                       double* a3 );
+FLA_Error FLA_Apply_G_mx4s_avx512_ops( int     m_A,
+                                       float*  gamma23_k1,
+                                       float*  sigma23_k1,
+                                       float*  gamma34_k1,
+                                       float*  sigma34_k1,
+                                       float*  gamma12_k2,
+                                       float*  sigma12_k2,
+                                       float*  gamma23_k2,
+                                       float*  sigma23_k2,
+                                       float*  a1,
+                                       float*  a2,
+                                       float*  a3,
+                                       float*  a4 );
+FLA_Error FLA_Apply_G_mx4s_avx512_opd( int     m_A,
+                                       double* gamma23_k1,
+                                       double* sigma23_k1,
+                                       double* gamma34_k1,
+                                       double* sigma34_k1,
+                                       double* gamma12_k2,
+                                       double* sigma12_k2,
+                                       double* gamma23_k2,
+                                       double* sigma23_k2,
+                                       double* a1,
+                                       double* a2,
+                                       double* a3,
+                                       double* a4 );
@@ -0,0 +1,184 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// Candidate numbers of accumulated sweeps (k_accum) and row blocksizes
+// (b_alg) tried by FLA_Apply_G_tune().
+#define FLA_APPLY_G_TUNE_N_K 6
+#define FLA_APPLY_G_TUNE_N_B 5
+
+static dim_t fla_apply_g_tune_k[FLA_APPLY_G_TUNE_N_K] = { 16, 24, 32, 48, 64, 96 };
+static dim_t fla_apply_g_tune_b[FLA_APPLY_G_TUNE_N_B] = { 64, 128, 256, 512, 1024 };
+
+// A larger k_accum is only chosen if it beats the smallest one by more
+// than this fraction, since it delays the convergence checks of the
+// eigensolvers and wastes more work on deflated rotations.
+#define FLA_APPLY_G_TUNE_TOL 0.03
+
+static double FLA_Apply_G_tune_time( FLA_Datatype datatype, int n_repeats,
+                                     dim_t k_G, dim_t b_alg, FLA_Obj G, FLA_Obj A );
+
+FLA_Error FLA_Apply_G_tune( FLA_Datatype datatype, dim_t m_A, int n_repeats, dim_t* k_accum, dim_t* b_alg )
+{
+  FLA_Datatype dt_G;
+  FLA_Obj      A, G;
+  double       rate[FLA_APPLY_G_TUNE_N_K][FLA_APPLY_G_TUNE_N_B];
+  double       rate_best = 0.0;
+  dim_t        k_max     = fla_apply_g_tune_k[FLA_APPLY_G_TUNE_N_K - 1];
+  int          i, j, i_best = 0, j_best = 0;
+
+  if ( FLA_Check_error_level() >= FLA_MIN_ERROR_CHECKING )
+    FLA_Check_error_code( FLA_Check_floating_datatype( datatype ) );
+
+  if ( m_A < 2 || n_repeats < 1 )
+    return FLA_FAILURE;
+
+  dt_G = ( datatype == FLA_FLOAT || datatype == FLA_COMPLEX ? FLA_COMPLEX
+                                                            : FLA_DOUBLE_COMPLEX );
+
+  FLA_Obj_create( datatype, m_A, m_A,       0, 0, &A );
+  FLA_Obj_create( dt_G,     m_A - 1, k_max, 0, 0, &G );
+
+  // Rotations preserve the norm of A, so A may be updated over and over
+  // without being refreshed between the timings.
+  FLA_Random_unitary_matrix( A );
+  FLA_Random_matrix( G );
+
+  if ( dt_G == FLA_COMPLEX )
+  {
+    scomplex* buff_G = FLA_Obj_buffer_at_view( G );
+
+    for ( i = 0; i < ( m_A - 1 ) * k_max; ++i )
+    {
+      float theta = 3.0F * buff_G[i].real;
+
+      buff_G[i].real = cosf( theta );
+      buff_G[i].imag = sinf( theta );
+    }
+  }
+  else // if ( dt_G == FLA_DOUBLE_COMPLEX )
+  {
+    dcomplex* buff_G = FLA_Obj_buffer_at_view( G );
+
+    for ( i = 0; i < ( m_A - 1 ) * k_max; ++i )
+    {
+      double theta = 3.0 * buff_G[i].real;
+
+      buff_G[i].real = cos( theta );
+      buff_G[i].imag = sin( theta );
+    }
+  }
+
+  // Measure the number of rotations applied per second for every pair of
+  // candidates.
+  for ( i = 0; i < FLA_APPLY_G_TUNE_N_K; ++i )
+  {
+    for ( j = 0; j < FLA_APPLY_G_TUNE_N_B; ++j )
+    {
+      double dtime = FLA_Apply_G_tune_time( datatype, n_repeats,
+                                            fla_apply_g_tune_k[i],
+                                            fla_apply_g_tune_b[j], G, A );
+
+      rate[i][j] = ( double ) fla_apply_g_tune_k[i] * ( m_A - 1 ) * m_A / dtime;
+      rate_best  = max( rate_best, rate[i][j] );
+    }
+  }
+
+  // Choose the smallest k_accum that comes within the tolerance of the best
+  // rate, along with its best blocksize.
+  for ( i = 0; i < FLA_APPLY_G_TUNE_N_K; ++i )
+  {
+    for ( j = 0; j < FLA_APPLY_G_TUNE_N_B; ++j )
+      if ( rate[i][j] > rate[i][j_best] ) j_best = j;
+
+    if ( rate[i][j_best] >= ( 1.0 - FLA_APPLY_G_TUNE_TOL ) * rate_best )
+    {
+      i_best = i;
+      break;
+    }
+
+    j_best = 0;
+  }
+
+  *k_accum = fla_apply_g_tune_k[i_best];
+  *b_alg   = fla_apply_g_tune_b[j_best];
+
+  // Every front end that applies waves of rotations with these kernels
+  // shares the result.
+  FLA_Tune_set( datatype, FLA_TUNE_HEVD, FLA_TUNE_K_ACCUM, *k_accum );
+  FLA_Tune_set( datatype, FLA_TUNE_HEVD, FLA_TUNE_B_ALG,   *b_alg );
+  FLA_Tune_set( datatype, FLA_TUNE_SVD,  FLA_TUNE_K_ACCUM, *k_accum );
+  FLA_Tune_set( datatype, FLA_TUNE_SVD,  FLA_TUNE_B_ALG,   *b_alg );
+  FLA_Tune_set( datatype, FLA_TUNE_BSVD, FLA_TUNE_K_ACCUM, *k_accum );
+  FLA_Tune_set( datatype, FLA_TUNE_BSVD, FLA_TUNE_B_ALG,   *b_alg );
+
+  FLA_Obj_free( &A );
+  FLA_Obj_free( &G );
+
+  return FLA_SUCCESS;
+}
+
+
+static double FLA_Apply_G_tune_time( FLA_Datatype datatype, int n_repeats,
+                                     dim_t k_G, dim_t b_alg, FLA_Obj G, FLA_Obj A )
+{
+  int    m_A    = FLA_Obj_length( A );
+  int    n_A    = FLA_Obj_width( A );
+  int    cs_A   = FLA_Obj_col_stride( A );
+  int    cs_G   = FLA_Obj_col_stride( G );
+  double dtime  = 1.0e9;
+  double dtime_rep;
+  int    irep;
+
+  // The double precision real eigensolvers and singular value solvers apply
+  // their waves with variant 3b, and the others with variant 3. Passing
+  // i_k = m_A updates every row of A, as in the later sweeps of the solvers.
+  for ( irep = 0; irep < n_repeats; ++irep )
+  {
+    dtime_rep = FLA_Clock();
+
+    switch ( datatype )
+    {
+      case FLA_FLOAT:
+        FLA_Apply_G_rf_bls_var3( k_G, m_A, n_A,
+                                 FLA_Obj_buffer_at_view( G ), 1, cs_G,
+                                 FLA_Obj_buffer_at_view( A ), 1, cs_A,
+                                 b_alg );
+        break;
+
+      case FLA_DOUBLE:
+        FLA_Apply_G_rf_bld_var3b( k_G, m_A, n_A, m_A,
+                                  FLA_Obj_buffer_at_view( G ), 1, cs_G,
+                                  FLA_Obj_buffer_at_view( A ), 1, cs_A,
+                                  b_alg );
+        break;
+
+      case FLA_COMPLEX:
+        FLA_Apply_G_rf_blc_var3( k_G, m_A, n_A,
+                                 FLA_Obj_buffer_at_view( G ), 1, cs_G,
+                                 FLA_Obj_buffer_at_view( A ), 1, cs_A,
+                                 b_alg );
+        break;
+
+      case FLA_DOUBLE_COMPLEX:
+        FLA_Apply_G_rf_blz_var3( k_G, m_A, n_A,
+                                 FLA_Obj_buffer_at_view( G ), 1, cs_G,
+                                 FLA_Obj_buffer_at_view( A ), 1, cs_A,
+                                 b_alg );
+        break;
+    }
+
+    dtime_rep = FLA_Clock() - dtime_rep;
+    dtime     = min( dtime, dtime_rep );
+  }
+
+  return dtime;
+}
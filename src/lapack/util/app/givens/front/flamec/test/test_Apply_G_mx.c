@@ -0,0 +1,180 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#define N_SHAPES 4
+
+char* shape_names[ N_SHAPES ] = { "mx2", "mx3", "mx3b", "mx4s" };
+char* simd_names[ 3 ]         = { "scalar", "avx2", "avx512" };
+
+// The number of columns touched and flops performed per row by each shape.
+int   shape_cols[ N_SHAPES ]  = { 2, 3, 3, 4 };
+int   shape_flops[ N_SHAPES ] = { 6, 12, 12, 24 };
+
+void apply_shape( FLA_Datatype datatype, int shape, int m, void* gs, void* buff, int ld );
+
+void time_Apply_G_mx( FLA_Datatype datatype, int shape, int simd_type,
+                      int n_repeats, int m, int n_apply,
+                      void* gs, void* buff, void* buff_ref, int ld,
+                      double* dtime, double* diff, double* gflops );
+
+
+int main(int argc, char *argv[])
+{
+  int 
+    m, p_first, p_last, p_inc, p,
+    n_repeats, n_apply,
+    simd_max, simd_type,
+    shape, i, dt;
+
+  FLA_Datatype datatype;
+
+  double
+    dtime,
+    gflops,
+    diff;
+
+  double  gs_d[ 8 ];
+  float   gs_s[ 8 ];
+  void*   buff;
+  void*   buff_ref;
+  
+
+  FLA_Init();
+
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c enter problem size first, last, inc:", '%' );
+  scanf( "%d%d%d", &p_first, &p_last, &p_inc );
+  fprintf( stdout, "%c %d %d %d\n", '%', p_first, p_last, p_inc );
+
+
+  // Find the widest instruction set that the processor supports.
+  simd_max = FLA_Apply_G_mx_simd_type();
+
+  fprintf( stdout, "%c widest kernels available: %s\n", '%', simd_names[ simd_max ] );
+  fprintf( stdout, "\n" );
+
+  // Each pair of gamma and sigma forms a proper rotation, so repeated
+  // application leaves the columns bounded.
+  for ( i = 0; i < 4; ++i )
+  {
+    gs_d[ 2*i + 0 ] = cos( 0.3 + 0.2 * i );
+    gs_d[ 2*i + 1 ] = sin( 0.3 + 0.2 * i );
+    gs_s[ 2*i + 0 ] = ( float ) gs_d[ 2*i + 0 ];
+    gs_s[ 2*i + 1 ] = ( float ) gs_d[ 2*i + 1 ];
+  }
+
+  buff     = FLA_malloc( 4 * p_last * sizeof( double ) );
+  buff_ref = FLA_malloc( 4 * p_last * sizeof( double ) );
+
+  for ( p = p_first, i = 1; p <= p_last; p += p_inc, i += 1 )
+  {
+    m = p;
+
+    // Apply each kernel often enough that one timing covers roughly 10^7
+    // flops, since a single application is far below the clock resolution.
+    n_apply = max( 1, 10000000 / ( 6 * m ) );
+
+    for ( dt = 0; dt < 2; ++dt )
+    {
+      datatype = ( dt == 0 ? FLA_FLOAT : FLA_DOUBLE );
+
+      for ( shape = 0; shape < N_SHAPES; ++shape )
+      {
+        for ( simd_type = FLA_APPLY_G_SIMD_NONE; simd_type <= simd_max; ++simd_type )
+        {
+          fprintf( stdout, "data_%s_%s_%c( %d, 1:3 ) = [ %d ",
+                   shape_names[ shape ], simd_names[ simd_type ],
+                   ( dt == 0 ? 's' : 'd' ), i, p );
+          fflush( stdout );
+
+          time_Apply_G_mx( datatype, shape, simd_type, n_repeats, m, n_apply,
+                           ( dt == 0 ? ( void* ) gs_s : ( void* ) gs_d ),
+                           buff, buff_ref, p_last,
+                           &dtime, &diff, &gflops );
+
+          fprintf( stdout, "%6.3lf %6.2le ];\n", gflops, diff );
+          fflush( stdout );
+        }
+      }
+    }
+
+    fprintf( stdout, "\n" );
+  }
+
+  FLA_free( buff );
+  FLA_free( buff_ref );
+
+  // Leave the kernels at their default for any later callers.
+  FLA_Apply_G_mx_set_simd_type( simd_max );
+
+  FLA_Finalize();
+
+  return 0;
+}
+
+
+void fill_columns( FLA_Datatype datatype, int m, int n, void* buff, int ld )
+{
+  int i, j;
+
+  for ( j = 0; j < n; ++j )
+    for ( i = 0; i < m; ++i )
+    {
+      double v = ( double ) ( ( 37 * i + 11 * j ) % 101 ) / 101.0 - 0.5;
+
+      if ( datatype == FLA_FLOAT ) ( ( float*  ) buff )[ i + j * ld ] = ( float ) v;
+      else                         ( ( double* ) buff )[ i + j * ld ] = v;
+    }
+}
+
+
+void apply_shape( FLA_Datatype datatype, int shape, int m, void* gs, void* buff, int ld )
+{
+  if ( datatype == FLA_FLOAT )
+  {
+    float* g  = ( float* ) gs;
+    float* a1 = ( float* ) buff;
+    float* a2 = a1 + ld;
+    float* a3 = a2 + ld;
+    float* a4 = a3 + ld;
+
+    switch ( shape )
+    {
+      case 0: FLA_Apply_G_mx2_simd_ops( m, g+0, g+1, a1, a2 ); break;
+      case 1: FLA_Apply_G_mx3_simd_ops( m, g+0, g+1, g+2, g+3, a1, a2, a3 ); break;
+      case 2: FLA_Apply_G_mx3b_simd_ops( m, g+0, g+1, g+2, g+3, a1, a2, a3 ); break;
+      case 3: FLA_Apply_G_mx4s_simd_ops( m, g+0, g+1, g+2, g+3, g+4, g+5, g+6, g+7,
+                                         a1, a2, a3, a4 ); break;
+    }
+  }
+  else
+  {
+    double* g  = ( double* ) gs;
+    double* a1 = ( double* ) buff;
+    double* a2 = a1 + ld;
+    double* a3 = a2 + ld;
+    double* a4 = a3 + ld;
+
+    switch ( shape )
+    {
+      case 0: FLA_Apply_G_mx2_simd_opd( m, g+0, g+1, a1, a2 ); break;
+      case 1: FLA_Apply_G_mx3_simd_opd( m, g+0, g+1, g+2, g+3, a1, a2, a3 ); break;
+      case 2: FLA_Apply_G_mx3b_simd_opd( m, g+0, g+1, g+2, g+3, a1, a2, a3 ); break;
+      case 3: FLA_Apply_G_mx4s_simd_opd( m, g+0, g+1, g+2, g+3, g+4, g+5, g+6, g+7,
+                                         a1, a2, a3, a4 ); break;
+    }
+  }
+}
@@ -0,0 +1,70 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+extern int shape_cols[];
+extern int shape_flops[];
+
+void fill_columns( FLA_Datatype datatype, int m, int n, void* buff, int ld );
+void apply_shape( FLA_Datatype datatype, int shape, int m, void* gs, void* buff, int ld );
+
+
+void time_Apply_G_mx( FLA_Datatype datatype, int shape, int simd_type,
+                      int n_repeats, int m, int n_apply,
+                      void* gs, void* buff, void* buff_ref, int ld,
+                      double* dtime, double* diff, double* gflops )
+{
+  int
+    irep, k, i,
+    n = shape_cols[ shape ];
+
+  double
+    dtime_old = 1.0e9;
+
+  // Compute the reference result with the scalar kernels.
+  fill_columns( datatype, m, n, buff_ref, ld );
+  FLA_Apply_G_mx_set_simd_type( FLA_APPLY_G_SIMD_NONE );
+  apply_shape( datatype, shape, m, gs, buff_ref, ld );
+
+  FLA_Apply_G_mx_set_simd_type( simd_type );
+
+  for ( irep = 0 ; irep < n_repeats; irep++ )
+  {
+    fill_columns( datatype, m, n, buff, ld );
+
+    *dtime = FLA_Clock();
+
+    for ( k = 0; k < n_apply; ++k )
+      apply_shape( datatype, shape, m, gs, buff, ld );
+
+    *dtime = FLA_Clock() - *dtime;
+    dtime_old = min( *dtime, dtime_old );
+  }
+
+  // Check a single application against the reference.
+  fill_columns( datatype, m, n, buff, ld );
+  apply_shape( datatype, shape, m, gs, buff, ld );
+
+  *diff = 0.0;
+  for ( k = 0; k < n; ++k )
+    for ( i = 0; i < m; ++i )
+    {
+      double d;
+
+      if ( datatype == FLA_FLOAT ) d = ( ( float*  ) buff )[ i + k * ld ] - ( ( float*  ) buff_ref )[ i + k * ld ];
+      else                         d = ( ( double* ) buff )[ i + k * ld ] - ( ( double* ) buff_ref )[ i + k * ld ];
+
+      *diff = max( *diff, fabs( d ) );
+    }
+
+  *dtime  = dtime_old;
+  *gflops = ( double ) shape_flops[ shape ] * m * n_apply / dtime_old / 1e9;
+}
@@ -0,0 +1,75 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// Search for the k_accum and b_alg that apply waves of rotations fastest
+// on this machine, for every datatype, and save them to the tuning file
+// that FLA_Init() loads.
+
+int main(int argc, char *argv[])
+{
+  int 
+    m, n_repeats, dt;
+
+  dim_t
+    k_accum, b_alg;
+
+  double
+    dtime;
+
+  char
+    file_name[1024];
+
+  FLA_Datatype datatype[4] = { FLA_FLOAT, FLA_DOUBLE, FLA_COMPLEX, FLA_DOUBLE_COMPLEX };
+  char         dt_char[4]  = { 's', 'd', 'c', 'z' };
+  
+
+  FLA_Init();
+
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c enter problem size:", '%' );
+  scanf( "%d", &m );
+  fprintf( stdout, "%c %d\n", '%', m );
+
+  fprintf( stdout, "%c enter tuning file (- for the default):", '%' );
+  scanf( "%1023s", file_name );
+  if ( strcmp( file_name, "-" ) == 0 && FLA_Tune_default_file() != NULL )
+    strcpy( file_name, FLA_Tune_default_file() );
+  fprintf( stdout, "%c %s\n", '%', file_name );
+
+
+  fprintf( stdout, "\n" );
+
+
+  for ( dt = 0; dt < 4; ++dt )
+  {
+    dtime = FLA_Clock();
+
+    FLA_Apply_G_tune( datatype[dt], m, n_repeats, &k_accum, &b_alg );
+
+    dtime = FLA_Clock() - dtime;
+
+    fprintf( stdout, "data_%c = [ %d %4d %5d ]; %% %6.2lf s\n",
+             dt_char[dt], m, ( int ) k_accum, ( int ) b_alg, dtime );
+    fflush( stdout );
+  }
+
+  if ( FLA_Tune_save( file_name ) != FLA_SUCCESS )
+    fprintf( stdout, "%c could not write %s\n", '%', file_name );
+
+  FLA_Finalize();
+
+  return 0;
+}
@@ -1002,3 +1002,26 @@ FLA_Error FLA_Apply_G_rf_blz_var9b( int       k_G,
                                    int       b_alg );
 
 
+// Parallel driver
+
+#define FLA_APPLY_G_RF_VAR3            3
+#define FLA_APPLY_G_RF_VAR6            6
+#define FLA_APPLY_G_RF_VAR9            9
+#define FLA_APPLY_G_RF_VAR3B          13
+#define FLA_APPLY_G_RF_VAR6B          16
+#define FLA_APPLY_G_RF_VAR9B          19
+
+// The fewest rows of A given to each thread by FLA_Apply_G_rf_blp().
+#define FLA_APPLY_G_RF_BLP_MIN_ROWS  128
+
+int       FLA_Apply_G_rf_blp_n_threads( int m_A );
+FLA_Error FLA_Apply_G_rf_blp( FLA_Datatype datatype,
+                              int          variant,
+                              int          k_G,
+                              int          m_A,
+                              int          n_A,
+                              int          i_k,
+                              void*        buff_G, int rs_G, int cs_G,
+                              void*        buff_A, int rs_A, int cs_A,
+                              int          b_alg );
+
@@ -106,6 +106,18 @@ FLA_Error FLA_Apply_G_rf_bls_var6( int       k_G,
 	int i;
 	int b = 0;
 
+	// Split the rows of A among threads when there are enough of them.
+	if ( FLA_Apply_G_rf_blp_n_threads( m_A ) > 1 )
+		return FLA_Apply_G_rf_blp( FLA_FLOAT,
+		                           FLA_APPLY_G_RF_VAR6,
+		                           k_G,
+		                           m_A,
+		                           n_A,
+		                           0,
+		                           buff_G, rs_G, cs_G,
+		                           buff_A, rs_A, cs_A,
+		                           b_alg );
+
 	for ( i = 0; i < m_A; i += b )
 	{
 		float*    A1      = buff_A + (0  )*cs_A + (i  )*rs_A;
@@ -134,6 +146,18 @@ FLA_Error FLA_Apply_G_rf_bld_var6( int       k_G,
 	int i;
 	int b = 0;
 
+	// Split the rows of A among threads when there are enough of them.
+	if ( FLA_Apply_G_rf_blp_n_threads( m_A ) > 1 )
+		return FLA_Apply_G_rf_blp( FLA_DOUBLE,
+		                           FLA_APPLY_G_RF_VAR6,
+		                           k_G,
+		                           m_A,
+		                           n_A,
+		                           0,
+		                           buff_G, rs_G, cs_G,
+		                           buff_A, rs_A, cs_A,
+		                           b_alg );
+
 	for ( i = 0; i < m_A; i += b )
 	{
 		double*   A1      = buff_A + (0  )*cs_A + (i  )*rs_A;
@@ -162,6 +186,18 @@ FLA_Error FLA_Apply_G_rf_blc_var6( int       k_G,
 	int i;
 	int b = 0;
 
+	// Split the rows of A among threads when there are enough of them.
+	if ( FLA_Apply_G_rf_blp_n_threads( m_A ) > 1 )
+		return FLA_Apply_G_rf_blp( FLA_COMPLEX,
+		                           FLA_APPLY_G_RF_VAR6,
+		                           k_G,
+		                           m_A,
+		                           n_A,
+		                           0,
+		                           buff_G, rs_G, cs_G,
+		                           buff_A, rs_A, cs_A,
+		                           b_alg );
+
 	for ( i = 0; i < m_A; i += b )
 	{
 		scomplex* A1      = buff_A + (0  )*cs_A + (i  )*rs_A;
@@ -190,6 +226,18 @@ FLA_Error FLA_Apply_G_rf_blz_var6( int       k_G,
 	int i;
 	int b = 0;
 
+	// Split the rows of A among threads when there are enough of them.
+	if ( FLA_Apply_G_rf_blp_n_threads( m_A ) > 1 )
+		return FLA_Apply_G_rf_blp( FLA_DOUBLE_COMPLEX,
+		                           FLA_APPLY_G_RF_VAR6,
+		                           k_G,
+		                           m_A,
+		                           n_A,
+		                           0,
+		                           buff_G, rs_G, cs_G,
+		                           buff_A, rs_A, cs_A,
+		                           b_alg );
+
 	for ( i = 0; i < m_A; i += b )
 	{
 		dcomplex* A1      = buff_A + (0  )*cs_A + (i  )*rs_A;
@@ -111,6 +111,18 @@ FLA_Error FLA_Apply_G_rf_bls_var6b( int       k_G,
 	int i;
 	int b = 0;
 
+	// Split the rows of A among threads when there are enough of them.
+	if ( FLA_Apply_G_rf_blp_n_threads( m_A ) > 1 )
+		return FLA_Apply_G_rf_blp( FLA_FLOAT,
+		                           FLA_APPLY_G_RF_VAR6B,
+		                           k_G,
+		                           m_A,
+		                           n_A,
+		                           i_k,
+		                           buff_G, rs_G, cs_G,
+		                           buff_A, rs_A, cs_A,
+		                           b_alg );
+
 	for ( i = 0; i < m_A; i += b )
 	{
 		float*    A1       = buff_A + (0  )*cs_A + (i  )*rs_A;
@@ -143,6 +155,18 @@ FLA_Error FLA_Apply_G_rf_bld_var6b( int       k_G,
 	int i;
 	int b = 0;
 
+	// Split the rows of A among threads when there are enough of them.
+	if ( FLA_Apply_G_rf_blp_n_threads( m_A ) > 1 )
+		return FLA_Apply_G_rf_blp( FLA_DOUBLE,
+		                           FLA_APPLY_G_RF_VAR6B,
+		                           k_G,
+		                           m_A,
+		                           n_A,
+		                           i_k,
+		                           buff_G, rs_G, cs_G,
+		                           buff_A, rs_A, cs_A,
+		                           b_alg );
+
 	for ( i = 0; i < m_A; i += b )
 	{
 		double*   A1       = buff_A + (0  )*cs_A + (i  )*rs_A;
@@ -0,0 +1,313 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// The rotations of a wave act on the columns of A, so each row of A may be
+// updated independently of the others. The rows are split into panels that
+// are dealt out to the threads in turn; the panels are smaller than b_alg
+// when needed to give every thread several of them, since the "b" variants
+// skip the rows below the leading part of A that the rotations reach early
+// on, which leaves the top panels with more work than the bottom ones.
+
+typedef struct FLA_Apply_G_rf_blp_vars_s
+{
+	FLA_Datatype datatype;
+	int          variant;
+	int          k_G;
+	int          m_A;
+	int          n_A;
+	int          i_k;
+	void*        buff_G;
+	int          rs_G;
+	int          cs_G;
+	void*        buff_A;
+	int          rs_A;
+	int          cs_A;
+	int          b_alg;
+} FLA_Apply_G_rf_blp_vars;
+
+static void* FLA_Apply_G_rf_blp_thread( void* arg );
+
+int FLA_Apply_G_rf_blp_n_threads( int m_A )
+{
+	int n_threads = 1;
+
+#ifdef FLA_ENABLE_MULTITHREADING
+	// Use the threads that SuperMatrix is set to use, but give each of them
+	// enough rows to amortize the cost of waking it.
+	n_threads = FLASH_Queue_get_num_threads();
+	n_threads = max( 1, min( n_threads, m_A / FLA_APPLY_G_RF_BLP_MIN_ROWS ) );
+#endif
+
+	return n_threads;
+}
+
+FLA_Error FLA_Apply_G_rf_blp( FLA_Datatype datatype,
+                              int          variant,
+                              int          k_G,
+                              int          m_A,
+                              int          n_A,
+                              int          i_k,
+                              void*        buff_G, int rs_G, int cs_G,
+                              void*        buff_A, int rs_A, int cs_A,
+                              int          b_alg )
+{
+	FLA_Apply_G_rf_blp_vars args;
+	int                     n_threads;
+	int                     b_thr;
+
+	n_threads = FLA_Apply_G_rf_blp_n_threads( m_A );
+
+	// Aim for at least four panels per thread, with the panel length a
+	// multiple of the vector length of the Givens kernels.
+	b_thr = b_alg;
+	if ( n_threads > 1 )
+	{
+		b_thr = ( m_A + 4 * n_threads - 1 ) / ( 4 * n_threads );
+		b_thr = ( ( b_thr + 15 ) / 16 ) * 16;
+		b_thr = max( 1, min( b_alg, b_thr ) );
+	}
+
+	args.datatype  = datatype;
+	args.variant   = variant;
+	args.k_G       = k_G;
+	args.m_A       = m_A;
+	args.n_A       = n_A;
+	args.i_k       = i_k;
+	args.buff_G    = buff_G;
+	args.rs_G      = rs_G;
+	args.cs_G      = cs_G;
+	args.buff_A    = buff_A;
+	args.rs_A      = rs_A;
+	args.cs_A      = cs_A;
+	args.b_alg     = b_thr;
+
+	// The threads may number fewer than requested when they are busy with
+	// another job, in which case the panels are dealt out to those that run.
+	FLA_Thread_run( n_threads, FLA_Apply_G_rf_blp_thread, ( void* ) &args );
+
+	return FLA_SUCCESS;
+}
+
+
+static void* FLA_Apply_G_rf_blp_thread( void* arg )
+{
+	FLASH_Thread*            me   = ( FLASH_Thread* ) arg;
+	FLA_Apply_G_rf_blp_vars* args = ( FLA_Apply_G_rf_blp_vars* ) me->args;
+	int                      k_G  = args->k_G;
+	int                      m_A  = args->m_A;
+	int                      n_A  = args->n_A;
+	int                      i_k  = args->i_k;
+	int                      rs_G = args->rs_G;
+	int                      cs_G = args->cs_G;
+	int                      rs_A = args->rs_A;
+	int                      cs_A = args->cs_A;
+	int                      i, b;
+
+	// Each thread takes every n_threads-th panel, starting with its own id.
+	for ( i = me->id * args->b_alg; i < m_A; i += me->n_threads * args->b_alg )
+	{
+		int m_behind = i;
+
+		b = min( args->b_alg, m_A - i );
+
+		switch ( args->datatype )
+		{
+			case FLA_FLOAT:
+			{
+				scomplex* buff_G = ( scomplex* ) args->buff_G;
+				float*    A1     = ( float* ) args->buff_A + i*rs_A;
+
+				switch ( args->variant )
+				{
+					case FLA_APPLY_G_RF_VAR3:
+						FLA_Apply_G_rf_ops_var3( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR3B:
+						FLA_Apply_G_rf_ass_var3b( k_G,
+						                          b,
+						                          n_A,
+						                          i_k,
+						                          m_behind,
+						                          buff_G, rs_G, cs_G,
+						                          A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR6:
+						FLA_Apply_G_rf_ass_var6( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR6B:
+						FLA_Apply_G_rf_ass_var6b( k_G,
+						                          b,
+						                          n_A,
+						                          i_k,
+						                          m_behind,
+						                          buff_G, rs_G, cs_G,
+						                          A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR9:
+						FLA_Apply_G_rf_ass_var9( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR9B:
+						FLA_Apply_G_rf_ass_var9b( k_G,
+						                          b,
+						                          n_A,
+						                          i_k,
+						                          m_behind,
+						                          buff_G, rs_G, cs_G,
+						                          A1,     rs_A, cs_A );
+						break;
+				}
+
+				break;
+			}
+
+			case FLA_DOUBLE:
+			{
+				dcomplex* buff_G = ( dcomplex* ) args->buff_G;
+				double*   A1     = ( double* ) args->buff_A + i*rs_A;
+
+				switch ( args->variant )
+				{
+					case FLA_APPLY_G_RF_VAR3:
+						FLA_Apply_G_rf_opd_var3( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR3B:
+						FLA_Apply_G_rf_asd_var3b( k_G,
+						                          b,
+						                          n_A,
+						                          i_k,
+						                          m_behind,
+						                          buff_G, rs_G, cs_G,
+						                          A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR6:
+						FLA_Apply_G_rf_asd_var6( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR6B:
+						FLA_Apply_G_rf_asd_var6b( k_G,
+						                          b,
+						                          n_A,
+						                          i_k,
+						                          m_behind,
+						                          buff_G, rs_G, cs_G,
+						                          A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR9:
+						FLA_Apply_G_rf_asd_var9( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR9B:
+						FLA_Apply_G_rf_asd_var9b( k_G,
+						                          b,
+						                          n_A,
+						                          i_k,
+						                          m_behind,
+						                          buff_G, rs_G, cs_G,
+						                          A1,     rs_A, cs_A );
+						break;
+				}
+
+				break;
+			}
+
+			case FLA_COMPLEX:
+			{
+				scomplex* buff_G = ( scomplex* ) args->buff_G;
+				scomplex* A1     = ( scomplex* ) args->buff_A + i*rs_A;
+
+				switch ( args->variant )
+				{
+					case FLA_APPLY_G_RF_VAR3:
+						FLA_Apply_G_rf_opc_var3( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR6:
+						FLA_Apply_G_rf_asc_var6( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR9:
+						FLA_Apply_G_rf_asc_var9( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+				}
+
+				break;
+			}
+
+			case FLA_DOUBLE_COMPLEX:
+			{
+				dcomplex* buff_G = ( dcomplex* ) args->buff_G;
+				dcomplex* A1     = ( dcomplex* ) args->buff_A + i*rs_A;
+
+				switch ( args->variant )
+				{
+					case FLA_APPLY_G_RF_VAR3:
+						FLA_Apply_G_rf_opz_var3( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR6:
+						FLA_Apply_G_rf_asz_var6( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+					case FLA_APPLY_G_RF_VAR9:
+						FLA_Apply_G_rf_asz_var9( k_G,
+						                         b,
+						                         n_A,
+						                         buff_G, rs_G, cs_G,
+						                         A1,     rs_A, cs_A );
+						break;
+				}
+
+				break;
+			}
+		}
+	}
+
+	return ( void* ) NULL;
+}
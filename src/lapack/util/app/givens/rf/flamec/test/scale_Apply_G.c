@@ -0,0 +1,164 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// Report how the blocked application of a wave of rotations (variant 3b,
+// as used by FLA_Tevd_v and FLA_Bsvd_v) scales as the rows of A are split
+// among more threads.
+
+int main(int argc, char *argv[])
+{
+  int 
+    m_input, k_input, n_input,
+    m, k, n,
+    p_first, p_last, p_inc,
+    p,
+    b_alg,
+    n_threads_max, n_threads,
+    n_repeats,
+    irep,
+    i;
+
+  FLA_Datatype datatype = FLA_DOUBLE;
+
+  double
+    dtime, dtime_one,
+    gflops,
+    diff;
+
+  FLA_Obj
+    A, A_save, A_ref, G, norm;
+  
+
+  FLA_Init();
+
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c Enter blocking size:", '%' );
+  scanf( "%d", &b_alg );
+  fprintf( stdout, "%c %d\n", '%', b_alg );
+
+  fprintf( stdout, "%c enter problem size first, last, inc:", '%' );
+  scanf( "%d%d%d", &p_first, &p_last, &p_inc );
+  fprintf( stdout, "%c %d %d %d\n", '%', p_first, p_last, p_inc );
+
+  fprintf( stdout, "%c enter m n k (-1 means bind to problem size): ", '%' );
+  scanf( "%d %d %d", &m_input, &n_input, &k_input );
+  fprintf( stdout, "%c %d %d %d\n", '%', m_input, n_input, k_input );
+
+  fprintf( stdout, "%c enter the largest number of threads: ", '%' );
+  scanf( "%d", &n_threads_max );
+  fprintf( stdout, "%c %d\n", '%', n_threads_max );
+
+
+  fprintf( stdout, "\n" );
+
+
+  for ( p = p_first, i = 1; p <= p_last; p += p_inc, i += 1 )
+  {
+    m = m_input;
+    k = k_input;
+    n = n_input;
+
+    if( m < 0 ) m = p / f2c_abs(m_input);
+    if( k < 0 ) k = p / f2c_abs(k_input);
+    if( n < 0 ) n = p / f2c_abs(n_input);
+
+    FLA_Obj_create( datatype, m, n, 0, 0, &A );
+    FLA_Obj_create( datatype, m, n, 0, 0, &A_save );
+    FLA_Obj_create( datatype, m, n, 0, 0, &A_ref );
+    FLA_Obj_create( FLA_DOUBLE_COMPLEX, n-1, k, 0, 0, &G );
+    FLA_Obj_create( datatype, 1, 1, 0, 0, &norm );
+
+    FLA_Random_unitary_matrix( A_save );
+    FLA_Random_matrix( G );
+
+    // Turn each entry of G into a proper rotation.
+    {
+      dcomplex* buff_G = FLA_Obj_buffer_at_view( G );
+      int       j;
+
+      for ( j = 0; j < ( n - 1 ) * k; ++j )
+      {
+        double theta = 3.0 * buff_G[j].real;
+
+        buff_G[j].real = cos( theta );
+        buff_G[j].imag = sin( theta );
+      }
+    }
+
+    dtime_one = 0.0;
+
+    for ( n_threads = 1; n_threads <= n_threads_max; n_threads *= 2 )
+    {
+      FLASH_Queue_set_num_threads( n_threads );
+
+      dtime = 1.0e9;
+
+      for ( irep = 0 ; irep < n_repeats; irep++ )
+      {
+        double dtime_rep;
+
+        FLA_Copy_external( A_save, A );
+
+        dtime_rep = FLA_Clock();
+
+        // Pass i_k = m so that every row of A is updated, as in the later
+        // sweeps of the eigensolvers.
+        FLA_Apply_G_rf_bld_var3b( k,
+                                  m,
+                                  n,
+                                  m,
+                                  FLA_Obj_buffer_at_view( G ), 1, n - 1,
+                                  FLA_Obj_buffer_at_view( A ), 1, m,
+                                  b_alg );
+
+        dtime_rep = FLA_Clock() - dtime_rep;
+        dtime     = min( dtime, dtime_rep );
+      }
+
+      // Compare with the result of a single thread.
+      if ( n_threads == 1 )
+      {
+        FLA_Copy_external( A, A_ref );
+        dtime_one = dtime;
+      }
+
+      FLA_Axpy_external( FLA_MINUS_ONE, A, A_ref );
+      FLA_Norm_frob( A_ref, norm );
+      FLA_Obj_extract_real_scalar( norm, &diff );
+      FLA_Axpy_external( FLA_ONE, A, A_ref );
+
+      gflops = 6.0 * m * ( n - 1 ) * k / dtime / 1.0e9;
+
+      fprintf( stdout, "data_nt%d( %d, 1:5 ) = [ %d %8.4lf %6.2lf %5.2lf %6.2le ];\n",
+               n_threads, i, p, dtime, gflops, dtime_one / dtime, diff );
+      fflush( stdout );
+    }
+
+    fprintf( stdout, "\n" );
+
+    FLA_Obj_free( &A );
+    FLA_Obj_free( &A_save );
+    FLA_Obj_free( &A_ref );
+    FLA_Obj_free( &G );
+    FLA_Obj_free( &norm );
+  }
+
+  FLASH_Queue_set_num_threads( 1 );
+
+  FLA_Finalize();
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+#include "FLA_lapack2flame_return_defs.h"
+#include "FLA_f2c.h"
+
+int dgbtrf_check(int *m, int *n, int *kl, int *ku, double *ab, int *ldab, int *ipiv, int *info)
+{
+    /* System generated locals */
+    int ab_dim1, ab_offset, i__1;
+
+    /* Parameter adjustments */
+    ab_dim1 = *ldab;
+    ab_offset = 1 + ab_dim1;
+    ab -= ab_offset;
+    --ipiv;
+    /* Function Body */
+    *info = 0;
+    if (*m < 0)
+    {
+        *info = -1;
+    }
+    else if (*n < 0)
+    {
+        *info = -2;
+    }
+    else if (*kl < 0)
+    {
+        *info = -3;
+    }
+    else if (*ku < 0)
+    {
+        *info = -4;
+    }
+    else if (*ldab < *kl + *kl + *ku + 1)
+    {
+        *info = -6;
+    }
+    if (*info != 0)
+    {
+        i__1 = -(*info);
+        xerbla_("DGBTRF", &i__1);
+        return LAPACK_FAILURE;
+    }
+    /* Quick return if possible */
+    if (*m == 0 || *n == 0)
+    {
+        return LAPACK_QUICK_RETURN;
+    }
+    return LAPACK_SUCCESS;
+}
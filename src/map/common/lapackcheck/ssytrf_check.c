@@ -0,0 +1,66 @@
+#include "FLA_lapack2flame_return_defs.h"
+#include "FLA_f2c.h" 
+static int c__1 = 1;
+static int c_n1 = -1;
+
+int ssytrf_check(char *uplo, int *n, float *a, int * lda, int *ipiv, float *work, int *lwork, int *info)
+{
+    /* System generated locals */
+    int a_dim1, a_offset, i__1;
+    /* Local variables */
+    int nb;
+    logical upper;
+    int lwkopt;
+    logical lquery;
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --ipiv;
+    --work;
+    /* Function Body */
+    *info = 0;
+    upper = lsame_(uplo, "U");
+    lquery = *lwork == -1;
+    if (! upper && ! lsame_(uplo, "L"))
+    {
+        *info = -1;
+    }
+    else if (*n < 0)
+    {
+        *info = -2;
+    }
+    else if (*lda < max(1,*n))
+    {
+        *info = -4;
+    }
+    else if (*lwork < 1 && ! lquery)
+    {
+        *info = -7;
+    }
+    if (*info == 0)
+    {
+        /* Determine the block size. */
+        nb = ilaenv_(&c__1, "SSYTRF", uplo, n, &c_n1, &c_n1, &c_n1);
+        lwkopt = *n * nb;
+        work[1] = (float) lwkopt;
+    }
+    if (*info != 0)
+    {
+        i__1 = -(*info);
+        xerbla_("SSYTRF", &i__1);
+        return LAPACK_FAILURE;
+    }
+    else if (lquery)
+    {
+        return LAPACK_QUERY_RETURN;
+    }
+    /* Quick return if possible */
+    if (*n == 0)
+    {
+        work[1] = 1.f;
+        return LAPACK_QUICK_RETURN;
+    }
+    return LAPACK_SUCCESS;
+}
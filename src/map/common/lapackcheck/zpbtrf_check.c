@@ -0,0 +1,44 @@
+#include "FLA_lapack2flame_return_defs.h"
+#include "FLA_f2c.h"
+
+int zpbtrf_check(char *uplo, int *n, int *kd, dcomplex *ab, int *ldab, int *info)
+{
+    /* System generated locals */
+    int ab_dim1, ab_offset, i__1;
+
+    /* Parameter adjustments */
+    ab_dim1 = *ldab;
+    ab_offset = 1 + ab_dim1;
+    ab -= ab_offset;
+    /* Function Body */
+    *info = 0;
+    if (! lsame_(uplo, "U") && ! lsame_(uplo, "L"))
+    {
+        *info = -1;
+    }
+    else if (*n < 0)
+    {
+        *info = -2;
+    }
+    else if (*kd < 0)
+    {
+        *info = -3;
+    }
+    else if (*ldab < *kd + 1)
+    {
+        *info = -5;
+    }
+    if (*info != 0)
+    {
+        i__1 = -(*info);
+        xerbla_("ZPBTRF", &i__1);
+        return LAPACK_FAILURE;
+    }
+    /* Quick return if possible */
+    if (*n == 0)
+    {
+        return LAPACK_QUICK_RETURN;
+    }
+
+    return LAPACK_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#ifdef FLA_ENABLE_LAPACK2FLAME
+
+#include "FLA_lapack2flame_util_defs.h"
+#include "FLA_lapack2flame_return_defs.h"
+#include "FLA_lapack2flame_prototypes.h"
+
+/*
+  PBTRF computes the Cholesky factorization of a symmetric (hermitian)
+  positive definite band matrix A.
+
+  INFO is INTEGER
+  = 0: successful exit
+  < 0: if INFO = -i, the i-th argument had an illegal value -  LAPACK_pbtrf_op_check
+  > 0: if INFO = i, the leading minor of order i is not - FLA_Chol_band
+  positive definite, and the factorization could not be
+  completed.
+*/
+
+#define LAPACK_pbtrf(prefix)                                    \
+  int F77_ ## prefix ## pbtrf( char* uplo,                      \
+                               int*  n,                         \
+                               int*  kd,                        \
+                               PREFIX2LAPACK_TYPEDEF(prefix)* buff_A, \
+                               int*  ldim_A,                    \
+                               int*  info )
+
+// The upper triangle is stored with its diagonal in row kd of the band
+// storage, and the lower triangle with its diagonal in row 0.
+#define LAPACK_pbtrf_body(prefix)                               \
+  FLA_Datatype datatype = PREFIX2FLAME_DATATYPE(prefix);        \
+  FLA_Uplo     uplo_fla;                                        \
+  FLA_Obj      A;                                               \
+  FLA_Error    e_val;                                           \
+  FLA_Error    init_result;                                     \
+                                                                \
+  FLA_Init_safe( &init_result );                                \
+  FLA_Param_map_netlib_to_flame_uplo( uplo, &uplo_fla );        \
+                                                                \
+  FLA_Obj_create_without_buffer( datatype, *n, *n, &A );        \
+  FLA_Obj_attach_band_buffer( buff_A,                           \
+                              ( uplo_fla == FLA_UPPER_TRIANGULAR ? *kd : 0 ), \
+                              *ldim_A, &A );                    \
+                                                                \
+  e_val = FLA_Chol_band( uplo_fla, *kd, A );                    \
+                                                                \
+  FLA_Obj_free_without_buffer( &A );                            \
+                                                                \
+  FLA_Finalize_safe( init_result );                             \
+                                                                \
+  if ( e_val != FLA_SUCCESS ) *info = e_val + 1;                \
+  else                        *info = 0;                        \
+                                                                \
+  return 0;
+
+LAPACK_pbtrf(s)
+{
+    {
+        LAPACK_RETURN_CHECK( spbtrf_check( uplo, n, kd,
+                                           buff_A, ldim_A,
+                                           info ) )
+    }
+    {
+        LAPACK_pbtrf_body(s)
+    }
+}
+LAPACK_pbtrf(d)
+{
+    {
+        LAPACK_RETURN_CHECK( dpbtrf_check( uplo, n, kd,
+                                           buff_A, ldim_A,
+                                           info ) )
+    }
+    {
+        LAPACK_pbtrf_body(d)
+    }
+}
+LAPACK_pbtrf(c)
+{
+    {
+        LAPACK_RETURN_CHECK( cpbtrf_check( uplo, n, kd,
+                                           buff_A, ldim_A,
+                                           info ) )
+    }
+    {
+        LAPACK_pbtrf_body(c)
+    }
+}
+LAPACK_pbtrf(z)
+{
+    {
+        LAPACK_RETURN_CHECK( zpbtrf_check( uplo, n, kd,
+                                           buff_A, ldim_A,
+                                           info ) )
+    }
+    {
+        LAPACK_pbtrf_body(z)
+    }
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+#ifdef FLA_ENABLE_LAPACK2FLAME
+
+#include "FLA_lapack2flame_util_defs.h"
+#include "FLA_lapack2flame_return_defs.h"
+#include "FLA_lapack2flame_prototypes.h"
+
+/*
+  SYTRF computes the factorization of a real symmetric matrix A using
+  the Bunch-Kaufman diagonal pivoting method. FLA_LDLT_piv() stores the
+  factors and the pivots as LAPACK does, so they may be passed to SYTRS,
+  and allocates its own workspace, so WORK is only used to return the
+  optimal LWORK.
+
+  INFO
+  = 0: successful exit
+  < 0: if INFO = -i, the i-th argument had an illegal value - LAPACK_sytrf_op_check
+  > 0: if INFO = i, D(i,i) is exactly zero. The factorization - FLA_LDLT_piv
+  has been completed, but the block diagonal matrix D is
+  exactly singular, and division by zero will occur if it
+  is used to solve a system of equations.
+*/
+
+#define LAPACK_sytrf(prefix)                                            \
+  int F77_ ## prefix ## sytrf( char* uplo,                              \
+                               int* n,                                  \
+                               PREFIX2LAPACK_TYPEDEF(prefix)* buff_A, int* ldim_A, \
+                               int* buff_p,                             \
+                               PREFIX2LAPACK_TYPEDEF(prefix)* buff_w, int* lwork, \
+                               int* info )
+
+#define LAPACK_sytrf_body(prefix)                               \
+  FLA_Datatype datatype = PREFIX2FLAME_DATATYPE(prefix);        \
+  FLA_Uplo     uplo_fla;                                        \
+  FLA_Obj      A, p;                                            \
+  FLA_Error    e_val;                                           \
+  FLA_Error    init_result;                                     \
+                                                                \
+  FLA_Init_safe( &init_result );                                \
+  FLA_Param_map_netlib_to_flame_uplo( uplo, &uplo_fla );        \
+                                                                \
+  FLA_Obj_create_without_buffer( datatype, *n, *n, &A );        \
+  FLA_Obj_attach_buffer( buff_A, 1, *ldim_A, &A );              \
+                                                                \
+  FLA_Obj_create_without_buffer( FLA_INT, *n, 1, &p );          \
+  FLA_Obj_attach_buffer( buff_p, 1, *n, &p );                   \
+                                                                \
+  e_val = FLA_LDLT_piv( uplo_fla, A, p );                       \
+                                                                \
+  FLA_Obj_free_without_buffer( &A );                            \
+  FLA_Obj_free_without_buffer( &p );                            \
+                                                                \
+  FLA_Finalize_safe( init_result );                             \
+                                                                \
+  if ( e_val != FLA_SUCCESS ) *info = e_val + 1;                \
+  else                        *info = 0;                        \
+                                                                \
+  return 0;
+
+LAPACK_sytrf(s)
+{
+    {
+        LAPACK_RETURN_CHECK( ssytrf_check( uplo, n,
+                                           buff_A, ldim_A,
+                                           buff_p,
+                                           buff_w, lwork,
+                                           info ) )
+    }
+    {
+        LAPACK_sytrf_body(s)
+    }
+}
+LAPACK_sytrf(d)
+{
+    {
+        LAPACK_RETURN_CHECK( dsytrf_check( uplo, n,
+                                           buff_A, ldim_A,
+                                           buff_p,
+                                           buff_w, lwork,
+                                           info ) )
+    }
+    {
+        LAPACK_sytrf_body(d)
+    }
+}
+
+#endif
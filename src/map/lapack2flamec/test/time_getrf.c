@@ -0,0 +1,98 @@
+/*
+
+    Copyright (C) 2014, The University of Texas at Austin
+
+    This file is part of libflame and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+
+*/
+
+#include "FLAME.h"
+
+// Time many calls of dgetrf through lapack2flame on small matrices, from a
+// program that never calls FLA_Init(), and compare the rate with calls of
+// the unblocked kernel that dgetrf reaches for such matrices, which bounds
+// what the mapping can achieve.
+
+int main(int argc, char *argv[])
+{
+  int
+    n_repeats, n_calls, n,
+    irep, i, j, info;
+
+  double
+    dtime,
+    dtime_getrf  = 1.0e9,
+    dtime_kernel = 1.0e9;
+
+  double*
+    buff_A_save;
+  double*
+    buff_A;
+  int*
+    buff_p;
+
+
+  fprintf( stdout, "%c number of repeats:", '%' );
+  scanf( "%d", &n_repeats );
+  fprintf( stdout, "%c %d\n", '%', n_repeats );
+
+  fprintf( stdout, "%c number of calls per repeat:", '%' );
+  scanf( "%d", &n_calls );
+  fprintf( stdout, "%c %d\n", '%', n_calls );
+
+  fprintf( stdout, "%c enter matrix size:", '%' );
+  scanf( "%d", &n );
+  fprintf( stdout, "%c %d\n", '%', n );
+
+  fprintf( stdout, "\n" );
+
+
+  buff_A_save = ( double* ) malloc( n * n * sizeof( double ) );
+  buff_A      = ( double* ) malloc( n * n * sizeof( double ) );
+  buff_p      = ( int*    ) malloc( n * sizeof( int ) );
+
+  for ( j = 0; j < n * n; ++j )
+    buff_A_save[j] = ( double ) rand() / RAND_MAX - 0.5;
+
+  // dgetrf first, so that its calls run before the library is initialized.
+  for ( irep = 0; irep < n_repeats; irep++ )
+  {
+    dtime = FLA_Clock();
+
+    for ( i = 0; i < n_calls; ++i )
+    {
+      memcpy( buff_A, buff_A_save, n * n * sizeof( double ) );
+      F77_dgetrf( &n, &n, buff_A, &n, buff_p, &info );
+    }
+
+    dtime = FLA_Clock() - dtime;
+    dtime_getrf = min( dtime, dtime_getrf );
+  }
+
+  for ( irep = 0; irep < n_repeats; irep++ )
+  {
+    dtime = FLA_Clock();
+
+    for ( i = 0; i < n_calls; ++i )
+    {
+      memcpy( buff_A, buff_A_save, n * n * sizeof( double ) );
+      FLA_LU_piv_opd_var5( n, n, buff_A, 1, n, buff_p, 1 );
+    }
+
+    dtime = FLA_Clock() - dtime;
+    dtime_kernel = min( dtime, dtime_kernel );
+  }
+
+  fprintf( stdout, "data_getrf( 1:4 ) = [ %d %10.3le %10.3le %6.2lf ];\n",
+           n, n_calls / dtime_getrf, n_calls / dtime_kernel,
+           dtime_getrf / dtime_kernel );
+
+  free( buff_A_save );
+  free( buff_A );
+  free( buff_p );
+
+  return 0;
+}
+